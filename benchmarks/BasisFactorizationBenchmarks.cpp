@@ -0,0 +1,329 @@
+/*********************                                                        */
+/*! \file BasisFactorizationBenchmarks.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** Benchmarks for the sparse basis factorizations: factorizing a fresh
+ ** basis, forward and backward transformations, and a sequence of basis
+ ** updates (which includes the periodic refactorizations).
+
+ **/
+
+#include "Benchmark.h"
+#include "DenseLUFactorization.h"
+#include "FloatUtils.h"
+#include "IBasisFactorization.h"
+#include "SparseColumnsOfBasis.h"
+#include "SparseFTFactorization.h"
+#include "SparseLUFactorization.h"
+#include "SparseUnsortedList.h"
+#include "Vector.h"
+
+#include <algorithm>
+#include <random>
+
+namespace {
+
+/*
+  A sparse, diagonally dominant (and hence non-singular) basis, in the
+  spirit of the bases that arise from the Marabou tableau: a few
+  off-diagonal entries per column. The columns can be replaced, to
+  follow a sequence of basis updates.
+*/
+class SyntheticBasisOracle : public IBasisFactorization::BasisColumnOracle
+{
+public:
+    static const unsigned ENTRIES_PER_COLUMN = 4;
+
+    SyntheticBasisOracle( unsigned m )
+        : _m( m )
+        , _random( 2024 )
+    {
+        for ( unsigned i = 0; i < _m; ++i )
+            _columns.append( new SparseUnsortedList( _m ) );
+
+        reset();
+    }
+
+    ~SyntheticBasisOracle()
+    {
+        for ( const auto &column : _columns )
+            delete column;
+    }
+
+    void reset()
+    {
+        _random.seed( 2024 );
+        for ( unsigned i = 0; i < _m; ++i )
+            generateColumn( i, *_columns[i] );
+    }
+
+    /*
+      A random column that keeps the basis non-singular when it
+      replaces column i
+    */
+    void generateColumn( unsigned i, SparseUnsortedList &column )
+    {
+        std::uniform_int_distribution<unsigned> row( 0, _m - 1 );
+        std::uniform_real_distribution<double> value( -1, 1 );
+
+        column.clear();
+        column.append( i, ENTRIES_PER_COLUMN + 1 );
+        for ( unsigned j = 0; j < ENTRIES_PER_COLUMN; ++j )
+        {
+            unsigned r = row( _random );
+            if ( r != i && FloatUtils::isZero( column.get( r ) ) )
+                column.append( r, value( _random ) );
+        }
+    }
+
+    void replaceColumn( unsigned i, const SparseUnsortedList &column )
+    {
+        *_columns[i] = column;
+    }
+
+    void getColumnOfBasis( unsigned column, double *result ) const
+    {
+        _columns[column]->toDense( result );
+    }
+
+    void getColumnOfBasis( unsigned column, SparseUnsortedList *result ) const
+    {
+        *result = *_columns[column];
+    }
+
+    void getSparseBasis( SparseColumnsOfBasis &basis ) const
+    {
+        for ( unsigned i = 0; i < _m; ++i )
+            basis._columns[i] = _columns[i];
+    }
+
+private:
+    unsigned _m;
+    Vector<SparseUnsortedList *> _columns;
+    std::mt19937 _random;
+};
+
+class BasisFactorizationBenchmark : public Benchmark
+{
+public:
+    enum Factorization {
+        SPARSE_LU,
+        SPARSE_FT,
+        DENSE_LU,
+    };
+
+    enum Operation {
+        FACTORIZE,
+        FORWARD_TRANSFORMATION,
+        BACKWARD_TRANSFORMATION,
+        UPDATE,
+    };
+
+    static const unsigned BASIS_SIZE = 500;
+    static const unsigned SMALL_BASIS_SIZE = 40;
+    static const unsigned NUMBER_OF_TRANSFORMATIONS = 200;
+    static const unsigned NUMBER_OF_UPDATES = 250;
+
+    BasisFactorizationBenchmark( Factorization factorization,
+                                 Operation operation,
+                                 unsigned basisSize )
+        : _factorization( factorization )
+        , _operation( operation )
+        , _basisSize( basisSize )
+        , _oracle( NULL )
+        , _basis( NULL )
+        , _y( NULL )
+        , _x( NULL )
+        , _random( 2024 )
+    {
+    }
+
+    ~BasisFactorizationBenchmark()
+    {
+        tearDown();
+    }
+
+    String getName() const
+    {
+        String name = "basis_factorization/";
+        if ( _basisSize == SMALL_BASIS_SIZE )
+            name += "small/";
+
+        if ( _factorization == SPARSE_LU )
+            name += "sparse_lu/";
+        else if ( _factorization == SPARSE_FT )
+            name += "sparse_ft/";
+        else
+            name += "dense_lu/";
+
+        switch ( _operation )
+        {
+        case FACTORIZE:
+            return name + "factorize";
+        case FORWARD_TRANSFORMATION:
+            return name + "ftran";
+        case BACKWARD_TRANSFORMATION:
+            return name + "btran";
+        case UPDATE:
+            return name + "update";
+        }
+
+        return name;
+    }
+
+    void setUp()
+    {
+        _oracle = new SyntheticBasisOracle( _basisSize );
+        if ( _factorization == SPARSE_LU )
+            _basis = new SparseLUFactorization( _basisSize, *_oracle );
+        else if ( _factorization == SPARSE_FT )
+            _basis = new SparseFTFactorization( _basisSize, *_oracle );
+        else
+            _basis = new DenseLUFactorization( _basisSize, *_oracle );
+
+        _y = new double[_basisSize];
+        _x = new double[_basisSize];
+    }
+
+    void prepare()
+    {
+        _oracle->reset();
+        _basis->obtainFreshBasis();
+        _random.seed( 2024 );
+    }
+
+    unsigned run()
+    {
+        switch ( _operation )
+        {
+        case FACTORIZE:
+            _basis->obtainFreshBasis();
+            return 1;
+
+        case FORWARD_TRANSFORMATION:
+        case BACKWARD_TRANSFORMATION:
+            for ( unsigned i = 0; i < NUMBER_OF_TRANSFORMATIONS; ++i )
+            {
+                generateRightHandSide();
+                if ( _operation == FORWARD_TRANSFORMATION )
+                    _basis->forwardTransformation( _y, _x );
+                else
+                    _basis->backwardTransformation( _y, _x );
+            }
+            return NUMBER_OF_TRANSFORMATIONS;
+
+        case UPDATE:
+            return runUpdates();
+        }
+
+        return 0;
+    }
+
+    void tearDown()
+    {
+        delete[] _x;
+        _x = NULL;
+        delete[] _y;
+        _y = NULL;
+        delete _basis;
+        _basis = NULL;
+        delete _oracle;
+        _oracle = NULL;
+    }
+
+private:
+    Factorization _factorization;
+    Operation _operation;
+    unsigned _basisSize;
+    SyntheticBasisOracle *_oracle;
+    IBasisFactorization *_basis;
+    double *_y;
+    double *_x;
+    std::mt19937 _random;
+
+    /*
+      A sparse right hand side, as is typical for the columns of the
+      constraint matrix
+    */
+    void generateRightHandSide()
+    {
+        std::uniform_int_distribution<unsigned> row( 0, _basisSize - 1 );
+        std::uniform_real_distribution<double> value( -1, 1 );
+
+        std::fill_n( _y, _basisSize, 0 );
+        for ( unsigned i = 0; i < SyntheticBasisOracle::ENTRIES_PER_COLUMN; ++i )
+            _y[row( _random )] = value( _random );
+    }
+
+    /*
+      Replace basis columns one by one, as the simplex does when
+      pivoting: the change column is computed by a forward
+      transformation of the entering column
+    */
+    unsigned runUpdates()
+    {
+        std::uniform_int_distribution<unsigned> leaving( 0, _basisSize - 1 );
+        SparseUnsortedList newColumn( _basisSize );
+
+        for ( unsigned i = 0; i < NUMBER_OF_UPDATES; ++i )
+        {
+            unsigned columnIndex = leaving( _random );
+            _oracle->generateColumn( columnIndex, newColumn );
+            newColumn.toDense( _y );
+
+            _basis->forwardTransformation( _y, _x );
+            _oracle->replaceColumn( columnIndex, newColumn );
+            _basis->updateToAdjacentBasis( columnIndex, _x, _y );
+        }
+
+        return NUMBER_OF_UPDATES;
+    }
+};
+
+} // namespace
+
+void registerBasisFactorizationBenchmarks( BenchmarkRunner &runner )
+{
+    BasisFactorizationBenchmark::Factorization factorizations[] = {
+        BasisFactorizationBenchmark::SPARSE_LU,
+        BasisFactorizationBenchmark::SPARSE_FT,
+    };
+
+    BasisFactorizationBenchmark::Operation operations[] = {
+        BasisFactorizationBenchmark::FACTORIZE,
+        BasisFactorizationBenchmark::FORWARD_TRANSFORMATION,
+        BasisFactorizationBenchmark::BACKWARD_TRANSFORMATION,
+        BasisFactorizationBenchmark::UPDATE,
+    };
+
+    for ( const auto &factorization : factorizations )
+        for ( const auto &operation : operations )
+            runner.addBenchmark( new BasisFactorizationBenchmark(
+                factorization, operation, BasisFactorizationBenchmark::BASIS_SIZE ) );
+
+    // Small bases, for which the dense factorization is selected by default
+    BasisFactorizationBenchmark::Factorization smallFactorizations[] = {
+        BasisFactorizationBenchmark::SPARSE_FT,
+        BasisFactorizationBenchmark::DENSE_LU,
+    };
+
+    for ( const auto &factorization : smallFactorizations )
+        for ( const auto &operation : operations )
+            runner.addBenchmark( new BasisFactorizationBenchmark(
+                factorization, operation, BasisFactorizationBenchmark::SMALL_BASIS_SIZE ) );
+}
+
+//
+// Local Variables:
+// compile-command: "make -C .. "
+// tags-file-name: "../TAGS"
+// c-basic-offset: 4
+// End:
+//
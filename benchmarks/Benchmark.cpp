@@ -0,0 +1,236 @@
+/*********************                                                        */
+/*! \file Benchmark.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "Benchmark.h"
+
+#include "Error.h"
+#include "File.h"
+#include "MStringf.h"
+#include "TimeUtils.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+
+#ifndef GIT_COMMIT_HASH
+#define GIT_COMMIT_HASH "unknown"
+#endif
+
+#ifndef GIT_BRANCH
+#define GIT_BRANCH "unknown"
+#endif
+
+BenchmarkRunner::BenchmarkRunner()
+    : _repetitions( 5 )
+{
+}
+
+BenchmarkRunner::~BenchmarkRunner()
+{
+    for ( const auto &benchmark : _benchmarks )
+        delete benchmark;
+}
+
+void BenchmarkRunner::addBenchmark( Benchmark *benchmark )
+{
+    _benchmarks.append( benchmark );
+}
+
+void BenchmarkRunner::setFilter( const String &filter )
+{
+    _filter = filter;
+}
+
+void BenchmarkRunner::setRepetitions( unsigned repetitions )
+{
+    _repetitions = repetitions;
+}
+
+bool BenchmarkRunner::selected( const Benchmark &benchmark ) const
+{
+    return _filter.length() == 0 || benchmark.getName().contains( _filter );
+}
+
+void BenchmarkRunner::listBenchmarks() const
+{
+    for ( const auto &benchmark : _benchmarks )
+    {
+        if ( selected( *benchmark ) )
+            printf( "%s\n", benchmark->getName().ascii() );
+    }
+}
+
+void BenchmarkRunner::runBenchmarks()
+{
+    _results.clear();
+
+    for ( const auto &benchmark : _benchmarks )
+    {
+        if ( !selected( *benchmark ) )
+            continue;
+
+        printf( "Running %s...\n", benchmark->getName().ascii() );
+        fflush( stdout );
+        _results.append( runBenchmark( *benchmark ) );
+    }
+}
+
+BenchmarkRunner::Result BenchmarkRunner::runBenchmark( Benchmark &benchmark ) const
+{
+    Result result;
+    result._name = benchmark.getName();
+    result._operations = 0;
+    result._failed = false;
+
+    try
+    {
+        benchmark.setUp();
+        for ( unsigned i = 0; i < _repetitions; ++i )
+        {
+            benchmark.prepare();
+
+            struct timespec start = TimeUtils::sampleMicro();
+            result._operations = benchmark.run();
+            struct timespec end = TimeUtils::sampleMicro();
+
+            result._timesMicro.append( TimeUtils::timePassed( start, end ) );
+        }
+        benchmark.tearDown();
+    }
+    catch ( const Error &e )
+    {
+        result._failed = true;
+        result._error = Stringf( "%s error %d: %s", e.getErrorClass(), e.getCode(), e.getUserMessage() );
+    }
+    catch ( const std::exception &e )
+    {
+        result._failed = true;
+        result._error = e.what();
+    }
+
+    return result;
+}
+
+unsigned long long BenchmarkRunner::minimum( const Vector<unsigned long long> &times )
+{
+    if ( times.empty() )
+        return 0;
+
+    return *std::min_element( times.begin(), times.end() );
+}
+
+unsigned long long BenchmarkRunner::median( const Vector<unsigned long long> &times )
+{
+    if ( times.empty() )
+        return 0;
+
+    Vector<unsigned long long> sorted = times;
+    std::sort( sorted.begin(), sorted.end() );
+    return sorted[sorted.size() / 2];
+}
+
+double BenchmarkRunner::mean( const Vector<unsigned long long> &times )
+{
+    if ( times.empty() )
+        return 0;
+
+    double sum = 0;
+    for ( const auto &time : times )
+        sum += time;
+
+    return sum / times.size();
+}
+
+void BenchmarkRunner::printResults() const
+{
+    printf( "\n%-50s %12s %12s %12s %10s\n", "Benchmark", "min (us)", "median (us)", "mean (us)", "ops" );
+    for ( const auto &result : _results )
+    {
+        if ( result._failed )
+        {
+            printf( "%-50s FAILED: %s\n", result._name.ascii(), result._error.ascii() );
+            continue;
+        }
+
+        printf( "%-50s %12llu %12llu %12.0lf %10u\n",
+                result._name.ascii(),
+                minimum( result._timesMicro ),
+                median( result._timesMicro ),
+                mean( result._timesMicro ),
+                result._operations );
+    }
+}
+
+void BenchmarkRunner::writeResults( const String &path ) const
+{
+    File file( path );
+    file.open( IFile::MODE_WRITE_TRUNCATE );
+
+    file.write( "{\n" );
+    file.write( Stringf( "  \"commit\": \"%s\",\n", GIT_COMMIT_HASH ) );
+    file.write( Stringf( "  \"branch\": \"%s\",\n", GIT_BRANCH ) );
+    file.write( Stringf( "  \"date\": \"%s\",\n", TimeUtils::now().ascii() ) );
+    file.write( Stringf( "  \"repetitions\": %u,\n", _repetitions ) );
+    file.write( "  \"benchmarks\": [" );
+
+    bool first = true;
+    for ( const auto &result : _results )
+    {
+        file.write( first ? "\n" : ",\n" );
+        first = false;
+
+        file.write( Stringf( "    {\"name\": \"%s\", ", result._name.ascii() ) );
+        if ( result._failed )
+        {
+            String error = result._error;
+            error.replaceAll( "\\", "\\\\" );
+            error.replaceAll( "\"", "\\\"" );
+            file.write( Stringf( "\"status\": \"failed\", \"error\": \"%s\"}", error.ascii() ) );
+            continue;
+        }
+
+        file.write( Stringf( "\"status\": \"ok\", \"operations\": %u, ", result._operations ) );
+        file.write( Stringf( "\"min_us\": %llu, \"median_us\": %llu, \"mean_us\": %.1lf, ",
+                             minimum( result._timesMicro ),
+                             median( result._timesMicro ),
+                             mean( result._timesMicro ) ) );
+
+        file.write( "\"times_us\": [" );
+        for ( unsigned i = 0; i < result._timesMicro.size(); ++i )
+            file.write( Stringf( i == 0 ? "%llu" : ", %llu", result._timesMicro[i] ) );
+        file.write( "]}" );
+    }
+
+    file.write( "\n  ]\n}\n" );
+}
+
+bool BenchmarkRunner::haveFailures() const
+{
+    for ( const auto &result : _results )
+    {
+        if ( result._failed )
+            return true;
+    }
+
+    return false;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C .. "
+// tags-file-name: "../TAGS"
+// c-basic-offset: 4
+// End:
+//
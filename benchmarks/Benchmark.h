@@ -0,0 +1,140 @@
+/*********************                                                        */
+/*! \file Benchmark.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** A benchmark is a fixed workload whose running time is tracked across
+ ** versions. Each benchmark is set up once, and then repeatedly prepared
+ ** and run; only the run itself is timed. The runner reports the timings
+ ** of all benchmarks as a JSON document, so that results of different
+ ** versions can be compared mechanically (see compare_results.py).
+
+ **/
+
+#ifndef __Benchmark_h__
+#define __Benchmark_h__
+
+#include "List.h"
+#include "MString.h"
+#include "Vector.h"
+
+class Benchmark
+{
+public:
+    virtual ~Benchmark()
+    {
+    }
+
+    /*
+      A unique name, of the form <module>/<workload>[/<variant>]
+    */
+    virtual String getName() const = 0;
+
+    /*
+      Build the data used by all repetitions. Not timed.
+    */
+    virtual void setUp()
+    {
+    }
+
+    /*
+      Bring the data to the state expected by run(), e.g. by undoing
+      the changes made by a previous repetition. Not timed.
+    */
+    virtual void prepare()
+    {
+    }
+
+    /*
+      The timed workload. Returns the number of basic operations
+      performed (e.g., pivots or layers processed), which is reported
+      alongside the timings.
+    */
+    virtual unsigned run() = 0;
+
+    /*
+      Release the data built by setUp()
+    */
+    virtual void tearDown()
+    {
+    }
+};
+
+class BenchmarkRunner
+{
+public:
+    struct Result
+    {
+        String _name;
+        Vector<unsigned long long> _timesMicro;
+        unsigned _operations;
+        bool _failed;
+        String _error;
+    };
+
+    BenchmarkRunner();
+    ~BenchmarkRunner();
+
+    /*
+      Take ownership of a benchmark
+    */
+    void addBenchmark( Benchmark *benchmark );
+
+    /*
+      Only run the benchmarks whose name contains the given string
+    */
+    void setFilter( const String &filter );
+    void setRepetitions( unsigned repetitions );
+
+    void listBenchmarks() const;
+    void runBenchmarks();
+
+    /*
+      Print a summary table, and write the results as JSON
+    */
+    void printResults() const;
+    void writeResults( const String &path ) const;
+
+    /*
+      True iff some benchmark threw an exception
+    */
+    bool haveFailures() const;
+
+private:
+    List<Benchmark *> _benchmarks;
+    List<Result> _results;
+    String _filter;
+    unsigned _repetitions;
+
+    bool selected( const Benchmark &benchmark ) const;
+    Result runBenchmark( Benchmark &benchmark ) const;
+
+    static unsigned long long minimum( const Vector<unsigned long long> &times );
+    static unsigned long long median( const Vector<unsigned long long> &times );
+    static double mean( const Vector<unsigned long long> &times );
+};
+
+/*
+  The benchmark groups, one per module
+*/
+void registerNlrBenchmarks( BenchmarkRunner &runner );
+void registerBasisFactorizationBenchmarks( BenchmarkRunner &runner );
+void registerTableauBenchmarks( BenchmarkRunner &runner );
+void registerParserBenchmarks( BenchmarkRunner &runner );
+void registerEndToEndBenchmarks( BenchmarkRunner &runner );
+
+#endif // __Benchmark_h__
+
+//
+// Local Variables:
+// compile-command: "make -C .. "
+// tags-file-name: "../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,48 @@
+/*********************                                                        */
+/*! \file BenchmarkError.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __BenchmarkError_h__
+#define __BenchmarkError_h__
+
+#include "Error.h"
+
+class BenchmarkError : public Error
+{
+public:
+    enum Code {
+        SETUP_FAILED = 0,
+        UNEXPECTED_RESULT = 1,
+    };
+
+    BenchmarkError( BenchmarkError::Code code )
+        : Error( "BenchmarkError", (int)code )
+    {
+    }
+
+    BenchmarkError( BenchmarkError::Code code, const char *userMessage )
+        : Error( "BenchmarkError", (int)code, userMessage )
+    {
+    }
+};
+
+#endif // __BenchmarkError_h__
+
+//
+// Local Variables:
+// compile-command: "make -C .. "
+// tags-file-name: "../TAGS"
+// c-basic-offset: 4
+// End:
+//
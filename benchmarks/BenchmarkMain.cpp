@@ -0,0 +1,90 @@
+/*********************                                                        */
+/*! \file BenchmarkMain.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "Benchmark.h"
+#include "MString.h"
+#include "Options.h"
+
+#include <cstdio>
+#include <cstdlib>
+
+static void printUsage( const char *program )
+{
+    printf( "Usage: %s [options]\n"
+            "  --list                 List the benchmarks and exit\n"
+            "  --filter=<substring>   Only run benchmarks whose name contains <substring>\n"
+            "  --repetitions=<n>      Number of timed runs per benchmark (default: 5)\n"
+            "  --output=<path>        Write the results as JSON to <path>\n",
+            program );
+}
+
+int main( int argc, char **argv )
+{
+    BenchmarkRunner runner;
+    registerNlrBenchmarks( runner );
+    registerBasisFactorizationBenchmarks( runner );
+    registerTableauBenchmarks( runner );
+    registerParserBenchmarks( runner );
+    registerEndToEndBenchmarks( runner );
+
+    bool list = false;
+    String outputPath;
+
+    for ( int i = 1; i < argc; ++i )
+    {
+        String argument( argv[i] );
+        if ( argument == "--list" )
+            list = true;
+        else if ( argument.find( "--filter=" ) == 0 )
+            runner.setFilter( argument.substring( 9, argument.length() - 9 ) );
+        else if ( argument.find( "--repetitions=" ) == 0 )
+            runner.setRepetitions( atoi( argv[i] + 14 ) );
+        else if ( argument.find( "--output=" ) == 0 )
+            outputPath = argument.substring( 9, argument.length() - 9 );
+        else
+        {
+            printUsage( argv[0] );
+            return 1;
+        }
+    }
+
+    if ( list )
+    {
+        runner.listBenchmarks();
+        return 0;
+    }
+
+    // Keep the engine quiet in the end-to-end benchmarks
+    Options::get()->setInt( Options::VERBOSITY, 0 );
+
+    runner.runBenchmarks();
+    runner.printResults();
+
+    if ( outputPath.length() > 0 )
+    {
+        runner.writeResults( outputPath );
+        printf( "\nResults written to %s\n", outputPath.ascii() );
+    }
+
+    return runner.haveFailures() ? 1 : 0;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C .. "
+// tags-file-name: "../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,41 @@
+/*********************                                                        */
+/*! \file BenchmarkUtils.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#ifndef __BenchmarkUtils_h__
+#define __BenchmarkUtils_h__
+
+#include "MString.h"
+
+class BenchmarkUtils
+{
+public:
+    /*
+      The full path of a file under the resources directory
+    */
+    static String resource( const char *relativePath )
+    {
+        return String( RESOURCES_DIR ) + "/" + relativePath;
+    }
+};
+
+#endif // __BenchmarkUtils_h__
+
+//
+// Local Variables:
+// compile-command: "make -C .. "
+// tags-file-name: "../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,100 @@
+/*********************                                                        */
+/*! \file EndToEndBenchmarks.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** End-to-end benchmarks: solving ACAS Xu queries with the engine, from
+ ** preprocessing to the final answer. The answer is checked against the
+ ** known one, so that a benchmark that becomes faster by becoming wrong
+ ** is reported as a failure.
+
+ **/
+
+#include "AcasParser.h"
+#include "Benchmark.h"
+#include "BenchmarkError.h"
+#include "BenchmarkUtils.h"
+#include "Engine.h"
+#include "PropertyParser.h"
+#include "Query.h"
+
+namespace {
+
+class AcasQueryBenchmark : public Benchmark
+{
+public:
+    static const unsigned TIMEOUT_IN_SECONDS = 600;
+
+    AcasQueryBenchmark( unsigned networkX,
+                        unsigned networkY,
+                        unsigned property,
+                        Engine::ExitCode expected )
+        : _networkX( networkX )
+        , _networkY( networkY )
+        , _property( property )
+        , _expected( expected )
+    {
+    }
+
+    String getName() const
+    {
+        return Stringf( "end_to_end/acasxu/%u_%u/property_%u", _networkX, _networkY, _property );
+    }
+
+    void setUp()
+    {
+        AcasParser parser( BenchmarkUtils::resource(
+            Stringf( "nnet/acasxu/ACASXU_experimental_v2a_%u_%u.nnet", _networkX, _networkY )
+                .ascii() ) );
+        parser.generateQuery( _query );
+        PropertyParser().parse(
+            BenchmarkUtils::resource( Stringf( "properties/acas_property_%u.txt", _property ).ascii() ),
+            _query );
+    }
+
+    unsigned run()
+    {
+        Engine engine;
+        Query query = _query;
+        if ( engine.processInputQuery( query ) )
+            engine.solve( TIMEOUT_IN_SECONDS );
+
+        Engine::ExitCode result = engine.getExitCode();
+        if ( result != _expected )
+            throw BenchmarkError( BenchmarkError::UNEXPECTED_RESULT,
+                                  Stringf( "Expected exit code %u, got %u", _expected, result )
+                                      .ascii() );
+
+        return (unsigned)engine.getStatistics()->getLongAttribute(
+            Statistics::NUM_MAIN_LOOP_ITERATIONS );
+    }
+
+private:
+    unsigned _networkX;
+    unsigned _networkY;
+    unsigned _property;
+    Engine::ExitCode _expected;
+    Query _query;
+};
+
+} // namespace
+
+void registerEndToEndBenchmarks( BenchmarkRunner &runner )
+{
+    runner.addBenchmark( new AcasQueryBenchmark( 1, 7, 3, Engine::SAT ) );
+    runner.addBenchmark( new AcasQueryBenchmark( 4, 1, 4, Engine::UNSAT ) );
+}
+
+//
+// Local Variables:
+// compile-command: "make -C .. "
+// tags-file-name: "../TAGS"
+// c-basic-offset: 4
+// End:
+//
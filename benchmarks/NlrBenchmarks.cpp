@@ -0,0 +1,332 @@
+/*********************                                                        */
+/*! \file NlrBenchmarks.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** Benchmarks for the bound propagation of the network level reasoner:
+ ** symbolic bound tightening for each layer type, on synthetic networks,
+ ** and symbolic bound tightening and DeepPoly on an ACAS Xu network.
+
+ **/
+
+#include "AcasParser.h"
+#include "Benchmark.h"
+#include "BenchmarkError.h"
+#include "BenchmarkUtils.h"
+#include "NetworkLevelReasoner.h"
+#include "Options.h"
+#include "PropertyParser.h"
+#include "Query.h"
+
+#include <cmath>
+#include <random>
+
+namespace {
+
+/*
+  Layers only allocate the memory for symbolic bounds when symbolic bound
+  tightening is the configured analysis, so the networks are built with
+  that setting (and the previous one is restored afterwards).
+*/
+class SymbolicBoundsSetting
+{
+public:
+    SymbolicBoundsSetting()
+        : _previous( Options::get()->getString( Options::SYMBOLIC_BOUND_TIGHTENING_TYPE ) )
+    {
+        Options::get()->setString( Options::SYMBOLIC_BOUND_TIGHTENING_TYPE, "sbt" );
+    }
+
+    ~SymbolicBoundsSetting()
+    {
+        Options::get()->setString( Options::SYMBOLIC_BOUND_TIGHTENING_TYPE, _previous.ascii() );
+    }
+
+private:
+    String _previous;
+};
+
+/*
+  A fully connected network with the given activation:
+
+    input -> ( weighted sum -> activation ) x NUMBER_OF_BLOCKS -> weighted sum
+
+  The weights are drawn with a fixed seed, so that all versions are
+  measured on the same network.
+*/
+class SyntheticNetwork
+{
+public:
+    static const unsigned INPUT_SIZE = 20;
+    static const unsigned HIDDEN_SIZE = 200;
+    static const unsigned OUTPUT_SIZE = 10;
+    static const unsigned NUMBER_OF_BLOCKS = 4;
+    static const unsigned SOFTMAX_GROUP_SIZE = 10;
+
+    SyntheticNetwork( NLR::Layer::Type activation )
+        : _activation( activation )
+        , _numberOfVariables( 0 )
+        , _random( 2024 )
+    {
+    }
+
+    void build( NLR::NetworkLevelReasoner &nlr, Query &query )
+    {
+        unsigned layerIndex = 0;
+        addLayer( nlr, layerIndex, NLR::Layer::INPUT, INPUT_SIZE );
+
+        for ( unsigned block = 0; block < NUMBER_OF_BLOCKS; ++block )
+        {
+            addWeightedSumLayer( nlr, layerIndex, HIDDEN_SIZE );
+            addActivationLayer( nlr, layerIndex );
+        }
+
+        addWeightedSumLayer( nlr, layerIndex, OUTPUT_SIZE );
+        nlr.computeSuccessorLayers();
+
+        query.setNumberOfVariables( _numberOfVariables );
+        for ( unsigned i = 0; i < _numberOfVariables; ++i )
+        {
+            bool input = i < INPUT_SIZE;
+            query.setLowerBound( i, input ? -1 : -1000 );
+            query.setUpperBound( i, input ? 1 : 1000 );
+        }
+    }
+
+private:
+    NLR::Layer::Type _activation;
+    unsigned _numberOfVariables;
+    std::mt19937 _random;
+
+    void addLayer( NLR::NetworkLevelReasoner &nlr,
+                   unsigned &layerIndex,
+                   NLR::Layer::Type type,
+                   unsigned size )
+    {
+        nlr.addLayer( layerIndex, type, size );
+        if ( layerIndex > 0 )
+            nlr.addLayerDependency( layerIndex - 1, layerIndex );
+
+        for ( unsigned i = 0; i < size; ++i )
+            nlr.setNeuronVariable( NLR::NeuronIndex( layerIndex, i ), _numberOfVariables++ );
+
+        ++layerIndex;
+    }
+
+    void addWeightedSumLayer( NLR::NetworkLevelReasoner &nlr, unsigned &layerIndex, unsigned size )
+    {
+        unsigned sourceIndex = layerIndex - 1;
+        unsigned sourceSize = nlr.getLayer( sourceIndex )->getSize();
+        addLayer( nlr, layerIndex, NLR::Layer::WEIGHTED_SUM, size );
+
+        double scale = 1 / std::sqrt( (double)sourceSize );
+        std::uniform_real_distribution<double> weight( -scale, scale );
+        for ( unsigned target = 0; target < size; ++target )
+        {
+            for ( unsigned source = 0; source < sourceSize; ++source )
+                nlr.setWeight( sourceIndex, source, sourceIndex + 1, target, weight( _random ) );
+            nlr.setBias( sourceIndex + 1, target, weight( _random ) );
+        }
+    }
+
+    void addActivationLayer( NLR::NetworkLevelReasoner &nlr, unsigned &layerIndex )
+    {
+        unsigned sourceIndex = layerIndex - 1;
+        unsigned targetIndex = layerIndex;
+
+        if ( _activation == NLR::Layer::MAX || _activation == NLR::Layer::BILINEAR )
+        {
+            // Each neuron depends on a pair of neurons
+            addLayer( nlr, layerIndex, _activation, HIDDEN_SIZE / 2 );
+            for ( unsigned i = 0; i < HIDDEN_SIZE / 2; ++i )
+            {
+                nlr.addActivationSource( sourceIndex, 2 * i, targetIndex, i );
+                nlr.addActivationSource( sourceIndex, 2 * i + 1, targetIndex, i );
+            }
+            return;
+        }
+
+        addLayer( nlr, layerIndex, _activation, HIDDEN_SIZE );
+        if ( _activation == NLR::Layer::LEAKY_RELU )
+            nlr.getLayer( targetIndex )->setAlpha( 0.1 );
+
+        for ( unsigned i = 0; i < HIDDEN_SIZE; ++i )
+        {
+            if ( _activation == NLR::Layer::SOFTMAX )
+            {
+                unsigned groupStart = i - ( i % SOFTMAX_GROUP_SIZE );
+                for ( unsigned j = groupStart; j < groupStart + SOFTMAX_GROUP_SIZE; ++j )
+                    nlr.addActivationSource( sourceIndex, j, targetIndex, i );
+            }
+            else
+                nlr.addActivationSource( sourceIndex, i, targetIndex, i );
+        }
+    }
+};
+
+/*
+  Layer::computeSymbolicBounds, for all the layers of one type in a
+  synthetic network. The layers feeding them are brought up to date
+  before each repetition, outside the timed region.
+*/
+class SymbolicBoundsBenchmark : public Benchmark
+{
+public:
+    SymbolicBoundsBenchmark( const String &name,
+                             NLR::Layer::Type activation,
+                             NLR::Layer::Type measuredType )
+        : _name( name )
+        , _activation( activation )
+        , _measuredType( measuredType )
+    {
+    }
+
+    String getName() const
+    {
+        return String( "nlr/symbolic_bounds/" ) + _name;
+    }
+
+    void setUp()
+    {
+        SymbolicBoundsSetting setting;
+        SyntheticNetwork( _activation ).build( _nlr, _query );
+    }
+
+    void prepare()
+    {
+        _nlr.obtainCurrentBounds( _query );
+        _nlr.symbolicBoundPropagation();
+    }
+
+    unsigned run()
+    {
+        unsigned layers = 0;
+        for ( unsigned i = 0; i < _nlr.getNumberOfLayers(); ++i )
+        {
+            NLR::Layer *layer = _nlr.getLayer( i );
+            if ( layer->getLayerType() == _measuredType )
+            {
+                layer->computeSymbolicBounds();
+                ++layers;
+            }
+        }
+
+        return layers;
+    }
+
+private:
+    String _name;
+    NLR::Layer::Type _activation;
+    NLR::Layer::Type _measuredType;
+    NLR::NetworkLevelReasoner _nlr;
+    Query _query;
+};
+
+/*
+  Bound propagation over a whole ACAS Xu network, with the input region
+  of ACAS Xu property 1
+*/
+class AcasPropagationBenchmark : public Benchmark
+{
+public:
+    enum Analysis {
+        SYMBOLIC_BOUNDS,
+        DEEP_POLY,
+    };
+
+    AcasPropagationBenchmark( Analysis analysis )
+        : _analysis( analysis )
+        , _nlr( NULL )
+    {
+    }
+
+    String getName() const
+    {
+        return _analysis == SYMBOLIC_BOUNDS ? "nlr/symbolic_bounds/acasxu" : "nlr/deeppoly/acasxu";
+    }
+
+    void setUp()
+    {
+        SymbolicBoundsSetting setting;
+        AcasParser parser( BenchmarkUtils::resource( "nnet/acasxu/ACASXU_experimental_v2a_1_1.nnet" ) );
+        parser.generateQuery( _query );
+        PropertyParser().parse( BenchmarkUtils::resource( "properties/acas_property_1.txt" ),
+                                _query );
+
+        List<Equation> unhandledEquations;
+        Set<unsigned> varsInUnhandledConstraints;
+        if ( !_query.constructNetworkLevelReasoner( unhandledEquations,
+                                                    varsInUnhandledConstraints ) )
+            throw BenchmarkError( BenchmarkError::SETUP_FAILED,
+                                  "Failed to construct the network level reasoner" );
+
+        _nlr = _query.getNetworkLevelReasoner();
+        _nlr->computeSuccessorLayers();
+    }
+
+    void prepare()
+    {
+        _nlr->obtainCurrentBounds( _query );
+        _nlr->clearConstraintTightenings();
+    }
+
+    unsigned run()
+    {
+        if ( _analysis == SYMBOLIC_BOUNDS )
+            _nlr->symbolicBoundPropagation();
+        else
+            _nlr->deepPolyPropagation();
+
+        return _nlr->getNumberOfLayers();
+    }
+
+private:
+    Analysis _analysis;
+    Query _query;
+    NLR::NetworkLevelReasoner *_nlr;
+};
+
+} // namespace
+
+void registerNlrBenchmarks( BenchmarkRunner &runner )
+{
+    runner.addBenchmark(
+        new SymbolicBoundsBenchmark( "weighted_sum", NLR::Layer::RELU, NLR::Layer::WEIGHTED_SUM ) );
+
+    struct
+    {
+        const char *_name;
+        NLR::Layer::Type _type;
+    } activations[] = {
+        { "relu", NLR::Layer::RELU },
+        { "leaky_relu", NLR::Layer::LEAKY_RELU },
+        { "absolute_value", NLR::Layer::ABSOLUTE_VALUE },
+        { "sign", NLR::Layer::SIGN },
+        { "round", NLR::Layer::ROUND },
+        { "sigmoid", NLR::Layer::SIGMOID },
+        { "max", NLR::Layer::MAX },
+        { "softmax", NLR::Layer::SOFTMAX },
+        { "bilinear", NLR::Layer::BILINEAR },
+    };
+
+    for ( const auto &activation : activations )
+        runner.addBenchmark(
+            new SymbolicBoundsBenchmark( activation._name, activation._type, activation._type ) );
+
+    runner.addBenchmark( new AcasPropagationBenchmark( AcasPropagationBenchmark::SYMBOLIC_BOUNDS ) );
+    runner.addBenchmark( new AcasPropagationBenchmark( AcasPropagationBenchmark::DEEP_POLY ) );
+}
+
+//
+// Local Variables:
+// compile-command: "make -C .. "
+// tags-file-name: "../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,102 @@
+/*********************                                                        */
+/*! \file ParserBenchmarks.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** Benchmarks for loading networks: parsing an ONNX or NNet file and
+ ** generating the query from it.
+
+ **/
+
+#include "AcasParser.h"
+#include "Benchmark.h"
+#include "BenchmarkUtils.h"
+#include "InputQueryBuilder.h"
+#include "OnnxParser.h"
+#include "Query.h"
+
+namespace {
+
+class OnnxParserBenchmark : public Benchmark
+{
+public:
+    OnnxParserBenchmark( const String &name, const char *networkPath )
+        : _name( name )
+        , _networkPath( BenchmarkUtils::resource( networkPath ) )
+    {
+    }
+
+    String getName() const
+    {
+        return String( "parser/onnx/" ) + _name;
+    }
+
+    unsigned run()
+    {
+        InputQueryBuilder queryBuilder;
+        OnnxParser::parse( queryBuilder, _networkPath, {}, {} );
+
+        Query query;
+        queryBuilder.generateQuery( query );
+        return query.getNumberOfVariables();
+    }
+
+private:
+    String _name;
+    String _networkPath;
+};
+
+class AcasParserBenchmark : public Benchmark
+{
+public:
+    AcasParserBenchmark( const String &name, const char *networkPath )
+        : _name( name )
+        , _networkPath( BenchmarkUtils::resource( networkPath ) )
+    {
+    }
+
+    String getName() const
+    {
+        return String( "parser/nnet/" ) + _name;
+    }
+
+    unsigned run()
+    {
+        AcasParser parser( _networkPath );
+
+        Query query;
+        parser.generateQuery( query );
+        return query.getNumberOfVariables();
+    }
+
+private:
+    String _name;
+    String _networkPath;
+};
+
+} // namespace
+
+void registerParserBenchmarks( BenchmarkRunner &runner )
+{
+    runner.addBenchmark(
+        new OnnxParserBenchmark( "acasxu", "onnx/acasxu/ACASXU_experimental_v2a_1_1.onnx" ) );
+    runner.addBenchmark( new OnnxParserBenchmark( "cifar10_cnn", "onnx/cifar10/cifar_base_kw.onnx" ) );
+    runner.addBenchmark( new OnnxParserBenchmark( "traffic_signs_cnn",
+                                                  "onnx/model-german-traffic-sign-fast.onnx" ) );
+    runner.addBenchmark(
+        new AcasParserBenchmark( "acasxu", "nnet/acasxu/ACASXU_experimental_v2a_1_1.nnet" ) );
+}
+
+//
+// Local Variables:
+// compile-command: "make -C .. "
+// tags-file-name: "../TAGS"
+// c-basic-offset: 4
+// End:
+//
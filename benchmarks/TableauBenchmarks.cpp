@@ -0,0 +1,279 @@
+/*********************                                                        */
+/*! \file TableauBenchmarks.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** Benchmarks for the tableau: simplex pivots, driven the same way as in
+ ** Engine::performSimplexStep, and a pass of the row bound tightener over
+ ** the constraint matrix.
+
+ **/
+
+#include "Benchmark.h"
+#include "BoundManager.h"
+#include "CostFunctionManager.h"
+#include "DantzigsRule.h"
+#include "FloatUtils.h"
+#include "GlobalConfiguration.h"
+#include "RowBoundTightener.h"
+#include "Set.h"
+#include "Tableau.h"
+#include "TableauState.h"
+#include "context/context.h"
+
+#include <random>
+
+namespace {
+
+/*
+  A feasible, sparse linear program in the tableau's form:
+
+    A x - s = 0,   -1 <= x <= 1,   l <= s <= u
+
+  The slack variables s form the initial basis. Their bounds are set
+  around the values they take at a random point x*, so the program is
+  feasible but the initial assignment (x at its lower bounds) is not.
+*/
+class LinearProgramBenchmark : public Benchmark
+{
+public:
+    static const unsigned NUMBER_OF_ROWS = 200;
+    static const unsigned NUMBER_OF_STRUCTURAL_VARIABLES = 400;
+    static const unsigned ENTRIES_PER_ROW = 8;
+    static const unsigned MAX_PIVOTS = 5000;
+
+    enum Workload {
+        SIMPLEX_PIVOTS,
+        EXAMINE_CONSTRAINT_MATRIX,
+    };
+
+    LinearProgramBenchmark( Workload workload )
+        : _workload( workload )
+        , _boundManager( NULL )
+        , _tableau( NULL )
+        , _rowBoundTightener( NULL )
+        , _costFunctionManager( NULL )
+        , _initialState( NULL )
+    {
+    }
+
+    ~LinearProgramBenchmark()
+    {
+        tearDown();
+    }
+
+    String getName() const
+    {
+        return _workload == SIMPLEX_PIVOTS ? "tableau/simplex_pivots"
+                                           : "tableau/examine_constraint_matrix";
+    }
+
+    void setUp()
+    {
+        const unsigned m = NUMBER_OF_ROWS;
+        const unsigned n = NUMBER_OF_STRUCTURAL_VARIABLES + NUMBER_OF_ROWS;
+
+        _boundManager = new BoundManager( _context );
+        _tableau = new Tableau( *_boundManager );
+        _boundManager->registerTableau( _tableau );
+        _rowBoundTightener = new RowBoundTightener( *_tableau );
+        _boundManager->registerRowBoundTightener( _rowBoundTightener );
+        _boundManager->initialize( n );
+
+        std::mt19937 random( 2024 );
+        std::uniform_int_distribution<unsigned> column( 0, NUMBER_OF_STRUCTURAL_VARIABLES - 1 );
+        std::uniform_real_distribution<double> value( -1, 1 );
+
+        double *point = new double[NUMBER_OF_STRUCTURAL_VARIABLES];
+        for ( unsigned j = 0; j < NUMBER_OF_STRUCTURAL_VARIABLES; ++j )
+            point[j] = value( random );
+
+        double *A = new double[m * n];
+        std::fill_n( A, m * n, 0 );
+        double *slackValues = new double[m];
+        for ( unsigned i = 0; i < m; ++i )
+        {
+            slackValues[i] = 0;
+            for ( unsigned k = 0; k < ENTRIES_PER_ROW; ++k )
+            {
+                unsigned j = column( random );
+                if ( !FloatUtils::isZero( A[i * n + j] ) )
+                    continue;
+
+                A[i * n + j] = value( random );
+                slackValues[i] += A[i * n + j] * point[j];
+            }
+            A[i * n + NUMBER_OF_STRUCTURAL_VARIABLES + i] = -1;
+        }
+
+        // The same order of initialization as in Engine::initializeTableau
+        _tableau->setDimensions( m, n );
+        for ( unsigned i = 0; i < m; ++i )
+            _tableau->setRightHandSide( i, 0 );
+        _tableau->setConstraintMatrix( A );
+
+        _tableau->registerToWatchAllVariables( _rowBoundTightener );
+        _tableau->registerResizeWatcher( _rowBoundTightener );
+        _rowBoundTightener->setDimensions();
+
+        List<unsigned> initialBasis;
+        for ( unsigned j = 0; j < n; ++j )
+        {
+            if ( j < NUMBER_OF_STRUCTURAL_VARIABLES )
+            {
+                _tableau->setLowerBound( j, -1 );
+                _tableau->setUpperBound( j, 1 );
+            }
+            else
+            {
+                double slack = slackValues[j - NUMBER_OF_STRUCTURAL_VARIABLES];
+                _tableau->setLowerBound( j, slack - 0.05 );
+                _tableau->setUpperBound( j, slack + 0.05 );
+                initialBasis.append( j );
+            }
+        }
+        _boundManager->storeLocalBounds();
+
+        _tableau->initializeTableau( initialBasis );
+
+        _costFunctionManager = new CostFunctionManager( _tableau );
+        _costFunctionManager->initialize();
+        _tableau->registerCostFunctionManager( _costFunctionManager );
+        _entryStrategy.initialize( *_tableau );
+
+        _initialState = new TableauState;
+        _tableau->storeState( *_initialState, TableauStateStorageLevel::STORE_ENTIRE_TABLEAU_STATE );
+
+        delete[] slackValues;
+        delete[] A;
+        delete[] point;
+    }
+
+    void prepare()
+    {
+        if ( _workload == SIMPLEX_PIVOTS )
+            _tableau->restoreState( *_initialState,
+                                    TableauStateStorageLevel::STORE_ENTIRE_TABLEAU_STATE );
+        else
+        {
+            // Undo the tightenings of the previous repetition
+            if ( _context.getLevel() > 0 )
+                _context.pop();
+            _context.push();
+
+            // Forget which rows were examined, so that all of them are examined again
+            _rowBoundTightener->setDimensions();
+        }
+    }
+
+    unsigned run()
+    {
+        if ( _workload == SIMPLEX_PIVOTS )
+            return runSimplex();
+
+        _rowBoundTightener->examineConstraintMatrix( false );
+        return NUMBER_OF_ROWS;
+    }
+
+    void tearDown()
+    {
+        if ( _context.getLevel() > 0 )
+            _context.popto( 0 );
+
+        delete _initialState;
+        _initialState = NULL;
+        delete _costFunctionManager;
+        _costFunctionManager = NULL;
+        delete _rowBoundTightener;
+        _rowBoundTightener = NULL;
+        delete _tableau;
+        _tableau = NULL;
+        delete _boundManager;
+        _boundManager = NULL;
+    }
+
+private:
+    Workload _workload;
+    CVC4::context::Context _context;
+    BoundManager *_boundManager;
+    Tableau *_tableau;
+    RowBoundTightener *_rowBoundTightener;
+    CostFunctionManager *_costFunctionManager;
+    DantzigsRule _entryStrategy;
+    TableauState *_initialState;
+
+    /*
+      Pivot until the assignment is feasible, following the same
+      steps as Engine::performSimplexStep: pick an entering variable,
+      compute the change column, run the ratio test, and pivot.
+      Returns the number of pivots performed.
+    */
+    unsigned runSimplex()
+    {
+        unsigned pivots = 0;
+        while ( _tableau->existsBasicOutOfBounds() && pivots < MAX_PIVOTS )
+        {
+            if ( _costFunctionManager->costFunctionInvalid() )
+                _costFunctionManager->computeCoreCostFunction();
+
+            List<unsigned> candidates;
+            _tableau->getEntryCandidates( candidates );
+
+            Set<unsigned> excluded;
+            bool haveCandidate = false;
+            while ( !haveCandidate &&
+                    _entryStrategy.select( *_tableau, candidates, excluded ) )
+            {
+                excluded.insert( _tableau->getEnteringVariableIndex() );
+
+                _tableau->computeChangeColumn();
+                _tableau->pickLeavingVariable();
+
+                haveCandidate =
+                    _tableau->performingFakePivot() ||
+                    FloatUtils::abs(
+                        _tableau->getChangeColumn()[_tableau->getLeavingVariableIndex()] ) >=
+                        GlobalConfiguration::ACCEPTABLE_SIMPLEX_PIVOT_THRESHOLD;
+            }
+
+            if ( !haveCandidate )
+            {
+                if ( _costFunctionManager->costFunctionJustComputed() )
+                    break;
+
+                _costFunctionManager->invalidateCostFunction();
+                continue;
+            }
+
+            if ( !_tableau->performingFakePivot() )
+                _tableau->computePivotRow();
+            _tableau->performPivot();
+            ++pivots;
+        }
+
+        return pivots;
+    }
+};
+
+} // namespace
+
+void registerTableauBenchmarks( BenchmarkRunner &runner )
+{
+    runner.addBenchmark( new LinearProgramBenchmark( LinearProgramBenchmark::SIMPLEX_PIVOTS ) );
+    runner.addBenchmark(
+        new LinearProgramBenchmark( LinearProgramBenchmark::EXAMINE_CONSTRAINT_MATRIX ) );
+}
+
+//
+// Local Variables:
+// compile-command: "make -C .. "
+// tags-file-name: "../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,72 @@
+'''
+Compare two benchmark result files produced by MarabouBenchmarks --output,
+and report the benchmarks whose median time changed by more than a
+threshold. Exits with a nonzero status if any benchmark slowed down (or
+stopped succeeding), so that it can be used in nightly jobs.
+
+Usage:
+    python3 compare_results.py baseline.json current.json [--threshold 0.10]
+'''
+
+import argparse
+import json
+import sys
+
+
+def load_results(path):
+    with open(path) as f:
+        data = json.load(f)
+    return data, {benchmark['name']: benchmark for benchmark in data['benchmarks']}
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Compare two Marabou benchmark result files')
+    parser.add_argument('baseline', help='results of the reference version')
+    parser.add_argument('current', help='results of the version under test')
+    parser.add_argument('--threshold', type=float, default=0.10,
+                        help='relative change in median time that is reported (default: 0.10)')
+    args = parser.parse_args()
+
+    baseline_data, baseline = load_results(args.baseline)
+    current_data, current = load_results(args.current)
+
+    print('Baseline: {} ({})'.format(baseline_data['commit'], baseline_data['date']))
+    print('Current:  {} ({})'.format(current_data['commit'], current_data['date']))
+    print()
+    print('{:<50} {:>14} {:>14} {:>9}'.format('Benchmark', 'baseline (us)', 'current (us)', 'change'))
+
+    regressions = 0
+    for name in sorted(set(baseline) | set(current)):
+        if name not in baseline or name not in current:
+            print('{:<50} only in {}'.format(name, 'baseline' if name in baseline else 'current'))
+            continue
+
+        old, new = baseline[name], current[name]
+        if new['status'] != 'ok':
+            print('{:<50} FAILED: {}'.format(name, new.get('error', '')))
+            if old['status'] == 'ok':
+                regressions += 1
+            continue
+        if old['status'] != 'ok':
+            print('{:<50} fixed (failed in baseline)'.format(name))
+            continue
+
+        change = (new['median_us'] - old['median_us']) / max(old['median_us'], 1)
+        marker = ''
+        if change > args.threshold:
+            marker = '  SLOWER'
+            regressions += 1
+        elif change < -args.threshold:
+            marker = '  faster'
+
+        print('{:<50} {:>14} {:>14} {:>+8.1f}%{}'.format(
+            name, old['median_us'], new['median_us'], 100 * change, marker))
+
+    if regressions > 0:
+        print('\n{} benchmark(s) regressed'.format(regressions))
+        return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -525,6 +525,11 @@ void saveQuery( InputQuery &inputQuery, std::string filename )
     inputQuery.saveQuery( String( filename ) );
 }
 
+void saveBinaryQuery( InputQuery &inputQuery, std::string filename )
+{
+    inputQuery.saveBinaryQuery( String( filename ) );
+}
+
 void saveQueryAsSmtLib( InputQuery &query, std::string filename )
 {
     query.saveQueryAsSmtLib( String( filename ) );
@@ -615,6 +620,18 @@ PYBIND11_MODULE( MarabouCore, m )
            R"pbdoc(
         Serializes the inputQuery in the given filename
 
+        Args:
+            inputQuery (:class:`~maraboupy.MarabouCore.InputQuery`): Marabou input query to be saved
+            filename (str): Name of file to save query
+        )pbdoc",
+           py::arg( "inputQuery" ),
+           py::arg( "filename" ) );
+    m.def( "saveBinaryQuery",
+           &saveBinaryQuery,
+           R"pbdoc(
+        Serializes the inputQuery in the given filename, in the binary query format.
+        Binary queries are loaded with loadQuery, much faster than text queries.
+
         Args:
             inputQuery (:class:`~maraboupy.MarabouCore.InputQuery`): Marabou input query to be saved
             filename (str): Name of file to save query
@@ -635,7 +652,8 @@ PYBIND11_MODULE( MarabouCore, m )
     m.def( "loadQuery",
            &loadQuery,
            R"pbdoc(
-        Loads and returns a serialized InputQuery from the given filename
+        Loads and returns a serialized InputQuery from the given filename, in either the
+        text or the binary query format
 
         Args:
             filename (str): Name of file to load into an InputQuery
@@ -831,6 +849,14 @@ PYBIND11_MODULE( MarabouCore, m )
     eq.def( "setScalar", &Equation::setScalar );
     py::enum_<Statistics::StatisticsUnsignedAttribute>( m, "StatisticsUnsignedAttribute" )
         .value( "NUM_POPS", Statistics::StatisticsUnsignedAttribute::NUM_POPS )
+        .value( "NUM_BACKJUMPS", Statistics::StatisticsUnsignedAttribute::NUM_BACKJUMPS )
+        .value( "NUM_LEVELS_SKIPPED_BY_BACKJUMPS",
+                Statistics::StatisticsUnsignedAttribute::NUM_LEVELS_SKIPPED_BY_BACKJUMPS )
+        .value( "NUM_LEARNED_CLAUSES",
+                Statistics::StatisticsUnsignedAttribute::NUM_LEARNED_CLAUSES )
+        .value( "NUM_CLAUSE_IMPLIED_SPLITS",
+                Statistics::StatisticsUnsignedAttribute::NUM_CLAUSE_IMPLIED_SPLITS )
+        .value( "NUM_RESTARTS", Statistics::StatisticsUnsignedAttribute::NUM_RESTARTS )
         .value( "CURRENT_DECISION_LEVEL",
                 Statistics::StatisticsUnsignedAttribute::CURRENT_DECISION_LEVEL )
         .value( "NUM_PL_SMT_ORIGINATED_SPLITS",
@@ -876,17 +902,37 @@ PYBIND11_MODULE( MarabouCore, m )
                 Statistics::StatisticsLongAttribute::NUM_BOUNDS_PROPOSED_BY_PL_CONSTRAINTS )
         .value( "TIME_SIMPLEX_STEPS_MICRO",
                 Statistics::StatisticsLongAttribute::TIME_SIMPLEX_STEPS_MICRO )
+        .value( "NUM_DUAL_SIMPLEX_STEPS",
+                Statistics::StatisticsLongAttribute::NUM_DUAL_SIMPLEX_STEPS )
+        .value( "NUM_DUAL_SIMPLEX_BOUND_FLIPS",
+                Statistics::StatisticsLongAttribute::NUM_DUAL_SIMPLEX_BOUND_FLIPS )
+        .value( "TIME_DUAL_SIMPLEX_STEPS_MICRO",
+                Statistics::StatisticsLongAttribute::TIME_DUAL_SIMPLEX_STEPS_MICRO )
         .value( "TIME_PIVOTS_MICRO", Statistics::StatisticsLongAttribute::TIME_PIVOTS_MICRO )
         .value( "NUM_TIGHTENED_BOUNDS", Statistics::StatisticsLongAttribute::NUM_TIGHTENED_BOUNDS )
         .value( "PSE_NUM_ITERATIONS", Statistics::StatisticsLongAttribute::PSE_NUM_ITERATIONS )
         .value( "NUM_TABLEAU_PIVOTS", Statistics::StatisticsLongAttribute::NUM_TABLEAU_PIVOTS )
         .value( "NUM_TIGHTENINGS_FROM_CONSTRAINT_MATRIX",
                 Statistics::StatisticsLongAttribute::NUM_TIGHTENINGS_FROM_CONSTRAINT_MATRIX )
+        .value( "NUM_CONSTRAINT_MATRIX_ROWS_EXAMINED",
+                Statistics::StatisticsLongAttribute::NUM_CONSTRAINT_MATRIX_ROWS_EXAMINED )
+        .value( "NUM_INVERTED_BASIS_ROWS_EXAMINED",
+                Statistics::StatisticsLongAttribute::NUM_INVERTED_BASIS_ROWS_EXAMINED )
+        .value( "NUM_INVERTED_BASIS_ROWS_COMPUTED",
+                Statistics::StatisticsLongAttribute::NUM_INVERTED_BASIS_ROWS_COMPUTED )
         .value( "NUM_TABLEAU_DEGENERATE_PIVOTS_BY_REQUEST",
                 Statistics::StatisticsLongAttribute::NUM_TABLEAU_DEGENERATE_PIVOTS_BY_REQUEST )
         .value( "NUM_ADDED_ROWS", Statistics::StatisticsLongAttribute::NUM_ADDED_ROWS )
         .value( "PSE_NUM_RESET_REFERENCE_SPACE",
                 Statistics::StatisticsLongAttribute::PSE_NUM_RESET_REFERENCE_SPACE )
+        .value( "NUM_PRICING_POOL_REFILLS",
+                Statistics::StatisticsLongAttribute::NUM_PRICING_POOL_REFILLS )
+        .value( "NUM_PRICING_POOL_REUSES",
+                Statistics::StatisticsLongAttribute::NUM_PRICING_POOL_REUSES )
+        .value( "NUM_COST_FUNCTION_COMPUTATIONS",
+                Statistics::StatisticsLongAttribute::NUM_COST_FUNCTION_COMPUTATIONS )
+        .value( "NUM_COST_FUNCTION_INCREMENTAL_UPDATES",
+                Statistics::StatisticsLongAttribute::NUM_COST_FUNCTION_INCREMENTAL_UPDATES )
         .value( "TIME_MAIN_LOOP_MICRO", Statistics::StatisticsLongAttribute::TIME_MAIN_LOOP_MICRO )
         .value( "NUM_MERGED_COLUMNS", Statistics::StatisticsLongAttribute::NUM_MERGED_COLUMNS )
         .value( "NUM_BOUND_NOTIFICATIONS_TO_TRANSCENDENTAL_CONSTRAINTS",
@@ -915,6 +961,22 @@ PYBIND11_MODULE( MarabouCore, m )
             Statistics::StatisticsLongAttribute::TOTAL_TIME_EXPLICIT_BASIS_BOUND_TIGHTENING_MICRO )
         .value( "NUM_BASIS_REFACTORIZATIONS",
                 Statistics::StatisticsLongAttribute::NUM_BASIS_REFACTORIZATIONS )
+        .value( "NUM_BASIS_FACTORIZATION_INPUT_NONZEROS",
+                Statistics::StatisticsLongAttribute::NUM_BASIS_FACTORIZATION_INPUT_NONZEROS )
+        .value( "NUM_BASIS_FACTORIZATION_FILL_IN",
+                Statistics::StatisticsLongAttribute::NUM_BASIS_FACTORIZATION_FILL_IN )
+        .value( "NUM_BASIS_FACTORIZATION_SINGLETON_PIVOTS",
+                Statistics::StatisticsLongAttribute::NUM_BASIS_FACTORIZATION_SINGLETON_PIVOTS )
+        .value( "TIME_BASIS_FACTORIZATION_MICRO",
+                Statistics::StatisticsLongAttribute::TIME_BASIS_FACTORIZATION_MICRO )
+        .value( "NUM_REFACTORIZATIONS_DUE_TO_SOLVE_COST",
+                Statistics::StatisticsLongAttribute::NUM_REFACTORIZATIONS_DUE_TO_SOLVE_COST )
+        .value( "NUM_REFACTORIZATIONS_DUE_TO_ETA_LIMIT",
+                Statistics::StatisticsLongAttribute::NUM_REFACTORIZATIONS_DUE_TO_ETA_LIMIT )
+        .value( "NUM_REFACTORIZATIONS_DUE_TO_DEGRADATION",
+                Statistics::StatisticsLongAttribute::NUM_REFACTORIZATIONS_DUE_TO_DEGRADATION )
+        .value( "NUM_BASIS_UPDATES_BEFORE_REFACTORIZATION",
+                Statistics::StatisticsLongAttribute::NUM_BASIS_UPDATES_BEFORE_REFACTORIZATION )
         .value( "NUM_SIMPLEX_STEPS", Statistics::StatisticsLongAttribute::NUM_SIMPLEX_STEPS )
         .value( "NUM_BOUND_NOTIFICATIONS_TO_PL_CONSTRAINTS",
                 Statistics::StatisticsLongAttribute::NUM_BOUND_NOTIFICATIONS_TO_PL_CONSTRAINTS )
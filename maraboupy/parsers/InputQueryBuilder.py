@@ -349,14 +349,18 @@ class InputQueryBuilder(ABC):
 
         return ipq
 
-    def saveQuery(self, filename=""):
+    def saveQuery(self, filename="", binary=False):
         """Serializes the inputQuery in the given filename
 
         Args:
             filename: (string) file to write serialized inputQuery
+            binary: (bool) whether to use the binary query format, which loads much faster
         """
         ipq = self.getInputQuery()
-        MarabouCore.saveQuery(ipq, str(filename))
+        if binary:
+            MarabouCore.saveBinaryQuery(ipq, str(filename))
+        else:
+            MarabouCore.saveQuery(ipq, str(filename))
 
     def isEqualTo(self, network):
         """
@@ -123,6 +123,27 @@ def test_get_marabou_query(tmpdir):
     diff = call(['diff', ipq1_filename, ipq2_filename])
     assert not diff
 
+def test_binary_query(tmpdir):
+    """
+    Tests that a query saved in the binary format is loaded back identically, by comparing the text
+    serializations of the original and the loaded queries.
+    """
+    network = load_acas_network()
+    ipq1 = network.getInputQuery()
+
+    queryDir = tmpdir.mkdir("query")
+    binary_filename = queryDir.join("query.ipqb").strpath
+    ipq1_filename = queryDir.join("query1.txt").strpath
+    ipq2_filename = queryDir.join("query2.txt").strpath
+
+    network.saveQuery(binary_filename, binary=True)
+    ipq2 = Marabou.load_query(binary_filename)
+
+    MarabouCore.saveQuery(ipq1, ipq1_filename)
+    MarabouCore.saveQuery(ipq2, ipq2_filename)
+    diff = call(['diff', ipq1_filename, ipq2_filename])
+    assert not diff
+
 
 def load_onnx_network():
     """
@@ -16,6 +16,7 @@
 #include "BasisFactorizationFactory.h"
 
 #include "BasisFactorizationError.h"
+#include "DenseLUFactorization.h"
 #include "ForrestTomlinFactorization.h"
 #include "GlobalConfiguration.h"
 #include "LUFactorization.h"
@@ -26,6 +27,14 @@ IBasisFactorization *BasisFactorizationFactory::createBasisFactorization(
     unsigned basisSize,
     const IBasisFactorization::BasisColumnOracle &basisColumnOracle )
 {
+    // Small bases are handled faster by the dense factorization
+    bool sparse = GlobalConfiguration::BASIS_FACTORIZATION_TYPE ==
+                      GlobalConfiguration::SPARSE_LU_FACTORIZATION ||
+                  GlobalConfiguration::BASIS_FACTORIZATION_TYPE ==
+                      GlobalConfiguration::SPARSE_FORREST_TOMLIN_FACTORIZATION;
+    if ( sparse && basisSize <= GlobalConfiguration::DENSE_BASIS_FACTORIZATION_MAX_SIZE )
+        return new DenseLUFactorization( basisSize, basisColumnOracle );
+
     // LU
     if ( GlobalConfiguration::BASIS_FACTORIZATION_TYPE == GlobalConfiguration::LU_FACTORIZATION )
         return new LUFactorization( basisSize, basisColumnOracle );
@@ -45,6 +54,11 @@ IBasisFactorization *BasisFactorizationFactory::createBasisFactorization(
               GlobalConfiguration::SPARSE_FORREST_TOMLIN_FACTORIZATION )
         return new SparseFTFactorization( basisSize, basisColumnOracle );
 
+    // Dense LU
+    else if ( GlobalConfiguration::BASIS_FACTORIZATION_TYPE ==
+              GlobalConfiguration::DENSE_LU_FACTORIZATION )
+        return new DenseLUFactorization( basisSize, basisColumnOracle );
+
     throw BasisFactorizationError( BasisFactorizationError::UNKNOWN_BASIS_FACTORIZATION_TYPE );
 }
 
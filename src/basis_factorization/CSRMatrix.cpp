@@ -21,6 +21,9 @@
 #include "MString.h"
 #include "SparseUnsortedList.h"
 
+#include <algorithm>
+#include <vector>
+
 CSRMatrix::CSRMatrix()
     : _m( 0 )
     , _n( 0 )
@@ -77,6 +80,62 @@ void CSRMatrix::initialize( const double *M, unsigned m, unsigned n )
     }
 }
 
+void CSRMatrix::initialize( const SparseUnsortedList **V, unsigned m, unsigned n )
+{
+    freeMemoryIfNeeded();
+
+    _m = m;
+    _n = n;
+
+    // Room for the non-zero entries, and for one more row of average density
+    unsigned nnz = 0;
+    for ( unsigned i = 0; i < _m; ++i )
+        nnz += V[i]->getNnz();
+    _estimatedNnz = nnz + std::max( 2U, _m > 0 ? nnz / _m : 0 );
+
+    _A = new double[_estimatedNnz];
+    if ( !_A )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED, "CSRMatrix::A" );
+
+    _IA = new unsigned[_m + 1];
+    if ( !_IA )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "CSRMatrix::IA" );
+
+    _JA = new unsigned[_estimatedNnz];
+    if ( !_JA )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "CSRMatrix::JA" );
+
+    // The rows are unsorted, whereas the column indices of every row need to be increasing
+    std::vector<SparseUnsortedList::Entry> row;
+    _nnz = 0;
+    _IA[0] = 0;
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        row.assign( V[i]->begin(), V[i]->end() );
+        std::sort( row.begin(),
+                   row.end(),
+                   []( const SparseUnsortedList::Entry &a, const SparseUnsortedList::Entry &b ) {
+                       return a._index < b._index;
+                   } );
+
+        _IA[i + 1] = _IA[i];
+        for ( const auto &entry : row )
+        {
+            // Ignore zero entries
+            if ( FloatUtils::isZero( entry._value ) )
+                continue;
+
+            _A[_nnz] = entry._value;
+            ++_IA[i + 1];
+            _JA[_nnz] = entry._index;
+
+            ++_nnz;
+        }
+    }
+}
+
 void CSRMatrix::initializeToEmpty( unsigned m, unsigned n )
 {
     _m = m;
@@ -107,8 +166,15 @@ void CSRMatrix::initializeToEmpty( unsigned m, unsigned n )
 
 void CSRMatrix::increaseCapacity()
 {
+    /*
+      Grow by the estimated size of the matrix, but by no more than the
+      current capacity: for a large and sparse matrix, the estimate
+      exceeds the actual number of non-zero entries by far.
+    */
     unsigned estimatedNumRowEntries = std::max( 2U, _n / ROW_DENSITY_ESTIMATE );
-    unsigned newEstimatedNnz = _estimatedNnz + ( estimatedNumRowEntries * _m );
+    unsigned growth = std::min( estimatedNumRowEntries * _m, _estimatedNnz );
+    growth = std::max( growth, 2U );
+    unsigned newEstimatedNnz = _estimatedNnz + growth;
 
     double *newA = new double[newEstimatedNnz];
     if ( !newA )
@@ -778,6 +844,11 @@ const double *CSRMatrix::getA() const
     return _A;
 }
 
+const unsigned *CSRMatrix::getIA() const
+{
+    return _IA;
+}
+
 const unsigned *CSRMatrix::getJA() const
 {
     return _JA;
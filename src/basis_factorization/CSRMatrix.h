@@ -47,11 +47,15 @@ public:
     /*
       Initialize a CSR matrix from a given matrix M of dimensions
       m x n, or create an empty object and then initialize it separately.
+      When initialized from sparse rows, the matrix is never stored in
+      dense form, and exactly the space for its non-zero entries is
+      allocated.
     */
     CSRMatrix( const double *M, unsigned m, unsigned n );
     CSRMatrix();
     ~CSRMatrix();
     void initialize( const double *M, unsigned m, unsigned n );
+    void initialize( const SparseUnsortedList **V, unsigned m, unsigned n );
     void initializeToEmpty( unsigned m, unsigned n );
 
     /*
@@ -128,6 +132,7 @@ public:
       Read-only access to the internal data structures
     */
     const double *getA() const;
+    const unsigned *getIA() const;
     const unsigned *getJA() const;
 
 private:
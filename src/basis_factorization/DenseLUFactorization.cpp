@@ -0,0 +1,611 @@
+/*********************                                                        */
+/*! \file DenseLUFactorization.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "DenseLUFactorization.h"
+
+#include "BasisFactorizationError.h"
+#include "Debug.h"
+#include "FloatUtils.h"
+#include "GlobalConfiguration.h"
+#include "MStringf.h"
+#include "MalformedBasisException.h"
+#include "TimeUtils.h"
+
+#include <algorithm>
+#include <cstring>
+
+DenseLUFactorization::DenseLUFactorization( unsigned m,
+                                            const BasisColumnOracle &basisColumnOracle )
+    : IBasisFactorization( basisColumnOracle )
+    , _m( m )
+    , _B( NULL )
+    , _LU( NULL )
+    , _LUt( NULL )
+    , _rowOrdering( NULL )
+    , _etaColumns( NULL )
+    , _etaColumnIndices( NULL )
+    , _numEtas( 0 )
+    , _etaCapacity( 0 )
+    , _factorizationCost( 0 )
+    , _statistics( NULL )
+    , _work( NULL )
+    , _z( NULL )
+{
+    _B = new double[m * m];
+    if ( !_B )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "DenseLUFactorization::B" );
+
+    _LU = new double[m * m];
+    if ( !_LU )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "DenseLUFactorization::LU" );
+
+    _LUt = new double[m * m];
+    if ( !_LUt )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "DenseLUFactorization::LUt" );
+
+    _rowOrdering = new unsigned[m];
+    if ( !_rowOrdering )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "DenseLUFactorization::rowOrdering" );
+
+    _work = new double[m];
+    if ( !_work )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "DenseLUFactorization::work" );
+
+    _z = new double[m];
+    if ( !_z )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "DenseLUFactorization::z" );
+
+    // Start from the identity, so that the factorization is valid before the first refactorization
+    std::fill_n( _B, m * m, 0 );
+    for ( unsigned i = 0; i < m; ++i )
+    {
+        _B[i * m + i] = 1;
+        _rowOrdering[i] = i;
+    }
+    memcpy( _LU, _B, sizeof( double ) * m * m );
+    memcpy( _LUt, _B, sizeof( double ) * m * m );
+}
+
+DenseLUFactorization::~DenseLUFactorization()
+{
+    freeIfNeeded();
+}
+
+void DenseLUFactorization::freeIfNeeded()
+{
+    if ( _B )
+    {
+        delete[] _B;
+        _B = NULL;
+    }
+
+    if ( _LU )
+    {
+        delete[] _LU;
+        _LU = NULL;
+    }
+
+    if ( _LUt )
+    {
+        delete[] _LUt;
+        _LUt = NULL;
+    }
+
+    if ( _rowOrdering )
+    {
+        delete[] _rowOrdering;
+        _rowOrdering = NULL;
+    }
+
+    if ( _etaColumns )
+    {
+        delete[] _etaColumns;
+        _etaColumns = NULL;
+    }
+
+    if ( _etaColumnIndices )
+    {
+        delete[] _etaColumnIndices;
+        _etaColumnIndices = NULL;
+    }
+
+    if ( _work )
+    {
+        delete[] _work;
+        _work = NULL;
+    }
+
+    if ( _z )
+    {
+        delete[] _z;
+        _z = NULL;
+    }
+
+    _numEtas = 0;
+    _etaCapacity = 0;
+}
+
+const double *DenseLUFactorization::getBasis() const
+{
+    return _B;
+}
+
+const SparseMatrix *DenseLUFactorization::getSparseBasis() const
+{
+    printf( "Error! sparse getBasis() not supported for DenseLUFactorization!\n" );
+    exit( 1 );
+}
+
+unsigned DenseLUFactorization::getNumberOfEtas() const
+{
+    return _numEtas;
+}
+
+void DenseLUFactorization::reserveEta()
+{
+    if ( _numEtas < _etaCapacity )
+        return;
+
+    unsigned newCapacity = std::max( 2 * _etaCapacity, 16U );
+
+    double *newEtaColumns = new double[newCapacity * _m];
+    if ( !newEtaColumns )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "DenseLUFactorization::etaColumns" );
+
+    unsigned *newEtaColumnIndices = new unsigned[newCapacity];
+    if ( !newEtaColumnIndices )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "DenseLUFactorization::etaColumnIndices" );
+
+    if ( _etaColumns )
+    {
+        memcpy( newEtaColumns, _etaColumns, sizeof( double ) * _numEtas * _m );
+        memcpy( newEtaColumnIndices, _etaColumnIndices, sizeof( unsigned ) * _numEtas );
+        delete[] _etaColumns;
+        delete[] _etaColumnIndices;
+    }
+
+    _etaColumns = newEtaColumns;
+    _etaColumnIndices = newEtaColumnIndices;
+    _etaCapacity = newCapacity;
+}
+
+void DenseLUFactorization::updateToAdjacentBasis( unsigned columnIndex,
+                                                  const double *changeColumn,
+                                                  const double * /* newColumn */ )
+{
+    ASSERT( !FloatUtils::isZero( changeColumn[columnIndex] ) );
+
+    reserveEta();
+    memcpy( _etaColumns + _numEtas * _m, changeColumn, sizeof( double ) * _m );
+    _etaColumnIndices[_numEtas] = columnIndex;
+    ++_numEtas;
+
+    _refactorizationPolicy.updatePerformed( getFactorsSize() );
+
+    if ( _refactorizationPolicy.shouldRefactorize( _numEtas ) )
+    {
+        DENSE_LU_FACTORIZATION_LOG( "Etas are too costly to keep. Refactoring basis\n" );
+        obtainFreshBasis();
+    }
+}
+
+void DenseLUFactorization::luForwardTransformation( double *w ) const
+{
+    /*
+      Solve L * u = w, going over the columns of L from left to right.
+      Column j of L is stored in row j of _LUt, below the diagonal.
+    */
+    for ( unsigned j = 0; j < _m; ++j )
+    {
+        double wj = w[j];
+        if ( wj == 0 )
+            continue;
+
+        const double *column = _LUt + j * _m;
+        for ( unsigned i = j + 1; i < _m; ++i )
+            w[i] -= wj * column[i];
+    }
+
+    /*
+      Solve U * w = u, going over the columns of U from right to left.
+      Column j of U is stored in row j of _LUt, up to the diagonal.
+    */
+    for ( unsigned j = _m; j-- > 0; )
+    {
+        if ( w[j] == 0 )
+            continue;
+
+        const double *column = _LUt + j * _m;
+        w[j] /= column[j];
+
+        double wj = w[j];
+        for ( unsigned i = 0; i < j; ++i )
+            w[i] -= wj * column[i];
+    }
+}
+
+void DenseLUFactorization::luBackwardTransformation( double *w ) const
+{
+    /*
+      Solve v * U = w, going over the rows of U from top to bottom
+    */
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        if ( w[i] == 0 )
+            continue;
+
+        const double *row = _LU + i * _m;
+        w[i] /= row[i];
+
+        double wi = w[i];
+        for ( unsigned j = i + 1; j < _m; ++j )
+            w[j] -= wi * row[j];
+    }
+
+    /*
+      Solve u * L = v, going over the rows of L from bottom to top
+    */
+    for ( unsigned i = _m; i-- > 0; )
+    {
+        double wi = w[i];
+        if ( wi == 0 )
+            continue;
+
+        const double *row = _LU + i * _m;
+        for ( unsigned j = 0; j < i; ++j )
+            w[j] -= wi * row[j];
+    }
+}
+
+void DenseLUFactorization::forwardTransformation( const double *y, double *x ) const
+{
+    /*
+      We are solving Bx = y, where B = B0 * E1 ... * En, and P * B0 = LU.
+      First we solve LU * z = P * y.
+    */
+    for ( unsigned i = 0; i < _m; ++i )
+        _work[i] = y[_rowOrdering[i]];
+
+    luForwardTransformation( _work );
+    memcpy( x, _work, sizeof( double ) * _m );
+
+    /*
+      Now we are left with E1 * ... * En * x = z (z is stored in x).
+      Eliminate the etas one by one.
+    */
+    for ( unsigned e = 0; e < _numEtas; ++e )
+    {
+        const double *eta = _etaColumns + e * _m;
+        unsigned columnIndex = _etaColumnIndices[e];
+
+        double factor = x[columnIndex] / eta[columnIndex];
+        if ( factor == 0 )
+            continue;
+
+        for ( unsigned i = 0; i < _m; ++i )
+            x[i] -= factor * eta[i];
+
+        x[columnIndex] = factor;
+    }
+
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        if ( FloatUtils::isZero( x[i] ) )
+            x[i] = 0.0;
+    }
+
+    _refactorizationPolicy.transformationPerformed();
+}
+
+void DenseLUFactorization::backwardTransformation( const double *y, double *x ) const
+{
+    /*
+      We are solving xB = y, where B = B0 * E1 ... * En, and P * B0 = LU.
+      The first step is to eliminate the eta matrices, in reverse order.
+      Only the entry at the eta's column index changes.
+    */
+    memcpy( _work, y, sizeof( double ) * _m );
+    for ( unsigned e = _numEtas; e-- > 0; )
+    {
+        const double *eta = _etaColumns + e * _m;
+        unsigned columnIndex = _etaColumnIndices[e];
+
+        double sum = 0;
+        for ( unsigned i = 0; i < _m; ++i )
+            sum += _work[i] * eta[i];
+
+        // The sum includes the diagonal entry, which should be excluded
+        sum -= _work[columnIndex] * eta[columnIndex];
+        _work[columnIndex] = ( _work[columnIndex] - sum ) / eta[columnIndex];
+    }
+
+    /*
+      We now need to solve x * P' * LU = z, i.e. find u such that
+      u * LU = z, and then x = u * P.
+    */
+    luBackwardTransformation( _work );
+    for ( unsigned i = 0; i < _m; ++i )
+        x[_rowOrdering[i]] = _work[i];
+
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        if ( FloatUtils::isZero( x[i] ) )
+            x[i] = 0.0;
+    }
+
+    _refactorizationPolicy.transformationPerformed();
+}
+
+void DenseLUFactorization::untrackedBackwardTransformation( const double *y, double *x ) const
+{
+    backwardTransformation( y, x );
+    _refactorizationPolicy.transformationExcluded();
+}
+
+void DenseLUFactorization::forwardTransformation( const SparseUnsortedList &y,
+                                                  double *x,
+                                                  unsigned *xIndices,
+                                                  unsigned &xNnz ) const
+{
+    y.toDense( _z );
+    forwardTransformation( _z, x );
+    listNonZeros( _m, x, xIndices, xNnz );
+}
+
+void DenseLUFactorization::backwardTransformation( const SparseUnsortedList &y,
+                                                   double *x,
+                                                   unsigned *xIndices,
+                                                   unsigned &xNnz ) const
+{
+    y.toDense( _z );
+    backwardTransformation( _z, x );
+    listNonZeros( _m, x, xIndices, xNnz );
+}
+
+void DenseLUFactorization::clearFactorization()
+{
+    _numEtas = 0;
+}
+
+void DenseLUFactorization::factorizeBasis()
+{
+    clearFactorization();
+
+    struct timespec start = TimeUtils::sampleMicro();
+
+    memcpy( _LU, _B, sizeof( double ) * _m * _m );
+    for ( unsigned i = 0; i < _m; ++i )
+        _rowOrdering[i] = i;
+
+    // Copying the basis and transposing the factors visit every entry twice
+    _factorizationCost = 4 * (unsigned long long)_m * _m;
+
+    /*
+      Gaussian elimination with partial pivoting. At step k, the
+      trailing submatrix receives a rank-one update, one row at a time;
+      rows whose multiplier is zero are skipped, and the update of the
+      other rows is restricted to the span of the non-zero entries of
+      the pivot row.
+    */
+    for ( unsigned k = 0; k < _m; ++k )
+    {
+        unsigned pivotRowIndex = k;
+        double maxInColumn = FloatUtils::abs( _LU[k * _m + k] );
+        for ( unsigned i = k + 1; i < _m; ++i )
+        {
+            double contender = FloatUtils::abs( _LU[i * _m + k] );
+            if ( contender > maxInColumn )
+            {
+                maxInColumn = contender;
+                pivotRowIndex = i;
+            }
+        }
+
+        if ( FloatUtils::isZero( maxInColumn ) )
+        {
+            DENSE_LU_FACTORIZATION_LOG(
+                Stringf( "Have a zero column: %u. Basis is malformed\n", k ).ascii() );
+            throw MalformedBasisException();
+        }
+
+        if ( pivotRowIndex != k )
+        {
+            std::swap_ranges( _LU + k * _m, _LU + ( k + 1 ) * _m, _LU + pivotRowIndex * _m );
+            std::swap( _rowOrdering[k], _rowOrdering[pivotRowIndex] );
+        }
+
+        // The pivot search and the computation of the multipliers each scan column k
+        _factorizationCost += 2 * ( _m - k );
+
+        const double *pivotRow = _LU + k * _m;
+        double inversePivot = 1 / pivotRow[k];
+
+        unsigned begin = k + 1;
+        while ( begin < _m && pivotRow[begin] == 0 )
+            ++begin;
+
+        unsigned end = _m;
+        while ( end > begin && pivotRow[end - 1] == 0 )
+            --end;
+
+        for ( unsigned i = k + 1; i < _m; ++i )
+        {
+            double *row = _LU + i * _m;
+            if ( FloatUtils::isZero( row[k] ) )
+            {
+                row[k] = 0;
+                continue;
+            }
+
+            double multiplier = row[k] * inversePivot;
+            row[k] = multiplier;
+
+            for ( unsigned j = begin; j < end; ++j )
+                row[j] -= multiplier * pivotRow[j];
+
+            _factorizationCost += end - begin;
+        }
+    }
+
+    for ( unsigned i = 0; i < _m; ++i )
+        for ( unsigned j = 0; j < _m; ++j )
+            _LUt[j * _m + i] = _LU[i * _m + j];
+
+    _refactorizationPolicy.factorizationPerformed( _factorizationCost, getFactorsSize() );
+
+    if ( _statistics )
+    {
+        _statistics->incLongAttribute( Statistics::NUM_BASIS_REFACTORIZATIONS );
+
+        struct timespec end = TimeUtils::sampleMicro();
+        _statistics->incLongAttribute( Statistics::TIME_BASIS_FACTORIZATION_MICRO,
+                                       TimeUtils::timePassed( start, end ) );
+    }
+}
+
+unsigned long long DenseLUFactorization::getFactorsSize() const
+{
+    return (unsigned long long)_m * ( _m + _numEtas );
+}
+
+void DenseLUFactorization::setStatistics( Statistics *statistics )
+{
+    _statistics = statistics;
+    _refactorizationPolicy.setStatistics( statistics );
+}
+
+void DenseLUFactorization::storeFactorization( IBasisFactorization *other )
+{
+    DenseLUFactorization *otherDenseLUFactorization = (DenseLUFactorization *)other;
+
+    ASSERT( _m == otherDenseLUFactorization->_m );
+
+    obtainFreshBasis();
+
+    // Store the new basis and factorization
+    otherDenseLUFactorization->clearFactorization();
+    memcpy( otherDenseLUFactorization->_B, _B, sizeof( double ) * _m * _m );
+    memcpy( otherDenseLUFactorization->_LU, _LU, sizeof( double ) * _m * _m );
+    memcpy( otherDenseLUFactorization->_LUt, _LUt, sizeof( double ) * _m * _m );
+    memcpy( otherDenseLUFactorization->_rowOrdering, _rowOrdering, sizeof( unsigned ) * _m );
+
+    otherDenseLUFactorization->_factorizationCost = _factorizationCost;
+    otherDenseLUFactorization->_refactorizationPolicy.factorizationPerformed(
+        _factorizationCost, otherDenseLUFactorization->getFactorsSize() );
+}
+
+void DenseLUFactorization::restoreFactorization( const IBasisFactorization *other )
+{
+    const DenseLUFactorization *otherDenseLUFactorization =
+        (const DenseLUFactorization *)other;
+
+    ASSERT( _m == otherDenseLUFactorization->_m );
+    ASSERT( otherDenseLUFactorization->_numEtas == 0 );
+
+    // Clear any existing data
+    clearFactorization();
+
+    // Restore the basis and factorization
+    memcpy( _B, otherDenseLUFactorization->_B, sizeof( double ) * _m * _m );
+    memcpy( _LU, otherDenseLUFactorization->_LU, sizeof( double ) * _m * _m );
+    memcpy( _LUt, otherDenseLUFactorization->_LUt, sizeof( double ) * _m * _m );
+    memcpy( _rowOrdering, otherDenseLUFactorization->_rowOrdering, sizeof( unsigned ) * _m );
+
+    _factorizationCost = otherDenseLUFactorization->_factorizationCost;
+    _refactorizationPolicy.factorizationPerformed( _factorizationCost, getFactorsSize() );
+}
+
+void DenseLUFactorization::invertBasis( double *result )
+{
+    if ( _numEtas > 0 )
+        throw BasisFactorizationError( BasisFactorizationError::CANT_INVERT_BASIS_BECAUSE_OF_ETAS );
+
+    ASSERT( result );
+
+    // Column j of inv(B0) is the solution of B0 * x = e_j
+    for ( unsigned j = 0; j < _m; ++j )
+    {
+        for ( unsigned i = 0; i < _m; ++i )
+            _work[i] = ( _rowOrdering[i] == j ) ? 1 : 0;
+
+        luForwardTransformation( _work );
+
+        for ( unsigned i = 0; i < _m; ++i )
+            result[i * _m + j] = _work[i];
+    }
+}
+
+bool DenseLUFactorization::explicitBasisAvailable() const
+{
+    return _numEtas == 0;
+}
+
+void DenseLUFactorization::makeExplicitBasisAvailable()
+{
+    obtainFreshBasis();
+}
+
+void DenseLUFactorization::dump() const
+{
+    printf( "*** Dumping dense LU factorization ***\n\n" );
+
+    printf( "\nDumping LU factors (row ordering in parentheses):\n" );
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        printf( "\t(%u)", _rowOrdering[i] );
+        for ( unsigned j = 0; j < _m; ++j )
+            printf( " %8.4lf", _LU[i * _m + j] );
+        printf( "\n" );
+    }
+    printf( "\n\n" );
+
+    printf( "Dumping etas:\n" );
+    for ( unsigned e = 0; e < _numEtas; ++e )
+    {
+        printf( "\tColumn index: %u. Column:", _etaColumnIndices[e] );
+        for ( unsigned i = 0; i < _m; ++i )
+            printf( " %8.4lf", _etaColumns[e * _m + i] );
+        printf( "\n" );
+    }
+    printf( "*** Done dumping dense LU factorization ***\n\n" );
+}
+
+void DenseLUFactorization::obtainFreshBasis()
+{
+    for ( unsigned column = 0; column < _m; ++column )
+    {
+        _basisColumnOracle->getColumnOfBasis( column, _z );
+        for ( unsigned row = 0; row < _m; ++row )
+            _B[row * _m + column] = _z[row];
+    }
+
+    factorizeBasis();
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,216 @@
+/*********************                                                        */
+/*! \file DenseLUFactorization.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** A basis factorization for small bases, which keeps the LU factors
+ ** of the basis in contiguous, dense arrays. For small bases the
+ ** overhead of the sparse data structures dominates the arithmetic;
+ ** here, every kernel is a loop over a contiguous row of a factor,
+ ** which the compiler vectorizes.
+
+ **/
+
+#ifndef __DenseLUFactorization_h__
+#define __DenseLUFactorization_h__
+
+#include "IBasisFactorization.h"
+#include "RefactorizationPolicy.h"
+
+#define DENSE_LU_FACTORIZATION_LOG( x, ... )                                                       \
+    LOG( GlobalConfiguration::BASIS_FACTORIZATION_LOGGING, "DenseLUFactorization: %s\n", x )
+
+class DenseLUFactorization : public IBasisFactorization
+{
+public:
+    DenseLUFactorization( unsigned m, const BasisColumnOracle &basisColumnOracle );
+    ~DenseLUFactorization();
+
+    /*
+      Free any allocated memory.
+    */
+    void freeIfNeeded();
+
+    /*
+      Inform the basis factorization that the basis has been changed
+      by a pivot step. The change column is stored as an eta matrix.
+    */
+    void updateToAdjacentBasis( unsigned columnIndex,
+                                const double *changeColumn,
+                                const double * /* newColumn */ );
+
+    /*
+      Perform a forward transformation, i.e. find x such that Bx = y,
+      where B = B0 * E1 * ... * En. B0 is handled using its LU factors,
+      and then the etas are eliminated one by one.
+    */
+    void forwardTransformation( const double *y, double *x ) const;
+
+    /*
+      Perform a backward transformation, i.e. find x such that xB = y.
+      The etas are eliminated in reverse order, and then B0 is handled
+      using its LU factors.
+    */
+    void backwardTransformation( const double *y, double *x ) const;
+    void untrackedBackwardTransformation( const double *y, double *x ) const;
+
+    /*
+      Sparse right hand sides are scattered into work memory, and then
+      handled by the dense transformations.
+    */
+    void forwardTransformation( const SparseUnsortedList &y,
+                                double *x,
+                                unsigned *xIndices,
+                                unsigned &xNnz ) const;
+    void backwardTransformation( const SparseUnsortedList &y,
+                                 double *x,
+                                 unsigned *xIndices,
+                                 unsigned &xNnz ) const;
+
+    /*
+      Store and restore the basis factorization. Storing triggers
+      condensing the etas.
+    */
+    void storeFactorization( IBasisFactorization *other );
+    void restoreFactorization( const IBasisFactorization *other );
+
+    /*
+      Factorize the stored _B matrix into LU form.
+    */
+    void factorizeBasis();
+
+    /*
+      Ask the basis factorization to obtain a fresh basis
+      (through the previously-provided oracle).
+    */
+    void obtainFreshBasis();
+
+    /*
+      Return true iff the basis matrix B0 is explicitly available.
+    */
+    bool explicitBasisAvailable() const;
+
+    /*
+      Make the basis explicitly available
+    */
+    void makeExplicitBasisAvailable();
+
+    /*
+      Get the explicit basis matrix
+    */
+    const double *getBasis() const;
+    const SparseMatrix *getSparseBasis() const;
+
+    /*
+      Compute the inverse of B0, using the LU factors. This can only be
+      done when B0 is "fresh", i.e. when there are no stored etas.
+     */
+    void invertBasis( double *result );
+
+    /*
+      Have the Basis Factoriaztion object start reporting statistics.
+    */
+    void setStatistics( Statistics *statistics );
+
+public:
+    /*
+      Functions made public strictly for testing, not part of the interface
+    */
+    unsigned getNumberOfEtas() const;
+
+    /*
+      Debug
+    */
+    void dump() const;
+
+private:
+    /*
+      The dimension of the basis matrix.
+    */
+    unsigned _m;
+
+    /*
+      The basis matrix B0, in row-major order.
+    */
+    double *_B;
+
+    /*
+      The LU factors of B0, stored in place: P * B0 = L * U, where L is
+      unit lower triangular and is stored below the diagonal of _LU, and
+      U is upper triangular and is stored on and above the diagonal.
+      Row i of P * B0 is row _rowOrdering[i] of B0.
+
+      _LU is in row-major order, which gives contiguous access to the
+      rows of L and U that the backward transformation needs. _LUt is
+      its transpose, for contiguous access to the columns that the
+      forward transformation needs.
+    */
+    double *_LU;
+    double *_LUt;
+    unsigned *_rowOrdering;
+
+    /*
+      The eta matrices, stored consecutively: eta i replaces column
+      _etaColumnIndices[i], and its column starts at _etaColumns + i * m.
+    */
+    double *_etaColumns;
+    unsigned *_etaColumnIndices;
+    unsigned _numEtas;
+    unsigned _etaCapacity;
+
+    /*
+      Decides when the etas become too costly to keep, and the number
+      of operations of the last factorization
+    */
+    mutable RefactorizationPolicy _refactorizationPolicy;
+    unsigned long long _factorizationCost;
+
+    /*
+      Statistics collection
+    */
+    Statistics *_statistics;
+
+    /*
+      Work memory.
+    */
+    mutable double *_work;
+    mutable double *_z;
+
+    /*
+      Clear a previous factorization.
+    */
+    void clearFactorization();
+
+    /*
+      Make room for at least one more eta matrix.
+    */
+    void reserveEta();
+
+    /*
+      Solve L * U * w = w and w * L * U = w, in place, for the LU
+      factors of B0.
+    */
+    void luForwardTransformation( double *w ) const;
+    void luBackwardTransformation( double *w ) const;
+
+    /*
+      The number of entries that a transformation visits.
+    */
+    unsigned long long getFactorsSize() const;
+};
+
+#endif // __DenseLUFactorization_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
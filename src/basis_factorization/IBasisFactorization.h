@@ -16,9 +16,10 @@
 #ifndef __IBasisFactorization_h__
 #define __IBasisFactorization_h__
 
+#include "SparseUnsortedList.h"
+
 class SparseColumnsOfBasis;
 class SparseMatrix;
-class SparseUnsortedList;
 class Statistics;
 
 class IBasisFactorization
@@ -78,6 +79,56 @@ public:
     */
     virtual void backwardTransformation( const double *y, double *x ) const = 0;
 
+    /*
+      A backward transformation that is not part of the simplex
+      iterations, e.g. computing a row of inv(B) for bound tightening.
+      Factorizations that decide when to refactorize according to the
+      cost of their transformations do not take it into account.
+    */
+    virtual void untrackedBackwardTransformation( const double *y, double *x ) const
+    {
+        backwardTransformation( y, x );
+    }
+
+    /*
+      Hypersparse variants of the transformations, for a sparse right hand
+      side y. The dense result x must be all zeros on entry; on exit, the
+      first xNnz entries of xIndices list the entries of x that may be
+      non-zero, and all other entries of x are zero. xIndices needs to be of
+      size m.
+
+      Factorizations that support it only visit the parts of the factors
+      that are reachable from the non-zero entries of y. The default
+      implementation falls back on the dense transformations.
+    */
+    virtual void forwardTransformation( const SparseUnsortedList &y,
+                                        double *x,
+                                        unsigned *xIndices,
+                                        unsigned &xNnz ) const
+    {
+        unsigned m = y.getSize();
+        double *dense = new double[m];
+        y.toDense( dense );
+        forwardTransformation( dense, x );
+        delete[] dense;
+
+        listNonZeros( m, x, xIndices, xNnz );
+    }
+
+    virtual void backwardTransformation( const SparseUnsortedList &y,
+                                         double *x,
+                                         unsigned *xIndices,
+                                         unsigned &xNnz ) const
+    {
+        unsigned m = y.getSize();
+        double *dense = new double[m];
+        y.toDense( dense );
+        backwardTransformation( dense, x );
+        delete[] dense;
+
+        listNonZeros( m, x, xIndices, xNnz );
+    }
+
     /*
       Store/restore the basis factorization.
     */
@@ -123,6 +174,16 @@ public:
 
 protected:
     const BasisColumnOracle *_basisColumnOracle;
+
+    static void listNonZeros( unsigned m, const double *x, unsigned *xIndices, unsigned &xNnz )
+    {
+        xNnz = 0;
+        for ( unsigned i = 0; i < m; ++i )
+        {
+            if ( x[i] != 0.0 )
+                xIndices[xNnz++] = i;
+        }
+    }
 };
 
 #endif // __IBasisFactorization_h__
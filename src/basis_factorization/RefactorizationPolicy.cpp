@@ -0,0 +1,106 @@
+/*********************                                                        */
+/*! \file RefactorizationPolicy.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "RefactorizationPolicy.h"
+
+#include "GlobalConfiguration.h"
+
+RefactorizationPolicy::RefactorizationPolicy()
+    : _factorizationCost( 0 )
+    , _factorsSize( 0 )
+    , _numUpdates( 0 )
+    , _numTransformations( 0 )
+    , _transformationCost( 0 )
+    , _statistics( NULL )
+{
+}
+
+void RefactorizationPolicy::factorizationPerformed( unsigned long long cost,
+                                                    unsigned long long factorsSize )
+{
+    _factorizationCost = cost;
+    _factorsSize = factorsSize;
+
+    _numUpdates = 0;
+    _numTransformations = 0;
+    _transformationCost = 0;
+}
+
+void RefactorizationPolicy::updatePerformed( unsigned long long factorsSize )
+{
+    _factorsSize = factorsSize;
+    ++_numUpdates;
+}
+
+void RefactorizationPolicy::transformationPerformed()
+{
+    ++_numTransformations;
+    _transformationCost += _factorsSize;
+}
+
+void RefactorizationPolicy::transformationExcluded()
+{
+    if ( _numTransformations == 0 )
+        return;
+
+    --_numTransformations;
+    _transformationCost -= _factorsSize;
+}
+
+bool RefactorizationPolicy::shouldRefactorize( unsigned numEtas )
+{
+    Statistics::StatisticsLongAttribute reason;
+
+    if ( numEtas >= GlobalConfiguration::REFACTORIZATION_MAX_ETAS )
+        reason = Statistics::NUM_REFACTORIZATIONS_DUE_TO_ETA_LIMIT;
+    else
+    {
+        /*
+          Had all the transformations so far been performed with the
+          current factors, they would have cost _factorsSize each. The
+          difference from their actual cost is the cost of the growth
+          of the factors. Once it exceeds the cost of refactorizing,
+          the average cost per transformation (including the
+          refactorization) only increases from here on.
+        */
+        unsigned long long costAtCurrentSize = _factorsSize * _numTransformations;
+        if ( costAtCurrentSize <= _transformationCost + _factorizationCost )
+            return false;
+
+        reason = Statistics::NUM_REFACTORIZATIONS_DUE_TO_SOLVE_COST;
+    }
+
+    if ( _statistics )
+    {
+        _statistics->incLongAttribute( reason );
+        _statistics->incLongAttribute( Statistics::NUM_BASIS_UPDATES_BEFORE_REFACTORIZATION,
+                                       _numUpdates );
+    }
+
+    return true;
+}
+
+void RefactorizationPolicy::setStatistics( Statistics *statistics )
+{
+    _statistics = statistics;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
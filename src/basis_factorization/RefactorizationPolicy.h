@@ -0,0 +1,104 @@
+/*********************                                                        */
+/*! \file RefactorizationPolicy.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** Decides when a basis factorization should be computed from scratch,
+ ** instead of being updated once more.
+ **
+ ** Every update makes the factors (and the eta file) larger, and so
+ ** every subsequent forward and backward transformation more
+ ** expensive; whereas a refactorization has a one-time cost. The
+ ** policy tracks both costs, measured as the number of matrix entries
+ ** that are visited, and refactorizes when the extra cost that the
+ ** updates have caused the transformations exceeds the cost of the last
+ ** refactorization. This minimizes the amortized cost per iteration
+ ** when the factors grow at a steady rate, and adapts the number of
+ ** updates between refactorizations to the size and density of the
+ ** basis. A hard limit on the number of etas is kept as a safeguard.
+
+ **/
+
+#ifndef __RefactorizationPolicy_h__
+#define __RefactorizationPolicy_h__
+
+#include "Statistics.h"
+
+class RefactorizationPolicy
+{
+public:
+    RefactorizationPolicy();
+
+    /*
+      A factorization was computed from scratch, with the given cost,
+      and the resulting factors have the given number of non-zeros
+    */
+    void factorizationPerformed( unsigned long long cost, unsigned long long factorsSize );
+
+    /*
+      The factors were updated, and now have the given size
+    */
+    void updatePerformed( unsigned long long factorsSize );
+
+    /*
+      A forward or a backward transformation was performed, using the
+      current factors
+    */
+    void transformationPerformed();
+
+    /*
+      The last transformation was not performed on behalf of the
+      simplex iterations (e.g., it was performed for bound tightening
+      right after a refactorization), and is not representative of the
+      transformations that follow. Do not take it into account.
+    */
+    void transformationExcluded();
+
+    /*
+      Invoked before an update: return true if the basis should be
+      refactorized instead. The decision is reported to the statistics.
+    */
+    bool shouldRefactorize( unsigned numEtas );
+
+    /*
+      Have the policy start reporting statistics.
+    */
+    void setStatistics( Statistics *statistics );
+
+private:
+    /*
+      The cost of the last refactorization, and the current size of
+      the factors
+    */
+    unsigned long long _factorizationCost;
+    unsigned long long _factorsSize;
+
+    /*
+      The number of updates and transformations performed since the
+      last refactorization, and the total cost of those transformations
+    */
+    unsigned _numUpdates;
+    unsigned long long _numTransformations;
+    unsigned long long _transformationCost;
+
+    /*
+      An object for reporting statistics
+    */
+    Statistics *_statistics;
+};
+
+#endif // __RefactorizationPolicy_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -33,6 +33,9 @@ SparseFTFactorization::SparseFTFactorization( unsigned m,
     , _z2( NULL )
     , _z3( NULL )
     , _z4( NULL )
+    , _sparseWorkVector( NULL )
+    , _sparseWorkIndices( NULL )
+    , _sparseWorkMarks( NULL )
 {
     _z1 = new double[m];
     if ( !_z1 )
@@ -53,6 +56,23 @@ SparseFTFactorization::SparseFTFactorization( unsigned m,
     if ( !_z4 )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
                                        "SparseFTFactorization::z4" );
+
+    _sparseWorkVector = new double[m];
+    if ( !_sparseWorkVector )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseFTFactorization::sparseWorkVector" );
+    std::fill_n( _sparseWorkVector, m, 0 );
+
+    _sparseWorkIndices = new unsigned[m];
+    if ( !_sparseWorkIndices )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseFTFactorization::sparseWorkIndices" );
+
+    _sparseWorkMarks = new bool[m];
+    if ( !_sparseWorkMarks )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseFTFactorization::sparseWorkMarks" );
+    std::fill_n( _sparseWorkMarks, m, false );
 }
 
 SparseFTFactorization::~SparseFTFactorization()
@@ -87,6 +107,24 @@ void SparseFTFactorization::freeIfNeeded()
         delete[] _z4;
         _z4 = NULL;
     }
+
+    if ( _sparseWorkVector )
+    {
+        delete[] _sparseWorkVector;
+        _sparseWorkVector = NULL;
+    }
+
+    if ( _sparseWorkIndices )
+    {
+        delete[] _sparseWorkIndices;
+        _sparseWorkIndices = NULL;
+    }
+
+    if ( _sparseWorkMarks )
+    {
+        delete[] _sparseWorkMarks;
+        _sparseWorkMarks = NULL;
+    }
 }
 
 const double *SparseFTFactorization::getBasis() const
@@ -105,18 +143,24 @@ void SparseFTFactorization::updateToAdjacentBasis( unsigned columnIndex,
                                                    const double * /* changeColumn */,
                                                    const double *newColumn )
 {
-    // q = columnIndex
-    // s = uColumnIndex
-    // p = vRowDiagonalIndex
-    // t = lastNonZeroEntryInU
-
-    if ( _etas.size() > GlobalConfiguration::REFACTORIZATION_THRESHOLD )
+    if ( _refactorizationPolicy.shouldRefactorize( _etas.size() ) )
     {
         obtainFreshBasis();
         return;
     }
 
     fixPForL();
+    performForrestTomlinUpdate( columnIndex, newColumn );
+    _refactorizationPolicy.updatePerformed( getFactorsSize() );
+}
+
+void SparseFTFactorization::performForrestTomlinUpdate( unsigned columnIndex,
+                                                        const double *newColumn )
+{
+    // q = columnIndex
+    // s = uColumnIndex
+    // p = vRowDiagonalIndex
+    // t = lastNonZeroEntryInU
 
     /*
       The columnIndex column of B needs to be replaced with the new column.
@@ -319,6 +363,8 @@ void SparseFTFactorization::forwardTransformation( const double *y, double *x )
         B = FHV
     */
 
+    _refactorizationPolicy.transformationPerformed();
+
     // Eliminate F
     _sparseLUFactors.fForwardTransformation( y, _z1 );
 
@@ -337,6 +383,8 @@ void SparseFTFactorization::backwardTransformation( const double *y, double *x )
         B = FHV
     */
 
+    _refactorizationPolicy.transformationPerformed();
+
     // Eliminate V
     _sparseLUFactors.vBackwardTransformation( y, _z1 );
 
@@ -347,6 +395,95 @@ void SparseFTFactorization::backwardTransformation( const double *y, double *x )
     _sparseLUFactors.fBackwardTransformation( _z2, x );
 }
 
+void SparseFTFactorization::untrackedBackwardTransformation( const double *y, double *x ) const
+{
+    backwardTransformation( y, x );
+    _refactorizationPolicy.transformationExcluded();
+}
+
+bool SparseFTFactorization::isHypersparse( unsigned nnz ) const
+{
+    return nnz <= GlobalConfiguration::HYPERSPARSE_TRANSFORMATION_DENSITY_THRESHOLD * _m;
+}
+
+void SparseFTFactorization::forwardTransformation( const SparseUnsortedList &y,
+                                                   double *x,
+                                                   unsigned *xIndices,
+                                                   unsigned &xNnz ) const
+{
+    if ( !isHypersparse( y.getNnz() ) )
+    {
+        IBasisFactorization::forwardTransformation( y, x, xIndices, xNnz );
+        return;
+    }
+
+    _refactorizationPolicy.transformationPerformed();
+
+    unsigned nnz = 0;
+    for ( const auto &entry : y )
+    {
+        _sparseWorkVector[entry._index] = entry._value;
+        _sparseWorkIndices[nnz++] = entry._index;
+    }
+
+    // Eliminate F and H, in place
+    _sparseLUFactors.fForwardTransformation( _sparseWorkVector, _sparseWorkIndices, nnz );
+    hForwardTransformation( _sparseWorkVector, _sparseWorkIndices, nnz );
+
+    // Eliminate V
+    if ( isHypersparse( nnz ) )
+        _sparseLUFactors.vForwardTransformation(
+            _sparseWorkVector, _sparseWorkIndices, nnz, x, xIndices, xNnz );
+    else
+    {
+        _sparseLUFactors.vForwardTransformation( _sparseWorkVector, x );
+        listNonZeros( _m, x, xIndices, xNnz );
+    }
+
+    for ( unsigned i = 0; i < nnz; ++i )
+        _sparseWorkVector[_sparseWorkIndices[i]] = 0;
+}
+
+void SparseFTFactorization::backwardTransformation( const SparseUnsortedList &y,
+                                                    double *x,
+                                                    unsigned *xIndices,
+                                                    unsigned &xNnz ) const
+{
+    if ( !isHypersparse( y.getNnz() ) )
+    {
+        IBasisFactorization::backwardTransformation( y, x, xIndices, xNnz );
+        return;
+    }
+
+    _refactorizationPolicy.transformationPerformed();
+
+    unsigned nnz = 0;
+    for ( const auto &entry : y )
+    {
+        _sparseWorkVector[entry._index] = entry._value;
+        _sparseWorkIndices[nnz++] = entry._index;
+    }
+
+    // Eliminate V
+    _sparseLUFactors.vBackwardTransformation(
+        _sparseWorkVector, _sparseWorkIndices, nnz, x, xIndices, xNnz );
+
+    for ( unsigned i = 0; i < nnz; ++i )
+        _sparseWorkVector[_sparseWorkIndices[i]] = 0;
+
+    if ( !isHypersparse( xNnz ) )
+    {
+        hBackwardTransformation( x, _z1 );
+        _sparseLUFactors.fBackwardTransformation( _z1, x );
+        listNonZeros( _m, x, xIndices, xNnz );
+        return;
+    }
+
+    // Eliminate H and F, in place
+    hBackwardTransformation( x, xIndices, xNnz );
+    _sparseLUFactors.fBackwardTransformation( x, xIndices, xNnz );
+}
+
 void SparseFTFactorization::clearFactorization()
 {
     List<SparseEtaMatrix *>::iterator it;
@@ -372,10 +509,22 @@ void SparseFTFactorization::factorizeBasis()
             throw e;
     }
 
+    _refactorizationPolicy.factorizationPerformed( _sparseGaussianEliminator.getCost(),
+                                                   getFactorsSize() );
+
     if ( _statistics )
         _statistics->incLongAttribute( Statistics::NUM_BASIS_REFACTORIZATIONS );
 }
 
+unsigned long long SparseFTFactorization::getFactorsSize() const
+{
+    unsigned long long size = _sparseLUFactors._F->getNnz() + _sparseLUFactors._V->getNnz();
+    for ( const auto &eta : _etas )
+        size += eta->_sparseColumn.size();
+
+    return size;
+}
+
 void SparseFTFactorization::storeFactorization( IBasisFactorization *other )
 {
     SparseFTFactorization *otherSparseFTFactorization = (SparseFTFactorization *)other;
@@ -386,6 +535,8 @@ void SparseFTFactorization::storeFactorization( IBasisFactorization *other )
 
     // Store the new basis and factorization
     _sparseLUFactors.storeToOther( &otherSparseFTFactorization->_sparseLUFactors );
+    otherSparseFTFactorization->_refactorizationPolicy.factorizationPerformed(
+        _sparseGaussianEliminator.getCost(), otherSparseFTFactorization->getFactorsSize() );
 }
 
 void SparseFTFactorization::restoreFactorization( const IBasisFactorization *other )
@@ -400,6 +551,10 @@ void SparseFTFactorization::restoreFactorization( const IBasisFactorization *oth
 
     // Store the new basis and factorization
     otherSparseFTFactorization->_sparseLUFactors.storeToOther( &_sparseLUFactors );
+
+    // The factors were computed from scratch, at about the cost of the last factorization
+    _refactorizationPolicy.factorizationPerformed( _sparseGaussianEliminator.getCost(),
+                                                   getFactorsSize() );
 }
 
 void SparseFTFactorization::invertBasis( double *result )
@@ -483,6 +638,65 @@ void SparseFTFactorization::hBackwardTransformation( const double *y, double *x
     }
 }
 
+void SparseFTFactorization::hForwardTransformation( double *x,
+                                                    unsigned *indices,
+                                                    unsigned &nnz ) const
+{
+    for ( unsigned i = 0; i < nnz; ++i )
+        _sparseWorkMarks[indices[i]] = true;
+
+    for ( const auto &eta : _etas )
+    {
+        unsigned pivotIndex = eta->_columnIndex;
+        double delta = 0;
+
+        for ( const auto &entry : eta->_sparseColumn )
+            delta += entry._value * x[entry._index];
+
+        if ( delta == 0.0 )
+            continue;
+
+        x[pivotIndex] -= delta;
+        if ( !_sparseWorkMarks[pivotIndex] )
+        {
+            _sparseWorkMarks[pivotIndex] = true;
+            indices[nnz++] = pivotIndex;
+        }
+    }
+
+    for ( unsigned i = 0; i < nnz; ++i )
+        _sparseWorkMarks[indices[i]] = false;
+}
+
+void SparseFTFactorization::hBackwardTransformation( double *x,
+                                                     unsigned *indices,
+                                                     unsigned &nnz ) const
+{
+    for ( unsigned i = 0; i < nnz; ++i )
+        _sparseWorkMarks[indices[i]] = true;
+
+    for ( auto eta = _etas.rbegin(); eta != _etas.rend(); ++eta )
+    {
+        double pivotValue = x[( *eta )->_columnIndex];
+        if ( pivotValue == 0.0 )
+            continue;
+
+        for ( const auto &entry : ( *eta )->_sparseColumn )
+        {
+            unsigned entryIndex = entry._index;
+            x[entryIndex] -= entry._value * pivotValue;
+            if ( !_sparseWorkMarks[entryIndex] )
+            {
+                _sparseWorkMarks[entryIndex] = true;
+                indices[nnz++] = entryIndex;
+            }
+        }
+    }
+
+    for ( unsigned i = 0; i < nnz; ++i )
+        _sparseWorkMarks[indices[i]] = false;
+}
+
 void SparseFTFactorization::fixPForL()
 {
     if ( !_sparseLUFactors._usePForF )
@@ -559,6 +773,7 @@ void SparseFTFactorization::setStatistics( Statistics *statistics )
 {
     _statistics = statistics;
     _sparseGaussianEliminator.setStatistics( statistics );
+    _refactorizationPolicy.setStatistics( statistics );
 }
 
 //
@@ -17,6 +17,7 @@
 #define __SparseFTFactorization_h__
 
 #include "IBasisFactorization.h"
+#include "RefactorizationPolicy.h"
 #include "SparseColumnsOfBasis.h"
 #include "SparseEtaMatrix.h"
 #include "SparseGaussianEliminator.h"
@@ -71,6 +72,22 @@ public:
       The solution is found by solving xB = y.
     */
     void backwardTransformation( const double *y, double *x ) const;
+    void untrackedBackwardTransformation( const double *y, double *x ) const;
+
+    /*
+      Hypersparse variants of the transformations: the F, H and V factors
+      are only visited along the entries reachable from the non-zero
+      entries of y. If the intermediate results become too dense, the
+      dense transformations take over.
+    */
+    void forwardTransformation( const SparseUnsortedList &y,
+                                double *x,
+                                unsigned *xIndices,
+                                unsigned &xNnz ) const;
+    void backwardTransformation( const SparseUnsortedList &y,
+                                 double *x,
+                                 unsigned *xIndices,
+                                 unsigned &xNnz ) const;
 
     /*
       Store and restore the basis factorization.
@@ -132,6 +149,12 @@ private:
     */
     SparseGaussianEliminator _sparseGaussianEliminator;
 
+    /*
+      Decides when to refactorize, based on the cost of the
+      transformations as the factors grow
+    */
+    mutable RefactorizationPolicy _refactorizationPolicy;
+
     /*
       An object for reporting statistics
     */
@@ -145,12 +168,34 @@ private:
     double *_z3;
     double *_z4;
 
+    /*
+      Work memory for the hypersparse transformations: a vector that is
+      kept all zero between calls, the list of its non-zero entries, and
+      marks (kept all false) for the entries in that list.
+    */
+    mutable double *_sparseWorkVector;
+    mutable unsigned *_sparseWorkIndices;
+    mutable bool *_sparseWorkMarks;
+
     /*
       Transformations on the H matrix (the list of etas)
     */
     void hForwardTransformation( const double *y, double *x ) const;
     void hBackwardTransformation( const double *y, double *x ) const;
 
+    /*
+      Transformations on the H matrix, in place, on a vector whose
+      non-zero entries are listed in indices
+    */
+    void hForwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const;
+    void hBackwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const;
+
+    /*
+      Return true iff a vector with the given number of non-zero entries
+      is sparse enough for the hypersparse transformations to pay off
+    */
+    bool isHypersparse( unsigned nnz ) const;
+
     /*
       Free any allocated memory.
     */
@@ -161,6 +206,17 @@ private:
     */
     void factorizeBasis();
 
+    /*
+      Replace a column of the basis in the factors (steps 1-6 of
+      updateToAdjacentBasis)
+    */
+    void performForrestTomlinUpdate( unsigned columnIndex, const double *newColumn );
+
+    /*
+      The total number of non-zero entries in F, V and the etas
+    */
+    unsigned long long getFactorsSize() const;
+
     /*
       Compute the inverse of B0, using the LP factorization already stored.
     */
@@ -22,16 +22,159 @@
 #include "GlobalConfiguration.h"
 #include "MStringf.h"
 #include "MalformedBasisException.h"
+#include "TimeUtils.h"
 
+#include <algorithm>
 #include <cstdio>
 
+SparseGaussianEliminator::CountLists::CountLists( unsigned m )
+    : _m( m )
+    , _count( NULL )
+    , _first( NULL )
+    , _next( NULL )
+    , _previous( NULL )
+    , _active( NULL )
+{
+    _count = new unsigned[_m];
+    if ( !_count )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseGaussianEliminator::CountLists::count" );
+
+    // Counts range from 0 to m
+    _first = new unsigned[_m + 1];
+    if ( !_first )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseGaussianEliminator::CountLists::first" );
+
+    _next = new unsigned[_m];
+    if ( !_next )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseGaussianEliminator::CountLists::next" );
+
+    _previous = new unsigned[_m];
+    if ( !_previous )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseGaussianEliminator::CountLists::previous" );
+
+    _active = new bool[_m];
+    if ( !_active )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseGaussianEliminator::CountLists::active" );
+
+    clear();
+}
+
+SparseGaussianEliminator::CountLists::~CountLists()
+{
+    if ( _count )
+    {
+        delete[] _count;
+        _count = NULL;
+    }
+
+    if ( _first )
+    {
+        delete[] _first;
+        _first = NULL;
+    }
+
+    if ( _next )
+    {
+        delete[] _next;
+        _next = NULL;
+    }
+
+    if ( _previous )
+    {
+        delete[] _previous;
+        _previous = NULL;
+    }
+
+    if ( _active )
+    {
+        delete[] _active;
+        _active = NULL;
+    }
+}
+
+void SparseGaussianEliminator::CountLists::clear()
+{
+    std::fill_n( _first, _m + 1, NONE );
+    std::fill_n( _active, _m, false );
+}
+
+void SparseGaussianEliminator::CountLists::insert( unsigned index, unsigned count )
+{
+    ASSERT( !_active[index] );
+    ASSERT( count <= _m );
+
+    _count[index] = count;
+    _active[index] = true;
+
+    _previous[index] = NONE;
+    _next[index] = _first[count];
+    if ( _first[count] != NONE )
+        _previous[_first[count]] = index;
+    _first[count] = index;
+}
+
+void SparseGaussianEliminator::CountLists::remove( unsigned index )
+{
+    ASSERT( _active[index] );
+
+    if ( _previous[index] != NONE )
+        _next[_previous[index]] = _next[index];
+    else
+        _first[_count[index]] = _next[index];
+
+    if ( _next[index] != NONE )
+        _previous[_next[index]] = _previous[index];
+
+    _active[index] = false;
+}
+
+void SparseGaussianEliminator::CountLists::update( unsigned index, unsigned count )
+{
+    if ( _count[index] == count )
+        return;
+
+    remove( index );
+    insert( index, count );
+}
+
+bool SparseGaussianEliminator::CountLists::isActive( unsigned index ) const
+{
+    return _active[index];
+}
+
+unsigned SparseGaussianEliminator::CountLists::getCount( unsigned index ) const
+{
+    return _count[index];
+}
+
+unsigned SparseGaussianEliminator::CountLists::getFirst( unsigned count ) const
+{
+    return _first[count];
+}
+
+unsigned SparseGaussianEliminator::CountLists::getNext( unsigned index ) const
+{
+    return _next[index];
+}
+
 SparseGaussianEliminator::SparseGaussianEliminator( unsigned m )
     : _m( m )
     , _work( NULL )
     , _work2( NULL )
+    , _pivotRowColumns( NULL )
+    , _pivotRowNnz( 0 )
+    , _rowColumns( NULL )
+    , _rowNnz( 0 )
+    , _inRow( NULL )
     , _statistics( NULL )
-    , _numURowElements( NULL )
-    , _numUColumnElements( NULL )
+    , _rowCounts( m )
+    , _columnCounts( m )
+    , _cost( 0 )
 {
     _work = new double[_m];
     if ( !_work )
@@ -43,15 +186,20 @@ SparseGaussianEliminator::SparseGaussianEliminator( unsigned m )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
                                        "SparseGaussianEliminator::work2" );
 
-    _numURowElements = new unsigned[_m];
-    if ( !_numURowElements )
+    _pivotRowColumns = new unsigned[_m];
+    if ( !_pivotRowColumns )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseGaussianEliminator::pivotRowColumns" );
+
+    _rowColumns = new unsigned[_m];
+    if ( !_rowColumns )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
-                                       "SparseGaussianEliminator::numURowElements" );
+                                       "SparseGaussianEliminator::rowColumns" );
 
-    _numUColumnElements = new unsigned[_m];
-    if ( !_numUColumnElements )
+    _inRow = new bool[_m];
+    if ( !_inRow )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
-                                       "SparseGaussianEliminator::numUColumnElements" );
+                                       "SparseGaussianEliminator::inRow" );
 }
 
 SparseGaussianEliminator::~SparseGaussianEliminator()
@@ -68,16 +216,22 @@ SparseGaussianEliminator::~SparseGaussianEliminator()
         _work2 = NULL;
     }
 
-    if ( _numURowElements )
+    if ( _pivotRowColumns )
+    {
+        delete[] _pivotRowColumns;
+        _pivotRowColumns = NULL;
+    }
+
+    if ( _rowColumns )
     {
-        delete[] _numURowElements;
-        _numURowElements = NULL;
+        delete[] _rowColumns;
+        _rowColumns = NULL;
     }
 
-    if ( _numUColumnElements )
+    if ( _inRow )
     {
-        delete[] _numUColumnElements;
-        _numUColumnElements = NULL;
+        delete[] _inRow;
+        _inRow = NULL;
     }
 }
 
@@ -106,8 +260,19 @@ void SparseGaussianEliminator::initializeFactorization( const SparseColumnsOfBas
     _sparseLUFactors->_P.resetToIdentity();
     _sparseLUFactors->_Q.resetToIdentity();
 
-    // Count number of non-zeros in U ( = V )
-    _sparseLUFactors->_V->countElements( _numURowElements, _numUColumnElements );
+    // Initially, all of V is active
+    _rowCounts.clear();
+    _columnCounts.clear();
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        _rowCounts.insert( i, _sparseLUFactors->_V->getRow( i )->getNnz() );
+        _columnCounts.insert( i, _sparseLUFactors->_Vt->getRow( i )->getNnz() );
+    }
+
+    // The work memory is kept zeroed between uses
+    std::fill_n( _work, _m, 0 );
+    std::fill_n( _work2, _m, 0 );
+    std::fill_n( _inRow, _m, false );
 
     // Use same matrix P for L and V
     _sparseLUFactors->_usePForF = false;
@@ -123,27 +288,39 @@ void SparseGaussianEliminator::permute()
 
     _sparseLUFactors->_P.swapColumns( _uPivotRow, _eliminationStep );
     _sparseLUFactors->_Q.swapRows( _uPivotColumn, _eliminationStep );
-
-    // Adjust the element counters
-    unsigned temp;
-    temp = _numURowElements[_uPivotRow];
-    _numURowElements[_uPivotRow] = _numURowElements[_eliminationStep];
-    _numURowElements[_eliminationStep] = temp;
-
-    temp = _numUColumnElements[_uPivotColumn];
-    _numUColumnElements[_uPivotColumn] = _numUColumnElements[_eliminationStep];
-    _numUColumnElements[_eliminationStep] = temp;
 }
 
 void SparseGaussianEliminator::run( const SparseColumnsOfBasis *A,
                                     SparseLUFactors *sparseLUFactors )
 {
+    struct timespec start = TimeUtils::sampleMicro();
+
     // Initialize the LU factors
     initializeFactorization( A, sparseLUFactors );
+    unsigned inputNnz = _sparseLUFactors->_V->getNnz();
+
+    // Building V and Vt, and the bookkeeping of the rows and columns
+    _cost = 2 * inputNnz + 4 * _m;
 
     // Do the work
     factorize();
 
+    if ( _statistics )
+    {
+        // F's diagonal is implicit, V's is stored
+        unsigned factorsNnz = _sparseLUFactors->_F->getNnz() + _sparseLUFactors->_V->getNnz();
+
+        _statistics->incLongAttribute( Statistics::NUM_BASIS_FACTORIZATION_INPUT_NONZEROS,
+                                       inputNnz );
+        if ( factorsNnz > inputNnz )
+            _statistics->incLongAttribute( Statistics::NUM_BASIS_FACTORIZATION_FILL_IN,
+                                           factorsNnz - inputNnz );
+
+        struct timespec end = TimeUtils::sampleMicro();
+        _statistics->incLongAttribute( Statistics::TIME_BASIS_FACTORIZATION_MICRO,
+                                       TimeUtils::timePassed( start, end ) );
+    }
+
     // DEBUG({
     //         // Check that the factorization is correct
     //         double *product = new double[_m * _m];
@@ -211,183 +388,235 @@ void SparseGaussianEliminator::choosePivot()
 {
     SGAUSSIAN_LOG( "Choose pivot invoked" );
 
+    // An empty row or column in the active submatrix means the matrix is singular
+    if ( _columnCounts.getFirst( 0 ) != CountLists::NONE )
+        throw BasisFactorizationError( BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED,
+                                       "Have a zero column" );
+
+    if ( _rowCounts.getFirst( 0 ) != CountLists::NONE )
+        throw BasisFactorizationError( BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED,
+                                       "Have a zero row" );
+
+    // Singletons cause no fill-in; slack-heavy bases are mostly singletons
+    if ( chooseSingletonPivot() )
+        return;
+
     /*
       Apply the Markowitz rule: in the active sub-matrix,
       let p_i denote the number of non-zero elements in the i'th
       equation, and let q_j denote the number of non-zero elements
       in the q'th column.
 
-      We pick a pivot a_ij \neq 0 that minimizes (p_i - 1)(q_i - 1).
-    */
+      We pick a pivot a_ij \neq 0 that minimizes (p_i - 1)(q_i - 1),
+      among the elements whose magnitude is within an acceptable
+      factor of the largest element in their column.
 
-    const SparseUnsortedArray *sparseRow;
-    const SparseUnsortedArray *sparseColumn;
-    const SparseUnsortedArray::Entry *entry;
-    unsigned nnz;
+      Columns and rows are inspected in order of increasing count.
+      When inspecting the columns with count k, any element not yet
+      considered has a cost of at least (k - 1)^2, and when
+      inspecting the rows with count k, at least (k - 1)k; so the
+      search stops once it cannot improve. It also stops after a few
+      more rows and columns once an acceptable pivot has been found.
+    */
+    _pivotFound = false;
+    _minimalCost = 0;
+    _absPivotElement = 0.0;
+    unsigned searched = 0;
 
-    // If there's a singleton row, use it as the pivot row
-    for ( unsigned i = _eliminationStep; i < _m; ++i )
+    for ( unsigned count = 2; count <= _m; ++count )
     {
-        if ( _numURowElements[i] == 1 )
+        for ( unsigned vColumn = _columnCounts.getFirst( count ); vColumn != CountLists::NONE;
+              vColumn = _columnCounts.getNext( vColumn ) )
         {
-            _uPivotRow = i;
-            _vPivotRow = _sparseLUFactors->_P._columnOrdering[i];
+            if ( _pivotFound && ( _minimalCost <= ( count - 1 ) * ( count - 1 ) ||
+                                  searched >= GlobalConfiguration::
+                                                  GAUSSIAN_ELIMINATION_MARKOWITZ_SEARCH_LIMIT ) )
+                break;
+
+            inspectColumn( vColumn );
+            if ( _pivotFound )
+                ++searched;
+        }
 
-            // Get the singleton element
-            sparseRow = _sparseLUFactors->_V->getRow( _vPivotRow );
+        for ( unsigned vRow = _rowCounts.getFirst( count ); vRow != CountLists::NONE;
+              vRow = _rowCounts.getNext( vRow ) )
+        {
+            if ( _pivotFound && ( _minimalCost <= ( count - 1 ) * count ||
+                                  searched >= GlobalConfiguration::
+                                                  GAUSSIAN_ELIMINATION_MARKOWITZ_SEARCH_LIMIT ) )
+                break;
+
+            inspectRow( vRow );
+            if ( _pivotFound )
+                ++searched;
+        }
 
-            ASSERT( sparseRow->getNnz() == 1U );
+        if ( _pivotFound &&
+             ( _minimalCost <= count * count ||
+               searched >= GlobalConfiguration::GAUSSIAN_ELIMINATION_MARKOWITZ_SEARCH_LIMIT ) )
+            break;
+    }
 
-            entry = sparseRow->getArray();
+    if ( !_pivotFound )
+        throw BasisFactorizationError( BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED,
+                                       "Couldn't find a pivot" );
 
-            _vPivotColumn = entry->_index;
-            _uPivotColumn = _sparseLUFactors->_Q._columnOrdering[_vPivotColumn];
-            _pivotElement = entry->_value;
+    SGAUSSIAN_LOG( Stringf( "Choose pivot selected a pivot: V[%u,%u] = %lf (cost %u)",
+                            _vPivotRow,
+                            _vPivotColumn,
+                            _pivotElement,
+                            _minimalCost )
+                       .ascii() );
+}
 
-            SGAUSSIAN_LOG( Stringf( "Choose pivot selected a pivot (singleton row): V[%u,%u] = %lf",
-                                    _vPivotRow,
-                                    _vPivotColumn,
-                                    _pivotElement )
-                               .ascii() );
-            return;
-        }
-    }
+bool SparseGaussianEliminator::chooseSingletonPivot()
+{
+    const SparseUnsortedArray::Entry *entry;
+    unsigned nnz;
 
     // If there's a singleton column, use it as the pivot column
-    for ( unsigned i = _eliminationStep; i < _m; ++i )
+    unsigned vColumn = _columnCounts.getFirst( 1 );
+    if ( vColumn != CountLists::NONE )
     {
-        if ( _numUColumnElements[i] == 1 )
-        {
-            _uPivotColumn = i;
-            _vPivotColumn = _sparseLUFactors->_Q._rowOrdering[i];
-
-            // Get the singleton element
-            sparseColumn = _sparseLUFactors->_Vt->getRow( _vPivotColumn );
-            entry = sparseColumn->getArray();
-            nnz = sparseColumn->getNnz();
-
-            // There may be some elements in higher rows - we need just the one
-            // in the active submatrix.
-
-            DEBUG( bool found = false; );
+        // There may be some elements in higher rows - we need just the one
+        // in the active submatrix.
+        const SparseUnsortedArray *sparseColumn = _sparseLUFactors->_Vt->getRow( vColumn );
+        entry = sparseColumn->getArray();
+        nnz = sparseColumn->getNnz();
 
-            for ( unsigned i = 0; i < nnz; ++i )
+        for ( unsigned i = 0; i < nnz; ++i )
+        {
+            if ( _rowCounts.isActive( entry[i]._index ) )
             {
-                unsigned vRow = entry[i]._index;
-                unsigned uRow = _sparseLUFactors->_P._rowOrdering[vRow];
+                setPivot( entry[i]._index, vColumn, entry[i]._value );
+                break;
+            }
+        }
 
-                if ( uRow >= _eliminationStep )
-                {
-                    DEBUG( found = true; );
+        SGAUSSIAN_LOG( Stringf( "Choose pivot selected a pivot (singleton column): V[%u,%u] = %lf",
+                                _vPivotRow,
+                                _vPivotColumn,
+                                _pivotElement )
+                           .ascii() );
+    }
+    else
+    {
+        // If there's a singleton row, use it as the pivot row
+        unsigned vRow = _rowCounts.getFirst( 1 );
+        if ( vRow == CountLists::NONE )
+            return false;
 
-                    _vPivotRow = vRow;
-                    _uPivotRow = uRow;
-                    _pivotElement = entry[i]._value;
+        const SparseUnsortedArray *sparseRow = _sparseLUFactors->_V->getRow( vRow );
+        entry = sparseRow->getArray();
+        nnz = sparseRow->getNnz();
 
-                    break;
-                }
+        for ( unsigned i = 0; i < nnz; ++i )
+        {
+            if ( _columnCounts.isActive( entry[i]._index ) )
+            {
+                setPivot( vRow, entry[i]._index, entry[i]._value );
+                break;
             }
-
-            ASSERT( found );
-
-            SGAUSSIAN_LOG(
-                Stringf( "Choose pivot selected a pivot (singleton column): V[%u,%u] = %lf",
-                         _vPivotRow,
-                         _vPivotColumn,
-                         _pivotElement )
-                    .ascii() );
-            return;
         }
+
+        SGAUSSIAN_LOG( Stringf( "Choose pivot selected a pivot (singleton row): V[%u,%u] = %lf",
+                                _vPivotRow,
+                                _vPivotColumn,
+                                _pivotElement )
+                           .ascii() );
     }
 
-    // No singletons, apply the Markowitz rule. Find the element with acceptable
-    // magnitude that has the smallet Markowitz value.
-    // Fail if no elements exists that are within acceptable magnitude
+    if ( _statistics )
+        _statistics->incLongAttribute( Statistics::NUM_BASIS_FACTORIZATION_SINGLETON_PIVOTS );
 
-    // Todo: more clever heuristics to reduce the search space
-    unsigned minimalCost = _m * _m;
-    _pivotElement = 0.0;
-    double absPivotElement = 0.0;
+    return true;
+}
 
-    bool found = false;
-    for ( unsigned uColumn = _eliminationStep; uColumn < _m; ++uColumn )
-    {
-        unsigned vColumn = _sparseLUFactors->_Q._rowOrdering[uColumn];
-        sparseColumn = _sparseLUFactors->_Vt->getRow( vColumn );
+void SparseGaussianEliminator::setPivot( unsigned vRow, unsigned vColumn, double value )
+{
+    _vPivotRow = vRow;
+    _vPivotColumn = vColumn;
+    _uPivotRow = _sparseLUFactors->_P._rowOrdering[vRow];
+    _uPivotColumn = _sparseLUFactors->_Q._columnOrdering[vColumn];
+    _pivotElement = value;
+}
 
-        double maxInColumn = 0;
-        nnz = sparseColumn->getNnz();
-        entry = sparseColumn->getArray();
+double SparseGaussianEliminator::maxInActiveColumn( unsigned vColumn )
+{
+    const SparseUnsortedArray *sparseColumn = _sparseLUFactors->_Vt->getRow( vColumn );
+    const SparseUnsortedArray::Entry *entry = sparseColumn->getArray();
+    unsigned nnz = sparseColumn->getNnz();
+    _cost += nnz;
 
-        for ( unsigned i = 0; i < nnz; ++i )
-        {
-            // Ignore entries that are not in the active submatrix
-            unsigned vRow = entry[i]._index;
-            unsigned uRow = _sparseLUFactors->_P._rowOrdering[vRow];
-            if ( uRow < _eliminationStep )
-                continue;
+    double maxInColumn = 0;
+    for ( unsigned i = 0; i < nnz; ++i )
+    {
+        // Ignore entries that are not in the active submatrix
+        if ( !_rowCounts.isActive( entry[i]._index ) )
+            continue;
 
-            double contender = FloatUtils::abs( entry[i]._value );
-            if ( FloatUtils::gt( contender, maxInColumn ) )
-                maxInColumn = contender;
-        }
+        double contender = FloatUtils::abs( entry[i]._value );
+        if ( FloatUtils::gt( contender, maxInColumn ) )
+            maxInColumn = contender;
+    }
 
-        if ( FloatUtils::isZero( maxInColumn ) )
-        {
-            throw BasisFactorizationError( BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED,
-                                           "Have a zero column" );
-        }
+    return maxInColumn;
+}
 
-        for ( unsigned i = 0; i < nnz; ++i )
-        {
-            unsigned vRow = entry[i]._index;
-            unsigned uRow = _sparseLUFactors->_P._rowOrdering[vRow];
+void SparseGaussianEliminator::inspectColumn( unsigned vColumn )
+{
+    double maxInColumn = maxInActiveColumn( vColumn );
 
-            // Ignore entries that are not in the active submatrix
-            if ( uRow < _eliminationStep )
-                continue;
+    const SparseUnsortedArray *sparseColumn = _sparseLUFactors->_Vt->getRow( vColumn );
+    const SparseUnsortedArray::Entry *entry = sparseColumn->getArray();
+    unsigned nnz = sparseColumn->getNnz();
+    _cost += nnz;
+
+    for ( unsigned i = 0; i < nnz; ++i )
+    {
+        if ( _rowCounts.isActive( entry[i]._index ) )
+            considerPivot( entry[i]._index, vColumn, entry[i]._value, maxInColumn );
+    }
+}
 
-            double contender = entry[i]._value;
-            double absContender = FloatUtils::abs( contender );
+void SparseGaussianEliminator::inspectRow( unsigned vRow )
+{
+    const SparseUnsortedArray *sparseRow = _sparseLUFactors->_V->getRow( vRow );
+    const SparseUnsortedArray::Entry *entry = sparseRow->getArray();
+    unsigned nnz = sparseRow->getNnz();
+    _cost += nnz;
 
-            // Only consider large-enough elements
-            if ( FloatUtils::gt(
-                     absContender,
-                     maxInColumn *
-                         GlobalConfiguration::GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD ) )
-            {
-                unsigned cost =
-                    ( _numURowElements[uRow] - 1 ) * ( _numUColumnElements[uColumn] - 1 );
-
-                ASSERT( ( cost != minimalCost ) || found );
-
-                if ( ( cost < minimalCost ) || ( ( cost == minimalCost ) &&
-                                                 FloatUtils::gt( absContender, absPivotElement ) ) )
-                {
-                    minimalCost = cost;
-                    _uPivotRow = uRow;
-                    _uPivotColumn = uColumn;
-                    _vPivotRow = vRow;
-                    _vPivotColumn = vColumn;
-                    _pivotElement = contender;
-                    absPivotElement = absContender;
-
-                    found = true;
-                }
-            }
-        }
+    for ( unsigned i = 0; i < nnz; ++i )
+    {
+        unsigned vColumn = entry[i]._index;
+        if ( _columnCounts.isActive( vColumn ) )
+            considerPivot( vRow, vColumn, entry[i]._value, maxInActiveColumn( vColumn ) );
     }
+}
 
-    if ( !found )
-        throw BasisFactorizationError( BasisFactorizationError::GAUSSIAN_ELIMINATION_FAILED,
-                                       "Couldn't find a pivot" );
+void SparseGaussianEliminator::considerPivot( unsigned vRow,
+                                              unsigned vColumn,
+                                              double value,
+                                              double maxInColumn )
+{
+    double absValue = FloatUtils::abs( value );
 
-    SGAUSSIAN_LOG( Stringf( "Choose pivot selected a pivot: V[%u,%u] = %lf (cost %u)",
-                            _vPivotRow,
-                            _vPivotColumn,
-                            _pivotElement,
-                            minimalCost )
-                       .ascii() );
+    // Only consider large-enough elements
+    if ( !FloatUtils::gt( absValue,
+                          maxInColumn *
+                              GlobalConfiguration::GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD ) )
+        return;
+
+    unsigned cost = ( _rowCounts.getCount( vRow ) - 1 ) * ( _columnCounts.getCount( vColumn ) - 1 );
+
+    if ( !_pivotFound || ( cost < _minimalCost ) ||
+         ( ( cost == _minimalCost ) && FloatUtils::gt( absValue, _absPivotElement ) ) )
+    {
+        setPivot( vRow, vColumn, value );
+        _minimalCost = cost;
+        _absPivotElement = absValue;
+        _pivotFound = true;
+    }
 }
 
 void SparseGaussianEliminator::eliminate()
@@ -399,33 +628,44 @@ void SparseGaussianEliminator::eliminate()
       We know that V[_vPivotRow, _vPivotColumn] = U[k,k].
     */
 
-    // Get the pivot row in dense format, due to repeated access
-    _sparseLUFactors->_V->getRowDense( _vPivotRow, _work );
+    // The pivot row and column leave the active submatrix
+    _rowCounts.remove( _vPivotRow );
+    _columnCounts.remove( _vPivotColumn );
 
     /*
-      The pivot row is not eliminated per se, but it is excluded
-      from the active submatrix, so we adjust the element counters
+      Scatter the active part of the pivot row into _work, due to
+      repeated access. The columns it touches lose an element.
     */
-    _numURowElements[_eliminationStep] = 0;
-    for ( unsigned uColumn = _eliminationStep; uColumn < _m; ++uColumn )
+    const SparseUnsortedArray *pivotRow = _sparseLUFactors->_V->getRow( _vPivotRow );
+    const SparseUnsortedArray::Entry *entry = pivotRow->getArray();
+    unsigned nnz = pivotRow->getNnz();
+    _cost += nnz;
+
+    _pivotRowNnz = 0;
+    for ( unsigned i = 0; i < nnz; ++i )
     {
-        unsigned vColumn = _sparseLUFactors->_Q._rowOrdering[uColumn];
-        if ( !FloatUtils::isZero( _work[vColumn] ) )
-            --_numUColumnElements[uColumn];
+        unsigned vColumn = entry[i]._index;
+        if ( !_columnCounts.isActive( vColumn ) )
+            continue;
+
+        _work[vColumn] = entry[i]._value;
+        _pivotRowColumns[_pivotRowNnz] = vColumn;
+        ++_pivotRowNnz;
+
+        _columnCounts.update( vColumn, _columnCounts.getCount( vColumn ) - 1 );
     }
 
-    // Process all rows below the pivot row
+    // Process all active rows with an entry in the pivot column
     SparseUnsortedArray *sparseColumn = _sparseLUFactors->_Vt->getRow( _vPivotColumn );
     unsigned index = 0;
-
-    const SparseUnsortedArray::Entry *entry = sparseColumn->getArray();
+    _cost += sparseColumn->getNnz();
 
     while ( index < sparseColumn->getNnz() )
     {
-        unsigned vRow = entry[index]._index;
-        unsigned uRow = _sparseLUFactors->_P._rowOrdering[vRow];
+        SparseUnsortedArray::Entry columnEntry = sparseColumn->getByArrayIndex( index );
+        unsigned vRow = columnEntry._index;
 
-        if ( uRow <= _eliminationStep )
+        if ( !_rowCounts.isActive( vRow ) )
         {
             ++index;
             continue;
@@ -435,68 +675,104 @@ void SparseGaussianEliminator::eliminate()
           Compute the Gaussian row multiplier for this row.
           The multiplier is: - U[row,k] / pivotElement
         */
-        double rowMultiplier = -entry[index]._value / _pivotElement;
+        double rowMultiplier = -columnEntry._value / _pivotElement;
 
-        // Get the row being eliminated in dense format
-        _sparseLUFactors->_V->getRowDense( vRow, _work2 );
-
-        // Eliminate the sub-diagonal entry
-        --_numUColumnElements[_eliminationStep];
-        --_numURowElements[uRow];
+        // Eliminate the sub-diagonal entry, and update the rest of the row
         sparseColumn->erase( index );
-        _work2[_vPivotColumn] = 0;
+        eliminateRow( vRow, rowMultiplier );
 
-        // Handle the rest of the row
-        for ( unsigned vColumnIndex = 0; vColumnIndex < _m; ++vColumnIndex )
-        {
-            unsigned uColumnIndex = _sparseLUFactors->_Q._columnOrdering[vColumnIndex];
+        /*
+          Store the row multiplier in matrix F, using F = PLP'.
+          F's rows are ordered same as V's. Column fColumn of F is
+          only populated in this step, so the entries are new.
+        */
+        _sparseLUFactors->_F->append( vRow, fColumn, -rowMultiplier );
+        _sparseLUFactors->_Ft->append( fColumn, vRow, -rowMultiplier );
+    }
 
-            // Only care about the active submatirx
-            if ( uColumnIndex <= _eliminationStep )
-                continue;
+    // Clear the work memory
+    for ( unsigned i = 0; i < _pivotRowNnz; ++i )
+        _work[_pivotRowColumns[i]] = 0;
 
-            // If the value does not change, skip
-            if ( FloatUtils::isZero( _work[vColumnIndex] ) )
-                continue;
+    // Store the pivot element
+    _sparseLUFactors->_vDiagonalElements[_vPivotRow] = _pivotElement;
+}
+
+void SparseGaussianEliminator::eliminateRow( unsigned vRow, double rowMultiplier )
+{
+    SparseUnsortedArray *sparseRow = _sparseLUFactors->_V->getRow( vRow );
+    const SparseUnsortedArray::Entry *entry = sparseRow->getArray();
+    unsigned nnz = sparseRow->getNnz();
+    _cost += nnz + _pivotRowNnz;
+
+    // Scatter the row, dropping its entry in the pivot column
+    _rowNnz = 0;
+    for ( unsigned i = 0; i < nnz; ++i )
+    {
+        unsigned vColumn = entry[i]._index;
+        if ( vColumn == _vPivotColumn )
+            continue;
+
+        _work2[vColumn] = entry[i]._value;
+        _inRow[vColumn] = true;
+        _rowColumns[_rowNnz] = vColumn;
+        ++_rowNnz;
+    }
 
-            // Value will change
-            double oldValue = _work2[vColumnIndex];
-            bool wasZero = FloatUtils::isZero( oldValue );
-            double newValue = oldValue + ( rowMultiplier * _work[vColumnIndex] );
-            bool isZero = FloatUtils::isZero( newValue );
+    unsigned count = _rowCounts.getCount( vRow ) - 1;
 
-            if ( !wasZero && isZero )
+    // Only the columns of the pivot row change
+    for ( unsigned i = 0; i < _pivotRowNnz; ++i )
+    {
+        unsigned vColumn = _pivotRowColumns[i];
+        double oldValue = _work2[vColumn];
+        double newValue = oldValue + ( rowMultiplier * _work[vColumn] );
+
+        // The transposed matrix is updated immediately, the regular
+        // matrix once the entire row has been processed
+        if ( _inRow[vColumn] )
+        {
+            if ( FloatUtils::isZero( newValue ) )
             {
                 newValue = 0;
-                --_numUColumnElements[uColumnIndex];
-                --_numURowElements[uRow];
+                --count;
+                _columnCounts.update( vColumn, _columnCounts.getCount( vColumn ) - 1 );
             }
-            else if ( wasZero && !isZero )
-            {
-                ++_numUColumnElements[uColumnIndex];
-                ++_numURowElements[uRow];
-            }
-
-            _work2[vColumnIndex] = newValue;
 
-            // Transposed matrix is updated immediately, regular matrix will
-            // be updated when entire row has been processed
             if ( newValue != oldValue )
-                _sparseLUFactors->_Vt->set( vColumnIndex, vRow, newValue );
+                _sparseLUFactors->_Vt->set( vColumn, vRow, newValue );
         }
+        else
+        {
+            if ( FloatUtils::isZero( newValue ) )
+                continue;
 
-        _sparseLUFactors->_V->updateSingleRow( vRow, _work2 );
+            // Fill-in
+            ++count;
+            _columnCounts.update( vColumn, _columnCounts.getCount( vColumn ) + 1 );
+            _sparseLUFactors->_Vt->append( vColumn, vRow, newValue );
 
-        /*
-          Store the row multiplier in matrix F, using F = PLP'.
-          F's rows are ordered same as V's
-        */
-        _sparseLUFactors->_F->set( vRow, fColumn, -rowMultiplier );
-        _sparseLUFactors->_Ft->set( fColumn, vRow, -rowMultiplier );
+            _inRow[vColumn] = true;
+            _rowColumns[_rowNnz] = vColumn;
+            ++_rowNnz;
+        }
+
+        _work2[vColumn] = newValue;
     }
 
-    // Store the pivot element
-    _sparseLUFactors->_vDiagonalElements[_vPivotRow] = _pivotElement;
+    // Gather the row back, and clear the work memory
+    sparseRow->clear();
+    for ( unsigned i = 0; i < _rowNnz; ++i )
+    {
+        unsigned vColumn = _rowColumns[i];
+        if ( _work2[vColumn] != 0 )
+            sparseRow->append( vColumn, _work2[vColumn] );
+
+        _work2[vColumn] = 0;
+        _inRow[vColumn] = false;
+    }
+
+    _rowCounts.update( vRow, count );
 }
 
 void SparseGaussianEliminator::setStatistics( Statistics *statistics )
@@ -504,6 +780,11 @@ void SparseGaussianEliminator::setStatistics( Statistics *statistics )
     _statistics = statistics;
 }
 
+unsigned long long SparseGaussianEliminator::getCost() const
+{
+    return _cost;
+}
+
 //
 // Local Variables:
 // compile-command: "make -C ../.. "
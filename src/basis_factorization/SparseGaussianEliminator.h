@@ -9,7 +9,11 @@
  ** All rights reserved. See the file COPYING in the top-level source
  ** directory for licensing information.\endverbatim
  **
- ** [[ Add lengthier description here ]]
+ ** Sparse LU factorization of the basis by Gaussian elimination. Pivots
+ ** are chosen by the Markowitz rule with threshold pivoting: singleton
+ ** rows and columns are taken first, and otherwise the rows and columns
+ ** of the active submatrix are searched in order of increasing number of
+ ** non-zeros, so only a few of them need to be inspected.
 
  **/
 
@@ -42,7 +46,59 @@ public:
     */
     void setStatistics( Statistics *statistics );
 
+    /*
+      The cost of the last factorization, measured as the number of
+      matrix entries that it visited
+    */
+    unsigned long long getCost() const;
+
 private:
+    /*
+      The rows (or columns) of the active submatrix, kept in
+      doubly-linked lists according to their number of non-zero
+      elements. Finding a row with a given count, and updating the
+      count of a row, both take constant time.
+    */
+    class CountLists
+    {
+    public:
+        static const unsigned NONE = 0xFFFFFFFF;
+
+        CountLists( unsigned m );
+        ~CountLists();
+
+        /*
+          Empty all lists
+        */
+        void clear();
+
+        /*
+          Add an element with the given count, remove it (once it
+          leaves the active submatrix), or change its count
+        */
+        void insert( unsigned index, unsigned count );
+        void remove( unsigned index );
+        void update( unsigned index, unsigned count );
+
+        bool isActive( unsigned index ) const;
+        unsigned getCount( unsigned index ) const;
+
+        /*
+          Iterate over the elements with a given count; NONE marks the
+          end of the list
+        */
+        unsigned getFirst( unsigned count ) const;
+        unsigned getNext( unsigned index ) const;
+
+    private:
+        unsigned _m;
+        unsigned *_count;
+        unsigned *_first;
+        unsigned *_next;
+        unsigned *_previous;
+        bool *_active;
+    };
+
     /*
       The dimension of the (square) matrix being factorized
     */
@@ -64,10 +120,18 @@ private:
     SparseLUFactors *_sparseLUFactors;
 
     /*
-      Work memory
+      Work memory. _work holds the pivot row, whose active columns
+      are listed in _pivotRowColumns. _work2 holds the row being
+      eliminated, whose columns are listed in _rowColumns and marked
+      in _inRow.
     */
     double *_work;
     double *_work2;
+    unsigned *_pivotRowColumns;
+    unsigned _pivotRowNnz;
+    unsigned *_rowColumns;
+    unsigned _rowNnz;
+    bool *_inRow;
 
     /*
       An object for reporting statistics
@@ -75,17 +139,48 @@ private:
     Statistics *_statistics;
 
     /*
-      Information on the number of non-zero elements in
-      every row of the current active submatrix of U
+      The number of non-zero elements in every row and column of the
+      active submatrix, indexed by the rows and columns of V
+    */
+    CountLists _rowCounts;
+    CountLists _columnCounts;
+
+    /*
+      The Markowitz cost and magnitude of the best pivot found so far
+      by the current search
     */
-    unsigned *_numURowElements;
-    unsigned *_numUColumnElements;
+    bool _pivotFound;
+    unsigned _minimalCost;
+    double _absPivotElement;
+
+    /*
+      The number of matrix entries visited by the current factorization
+    */
+    unsigned long long _cost;
 
     void choosePivot();
     void initializeFactorization( const SparseColumnsOfBasis *A, SparseLUFactors *sparseLUFactors );
     void factorize();
     void permute();
     void eliminate();
+
+    /*
+      Helpers for choosePivot(): take the pivot from a singleton
+      column or row, if there is one, and otherwise inspect the
+      active elements of a row or a column as Markowitz candidates
+    */
+    bool chooseSingletonPivot();
+    void setPivot( unsigned vRow, unsigned vColumn, double value );
+    double maxInActiveColumn( unsigned vColumn );
+    void inspectColumn( unsigned vColumn );
+    void inspectRow( unsigned vRow );
+    void considerPivot( unsigned vRow, unsigned vColumn, double value, double maxInColumn );
+
+    /*
+      Add a multiple of the pivot row to the given row, eliminating
+      its entry in the pivot column
+    */
+    void eliminateRow( unsigned vRow, double rowMultiplier );
 };
 
 #endif // __SparseGaussianEliminator_h__
@@ -30,12 +30,33 @@ SparseLUFactorization::SparseLUFactorization( unsigned m,
     , _m( m )
     , _sparseLUFactors( m )
     , _sparseGaussianEliminator( m )
+    , _statistics( NULL )
     , _z( NULL )
+    , _sparseWorkVector( NULL )
+    , _sparseWorkIndices( NULL )
+    , _sparseWorkMarks( NULL )
 {
     _z = new double[m];
     if ( !_z )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
                                        "SparseLUFactorization::z" );
+
+    _sparseWorkVector = new double[m];
+    if ( !_sparseWorkVector )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseLUFactorization::sparseWorkVector" );
+    std::fill_n( _sparseWorkVector, m, 0 );
+
+    _sparseWorkIndices = new unsigned[m];
+    if ( !_sparseWorkIndices )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseLUFactorization::sparseWorkIndices" );
+
+    _sparseWorkMarks = new bool[m];
+    if ( !_sparseWorkMarks )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseLUFactorization::sparseWorkMarks" );
+    std::fill_n( _sparseWorkMarks, m, false );
 }
 
 SparseLUFactorization::~SparseLUFactorization()
@@ -51,6 +72,24 @@ void SparseLUFactorization::freeIfNeeded()
         _z = NULL;
     }
 
+    if ( _sparseWorkVector )
+    {
+        delete[] _sparseWorkVector;
+        _sparseWorkVector = NULL;
+    }
+
+    if ( _sparseWorkIndices )
+    {
+        delete[] _sparseWorkIndices;
+        _sparseWorkIndices = NULL;
+    }
+
+    if ( _sparseWorkMarks )
+    {
+        delete[] _sparseWorkMarks;
+        _sparseWorkMarks = NULL;
+    }
+
     List<EtaMatrix *>::iterator it;
     for ( it = _etas.begin(); it != _etas.end(); ++it )
         delete *it;
@@ -83,10 +122,11 @@ void SparseLUFactorization::updateToAdjacentBasis( unsigned columnIndex,
 
     EtaMatrix *matrix = new EtaMatrix( _m, columnIndex, changeColumn );
     _etas.append( matrix );
+    _refactorizationPolicy.updatePerformed( getFactorsSize() );
 
-    if ( _etas.size() > GlobalConfiguration::REFACTORIZATION_THRESHOLD )
+    if ( _refactorizationPolicy.shouldRefactorize( _etas.size() ) )
     {
-        BASIS_FACTORIZATION_LOG( "Number of etas exceeds threshold. Refactoring basis\n" );
+        BASIS_FACTORIZATION_LOG( "Etas are too costly to keep. Refactoring basis\n" );
         obtainFreshBasis();
     }
 }
@@ -97,6 +137,7 @@ void SparseLUFactorization::forwardTransformation( const double *y, double *x )
       We are solving Bx = y, where B = B0 * E1 ... * En.
       First we solve B0 * z = y using a forward transformation.
     */
+    _refactorizationPolicy.transformationPerformed();
     _sparseLUFactors.forwardTransformation( y, x );
 
     /*
@@ -132,6 +173,7 @@ void SparseLUFactorization::backwardTransformation( const double *y, double *x )
       We are solving xB = y, where B = B0 * E1 ... * En.
       The first step is to eliminate the eta matrices.
     */
+    _refactorizationPolicy.transformationPerformed();
     memcpy( _z, y, sizeof( double ) * _m );
     for ( auto eta = _etas.rbegin(); eta != _etas.rend(); ++eta )
     {
@@ -155,6 +197,142 @@ void SparseLUFactorization::backwardTransformation( const double *y, double *x )
     _sparseLUFactors.backwardTransformation( _z, x );
 }
 
+void SparseLUFactorization::untrackedBackwardTransformation( const double *y, double *x ) const
+{
+    backwardTransformation( y, x );
+    _refactorizationPolicy.transformationExcluded();
+}
+
+bool SparseLUFactorization::isHypersparse( unsigned nnz ) const
+{
+    return nnz <= GlobalConfiguration::HYPERSPARSE_TRANSFORMATION_DENSITY_THRESHOLD * _m;
+}
+
+void SparseLUFactorization::forwardTransformation( const SparseUnsortedList &y,
+                                                   double *x,
+                                                   unsigned *xIndices,
+                                                   unsigned &xNnz ) const
+{
+    if ( !isHypersparse( y.getNnz() ) )
+    {
+        IBasisFactorization::forwardTransformation( y, x, xIndices, xNnz );
+        return;
+    }
+
+    _refactorizationPolicy.transformationPerformed();
+
+    unsigned nnz = 0;
+    for ( const auto &entry : y )
+    {
+        _sparseWorkVector[entry._index] = entry._value;
+        _sparseWorkIndices[nnz++] = entry._index;
+    }
+
+    // Solve B0 * z = y
+    _sparseLUFactors.fForwardTransformation( _sparseWorkVector, _sparseWorkIndices, nnz );
+    _sparseLUFactors.vForwardTransformation(
+        _sparseWorkVector, _sparseWorkIndices, nnz, x, xIndices, xNnz );
+
+    for ( unsigned i = 0; i < nnz; ++i )
+        _sparseWorkVector[_sparseWorkIndices[i]] = 0;
+
+    /*
+      Eliminate the etas. Etas whose pivot entry is zero leave x
+      unchanged; the others may fill it in.
+    */
+    bool dense = false;
+    for ( const auto &eta : _etas )
+    {
+        double inverseDiagonal = 1 / eta->_column[eta->_columnIndex];
+        double factor = x[eta->_columnIndex] * inverseDiagonal;
+        if ( factor == 0.0 )
+            continue;
+
+        dense = true;
+        for ( unsigned i = 0; i < _m; ++i )
+        {
+            if ( i == eta->_columnIndex )
+                continue;
+
+            x[i] -= ( factor * eta->_column[i] );
+            if ( FloatUtils::isZero( x[i] ) )
+                x[i] = 0.0;
+        }
+
+        x[eta->_columnIndex] *= inverseDiagonal;
+        if ( FloatUtils::isZero( x[eta->_columnIndex] ) )
+            x[eta->_columnIndex] = 0.0;
+    }
+
+    if ( dense )
+        listNonZeros( _m, x, xIndices, xNnz );
+}
+
+void SparseLUFactorization::backwardTransformation( const SparseUnsortedList &y,
+                                                    double *x,
+                                                    unsigned *xIndices,
+                                                    unsigned &xNnz ) const
+{
+    if ( !isHypersparse( y.getNnz() ) )
+    {
+        IBasisFactorization::backwardTransformation( y, x, xIndices, xNnz );
+        return;
+    }
+
+    _refactorizationPolicy.transformationPerformed();
+
+    unsigned nnz = 0;
+    for ( const auto &entry : y )
+    {
+        _sparseWorkVector[entry._index] = entry._value;
+        _sparseWorkIndices[nnz++] = entry._index;
+        _sparseWorkMarks[entry._index] = true;
+    }
+
+    // Eliminate the etas. Each one only changes its pivot entry.
+    for ( auto eta = _etas.rbegin(); eta != _etas.rend(); ++eta )
+    {
+        unsigned columnIndex = ( *eta )->_columnIndex;
+        double value = _sparseWorkVector[columnIndex];
+        for ( unsigned i = 0; i < nnz; ++i )
+        {
+            unsigned index = _sparseWorkIndices[i];
+            if ( index != columnIndex )
+                value -= ( _sparseWorkVector[index] * ( *eta )->_column[index] );
+        }
+
+        value = value / ( *eta )->_column[columnIndex];
+        if ( FloatUtils::isZero( value ) )
+            value = 0.0;
+
+        _sparseWorkVector[columnIndex] = value;
+        if ( value != 0.0 && !_sparseWorkMarks[columnIndex] )
+        {
+            _sparseWorkMarks[columnIndex] = true;
+            _sparseWorkIndices[nnz++] = columnIndex;
+        }
+    }
+
+    for ( unsigned i = 0; i < nnz; ++i )
+        _sparseWorkMarks[_sparseWorkIndices[i]] = false;
+
+    // Solve x * B0 = z
+    if ( isHypersparse( nnz ) )
+    {
+        _sparseLUFactors.vBackwardTransformation(
+            _sparseWorkVector, _sparseWorkIndices, nnz, x, xIndices, xNnz );
+        _sparseLUFactors.fBackwardTransformation( x, xIndices, xNnz );
+    }
+    else
+    {
+        _sparseLUFactors.backwardTransformation( _sparseWorkVector, x );
+        listNonZeros( _m, x, xIndices, xNnz );
+    }
+
+    for ( unsigned i = 0; i < nnz; ++i )
+        _sparseWorkVector[_sparseWorkIndices[i]] = 0;
+}
+
 void SparseLUFactorization::clearFactorization()
 {
     List<EtaMatrix *>::iterator it;
@@ -178,6 +356,25 @@ void SparseLUFactorization::factorizeBasis()
         else
             throw e;
     }
+
+    _refactorizationPolicy.factorizationPerformed( _sparseGaussianEliminator.getCost(),
+                                                   getFactorsSize() );
+
+    if ( _statistics )
+        _statistics->incLongAttribute( Statistics::NUM_BASIS_REFACTORIZATIONS );
+}
+
+unsigned long long SparseLUFactorization::getFactorsSize() const
+{
+    return _sparseLUFactors._F->getNnz() + _sparseLUFactors._V->getNnz() +
+           (unsigned long long)_etas.size() * _m;
+}
+
+void SparseLUFactorization::setStatistics( Statistics *statistics )
+{
+    _statistics = statistics;
+    _sparseGaussianEliminator.setStatistics( statistics );
+    _refactorizationPolicy.setStatistics( statistics );
 }
 
 void SparseLUFactorization::storeFactorization( IBasisFactorization *other )
@@ -191,6 +388,8 @@ void SparseLUFactorization::storeFactorization( IBasisFactorization *other )
 
     // Store the new basis and factorization
     _sparseLUFactors.storeToOther( &otherSparseLUFactorization->_sparseLUFactors );
+    otherSparseLUFactorization->_refactorizationPolicy.factorizationPerformed(
+        _sparseGaussianEliminator.getCost(), otherSparseLUFactorization->getFactorsSize() );
 }
 
 void SparseLUFactorization::restoreFactorization( const IBasisFactorization *other )
@@ -205,6 +404,10 @@ void SparseLUFactorization::restoreFactorization( const IBasisFactorization *oth
 
     // Store the new basis and factorization
     otherSparseLUFactorization->_sparseLUFactors.storeToOther( &_sparseLUFactors );
+
+    // The factors were computed from scratch, at about the cost of the last factorization
+    _refactorizationPolicy.factorizationPerformed( _sparseGaussianEliminator.getCost(),
+                                                   getFactorsSize() );
 }
 
 void SparseLUFactorization::invertBasis( double *result )
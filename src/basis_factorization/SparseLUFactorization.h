@@ -18,6 +18,7 @@
 
 #include "IBasisFactorization.h"
 #include "List.h"
+#include "RefactorizationPolicy.h"
 #include "SparseGaussianEliminator.h"
 #include "SparseLUFactors.h"
 
@@ -85,6 +86,22 @@ public:
       Result needs to be of size m.
     */
     void backwardTransformation( const double *y, double *x ) const;
+    void untrackedBackwardTransformation( const double *y, double *x ) const;
+
+    /*
+      Hypersparse variants of the transformations. The LU factors are only
+      visited along the entries reachable from the non-zero entries of y;
+      the eta matrices are dense, so forward transformations through etas
+      that affect the result produce a dense result.
+    */
+    void forwardTransformation( const SparseUnsortedList &y,
+                                double *x,
+                                unsigned *xIndices,
+                                unsigned &xNnz ) const;
+    void backwardTransformation( const SparseUnsortedList &y,
+                                 double *x,
+                                 unsigned *xIndices,
+                                 unsigned &xNnz ) const;
 
     /*
       Store and restore the basis factorization. Storing triggers
@@ -115,6 +132,11 @@ public:
     const double *getBasis() const;
     const SparseMatrix *getSparseBasis() const;
 
+    /*
+      Have the Basis Factoriaztion object start reporting statistics.
+    */
+    void setStatistics( Statistics *statistics );
+
 public:
     /*
       Functions made public strictly for testing, not part of the interface
@@ -157,11 +179,37 @@ private:
     */
     SparseGaussianEliminator _sparseGaussianEliminator;
 
+    /*
+      Decides when to refactorize, based on the cost of the
+      transformations as the etas accumulate
+    */
+    mutable RefactorizationPolicy _refactorizationPolicy;
+
+    /*
+      An object for reporting statistics
+    */
+    Statistics *_statistics;
+
     /*
       Work memory.
     */
     mutable double *_z;
 
+    /*
+      Work memory for the hypersparse transformations: a vector that is
+      kept all zero between calls, the list of its non-zero entries, and
+      marks (kept all false) for the entries in that list.
+    */
+    mutable double *_sparseWorkVector;
+    mutable unsigned *_sparseWorkIndices;
+    mutable bool *_sparseWorkMarks;
+
+    /*
+      Return true iff a vector with the given number of non-zero entries
+      is sparse enough for the hypersparse transformations to pay off
+    */
+    bool isHypersparse( unsigned nnz ) const;
+
     /*
       Free any allocated memory.
     */
@@ -172,6 +220,11 @@ private:
     */
     void factorizeBasis();
 
+    /*
+      The total number of entries in F, V and the (dense) etas
+    */
+    unsigned long long getFactorsSize() const;
+
     /*
       Compute the inverse of B0, using the LP factorization already stored.
       This can only be done when B0 is "fresh", i.e. when there are no stored etas.
@@ -34,6 +34,11 @@ SparseLUFactors::SparseLUFactors( unsigned m )
     , _z( NULL )
     , _workMatrix( NULL )
     , _workVector( NULL )
+    , _sparseWorkVector( NULL )
+    , _marked( NULL )
+    , _reach( NULL )
+    , _stack( NULL )
+    , _stackPositions( NULL )
 {
     _F = new SparseUnsortedArrays();
     if ( !_F )
@@ -74,6 +79,33 @@ SparseLUFactors::SparseLUFactors( unsigned m )
     if ( !_workVector )
         throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
                                        "SparseLUFactors::workVector" );
+
+    _sparseWorkVector = new double[m];
+    if ( !_sparseWorkVector )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseLUFactors::sparseWorkVector" );
+    std::fill_n( _sparseWorkVector, m, 0 );
+
+    _marked = new bool[m];
+    if ( !_marked )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseLUFactors::marked" );
+    std::fill_n( _marked, m, false );
+
+    _reach = new unsigned[m];
+    if ( !_reach )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseLUFactors::reach" );
+
+    _stack = new unsigned[m];
+    if ( !_stack )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseLUFactors::stack" );
+
+    _stackPositions = new unsigned[m];
+    if ( !_stackPositions )
+        throw BasisFactorizationError( BasisFactorizationError::ALLOCATION_FAILED,
+                                       "SparseLUFactors::stackPositions" );
 }
 
 SparseLUFactors::~SparseLUFactors()
@@ -125,6 +157,36 @@ SparseLUFactors::~SparseLUFactors()
         delete[] _workVector;
         _workVector = NULL;
     }
+
+    if ( _sparseWorkVector )
+    {
+        delete[] _sparseWorkVector;
+        _sparseWorkVector = NULL;
+    }
+
+    if ( _marked )
+    {
+        delete[] _marked;
+        _marked = NULL;
+    }
+
+    if ( _reach )
+    {
+        delete[] _reach;
+        _reach = NULL;
+    }
+
+    if ( _stack )
+    {
+        delete[] _stack;
+        _stack = NULL;
+    }
+
+    if ( _stackPositions )
+    {
+        delete[] _stackPositions;
+        _stackPositions = NULL;
+    }
 }
 
 void SparseLUFactors::dump() const
@@ -413,6 +475,232 @@ void SparseLUFactors::vBackwardTransformation( const double *y, double *x ) cons
     }
 }
 
+template <typename Children>
+unsigned SparseLUFactors::computeReach( const unsigned *start,
+                                        unsigned startNnz,
+                                        Children children ) const
+{
+    /*
+      A non-recursive depth-first search. A node is appended to the
+      reach list once all of its successors have been visited, and the
+      list is filled from its end, so that every node appears before
+      its successors.
+    */
+    unsigned top = _m;
+    const SparseUnsortedArray *successors;
+    const SparseUnsortedArray::Entry *entry;
+    unsigned nnz;
+
+    for ( unsigned i = 0; i < startNnz; ++i )
+    {
+        if ( _marked[start[i]] )
+            continue;
+
+        int head = 0;
+        _stack[0] = start[i];
+        _stackPositions[0] = 0;
+        _marked[start[i]] = true;
+
+        while ( head >= 0 )
+        {
+            unsigned node = _stack[head];
+            successors = children( node );
+            entry = successors->getArray();
+            nnz = successors->getNnz();
+
+            bool done = true;
+            for ( unsigned j = _stackPositions[head]; j < nnz; ++j )
+            {
+                unsigned child = entry[j]._index;
+                if ( _marked[child] )
+                    continue;
+
+                // Resume from the next successor when we return to this node
+                _stackPositions[head] = j + 1;
+
+                ++head;
+                _stack[head] = child;
+                _stackPositions[head] = 0;
+                _marked[child] = true;
+                done = false;
+                break;
+            }
+
+            if ( done )
+            {
+                --head;
+                _reach[--top] = node;
+            }
+        }
+    }
+
+    return top;
+}
+
+void SparseLUFactors::fForwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const
+{
+    unsigned top = computeReach( indices, nnz, [this]( unsigned fColumn ) {
+        return _Ft->getRow( fColumn );
+    } );
+
+    double xElement;
+    const SparseUnsortedArray *sparseColumn;
+    const SparseUnsortedArray::Entry *entry;
+    unsigned columnNnz;
+
+    nnz = 0;
+    for ( unsigned k = top; k < _m; ++k )
+    {
+        unsigned fColumn = _reach[k];
+        _marked[fColumn] = false;
+
+        xElement = x[fColumn];
+        if ( xElement != 0.0 )
+        {
+            indices[nnz++] = fColumn;
+
+            sparseColumn = _Ft->getRow( fColumn );
+            entry = sparseColumn->getArray();
+            columnNnz = sparseColumn->getNnz();
+
+            for ( unsigned i = 0; i < columnNnz; ++i )
+                x[entry[i]._index] -= xElement * entry[i]._value;
+        }
+    }
+}
+
+void SparseLUFactors::fBackwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const
+{
+    unsigned top = computeReach( indices, nnz, [this]( unsigned fColumn ) {
+        return _F->getRow( fColumn );
+    } );
+
+    double xElement;
+    const SparseUnsortedArray *sparseRow;
+    const SparseUnsortedArray::Entry *entry;
+    unsigned rowNnz;
+
+    nnz = 0;
+    for ( unsigned k = top; k < _m; ++k )
+    {
+        unsigned fColumn = _reach[k];
+        _marked[fColumn] = false;
+
+        xElement = x[fColumn];
+        if ( xElement != 0.0 )
+        {
+            indices[nnz++] = fColumn;
+
+            sparseRow = _F->getRow( fColumn );
+            entry = sparseRow->getArray();
+            rowNnz = sparseRow->getNnz();
+
+            for ( unsigned i = 0; i < rowNnz; ++i )
+                x[entry[i]._index] -= xElement * entry[i]._value;
+        }
+    }
+}
+
+void SparseLUFactors::vForwardTransformation( const double *y,
+                                              const unsigned *yIndices,
+                                              unsigned yNnz,
+                                              double *x,
+                                              unsigned *xIndices,
+                                              unsigned &xNnz ) const
+{
+    /*
+      The nodes of the graph are the rows of V. Eliminating the pivot
+      of row vRow (in column vColumn) updates the rows that have
+      entries in column vColumn.
+    */
+    for ( unsigned i = 0; i < yNnz; ++i )
+        _sparseWorkVector[yIndices[i]] = y[yIndices[i]];
+
+    unsigned top = computeReach( yIndices, yNnz, [this]( unsigned vRow ) {
+        return _Vt->getRow( _Q._rowOrdering[_P._rowOrdering[vRow]] );
+    } );
+
+    double xElement;
+    const SparseUnsortedArray *sparseColumn;
+    const SparseUnsortedArray::Entry *entry;
+    unsigned nnz;
+
+    xNnz = 0;
+    for ( unsigned k = top; k < _m; ++k )
+    {
+        unsigned vRow = _reach[k];
+        unsigned vColumn = _Q._rowOrdering[_P._rowOrdering[vRow]];
+        _marked[vRow] = false;
+
+        xElement = _sparseWorkVector[vRow] / _vDiagonalElements[vRow];
+        if ( xElement != 0.0 )
+        {
+            x[vColumn] = xElement;
+            xIndices[xNnz++] = vColumn;
+
+            sparseColumn = _Vt->getRow( vColumn );
+            entry = sparseColumn->getArray();
+            nnz = sparseColumn->getNnz();
+
+            for ( unsigned i = 0; i < nnz; ++i )
+                _sparseWorkVector[entry[i]._index] -= xElement * entry[i]._value;
+        }
+
+        // All the updates to this entry have been made, so it can be reset
+        _sparseWorkVector[vRow] = 0;
+    }
+}
+
+void SparseLUFactors::vBackwardTransformation( const double *y,
+                                               const unsigned *yIndices,
+                                               unsigned yNnz,
+                                               double *x,
+                                               unsigned *xIndices,
+                                               unsigned &xNnz ) const
+{
+    /*
+      The nodes of the graph are the columns of V. Eliminating the
+      pivot of column vColumn (in row vRow) updates the columns that
+      have entries in row vRow.
+    */
+    for ( unsigned i = 0; i < yNnz; ++i )
+        _sparseWorkVector[yIndices[i]] = y[yIndices[i]];
+
+    unsigned top = computeReach( yIndices, yNnz, [this]( unsigned vColumn ) {
+        return _V->getRow( _P._columnOrdering[_Q._columnOrdering[vColumn]] );
+    } );
+
+    double xElement;
+    const SparseUnsortedArray *sparseRow;
+    const SparseUnsortedArray::Entry *entry;
+    unsigned nnz;
+
+    xNnz = 0;
+    for ( unsigned k = top; k < _m; ++k )
+    {
+        unsigned vColumn = _reach[k];
+        unsigned vRow = _P._columnOrdering[_Q._columnOrdering[vColumn]];
+        _marked[vColumn] = false;
+
+        xElement = _sparseWorkVector[vColumn] / _vDiagonalElements[vRow];
+        if ( xElement != 0.0 )
+        {
+            x[vRow] = xElement;
+            xIndices[xNnz++] = vRow;
+
+            sparseRow = _V->getRow( vRow );
+            entry = sparseRow->getArray();
+            nnz = sparseRow->getNnz();
+
+            for ( unsigned i = 0; i < nnz; ++i )
+                _sparseWorkVector[entry[i]._index] -= xElement * entry[i]._value;
+        }
+
+        // All the updates to this entry have been made, so it can be reset
+        _sparseWorkVector[vColumn] = 0;
+    }
+}
+
 void SparseLUFactors::forwardTransformation( const double *y, double *x ) const
 {
     /*
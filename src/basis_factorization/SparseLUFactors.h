@@ -110,6 +110,37 @@ public:
     void vForwardTransformation( const double *y, double *x ) const;
     void vBackwardTransformation( const double *y, double *x ) const;
 
+    /*
+      Hypersparse variants of the F and V transformations. A sparse vector
+      is kept as a dense array together with the list of its (possibly)
+      non-zero entries; entries not in the list are zero.
+
+      Following Gilbert and Peierls, each transformation first finds the
+      entries of the solution that are reachable from the non-zero entries
+      of the right hand side in the graph of the factor (a depth-first
+      search, which also yields a valid elimination order), and then only
+      eliminates along these entries. The cost is thus proportional to the
+      number of arithmetic operations performed, rather than to m.
+
+      The F transformations work in place: x contains y on entry, and
+      indices/nnz are updated to cover the solution. The V transformations
+      leave y unchanged, and write into x, which must be all zeros on entry.
+    */
+    void fForwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const;
+    void fBackwardTransformation( double *x, unsigned *indices, unsigned &nnz ) const;
+    void vForwardTransformation( const double *y,
+                                 const unsigned *yIndices,
+                                 unsigned yNnz,
+                                 double *x,
+                                 unsigned *xIndices,
+                                 unsigned &xNnz ) const;
+    void vBackwardTransformation( const double *y,
+                                  const unsigned *yIndices,
+                                  unsigned yNnz,
+                                  double *x,
+                                  unsigned *xIndices,
+                                  unsigned &xNnz ) const;
+
     /*
       Compute the inverse of the factorized basis
     */
@@ -122,6 +153,16 @@ public:
     double *_workMatrix;
     double *_workVector;
 
+    /*
+      Work memory for the hypersparse transformations. The sparse work
+      vector and the marks are kept all zero/false between calls.
+    */
+    double *_sparseWorkVector;
+    bool *_marked;
+    unsigned *_reach;
+    unsigned *_stack;
+    unsigned *_stackPositions;
+
     /*
       Clone this SparseLUFactors object into another object
     */
@@ -131,6 +172,17 @@ public:
       For debugging purposes
     */
     void dump() const;
+
+private:
+    /*
+      Compute the set of nodes reachable from the given start nodes in the
+      graph in which the successors of node u are the indices of the
+      entries of children( u ). The reachable nodes are stored in
+      _reach[top..m-1], in topological order, and top is returned.
+      Marks the reachable nodes.
+    */
+    template <typename Children>
+    unsigned computeReach( const unsigned *start, unsigned startNnz, Children children ) const;
 };
 
 #endif // __SparseLUFactors_h__
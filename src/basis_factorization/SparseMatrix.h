@@ -27,9 +27,11 @@ public:
 
     /*
       Initialize the sparse matrix from a given dense matrix
-      M of dimensions m x n, or an empty matrix
+      M of dimensions m x n, from the m sparse rows V, or an
+      empty matrix
     */
     virtual void initialize( const double *M, unsigned m, unsigned n ) = 0;
+    virtual void initialize( const SparseUnsortedList **V, unsigned m, unsigned n ) = 0;
     virtual void initializeToEmpty( unsigned m, unsigned n ) = 0;
 
     /*
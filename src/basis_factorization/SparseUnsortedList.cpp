@@ -19,6 +19,8 @@
 #include "Debug.h"
 #include "FloatUtils.h"
 
+#include <algorithm>
+
 SparseUnsortedList::SparseUnsortedList()
     : _size( 0 )
 {
@@ -54,7 +56,7 @@ void SparseUnsortedList::initialize( const double *V, unsigned size )
         if ( FloatUtils::isZero( V[i] ) )
             continue;
 
-        _list.append( Entry( i, V[i] ) );
+        _list.emplace_back( i, V[i] );
     }
 }
 
@@ -92,7 +94,7 @@ double SparseUnsortedList::get( unsigned entry ) const
 
 void SparseUnsortedList::dump() const
 {
-    printf( "\nDumping sparse unsortedList: (nnz = %u)\n", _list.size() );
+    printf( "\nDumping sparse unsortedList: (nnz = %u)\n", getNnz() );
     for ( const auto &entry : _list )
         printf( "\tEntry %u: %6.2lf\n", entry._index, entry._value );
     printf( "\n" );
@@ -131,22 +133,22 @@ void SparseUnsortedList::storeIntoOther( SparseUnsortedList *other ) const
     other->_list = _list;
 }
 
-List<SparseUnsortedList::Entry>::const_iterator SparseUnsortedList::begin() const
+SparseUnsortedList::const_iterator SparseUnsortedList::begin() const
 {
     return _list.begin();
 }
 
-List<SparseUnsortedList::Entry>::const_iterator SparseUnsortedList::end() const
+SparseUnsortedList::const_iterator SparseUnsortedList::end() const
 {
     return _list.end();
 }
 
-List<SparseUnsortedList::Entry>::iterator SparseUnsortedList::begin()
+SparseUnsortedList::iterator SparseUnsortedList::begin()
 {
     return _list.begin();
 }
 
-List<SparseUnsortedList::Entry>::iterator SparseUnsortedList::end()
+SparseUnsortedList::iterator SparseUnsortedList::end()
 {
     return _list.end();
 }
@@ -169,18 +171,18 @@ void SparseUnsortedList::set( unsigned index, double value )
     }
 
     if ( !isZero )
-        _list.append( Entry( index, value ) );
+        _list.emplace_back( index, value );
 }
 
 void SparseUnsortedList::append( unsigned index, double value )
 {
-    _list.append( Entry( index, value ) );
+    _list.emplace_back( index, value );
 }
 
 void SparseUnsortedList::addLastEntry( double entry )
 {
     if ( !FloatUtils::isZero( entry ) )
-        _list.append( Entry( _size, entry ) );
+        _list.emplace_back( _size, entry );
 
     ++_size;
 }
@@ -192,52 +194,62 @@ void SparseUnsortedList::incrementSize()
 
 void SparseUnsortedList::mergeEntries( unsigned source, unsigned target )
 {
-    List<Entry>::iterator sourceIt = _list.end();
-    List<Entry>::iterator targetIt = _list.end();
-    List<Entry>::iterator it;
+    unsigned numberOfEntries = _list.size();
+    unsigned sourcePosition = numberOfEntries;
+    unsigned targetPosition = numberOfEntries;
 
-    for ( it = _list.begin(); it != _list.end(); ++it )
+    for ( unsigned i = 0; i < numberOfEntries; ++i )
     {
-        if ( it->_index == source )
+        if ( _list[i]._index == source )
         {
-            sourceIt = it;
-            if ( targetIt != _list.end() )
+            sourcePosition = i;
+            if ( targetPosition != numberOfEntries )
                 break;
         }
 
-        if ( it->_index == target )
+        if ( _list[i]._index == target )
         {
-            targetIt = it;
-            if ( sourceIt != _list.end() )
+            targetPosition = i;
+            if ( sourcePosition != numberOfEntries )
                 break;
         }
     }
 
     // If no source entry exists, we are done
-    if ( sourceIt == _list.end() )
+    if ( sourcePosition == numberOfEntries )
         return;
 
     // If no target entry, simply change index on source entry
-    if ( targetIt == _list.end() )
+    if ( targetPosition == numberOfEntries )
     {
-        sourceIt->_index = target;
+        _list[sourcePosition]._index = target;
         return;
     }
 
     // Both source and target entries
-    targetIt->_value += sourceIt->_value;
+    _list[targetPosition]._value += _list[sourcePosition]._value;
+
+    // Erase the later position first, so that the earlier one stays valid
+    bool targetIsZero = FloatUtils::isZero( _list[targetPosition]._value );
+    unsigned first = std::min( sourcePosition, targetPosition );
+    unsigned second = std::max( sourcePosition, targetPosition );
 
-    _list.erase( sourceIt );
-    if ( FloatUtils::isZero( targetIt->_value ) )
-        _list.erase( targetIt );
+    if ( targetIsZero || second == sourcePosition )
+        _list.erase( _list.begin() + second );
+    if ( targetIsZero || first == sourcePosition )
+        _list.erase( _list.begin() + first );
 }
 
-List<SparseUnsortedList::Entry>::iterator
-SparseUnsortedList::erase( List<SparseUnsortedList::Entry>::iterator it )
+SparseUnsortedList::iterator SparseUnsortedList::erase( SparseUnsortedList::iterator it )
 {
     return _list.erase( it );
 }
 
+void SparseUnsortedList::reserve( unsigned nnz )
+{
+    _list.reserve( nnz );
+}
+
 unsigned SparseUnsortedList::getSize() const
 {
     return _size;
@@ -9,7 +9,10 @@
  ** All rights reserved. See the file COPYING in the top-level source
  ** directory for licensing information.\endverbatim
  **
- ** [[ Add lengthier description here ]]
+ ** A sparse vector, stored as an array of <index, value> entries in no
+ ** particular order. The entries are kept contiguously, so that iterating
+ ** over them, copying them and appending to them is cheap; erasing an
+ ** entry shifts the ones after it, preserving their order.
 
  **/
 
@@ -19,6 +22,8 @@
 #include "HashMap.h"
 #include "SparseMatrix.h"
 
+#include <vector>
+
 class SparseUnsortedList
 {
 public:
@@ -34,6 +39,9 @@ public:
         double _value;
     };
 
+    typedef std::vector<Entry>::iterator iterator;
+    typedef std::vector<Entry>::const_iterator const_iterator;
+
     /*
       Initialization: the size determines the dimension of the
       underlying storage.
@@ -94,15 +102,20 @@ public:
     /*
       Retrieve entries
     */
-    List<Entry>::const_iterator begin() const;
-    List<Entry>::const_iterator end() const;
-    List<Entry>::iterator begin();
-    List<Entry>::iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+    iterator begin();
+    iterator end();
 
     /*
       Erasing an element by iterator
     */
-    List<Entry>::iterator erase( List<Entry>::iterator it );
+    iterator erase( iterator it );
+
+    /*
+      Allocate room for the given number of non-zero elements
+    */
+    void reserve( unsigned nnz );
 
     /*
       Addes the coefficient for entry 'source' to entry 'target'
@@ -123,7 +136,7 @@ public:
 
 private:
     unsigned _size;
-    List<Entry> _list;
+    std::vector<Entry> _list;
 };
 
 #endif // __SparseUnsortedList_h__
@@ -133,6 +133,11 @@ void SparseUnsortedLists::set( unsigned row, unsigned column, double value )
     _rows[row]->set( column, value );
 }
 
+const SparseUnsortedList **SparseUnsortedLists::getRows() const
+{
+    return (const SparseUnsortedList **)_rows;
+}
+
 const SparseUnsortedList *SparseUnsortedLists::getRow( unsigned row ) const
 {
     return _rows[row];
@@ -215,7 +220,7 @@ void SparseUnsortedLists::countElements( unsigned *numRowElements, unsigned *num
     }
 }
 
-void SparseUnsortedLists::transposeIntoOther( SparseUnsortedLists *other )
+void SparseUnsortedLists::transposeIntoOther( SparseUnsortedLists *other ) const
 {
     other->initializeToEmpty( _n, _m );
 
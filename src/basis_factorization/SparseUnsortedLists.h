@@ -43,6 +43,7 @@ public:
     double get( unsigned row, unsigned column ) const;
     void set( unsigned row, unsigned column, double value );
     const SparseUnsortedList *getRow( unsigned row ) const;
+    const SparseUnsortedList **getRows() const;
     SparseUnsortedList *getRow( unsigned row );
     void getRowDense( unsigned row, double *result ) const;
     void getColumn( unsigned column, SparseUnsortedList *result ) const;
@@ -69,7 +70,7 @@ public:
     /*
       Transpose the matrix and store it in another matrix
     */
-    void transposeIntoOther( SparseUnsortedLists *other );
+    void transposeIntoOther( SparseUnsortedLists *other ) const;
 
     /*
       For debugging purposes.
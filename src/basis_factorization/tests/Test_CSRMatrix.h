@@ -78,6 +78,60 @@ public:
                 TS_ASSERT_EQUALS( M2[i * 4 + j], csr2.get( i, j ) );
     }
 
+    void test_initialize_from_sparse_rows()
+    {
+        double M1[] = {
+            0, 0, 0, 0, //
+            5, 8, 0, 0, //
+            0, 0, 3, 0, //
+            0, 6, 0, 7, //
+        };
+
+        // The rows are unsorted
+        SparseUnsortedList row0( 4 );
+        SparseUnsortedList row1( 4 );
+        row1.append( 1, 8 );
+        row1.append( 0, 5 );
+        SparseUnsortedList row2( 4 );
+        row2.append( 2, 3 );
+        SparseUnsortedList row3( 4 );
+        row3.append( 3, 7 );
+        row3.append( 1, 6 );
+
+        const SparseUnsortedList *rows[] = { &row0, &row1, &row2, &row3 };
+
+        CSRMatrix csr1;
+        csr1.initialize( rows, 4, 4 );
+        TS_ASSERT_EQUALS( csr1.getNnz(), 5U );
+
+        for ( unsigned i = 0; i < 4; ++i )
+            for ( unsigned j = 0; j < 4; ++j )
+                TS_ASSERT_EQUALS( M1[i * 4 + j], csr1.get( i, j ) );
+
+        // The column indices of every row are increasing
+        const unsigned *IA = csr1.getIA();
+        const unsigned *JA = csr1.getJA();
+        for ( unsigned i = 0; i < 4; ++i )
+            for ( unsigned j = IA[i] + 1; j < IA[i + 1]; ++j )
+                TS_ASSERT( JA[j - 1] < JA[j] );
+
+        // The matrix can grow beyond the space allocated for its entries
+        double row4[] = { 1, 2, 3, 4 };
+        double row5[] = { 0, 0, 0, 9 };
+        csr1.addLastRow( row4 );
+        csr1.addLastRow( row5 );
+        csr1.addLastRow( row4 );
+        TS_ASSERT_EQUALS( csr1.getNnz(), 14U );
+
+        for ( unsigned j = 0; j < 4; ++j )
+        {
+            TS_ASSERT_EQUALS( csr1.get( 1, j ), M1[4 + j] );
+            TS_ASSERT_EQUALS( csr1.get( 4, j ), row4[j] );
+            TS_ASSERT_EQUALS( csr1.get( 5, j ), row5[j] );
+            TS_ASSERT_EQUALS( csr1.get( 6, j ), row4[j] );
+        }
+    }
+
     void test_store_restore()
     {
         double M1[] = {
@@ -0,0 +1,340 @@
+/*********************                                                        */
+/*! \file Test_DenseLUFactorization.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "BasisFactorizationError.h"
+#include "DenseLUFactorization.h"
+#include "FloatUtils.h"
+#include "MalformedBasisException.h"
+#include "MockColumnOracle.h"
+#include "MockErrno.h"
+#include "SparseLUFactorization.h"
+#include "SparseUnsortedList.h"
+
+#include <cxxtest/TestSuite.h>
+
+class MockForDenseLUFactorization
+{
+public:
+};
+
+class DenseLUFactorizationTestSuite : public CxxTest::TestSuite
+{
+public:
+    MockForDenseLUFactorization *mock;
+    MockColumnOracle *oracle;
+
+    void setUp()
+    {
+        TS_ASSERT( mock = new MockForDenseLUFactorization );
+        TS_ASSERT( oracle = new MockColumnOracle );
+    }
+
+    void tearDown()
+    {
+        TS_ASSERT_THROWS_NOTHING( delete oracle );
+        TS_ASSERT_THROWS_NOTHING( delete mock );
+    }
+
+    void test_forward_transformation()
+    {
+        DenseLUFactorization basis( 3, *oracle );
+
+        double B[] = {
+            1, 0, 0, //
+            0, 1, 0, //
+            0, 0, 1, //
+        };
+        oracle->storeBasis( 3, B );
+        basis.obtainFreshBasis();
+
+        // If no eta matrices are provided, d = a
+        double a1[] = { 1, 1, 3 };
+        double d1[] = { 0, 0, 0 };
+        double expected1[] = { 1, 1, 3 };
+
+        TS_ASSERT_THROWS_NOTHING( basis.forwardTransformation( a1, d1 ) );
+        TS_ASSERT_SAME_DATA( d1, expected1, sizeof( double ) * 3 );
+
+        // E1 = | 1 1   |
+        //      |   1   |
+        //      |   3 1 |
+        basis.updateToAdjacentBasis( 1, a1, NULL );
+        TS_ASSERT_EQUALS( basis.getNumberOfEtas(), 1U );
+        TS_ASSERT( !basis.explicitBasisAvailable() );
+
+        double a2[] = { 3, 1, 4 };
+        double d2[] = { 0, 0, 0 };
+        double expected2[] = { 2, 1, 1 };
+
+        TS_ASSERT_THROWS_NOTHING( basis.forwardTransformation( a2, d2 ) );
+        TS_ASSERT_SAME_DATA( d2, expected2, sizeof( double ) * 3 );
+
+        // E2 = | 2     |
+        //      | 1 1   |
+        //      | 1   1 |
+        basis.updateToAdjacentBasis( 0, d2, NULL );
+
+        double a3[] = { 2, 1, 4 };
+        double d3[] = { 0, 0, 0 };
+        double expected3[] = { 0.5, 0.5, 0.5 };
+
+        TS_ASSERT_THROWS_NOTHING( basis.forwardTransformation( a3, d3 ) );
+        TS_ASSERT_SAME_DATA( d3, expected3, sizeof( double ) * 3 );
+    }
+
+    void test_transformations_with_pivoting()
+    {
+        /*
+          The leading entry is zero, and the second column is only
+          non-zero in its last row, so that elimination needs row
+          exchanges.
+        */
+        DenseLUFactorization basis( 4, *oracle );
+
+        double B[] = {
+            0,  0,  3,   -4, //
+            1,  0,  10,  0,  //
+            -3, 0,  1,   1,  //
+            0,  -2, 2,   2   //
+        };
+        oracle->storeBasis( 4, B );
+        basis.obtainFreshBasis();
+
+        double y[] = { 9, 15, 10, -12 };
+        double x[4];
+
+        // Forward: B * x = y
+        TS_ASSERT_THROWS_NOTHING( basis.forwardTransformation( y, x ) );
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            double sum = 0;
+            for ( unsigned j = 0; j < 4; ++j )
+                sum += B[i * 4 + j] * x[j];
+            TS_ASSERT( FloatUtils::areEqual( sum, y[i] ) );
+        }
+
+        // Backward: x * B = y
+        TS_ASSERT_THROWS_NOTHING( basis.backwardTransformation( y, x ) );
+        for ( unsigned j = 0; j < 4; ++j )
+        {
+            double sum = 0;
+            for ( unsigned i = 0; i < 4; ++i )
+                sum += x[i] * B[i * 4 + j];
+            TS_ASSERT( FloatUtils::areEqual( sum, y[j] ) );
+        }
+
+        // The inverse, times B, is the identity
+        double inverse[16];
+        TS_ASSERT_THROWS_NOTHING( basis.invertBasis( inverse ) );
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            for ( unsigned j = 0; j < 4; ++j )
+            {
+                double sum = 0;
+                for ( unsigned k = 0; k < 4; ++k )
+                    sum += inverse[i * 4 + k] * B[k * 4 + j];
+                TS_ASSERT( FloatUtils::areEqual( sum, ( i == j ) ? 1 : 0 ) );
+            }
+        }
+
+        // Once an eta is stored, the basis can no longer be inverted
+        double changeColumn[] = { 1, 2, 0, 0 };
+        basis.updateToAdjacentBasis( 0, changeColumn, NULL );
+        TS_ASSERT_THROWS_EQUALS( basis.invertBasis( inverse ),
+                                 const BasisFactorizationError &e,
+                                 e.getCode(),
+                                 BasisFactorizationError::CANT_INVERT_BASIS_BECAUSE_OF_ETAS );
+    }
+
+    void test_singular_basis()
+    {
+        DenseLUFactorization basis( 3, *oracle );
+
+        double B[] = {
+            1, 2, 3, //
+            2, 4, 6, //
+            0, 1, 1, //
+        };
+        oracle->storeBasis( 3, B );
+
+        TS_ASSERT_THROWS( basis.obtainFreshBasis(), MalformedBasisException );
+    }
+
+    void test_agrees_with_sparse_lu()
+    {
+        /*
+          A sparse, diagonally dominant basis, followed by a sequence of
+          column replacements. Both factorizations should agree on
+          all transformations, including the sparse ones.
+        */
+        const unsigned m = 25;
+        DenseLUFactorization dense( m, *oracle );
+        SparseLUFactorization sparse( m, *oracle );
+
+        double B[m * m];
+        std::fill_n( B, m * m, 0 );
+        for ( unsigned i = 0; i < m; ++i )
+        {
+            B[i * m + i] = 5 + i % 4;
+            B[( ( i * 7 + 3 ) % m ) * m + i] += 1.5;
+            B[( ( i * 11 + 5 ) % m ) * m + i] -= 2;
+        }
+        oracle->storeBasis( m, B );
+        dense.obtainFreshBasis();
+        sparse.obtainFreshBasis();
+
+        compareTransformations( dense, sparse, m );
+
+        double newColumn[m];
+        double changeColumn[m];
+        double otherChangeColumn[m];
+        for ( unsigned step = 0; step < 10; ++step )
+        {
+            unsigned column = ( step * 13 + 2 ) % m;
+            std::fill_n( newColumn, m, 0 );
+            newColumn[column] = 4;
+            newColumn[( column + step + 1 ) % m] = -1;
+            newColumn[( column + 3 * step + 5 ) % m] += 0.5;
+
+            dense.forwardTransformation( newColumn, changeColumn );
+            sparse.forwardTransformation( newColumn, otherChangeColumn );
+            for ( unsigned i = 0; i < m; ++i )
+                TS_ASSERT( FloatUtils::areEqual( changeColumn[i], otherChangeColumn[i] ) );
+
+            // Either factorization may refactorize, so the oracle needs to follow the basis
+            for ( unsigned i = 0; i < m; ++i )
+                B[i * m + column] = newColumn[i];
+            oracle->storeBasis( m, B );
+
+            dense.updateToAdjacentBasis( column, changeColumn, newColumn );
+            sparse.updateToAdjacentBasis( column, changeColumn, newColumn );
+        }
+
+        compareTransformations( dense, sparse, m );
+    }
+
+    void compareTransformations( DenseLUFactorization &dense,
+                                 SparseLUFactorization &sparse,
+                                 unsigned m )
+    {
+        double *y = new double[m];
+        double *x1 = new double[m];
+        double *x2 = new double[m];
+        double *x3 = new double[m];
+        unsigned *xIndices = new unsigned[m];
+        unsigned xNnz;
+
+        for ( unsigned i = 0; i < m; ++i )
+        {
+            SparseUnsortedList sparseY( m );
+            sparseY.append( i, 1 );
+            sparseY.append( ( i + 4 ) % m, -2.5 );
+            sparseY.toDense( y );
+
+            for ( unsigned direction = 0; direction < 2; ++direction )
+            {
+                std::fill_n( x3, m, 0 );
+                if ( direction == 0 )
+                {
+                    dense.forwardTransformation( y, x1 );
+                    sparse.forwardTransformation( y, x2 );
+                    dense.forwardTransformation( sparseY, x3, xIndices, xNnz );
+                }
+                else
+                {
+                    dense.backwardTransformation( y, x1 );
+                    sparse.backwardTransformation( y, x2 );
+                    dense.backwardTransformation( sparseY, x3, xIndices, xNnz );
+                }
+
+                unsigned expectedNnz = 0;
+                for ( unsigned j = 0; j < m; ++j )
+                {
+                    TS_ASSERT( FloatUtils::areEqual( x1[j], x2[j] ) );
+                    TS_ASSERT_EQUALS( x1[j], x3[j] );
+                    if ( x1[j] != 0 )
+                        ++expectedNnz;
+                }
+                TS_ASSERT_EQUALS( xNnz, expectedNnz );
+            }
+        }
+
+        delete[] xIndices;
+        delete[] x3;
+        delete[] x2;
+        delete[] x1;
+        delete[] y;
+    }
+
+    void test_store_and_restore()
+    {
+        DenseLUFactorization basis( 3, *oracle );
+        DenseLUFactorization otherBasis( 3, *oracle );
+
+        double B[] = {
+            1, 0, 0, //
+            0, 1, 0, //
+            0, 0, 1, //
+        };
+        oracle->storeBasis( 3, B );
+        basis.obtainFreshBasis();
+
+        double a1[] = { 1, 1, 3 };
+        basis.updateToAdjacentBasis( 1, a1, NULL );
+
+        // Storing condenses the etas, so the oracle needs to provide the current basis
+        double currentBasis[] = {
+            1, 1, 0, //
+            0, 1, 0, //
+            0, 3, 1  //
+        };
+        oracle->storeBasis( 3, currentBasis );
+
+        double a2[] = { 3, 1, 4 };
+        double d2[] = { 0, 0, 0 };
+        double d2other[] = { 0, 0, 0 };
+        double expected2[] = { 2, 1, 1 };
+
+        basis.storeFactorization( &otherBasis );
+        TS_ASSERT_EQUALS( basis.getNumberOfEtas(), 0U );
+        TS_ASSERT_THROWS_NOTHING( basis.forwardTransformation( a2, d2 ) );
+        TS_ASSERT_THROWS_NOTHING( otherBasis.forwardTransformation( a2, d2other ) );
+
+        for ( unsigned i = 0; i < 3; ++i )
+        {
+            TS_ASSERT( FloatUtils::areEqual( expected2[i], d2[i] ) );
+            TS_ASSERT( FloatUtils::areEqual( expected2[i], d2other[i] ) );
+        }
+
+        // Change the original basis, and then restore it
+        basis.updateToAdjacentBasis( 0, d2, NULL );
+        TS_ASSERT_THROWS_NOTHING( basis.forwardTransformation( a2, d2 ) );
+        TS_ASSERT( !FloatUtils::areEqual( expected2[0], d2[0] ) );
+
+        basis.restoreFactorization( &otherBasis );
+        TS_ASSERT_EQUALS( basis.getNumberOfEtas(), 0U );
+        TS_ASSERT_THROWS_NOTHING( basis.forwardTransformation( a2, d2 ) );
+        for ( unsigned i = 0; i < 3; ++i )
+            TS_ASSERT( FloatUtils::areEqual( expected2[i], d2[i] ) );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,171 @@
+/*********************                                                        */
+/*! \file Test_RefactorizationPolicy.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "GlobalConfiguration.h"
+#include "RefactorizationPolicy.h"
+#include "Statistics.h"
+
+#include <cxxtest/TestSuite.h>
+
+class MockForRefactorizationPolicy
+{
+public:
+};
+
+class RefactorizationPolicyTestSuite : public CxxTest::TestSuite
+{
+public:
+    MockForRefactorizationPolicy *mock;
+
+    void setUp()
+    {
+        TS_ASSERT( mock = new MockForRefactorizationPolicy );
+    }
+
+    void tearDown()
+    {
+        TS_ASSERT_THROWS_NOTHING( delete mock );
+    }
+
+    /*
+      Simulate iterations with two transformations each, where every
+      update grows the factors by the given amount. Return the number
+      of updates performed before the policy asked to refactorize.
+    */
+    unsigned updatesUntilRefactorization( RefactorizationPolicy &policy,
+                                          unsigned long long factorsSize,
+                                          unsigned long long growth )
+    {
+        unsigned updates = 0;
+        while ( updates < 2 * GlobalConfiguration::REFACTORIZATION_MAX_ETAS )
+        {
+            policy.transformationPerformed();
+            policy.transformationPerformed();
+
+            if ( policy.shouldRefactorize( updates ) )
+                return updates;
+
+            factorsSize += growth;
+            policy.updatePerformed( factorsSize );
+            ++updates;
+        }
+
+        return updates;
+    }
+
+    void test_refactorize_when_growth_outweighs_factorization()
+    {
+        Statistics statistics;
+        RefactorizationPolicy policy;
+        policy.setStatistics( &statistics );
+
+        /*
+          After j updates, the 2(j + 1) transformations have cost
+          10j(j + 1) more than they would have with the current factors.
+          This exceeds the factorization cost of 1000 once j = 10.
+        */
+        policy.factorizationPerformed( 1000, 100 );
+        TS_ASSERT_EQUALS( updatesUntilRefactorization( policy, 100, 10 ), 10U );
+
+        TS_ASSERT_EQUALS(
+            statistics.getLongAttribute( Statistics::NUM_REFACTORIZATIONS_DUE_TO_SOLVE_COST ), 1U );
+        TS_ASSERT_EQUALS(
+            statistics.getLongAttribute( Statistics::NUM_BASIS_UPDATES_BEFORE_REFACTORIZATION ),
+            10U );
+
+        // A costlier factorization is kept longer: j(j + 1) > 400 once j = 20
+        policy.factorizationPerformed( 4000, 100 );
+        TS_ASSERT_EQUALS( updatesUntilRefactorization( policy, 100, 10 ), 20U );
+
+        // Faster growth means earlier refactorization: 50j(j + 1) > 4000 once j = 9
+        policy.factorizationPerformed( 4000, 100 );
+        TS_ASSERT_EQUALS( updatesUntilRefactorization( policy, 100, 50 ), 9U );
+
+        TS_ASSERT_EQUALS(
+            statistics.getLongAttribute( Statistics::NUM_REFACTORIZATIONS_DUE_TO_SOLVE_COST ), 3U );
+        TS_ASSERT_EQUALS(
+            statistics.getLongAttribute( Statistics::NUM_BASIS_UPDATES_BEFORE_REFACTORIZATION ),
+            39U );
+        TS_ASSERT_EQUALS(
+            statistics.getLongAttribute( Statistics::NUM_REFACTORIZATIONS_DUE_TO_ETA_LIMIT ), 0U );
+    }
+
+    void test_eta_limit()
+    {
+        Statistics statistics;
+        RefactorizationPolicy policy;
+        policy.setStatistics( &statistics );
+
+        // Factors that do not grow are never too costly, but the number of etas is bounded
+        policy.factorizationPerformed( 1000, 100 );
+        TS_ASSERT_EQUALS( updatesUntilRefactorization( policy, 100, 0 ),
+                          GlobalConfiguration::REFACTORIZATION_MAX_ETAS );
+
+        TS_ASSERT_EQUALS(
+            statistics.getLongAttribute( Statistics::NUM_REFACTORIZATIONS_DUE_TO_ETA_LIMIT ), 1U );
+        TS_ASSERT_EQUALS(
+            statistics.getLongAttribute( Statistics::NUM_REFACTORIZATIONS_DUE_TO_SOLVE_COST ), 0U );
+    }
+
+    void test_no_transformations()
+    {
+        RefactorizationPolicy policy;
+        policy.factorizationPerformed( 0, 100 );
+
+        // Updates without transformations cost nothing extra
+        for ( unsigned i = 0; i < 10; ++i )
+        {
+            TS_ASSERT( !policy.shouldRefactorize( i ) );
+            policy.updatePerformed( 100 + 10 * i );
+        }
+
+        policy.transformationPerformed();
+        policy.updatePerformed( 300 );
+        TS_ASSERT( policy.shouldRefactorize( 11 ) );
+    }
+
+    void test_excluded_transformations()
+    {
+        RefactorizationPolicy policy;
+        policy.factorizationPerformed( 1000, 100 );
+
+        /*
+          Many transformations with the fresh factors, e.g. for bound
+          tightening, would make the growth of the factors seem costly.
+          Excluded, they do not affect the decision.
+        */
+        for ( unsigned i = 0; i < 50; ++i )
+        {
+            policy.transformationPerformed();
+            policy.transformationExcluded();
+        }
+
+        TS_ASSERT_EQUALS( updatesUntilRefactorization( policy, 100, 10 ), 10U );
+
+        policy.factorizationPerformed( 1000, 100 );
+        for ( unsigned i = 0; i < 50; ++i )
+            policy.transformationPerformed();
+
+        TS_ASSERT_EQUALS( updatesUntilRefactorization( policy, 100, 10 ), 2U );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
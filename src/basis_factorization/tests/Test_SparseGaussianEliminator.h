@@ -18,8 +18,10 @@
 #include "EtaMatrix.h"
 #include "FloatUtils.h"
 #include "SparseGaussianEliminator.h"
+#include "Statistics.h"
 
 #include <cstring>
+#include <random>
 #include <cxxtest/TestSuite.h>
 
 class MockForSparseGaussianEliminator
@@ -140,6 +142,23 @@ public:
         }
     }
 
+    void checkFactorization( const double *A, unsigned m, SparseLUFactors *lu )
+    {
+        double *result = new double[m * m];
+        computeMatrixFromFactorization( lu, result );
+        for ( unsigned i = 0; i < m * m; ++i )
+            TS_ASSERT( FloatUtils::areEqual( A[i], result[i] ) );
+
+        double *At = new double[m * m];
+        transposeMatrix( A, At, m );
+        computeTransposedMatrixFromFactorization( lu, result );
+        for ( unsigned i = 0; i < m * m; ++i )
+            TS_ASSERT( FloatUtils::areEqual( At[i], result[i] ) );
+
+        delete[] At;
+        delete[] result;
+    }
+
     void test_sanity()
     {
         SparseLUFactors lu3( 3 );
@@ -328,6 +347,92 @@ public:
             TS_ASSERT_THROWS_NOTHING( delete ge );
         }
     }
+
+    void test_markowitz_pivoting_avoids_fill_in()
+    {
+        /*
+          An arrow matrix: eliminating with the dense first row and
+          column as the first pivot would fill in the entire matrix,
+          whereas the Markowitz rule causes no fill-in at all.
+        */
+        const unsigned m = 6;
+        double A[m * m];
+        std::fill_n( A, m * m, 0.0 );
+        for ( unsigned i = 0; i < m; ++i )
+        {
+            A[i] = 1;
+            A[i * m] = 1;
+            A[i * m + i] = 4;
+        }
+
+        SparseColumnsOfBasis sparseCols( m );
+        basisIntoSparseColumns( A, m, sparseCols );
+
+        SparseLUFactors lu( m );
+        Statistics statistics;
+        SparseGaussianEliminator ge( m );
+        ge.setStatistics( &statistics );
+
+        TS_ASSERT_THROWS_NOTHING( ge.run( &sparseCols, &lu ) );
+        checkFactorization( A, m, &lu );
+
+        TS_ASSERT_EQUALS(
+            statistics.getLongAttribute( Statistics::NUM_BASIS_FACTORIZATION_INPUT_NONZEROS ),
+            3 * m - 2 );
+        TS_ASSERT_EQUALS( statistics.getLongAttribute( Statistics::NUM_BASIS_FACTORIZATION_FILL_IN ),
+                          0U );
+    }
+
+    void test_slack_heavy_basis()
+    {
+        /*
+          Most columns are slack columns, as in the bases of the
+          Marabou tableau; the rest are sparse structural columns. The
+          slack columns are singletons, and are pivoted on first.
+        */
+        const unsigned m = 40;
+        const unsigned numStructural = 8;
+        double A[m * m];
+        std::fill_n( A, m * m, 0.0 );
+
+        std::mt19937 random( 1 );
+        std::uniform_int_distribution<unsigned> row( 0, m - 1 );
+        std::uniform_real_distribution<double> value( -1, 1 );
+
+        for ( unsigned j = 0; j < m; ++j )
+        {
+            if ( j < numStructural )
+            {
+                for ( unsigned k = 0; k < 6; ++k )
+                    A[row( random ) * m + j] = value( random );
+                A[j * m + j] = 5;
+            }
+            else
+                A[j * m + j] = ( j % 2 ) ? 1 : -1;
+        }
+
+        SparseColumnsOfBasis sparseCols( m );
+        basisIntoSparseColumns( A, m, sparseCols );
+
+        SparseLUFactors lu( m );
+        Statistics statistics;
+        SparseGaussianEliminator ge( m );
+        ge.setStatistics( &statistics );
+
+        TS_ASSERT_THROWS_NOTHING( ge.run( &sparseCols, &lu ) );
+        checkFactorization( A, m, &lu );
+
+        TS_ASSERT_LESS_THAN_EQUALS(
+            m - numStructural,
+            statistics.getLongAttribute( Statistics::NUM_BASIS_FACTORIZATION_SINGLETON_PIVOTS ) );
+
+        // Factorizing again gives the same result, and the counters add up
+        TS_ASSERT_THROWS_NOTHING( ge.run( &sparseCols, &lu ) );
+        checkFactorization( A, m, &lu );
+        TS_ASSERT_LESS_THAN_EQUALS(
+            2 * ( m - numStructural ),
+            statistics.getLongAttribute( Statistics::NUM_BASIS_FACTORIZATION_SINGLETON_PIVOTS ) );
+    }
 };
 
 //
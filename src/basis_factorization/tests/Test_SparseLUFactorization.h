@@ -20,7 +20,9 @@
 #include "List.h"
 #include "MockColumnOracle.h"
 #include "MockErrno.h"
+#include "Set.h"
 #include "SparseLUFactorization.h"
+#include "SparseUnsortedList.h"
 
 #include <cxxtest/TestSuite.h>
 
@@ -350,6 +352,106 @@ public:
         TS_ASSERT_THROWS_NOTHING( basis.forwardTransformation( a3, d3 ) );
         TS_ASSERT( memcmp( d3other, d3, sizeof( double ) * 3 ) );
     }
+
+    void test_hypersparse_transformations()
+    {
+        /*
+          A sparse 20x20 basis: a diagonal, plus a few off-diagonal
+          entries that chain some of the rows and columns together.
+          Right hand sides with one or two entries are sparse enough to be handled by the
+          hypersparse transformations, which should agree with the
+          dense ones.
+        */
+        const unsigned m = 20;
+        SparseLUFactorization basis( m, *oracle );
+
+        double B[m * m];
+        std::fill_n( B, m * m, 0 );
+        for ( unsigned i = 0; i < m; ++i )
+        {
+            B[i * m + i] = 4 + i % 3;
+            if ( i + 1 < m && i % 4 != 3 )
+                B[( i + 1 ) * m + i] = 1;
+            if ( i >= 5 && i % 2 == 0 )
+                B[( i - 5 ) * m + i] = -2;
+        }
+        oracle->storeBasis( m, B );
+        basis.obtainFreshBasis();
+
+        checkHypersparseTransformations( basis, m );
+
+        // Replace a couple of columns, to have the etas involved too
+        double newColumn[m];
+        double changeColumn[m];
+        for ( unsigned column = 3; column < m; column += 7 )
+        {
+            std::fill_n( newColumn, m, 0 );
+            newColumn[column] = 3;
+            newColumn[( column + 2 ) % m] = -1;
+
+            basis.forwardTransformation( newColumn, changeColumn );
+            basis.updateToAdjacentBasis( column, changeColumn, newColumn );
+        }
+
+        checkHypersparseTransformations( basis, m );
+    }
+
+    void checkHypersparseTransformations( SparseLUFactorization &basis, unsigned m )
+    {
+        double *dense = new double[m];
+        double *expected = new double[m];
+        double *x = new double[m];
+        unsigned *xIndices = new unsigned[m];
+        unsigned xNnz;
+
+        for ( unsigned i = 0; i < m; ++i )
+        {
+            SparseUnsortedList y( m );
+            y.append( i, 1 );
+            if ( i + 1 < m )
+                y.append( i + 1, -0.5 );
+            y.toDense( dense );
+
+            for ( unsigned direction = 0; direction < 2; ++direction )
+            {
+                if ( direction == 0 )
+                {
+                    basis.forwardTransformation( dense, expected );
+                    std::fill_n( x, m, 0 );
+                    TS_ASSERT_THROWS_NOTHING( basis.forwardTransformation( y, x, xIndices, xNnz ) );
+                }
+                else
+                {
+                    basis.backwardTransformation( dense, expected );
+                    std::fill_n( x, m, 0 );
+                    TS_ASSERT_THROWS_NOTHING(
+                        basis.backwardTransformation( y, x, xIndices, xNnz ) );
+                }
+
+                for ( unsigned j = 0; j < m; ++j )
+                    TS_ASSERT( FloatUtils::areEqual( x[j], expected[j] ) );
+
+                // Every non-zero entry is listed, exactly once
+                TS_ASSERT( xNnz <= m );
+                Set<unsigned> listed;
+                for ( unsigned j = 0; j < xNnz; ++j )
+                {
+                    TS_ASSERT( !listed.exists( xIndices[j] ) );
+                    listed.insert( xIndices[j] );
+                }
+                for ( unsigned j = 0; j < m; ++j )
+                {
+                    if ( !listed.exists( j ) )
+                        TS_ASSERT_EQUALS( x[j], 0.0 );
+                }
+            }
+        }
+
+        delete[] xIndices;
+        delete[] x;
+        delete[] expected;
+        delete[] dense;
+    }
 };
 
 //
@@ -173,6 +173,45 @@ public:
         TS_ASSERT_THROWS_NOTHING( v1.mergeEntries( 2, 4 ) );
 
         TS_ASSERT_EQUALS( v1.getNnz(), 0U );
+
+        // Target before source, and a merge that does not cancel out
+        v1.set( 1, 2 );
+        v1.set( 3, 5 );
+        v1.set( 0, 1 );
+
+        TS_ASSERT_THROWS_NOTHING( v1.mergeEntries( 0, 3 ) );
+        TS_ASSERT_EQUALS( v1.getNnz(), 2U );
+        TS_ASSERT_EQUALS( v1.get( 0 ), 0 );
+        TS_ASSERT_EQUALS( v1.get( 1 ), 2 );
+        TS_ASSERT_EQUALS( v1.get( 3 ), 6 );
+    }
+
+    void test_erase_preserves_order()
+    {
+        SparseUnsortedList v1( 6 );
+        v1.reserve( 4 );
+
+        v1.append( 5, 1 );
+        v1.append( 0, 2 );
+        v1.append( 3, 3 );
+        v1.append( 1, 4 );
+
+        for ( auto it = v1.begin(); it != v1.end(); )
+        {
+            if ( it->_index == 0 )
+                it = v1.erase( it );
+            else
+                ++it;
+        }
+
+        unsigned expectedIndices[] = { 5, 3, 1 };
+        unsigned i = 0;
+        for ( const auto &entry : v1 )
+        {
+            TS_ASSERT_EQUALS( entry._index, expectedIndices[i] );
+            ++i;
+        }
+        TS_ASSERT_EQUALS( i, 3U );
     }
 };
 
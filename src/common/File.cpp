@@ -23,9 +23,15 @@
 #include "T/unistd.h"
 #include "Vector.h"
 
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
+
 File::File( const String &path )
     : _path( path )
     , _descriptor( NO_DESCRIPTOR )
+    , _mappedData( NULL )
+    , _mappedSize( 0 )
 {
 }
 
@@ -142,8 +148,56 @@ String File::readLine( char lineSeparatingChar )
     return result;
 }
 
+const char *File::map( unsigned &size )
+{
+    if ( !_mappedData )
+    {
+        _mappedSize = getSize( _path );
+        if ( _mappedSize == 0 )
+        {
+            size = 0;
+            return "";
+        }
+
+#ifndef _WIN32
+        void *mapping = mmap( NULL, _mappedSize, PROT_READ, MAP_PRIVATE, _descriptor, 0 );
+        if ( mapping == MAP_FAILED )
+            throw CommonError( CommonError::READ_FAILED, _path.ascii() );
+        _mappedData = (char *)mapping;
+#else
+        _mappedData = new char[_mappedSize];
+        unsigned totalRead = 0;
+        while ( totalRead < _mappedSize )
+        {
+            int n = T::read( _descriptor, _mappedData + totalRead, _mappedSize - totalRead );
+            if ( n <= 0 )
+            {
+                delete[] _mappedData;
+                _mappedData = NULL;
+                throw CommonError( CommonError::READ_FAILED, _path.ascii() );
+            }
+            totalRead += n;
+        }
+#endif
+    }
+
+    size = _mappedSize;
+    return _mappedData;
+}
+
 void File::closeIfNeeded()
 {
+    if ( _mappedData )
+    {
+#ifndef _WIN32
+        munmap( _mappedData, _mappedSize );
+#else
+        delete[] _mappedData;
+#endif
+        _mappedData = NULL;
+        _mappedSize = 0;
+    }
+
     if ( _descriptor != NO_DESCRIPTOR )
     {
         T::close( _descriptor );
@@ -72,6 +72,7 @@ public:
     void write( const ConstSimpleData &data );
     void read( HeapData &buffer, unsigned maxReadSize );
     String readLine( char lineSeparatingChar = '\n' );
+    const char *map( unsigned &size );
 
 private:
     enum {
@@ -82,6 +83,9 @@ private:
     int _descriptor;
     String _readLineBuffer;
 
+    char *_mappedData;
+    unsigned _mappedSize;
+
     void closeIfNeeded();
 };
 
@@ -0,0 +1,251 @@
+/*********************                                                        */
+/*! \file FlatMap.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** A map with the interface of Map, stored as a vector of pairs sorted by
+ ** key. Lookups are binary searches over contiguous memory, and no memory
+ ** is allocated per entry. Inserting a key larger than all existing keys
+ ** takes amortized constant time; other insertions and erasures shift the
+ ** entries after them, so this container suits small maps, and maps that
+ ** are mostly built in key order.
+
+ **/
+
+#ifndef __FlatMap_h__
+#define __FlatMap_h__
+
+#include "CommonError.h"
+#include "Set.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+template <class Key, class Value> class FlatMap
+{
+    typedef std::pair<Key, Value> Entry;
+    typedef std::vector<Entry> Super;
+
+public:
+    typedef typename Super::iterator iterator;
+    typedef typename Super::const_iterator const_iterator;
+    typedef typename Super::reverse_iterator reverse_iterator;
+    typedef typename Super::const_reverse_iterator const_reverse_iterator;
+
+    Value &operator[]( const Key &key )
+    {
+        iterator it = lowerBound( key );
+        if ( it == _container.end() || it->first != key )
+            it = _container.insert( it, Entry( key, Value() ) );
+
+        return it->second;
+    }
+
+    const Value &operator[]( const Key &key ) const
+    {
+        return at( key );
+    }
+
+    const Value &at( const Key &key ) const
+    {
+        const_iterator it = find( key );
+        if ( it == _container.end() )
+            throw CommonError( CommonError::KEY_DOESNT_EXIST_IN_MAP );
+
+        return it->second;
+    }
+
+    Value &at( const Key &key )
+    {
+        iterator it = find( key );
+        if ( it == _container.end() )
+            throw CommonError( CommonError::KEY_DOESNT_EXIST_IN_MAP );
+
+        return it->second;
+    }
+
+    Value get( const Key &key ) const
+    {
+        return at( key );
+    }
+
+    Set<Value> values() const
+    {
+        Set<Value> result;
+        for ( const auto &it : _container )
+            result.insert( it.second );
+
+        return result;
+    }
+
+    Set<Key> keys() const
+    {
+        Set<Key> result;
+        for ( const auto &it : _container )
+            result.insert( it.first );
+
+        return result;
+    }
+
+    bool operator==( const FlatMap<Key, Value> &other ) const
+    {
+        return _container == other._container;
+    }
+
+    bool operator!=( const FlatMap<Key, Value> &other ) const
+    {
+        return _container != other._container;
+    }
+
+    bool empty() const
+    {
+        return _container.empty();
+    }
+
+    unsigned size() const
+    {
+        return _container.size();
+    }
+
+    void reserve( unsigned size )
+    {
+        _container.reserve( size );
+    }
+
+    /*
+      As with Map, inserting an existing key does not change its value
+    */
+    void insert( const Key &key, Value value )
+    {
+        iterator it = lowerBound( key );
+        if ( it == _container.end() || it->first != key )
+            _container.insert( it, Entry( key, value ) );
+    }
+
+    void setIfDoesNotExist( const Key &key, const Value &value )
+    {
+        insert( key, value );
+    }
+
+    bool exists( const Key &key ) const
+    {
+        return find( key ) != _container.end();
+    }
+
+    iterator find( const Key &key )
+    {
+        iterator it = lowerBound( key );
+        return ( it != _container.end() && it->first == key ) ? it : _container.end();
+    }
+
+    const_iterator find( const Key &key ) const
+    {
+        const_iterator it = lowerBound( key );
+        return ( it != _container.end() && it->first == key ) ? it : _container.end();
+    }
+
+    void erase( const Key &key )
+    {
+        iterator it = find( key );
+        if ( it == _container.end() )
+            throw CommonError( CommonError::KEY_DOESNT_EXIST_IN_MAP );
+
+        _container.erase( it );
+    }
+
+    iterator erase( iterator it )
+    {
+        return _container.erase( it );
+    }
+
+    iterator begin()
+    {
+        return _container.begin();
+    }
+
+    iterator end()
+    {
+        return _container.end();
+    }
+
+    const_iterator begin() const
+    {
+        return _container.begin();
+    }
+
+    const_iterator end() const
+    {
+        return _container.end();
+    }
+
+    reverse_iterator rbegin()
+    {
+        return _container.rbegin();
+    }
+
+    reverse_iterator rend()
+    {
+        return _container.rend();
+    }
+
+    const_reverse_iterator rbegin() const
+    {
+        return _container.rbegin();
+    }
+
+    const_reverse_iterator rend() const
+    {
+        return _container.rend();
+    }
+
+    void clear()
+    {
+        _container.clear();
+    }
+
+private:
+    Super _container;
+
+    static bool keyLess( const Entry &entry, const Key &key )
+    {
+        return entry.first < key;
+    }
+
+    /*
+      The first entry whose key is not smaller than the given key. Keys
+      are often added in increasing order, so the last entry is checked
+      before searching.
+    */
+    iterator lowerBound( const Key &key )
+    {
+        if ( _container.empty() || _container.back().first < key )
+            return _container.end();
+
+        return std::lower_bound( _container.begin(), _container.end(), key, keyLess );
+    }
+
+    const_iterator lowerBound( const Key &key ) const
+    {
+        if ( _container.empty() || _container.back().first < key )
+            return _container.end();
+
+        return std::lower_bound( _container.begin(), _container.end(), key, keyLess );
+    }
+};
+
+#endif // __FlatMap_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
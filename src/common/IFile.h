@@ -32,6 +32,14 @@ public:
     virtual void write( const String &line ) = 0;
     virtual String readLine( char lineSeparatingChar = '\n' ) = 0;
     virtual void read( HeapData &buffer, unsigned maxReadSize ) = 0;
+
+    /*
+      Map the entire contents of a file opened for reading into memory,
+      and return them. The contents remain valid until the file is
+      closed.
+    */
+    virtual const char *map( unsigned &size ) = 0;
+
     virtual void close() = 0;
 
     static bool exists( const String &path );
@@ -0,0 +1,112 @@
+/*********************                                                        */
+/*! \file ILPSolver.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** The interface of the (MI)LP solvers used by the LP/MILP-based bound
+ ** tightening of the network level reasoner. It is implemented by the
+ ** GurobiWrapper, and by the NativeLPSolver that uses Marabou's own
+ ** simplex machinery and is available without Gurobi.
+
+**/
+
+#ifndef __ILPSolver_h__
+#define __ILPSolver_h__
+
+#include "List.h"
+#include "MString.h"
+#include "Map.h"
+
+class ILPSolver
+{
+public:
+    enum VariableType {
+        CONTINUOUS = 0,
+        BINARY = 1,
+        INTEGER = 2,
+    };
+
+    /*
+      A term has the form: coefficient * variable
+    */
+    struct Term
+    {
+        Term( double coefficient, String variable )
+            : _coefficient( coefficient )
+            , _variable( variable )
+        {
+        }
+
+        Term()
+            : _coefficient( 0 )
+            , _variable( "" )
+        {
+        }
+
+        double _coefficient;
+        String _variable;
+    };
+
+    virtual ~ILPSolver()
+    {
+    }
+
+    // Add a new variable to the model
+    virtual void addVariable( String name, double lb, double ub, VariableType type = CONTINUOUS ) = 0;
+
+    // Set the lower or upper bound for an existing variable
+    virtual void setLowerBound( String name, double lb ) = 0;
+    virtual void setUpperBound( String name, double ub ) = 0;
+
+    // Add a new LEQ, GEQ or EQ constraint, e.g. 3x + 4y <= -5
+    virtual void addLeqConstraint( const List<Term> &terms, double scalar ) = 0;
+    virtual void addGeqConstraint( const List<Term> &terms, double scalar ) = 0;
+    virtual void addEqConstraint( const List<Term> &terms, double scalar ) = 0;
+
+    // A cost function to minimize, or an objective function to maximize
+    virtual void setCost( const List<Term> &terms, double constant = 0 ) = 0;
+    virtual void setObjective( const List<Term> &terms, double constant = 0 ) = 0;
+
+    // Set a cutoff value for the objective function
+    virtual void setCutoff( double cutoff ) = 0;
+
+    // Specify a time limit, in seconds
+    virtual void setTimeLimit( double seconds ) = 0;
+
+    virtual bool containsVariable( String name ) const = 0;
+
+    // Solve, and query the status of the last solve
+    virtual void solve() = 0;
+    virtual bool optimal() = 0;
+    virtual bool cutoffOccurred() = 0;
+    virtual bool infeasible() = 0;
+    virtual bool timeout() = 0;
+    virtual bool haveFeasibleSolution() = 0;
+
+    // Extract the solution, or the best known bound on the objective
+    // function
+    virtual void extractSolution( Map<String, double> &values, double &costOrObjective ) = 0;
+    virtual double getObjectiveBound() = 0;
+
+    // Reset the result of the last solve, keeping the model
+    virtual void reset() = 0;
+
+    // Clear the underlying model and create a fresh model
+    virtual void resetModel() = 0;
+};
+
+#endif // __ILPSolver_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -15,6 +15,8 @@
 
 #include "MatrixMultiplication.h"
 
+#include <algorithm>
+
 #ifdef ENABLE_OPENBLAS
 #include "cblas.h"
 void matrixMultiplication( const double *matA,
@@ -45,7 +47,34 @@ void matrixMultiplication( const double *matA,
                  matC,
                  columnsB );
 }
+
+void symbolicBoundMultiplication( const double *symbolicLb,
+                                  const double *symbolicUb,
+                                  const double *positiveWeights,
+                                  const double *negativeWeights,
+                                  double *newSymbolicLb,
+                                  double *newSymbolicUb,
+                                  unsigned rowsA,
+                                  unsigned columnsA,
+                                  unsigned columnsB )
+{
+    // The BLAS kernels are already blocked and vectorized
+    matrixMultiplication( symbolicUb, positiveWeights, newSymbolicUb, rowsA, columnsA, columnsB );
+    matrixMultiplication( symbolicLb, negativeWeights, newSymbolicUb, rowsA, columnsA, columnsB );
+    matrixMultiplication( symbolicLb, positiveWeights, newSymbolicLb, rowsA, columnsA, columnsB );
+    matrixMultiplication( symbolicUb, negativeWeights, newSymbolicLb, rowsA, columnsA, columnsB );
+}
 #else
+/*
+  The fallback kernels traverse the matrices in i-k-j order, so that
+  the innermost loop runs over contiguous rows of matB and matC and
+  can be vectorized by the compiler. The k and j dimensions are
+  blocked, so that the active panel of matB stays in cache while all
+  rows of matA are processed.
+*/
+static const unsigned MATRIX_MULTIPLICATION_K_BLOCK_SIZE = 64;
+static const unsigned MATRIX_MULTIPLICATION_J_BLOCK_SIZE = 128;
+
 void matrixMultiplication( const double *matA,
                            const double *matB,
                            double *matC,
@@ -53,13 +82,78 @@ void matrixMultiplication( const double *matA,
                            unsigned columnsA,
                            unsigned columnsB )
 {
-    for ( unsigned i = 0; i < rowsA; ++i )
+    for ( unsigned kBlock = 0; kBlock < columnsA; kBlock += MATRIX_MULTIPLICATION_K_BLOCK_SIZE )
     {
-        for ( unsigned j = 0; j < columnsB; ++j )
+        unsigned kEnd = std::min( kBlock + MATRIX_MULTIPLICATION_K_BLOCK_SIZE, columnsA );
+
+        for ( unsigned jBlock = 0; jBlock < columnsB;
+              jBlock += MATRIX_MULTIPLICATION_J_BLOCK_SIZE )
         {
-            for ( unsigned k = 0; k < columnsA; ++k )
+            unsigned jEnd = std::min( jBlock + MATRIX_MULTIPLICATION_J_BLOCK_SIZE, columnsB );
+
+            for ( unsigned i = 0; i < rowsA; ++i )
             {
-                matC[i * columnsB + j] += matA[i * columnsA + k] * matB[k * columnsB + j];
+                const double *rowA = matA + i * columnsA;
+                double *__restrict rowC = matC + i * columnsB;
+
+                for ( unsigned k = kBlock; k < kEnd; ++k )
+                {
+                    double a = rowA[k];
+                    if ( a == 0 )
+                        continue;
+
+                    const double *__restrict rowB = matB + k * columnsB;
+                    for ( unsigned j = jBlock; j < jEnd; ++j )
+                        rowC[j] += a * rowB[j];
+                }
+            }
+        }
+    }
+}
+
+void symbolicBoundMultiplication( const double *symbolicLb,
+                                  const double *symbolicUb,
+                                  const double *positiveWeights,
+                                  const double *negativeWeights,
+                                  double *newSymbolicLb,
+                                  double *newSymbolicUb,
+                                  unsigned rowsA,
+                                  unsigned columnsA,
+                                  unsigned columnsB )
+{
+    for ( unsigned kBlock = 0; kBlock < columnsA; kBlock += MATRIX_MULTIPLICATION_K_BLOCK_SIZE )
+    {
+        unsigned kEnd = std::min( kBlock + MATRIX_MULTIPLICATION_K_BLOCK_SIZE, columnsA );
+
+        for ( unsigned jBlock = 0; jBlock < columnsB;
+              jBlock += MATRIX_MULTIPLICATION_J_BLOCK_SIZE )
+        {
+            unsigned jEnd = std::min( jBlock + MATRIX_MULTIPLICATION_J_BLOCK_SIZE, columnsB );
+
+            for ( unsigned i = 0; i < rowsA; ++i )
+            {
+                const double *rowLb = symbolicLb + i * columnsA;
+                const double *rowUb = symbolicUb + i * columnsA;
+                double *__restrict newRowLb = newSymbolicLb + i * columnsB;
+                double *__restrict newRowUb = newSymbolicUb + i * columnsB;
+
+                for ( unsigned k = kBlock; k < kEnd; ++k )
+                {
+                    double lb = rowLb[k];
+                    double ub = rowUb[k];
+
+                    // Symbolic bounds of early layers are mostly zero
+                    if ( lb == 0 && ub == 0 )
+                        continue;
+
+                    const double *__restrict positiveRow = positiveWeights + k * columnsB;
+                    const double *__restrict negativeRow = negativeWeights + k * columnsB;
+                    for ( unsigned j = jBlock; j < jEnd; ++j )
+                    {
+                        newRowUb[j] += ub * positiveRow[j] + lb * negativeRow[j];
+                        newRowLb[j] += lb * positiveRow[j] + ub * negativeRow[j];
+                    }
+                }
             }
         }
     }
@@ -14,4 +14,27 @@ void matrixMultiplication( const double *matA,
                            unsigned columnsA,
                            unsigned columnsB );
 
+/*
+  Propagate a pair of symbolic bounds through a weight matrix that
+  has been split into its positive and negative parts.
+
+  The size of symbolicLb and symbolicUb is rowsA x columnsA, and the
+  size of positiveWeights and negativeWeights is columnsA x columnsB.
+  Compute
+
+    newSymbolicUb += symbolicUb * positiveWeights + symbolicLb * negativeWeights
+    newSymbolicLb += symbolicLb * positiveWeights + symbolicUb * negativeWeights
+
+  in a single sweep over the inputs.
+*/
+void symbolicBoundMultiplication( const double *symbolicLb,
+                                  const double *symbolicUb,
+                                  const double *positiveWeights,
+                                  const double *negativeWeights,
+                                  double *newSymbolicLb,
+                                  double *newSymbolicUb,
+                                  unsigned rowsA,
+                                  unsigned columnsA,
+                                  unsigned columnsB );
+
 #endif // __MatrixMultiplication_h__
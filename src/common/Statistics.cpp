@@ -30,6 +30,11 @@ Statistics::Statistics()
     _unsignedAttributes[MAX_DECISION_LEVEL] = 0;
     _unsignedAttributes[NUM_SPLITS] = 0;
     _unsignedAttributes[NUM_POPS] = 0;
+    _unsignedAttributes[NUM_BACKJUMPS] = 0;
+    _unsignedAttributes[NUM_LEVELS_SKIPPED_BY_BACKJUMPS] = 0;
+    _unsignedAttributes[NUM_LEARNED_CLAUSES] = 0;
+    _unsignedAttributes[NUM_CLAUSE_IMPLIED_SPLITS] = 0;
+    _unsignedAttributes[NUM_RESTARTS] = 0;
     _unsignedAttributes[NUM_CONTEXT_PUSHES] = 0;
     _unsignedAttributes[NUM_CONTEXT_POPS] = 0;
     _unsignedAttributes[NUM_VISITED_TREE_STATES] = 1;
@@ -48,6 +53,9 @@ Statistics::Statistics()
     _longAttributes[NUM_MAIN_LOOP_ITERATIONS] = 0;
     _longAttributes[NUM_SIMPLEX_STEPS] = 0;
     _longAttributes[TIME_SIMPLEX_STEPS_MICRO] = 0;
+    _longAttributes[NUM_DUAL_SIMPLEX_STEPS] = 0;
+    _longAttributes[NUM_DUAL_SIMPLEX_BOUND_FLIPS] = 0;
+    _longAttributes[TIME_DUAL_SIMPLEX_STEPS_MICRO] = 0;
     _longAttributes[TIME_MAIN_LOOP_MICRO] = 0;
     _longAttributes[TIME_CONSTRAINT_FIXING_STEPS_MICRO] = 0;
     _longAttributes[NUM_CONSTRAINT_FIXING_STEPS] = 0;
@@ -66,14 +74,29 @@ Statistics::Statistics()
     _longAttributes[NUM_TIGHTENINGS_FROM_ROWS] = 0;
     _longAttributes[NUM_BOUND_TIGHTENINGS_ON_EXPLICIT_BASIS] = 0;
     _longAttributes[NUM_TIGHTENINGS_FROM_EXPLICIT_BASIS] = 0;
+    _longAttributes[NUM_INVERTED_BASIS_ROWS_EXAMINED] = 0;
+    _longAttributes[NUM_INVERTED_BASIS_ROWS_COMPUTED] = 0;
     _longAttributes[NUM_BOUND_NOTIFICATIONS_TO_PL_CONSTRAINTS] = 0;
     _longAttributes[NUM_BOUND_NOTIFICATIONS_TO_TRANSCENDENTAL_CONSTRAINTS] = 0;
     _longAttributes[NUM_BOUNDS_PROPOSED_BY_PL_CONSTRAINTS] = 0;
     _longAttributes[NUM_BOUND_TIGHTENINGS_ON_CONSTRAINT_MATRIX] = 0;
     _longAttributes[NUM_TIGHTENINGS_FROM_CONSTRAINT_MATRIX] = 0;
+    _longAttributes[NUM_CONSTRAINT_MATRIX_ROWS_EXAMINED] = 0;
     _longAttributes[NUM_BASIS_REFACTORIZATIONS] = 0;
+    _longAttributes[NUM_BASIS_FACTORIZATION_INPUT_NONZEROS] = 0;
+    _longAttributes[NUM_BASIS_FACTORIZATION_FILL_IN] = 0;
+    _longAttributes[NUM_BASIS_FACTORIZATION_SINGLETON_PIVOTS] = 0;
+    _longAttributes[TIME_BASIS_FACTORIZATION_MICRO] = 0;
+    _longAttributes[NUM_REFACTORIZATIONS_DUE_TO_SOLVE_COST] = 0;
+    _longAttributes[NUM_REFACTORIZATIONS_DUE_TO_ETA_LIMIT] = 0;
+    _longAttributes[NUM_REFACTORIZATIONS_DUE_TO_DEGRADATION] = 0;
+    _longAttributes[NUM_BASIS_UPDATES_BEFORE_REFACTORIZATION] = 0;
     _longAttributes[PSE_NUM_ITERATIONS] = 0;
     _longAttributes[PSE_NUM_RESET_REFERENCE_SPACE] = 0;
+    _longAttributes[NUM_PRICING_POOL_REFILLS] = 0;
+    _longAttributes[NUM_PRICING_POOL_REUSES] = 0;
+    _longAttributes[NUM_COST_FUNCTION_COMPUTATIONS] = 0;
+    _longAttributes[NUM_COST_FUNCTION_INCREMENTAL_UPDATES] = 0;
     _longAttributes[TOTAL_TIME_PERFORMING_VALID_CASE_SPLITS_MICRO] = 0;
     _longAttributes[TOTAL_TIME_PERFORMING_SYMBOLIC_BOUND_TIGHTENING] = 0;
     _longAttributes[TOTAL_TIME_HANDLING_STATISTICS_MICRO] = 0;
@@ -164,6 +187,11 @@ void Statistics::print()
     printf( "\t\t[%.2lf%%] Simplex steps: %llu milli\n",
             printPercents( timeSimplexStepsMicro, timeMainLoopMicro ),
             timeSimplexStepsMicro / 1000 );
+    unsigned long long timeDualSimplexStepsMicro =
+        getLongAttribute( Statistics::TIME_DUAL_SIMPLEX_STEPS_MICRO );
+    printf( "\t\t[%.2lf%%] Dual simplex steps: %llu milli\n",
+            printPercents( timeDualSimplexStepsMicro, timeMainLoopMicro ),
+            timeDualSimplexStepsMicro / 1000 );
     unsigned long long totalTimeExplicitBasisBoundTighteningMicro =
         getLongAttribute( TOTAL_TIME_EXPLICIT_BASIS_BOUND_TIGHTENING_MICRO );
     printf( "\t\t[%.2lf%%] Explicit-basis bound tightening: %llu milli\n",
@@ -230,7 +258,7 @@ void Statistics::print()
             totalTimeAddingConstraintsToMILPSolver / 1000 );
 
     unsigned long long total =
-        timeSimplexStepsMicro + timeConstraintFixingStepsMicro +
+        timeSimplexStepsMicro + timeDualSimplexStepsMicro + timeConstraintFixingStepsMicro +
         totalTimePerformingValidCaseSplitsMicro + totalTimeHandlingStatisticsMicro +
         totalTimeExplicitBasisBoundTighteningMicro + totalTimeDegradationChecking +
         totalTimePrecisionRestoration + totalTimeConstraintMatrixBoundTighteningMicro +
@@ -268,6 +296,13 @@ void Statistics::print()
         numConstraintFixingSteps,
         timeConstraintFixingStepsMicro / 1000,
         printAverage( timeConstraintFixingStepsMicro / 1000, numConstraintFixingSteps ) );
+    unsigned long long numDualSimplexSteps = getLongAttribute( Statistics::NUM_DUAL_SIMPLEX_STEPS );
+    printf( "\t\t%llu iterations were dual simplex steps. Total time: %llu milli. "
+            "Average: %.2lf milli. Bound flips: %llu\n",
+            numDualSimplexSteps,
+            timeDualSimplexStepsMicro / 1000,
+            printAverage( timeDualSimplexStepsMicro / 1000, numDualSimplexSteps ),
+            getLongAttribute( Statistics::NUM_DUAL_SIMPLEX_BOUND_FLIPS ) );
     printf( "\tNumber of active piecewise-linear constraints: %u / %u\n"
             "\t\tConstraints disabled by valid splits: %u. "
             "By SMT-originated splits: %u\n",
@@ -322,6 +357,13 @@ void Statistics::print()
         getUnsignedAttribute( Statistics::NUM_SPLITS ),
         getUnsignedAttribute( Statistics::NUM_POPS ) );
     printf( "\tMax stack depth: %u\n", getUnsignedAttribute( Statistics::MAX_DECISION_LEVEL ) );
+    printf( "\tNumber of backjumps: %u (skipped levels: %u). Learned clauses: %u. "
+            "Splits implied by learned clauses: %u\n",
+            getUnsignedAttribute( Statistics::NUM_BACKJUMPS ),
+            getUnsignedAttribute( Statistics::NUM_LEVELS_SKIPPED_BY_BACKJUMPS ),
+            getUnsignedAttribute( Statistics::NUM_LEARNED_CLAUSES ),
+            getUnsignedAttribute( Statistics::NUM_CLAUSE_IMPLIED_SPLITS ) );
+    printf( "\tNumber of restarts: %u\n", getUnsignedAttribute( Statistics::NUM_RESTARTS ) );
 
     printf( "\t--- Bound Tightening Statistics ---\n" );
     printf( "\tNumber of tightened bounds: %llu.\n",
@@ -334,11 +376,16 @@ void Statistics::print()
             "tightenings: %llu\n",
             getLongAttribute( Statistics::NUM_BOUND_TIGHTENINGS_ON_EXPLICIT_BASIS ),
             getLongAttribute( Statistics::NUM_TIGHTENINGS_FROM_EXPLICIT_BASIS ) );
+    printf( "\t\t\tRows of the explicit basis matrices examined: %llu. Computed: %llu\n",
+            getLongAttribute( Statistics::NUM_INVERTED_BASIS_ROWS_EXAMINED ),
+            getLongAttribute( Statistics::NUM_INVERTED_BASIS_ROWS_COMPUTED ) );
 
     printf( "\t\tNumber of bound tightening rounds on the entire constraint matrix: %llu. "
             "Consequent tightenings: %llu\n",
             getLongAttribute( Statistics::NUM_BOUND_TIGHTENINGS_ON_CONSTRAINT_MATRIX ),
             getLongAttribute( Statistics::NUM_TIGHTENINGS_FROM_CONSTRAINT_MATRIX ) );
+    printf( "\t\t\tRows of the constraint matrix examined: %llu\n",
+            getLongAttribute( Statistics::NUM_CONSTRAINT_MATRIX_ROWS_EXAMINED ) );
 
     printf( "\t\tNumber of bound notifications sent to PL constraints: %llu. Tightenings proposed: "
             "%llu\n",
@@ -348,6 +395,23 @@ void Statistics::print()
     printf( "\t--- Basis Factorization statistics ---\n" );
     printf( "\tNumber of basis refactorizations: %llu\n",
             getLongAttribute( Statistics::NUM_BASIS_REFACTORIZATIONS ) );
+    printf( "\tLU factorizations: %llu input non-zeros, %llu fill-in, %llu singleton pivots. "
+            "Time: %llu milli\n",
+            getLongAttribute( Statistics::NUM_BASIS_FACTORIZATION_INPUT_NONZEROS ),
+            getLongAttribute( Statistics::NUM_BASIS_FACTORIZATION_FILL_IN ),
+            getLongAttribute( Statistics::NUM_BASIS_FACTORIZATION_SINGLETON_PIVOTS ),
+            getLongAttribute( Statistics::TIME_BASIS_FACTORIZATION_MICRO ) / 1000 );
+
+    unsigned long long adaptiveRefactorizations =
+        getLongAttribute( Statistics::NUM_REFACTORIZATIONS_DUE_TO_SOLVE_COST ) +
+        getLongAttribute( Statistics::NUM_REFACTORIZATIONS_DUE_TO_ETA_LIMIT );
+    printf( "\tRefactorizations due to solve cost: %llu, eta limit: %llu, degradation: %llu. "
+            "Avg. updates before refactorization: %.2lf\n",
+            getLongAttribute( Statistics::NUM_REFACTORIZATIONS_DUE_TO_SOLVE_COST ),
+            getLongAttribute( Statistics::NUM_REFACTORIZATIONS_DUE_TO_ETA_LIMIT ),
+            getLongAttribute( Statistics::NUM_REFACTORIZATIONS_DUE_TO_DEGRADATION ),
+            printAverage( getLongAttribute( Statistics::NUM_BASIS_UPDATES_BEFORE_REFACTORIZATION ),
+                          adaptiveRefactorizations ) );
 
     unsigned long long pseNumIterations = getLongAttribute( Statistics::PSE_NUM_ITERATIONS );
     unsigned long long pseNumResetReferenceSpace =
@@ -359,6 +423,12 @@ void Statistics::print()
             pseNumResetReferenceSpace > 0
                 ? (unsigned)( (double)pseNumIterations / pseNumResetReferenceSpace )
                 : 0 );
+    printf( "\tPricing: candidates searched for in %llu simplex steps, reused in %llu\n",
+            getLongAttribute( Statistics::NUM_PRICING_POOL_REFILLS ),
+            getLongAttribute( Statistics::NUM_PRICING_POOL_REUSES ) );
+    printf( "\tCost function: computed %llu times, updated incrementally %llu times\n",
+            getLongAttribute( Statistics::NUM_COST_FUNCTION_COMPUTATIONS ),
+            getLongAttribute( Statistics::NUM_COST_FUNCTION_INCREMENTAL_UPDATES ) );
 
     printf( "\t--- SBT ---\n" );
     printf( "\tNumber of tightened bounds: %llu\n",
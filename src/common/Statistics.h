@@ -46,6 +46,16 @@ public:
         // Total number of pops so far
         NUM_POPS,
 
+        // Non-chronological backjumps, the decision levels they skipped,
+        // learned phase clauses and the splits implied by them
+        NUM_BACKJUMPS,
+        NUM_LEVELS_SKIPPED_BY_BACKJUMPS,
+        NUM_LEARNED_CLAUSES,
+        NUM_CLAUSE_IMPLIED_SPLITS,
+
+        // Number of times the search restarted from the root
+        NUM_RESTARTS,
+
         // Number of calls to context push and pop
         NUM_CONTEXT_PUSHES,
         NUM_CONTEXT_POPS,
@@ -93,6 +103,14 @@ public:
         // Total time spent on performing simplex steps, in microseconds
         TIME_SIMPLEX_STEPS_MICRO,
 
+        // Number of dual simplex steps performed by the main loop, and the number of
+        // non-basic variables flipped to their opposite bound by their ratio tests
+        NUM_DUAL_SIMPLEX_STEPS,
+        NUM_DUAL_SIMPLEX_BOUND_FLIPS,
+
+        // Total time spent on performing dual simplex steps, in microseconds
+        TIME_DUAL_SIMPLEX_STEPS_MICRO,
+
         // Total time spent in the main loop, in microseconds
         TIME_MAIN_LOOP_MICRO,
 
@@ -145,6 +163,11 @@ public:
         NUM_BOUND_TIGHTENINGS_ON_EXPLICIT_BASIS,
         NUM_TIGHTENINGS_FROM_EXPLICIT_BASIS,
 
+        // Number of rows of the explicit basis matrices examined, and
+        // number of these rows that had to be computed
+        NUM_INVERTED_BASIS_ROWS_EXAMINED,
+        NUM_INVERTED_BASIS_ROWS_COMPUTED,
+
         // Number of bound notifications sent to pl constraints
         NUM_BOUND_NOTIFICATIONS_TO_PL_CONSTRAINTS,
 
@@ -159,13 +182,42 @@ public:
         NUM_BOUND_TIGHTENINGS_ON_CONSTRAINT_MATRIX,
         NUM_TIGHTENINGS_FROM_CONSTRAINT_MATRIX,
 
+        // Number of rows of the constraint matrix examined in these rounds
+        NUM_CONSTRAINT_MATRIX_ROWS_EXAMINED,
+
         // Basis factorization statistics
         NUM_BASIS_REFACTORIZATIONS,
 
+        // LU factorizations of the basis from scratch: the total number of non-zeros in the
+        // factorized bases, the fill-in (non-zeros in the factors beyond those of the bases),
+        // the number of pivots taken from singleton rows or columns, and the time spent
+        NUM_BASIS_FACTORIZATION_INPUT_NONZEROS,
+        NUM_BASIS_FACTORIZATION_FILL_IN,
+        NUM_BASIS_FACTORIZATION_SINGLETON_PIVOTS,
+        TIME_BASIS_FACTORIZATION_MICRO,
+
+        // Refactorizations decided by the refactorization policy or the engine: when updating
+        // became costlier than refactorizing, when the eta limit was reached, and when the
+        // degradation grew; and the total number of basis updates that preceded the first two
+        NUM_REFACTORIZATIONS_DUE_TO_SOLVE_COST,
+        NUM_REFACTORIZATIONS_DUE_TO_ETA_LIMIT,
+        NUM_REFACTORIZATIONS_DUE_TO_DEGRADATION,
+        NUM_BASIS_UPDATES_BEFORE_REFACTORIZATION,
+
         // Projected steepest edge statistics
         PSE_NUM_ITERATIONS,
         PSE_NUM_RESET_REFERENCE_SPACE,
 
+        // Number of simplex steps whose entering candidates were searched for by the pricing
+        // manager, and the number of steps that reused the candidates of a previous step
+        NUM_PRICING_POOL_REFILLS,
+        NUM_PRICING_POOL_REUSES,
+
+        // Number of times the cost function was computed from scratch, and number of times it was
+        // updated for changes to the costs without recomputing it
+        NUM_COST_FUNCTION_COMPUTATIONS,
+        NUM_COST_FUNCTION_INCREMENTAL_UPDATES,
+
         // Total amount of time spent performing valid case splits
         TOTAL_TIME_PERFORMING_VALID_CASE_SPLITS_MICRO,
         TOTAL_TIME_PERFORMING_SYMBOLIC_BOUND_TIGHTENING,
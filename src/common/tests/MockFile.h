@@ -79,6 +79,12 @@ public:
     {
     }
 
+    const char *map( unsigned &size )
+    {
+        size = writtenLines.length();
+        return writtenLines.ascii();
+    }
+
     void close()
     {
     }
@@ -0,0 +1,185 @@
+/*********************                                                        */
+/*! \file Test_FlatMap.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** \brief [[ Add one-line brief description here ]]
+ **
+ ** [[ Add lengthier description here ]]
+ **/
+
+#include "FlatMap.h"
+#include "MString.h"
+#include "MockErrno.h"
+
+#include <cxxtest/TestSuite.h>
+
+class FlatMapTestSuite : public CxxTest::TestSuite
+{
+public:
+    MockErrno *mockErrno;
+
+    void setUp()
+    {
+        TS_ASSERT( mockErrno = new MockErrno );
+    }
+
+    void tearDown()
+    {
+        TS_ASSERT_THROWS_NOTHING( delete mockErrno );
+    }
+
+    void test_brackets()
+    {
+        FlatMap<unsigned, String> map;
+
+        map[3] = "Tasty";
+        map[1] = "Apple";
+        map[2] = "Red";
+
+        TS_ASSERT_EQUALS( map[1], "Apple" );
+        TS_ASSERT_EQUALS( map[2], "Red" );
+        TS_ASSERT_EQUALS( map[3], "Tasty" );
+
+        map[2] = "OtherRed";
+        TS_ASSERT_EQUALS( map.size(), 3u );
+        TS_ASSERT_EQUALS( map[2], "OtherRed" );
+
+        const FlatMap<unsigned, String> &constMap = map;
+        TS_ASSERT_EQUALS( constMap[1], "Apple" );
+        TS_ASSERT_THROWS_EQUALS( constMap[4],
+                                 const CommonError &e,
+                                 e.getCode(),
+                                 CommonError::KEY_DOESNT_EXIST_IN_MAP );
+    }
+
+    void test_size_and_exists()
+    {
+        FlatMap<unsigned, String> map;
+
+        TS_ASSERT_EQUALS( map.size(), 0u );
+        TS_ASSERT( map.empty() );
+        TS_ASSERT( !map.exists( 1 ) );
+
+        map[5] = "Apple";
+        map[1] = "Red";
+        map[3] = "Tasty";
+        TS_ASSERT_EQUALS( map.size(), 3u );
+        TS_ASSERT( !map.empty() );
+        TS_ASSERT( map.exists( 1 ) );
+        TS_ASSERT( !map.exists( 2 ) );
+        TS_ASSERT( map.exists( 3 ) );
+        TS_ASSERT( !map.exists( 4 ) );
+        TS_ASSERT( map.exists( 5 ) );
+        TS_ASSERT( !map.exists( 6 ) );
+
+        map.clear();
+        TS_ASSERT( map.empty() );
+        TS_ASSERT( !map.exists( 1 ) );
+    }
+
+    void test_iteration_is_sorted()
+    {
+        FlatMap<int, int> map;
+
+        map[7] = 70;
+        map[-2] = -20;
+        map[4] = 40;
+        map.insert( 0, 0 );
+        map.insert( 4, 400 );
+
+        int expectedKeys[] = { -2, 0, 4, 7 };
+        unsigned i = 0;
+        for ( const auto &entry : map )
+        {
+            TS_ASSERT_EQUALS( entry.first, expectedKeys[i] );
+            TS_ASSERT_EQUALS( entry.second, expectedKeys[i] * 10 );
+            ++i;
+        }
+        TS_ASSERT_EQUALS( i, 4u );
+
+        TS_ASSERT_EQUALS( map.rbegin()->first, 7 );
+    }
+
+    void test_erase()
+    {
+        FlatMap<unsigned, String> map;
+
+        map[1] = "Apple";
+        map[2] = "Red";
+        map[3] = "Tasty";
+
+        TS_ASSERT_THROWS_NOTHING( map.erase( 2 ) );
+        TS_ASSERT_EQUALS( map.size(), 2u );
+        TS_ASSERT( !map.exists( 2 ) );
+        TS_ASSERT_EQUALS( map[3], "Tasty" );
+
+        TS_ASSERT_THROWS_EQUALS( map.erase( 2 ),
+                                 const CommonError &e,
+                                 e.getCode(),
+                                 CommonError::KEY_DOESNT_EXIST_IN_MAP );
+
+        auto it = map.begin();
+        while ( it != map.end() )
+        {
+            if ( it->first == 1 )
+                it = map.erase( it );
+            else
+                ++it;
+        }
+
+        TS_ASSERT_EQUALS( map.size(), 1u );
+        TS_ASSERT( map.exists( 3 ) );
+    }
+
+    void test_get_keys_and_values()
+    {
+        FlatMap<unsigned, String> map;
+
+        map[3] = "Tasty";
+        map[1] = "Apple";
+
+        Set<unsigned> keys = { 1, 3 };
+        Set<String> values = { "Apple", "Tasty" };
+
+        TS_ASSERT_EQUALS( map.keys(), keys );
+        TS_ASSERT_EQUALS( map.values(), values );
+        TS_ASSERT_EQUALS( map.get( 1 ), "Apple" );
+        TS_ASSERT_THROWS_EQUALS( map.at( 2 ),
+                                 const CommonError &e,
+                                 e.getCode(),
+                                 CommonError::KEY_DOESNT_EXIST_IN_MAP );
+    }
+
+    void test_equality()
+    {
+        FlatMap<unsigned, unsigned> map1;
+        FlatMap<unsigned, unsigned> map2;
+
+        map1[2] = 4;
+        map1[1] = 3;
+        map2[1] = 3;
+
+        TS_ASSERT( map1 != map2 );
+
+        map2[2] = 4;
+        TS_ASSERT( map1 == map2 );
+
+        map2[2] = 5;
+        TS_ASSERT( map1 != map2 );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
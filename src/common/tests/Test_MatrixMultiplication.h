@@ -54,6 +54,77 @@ public:
         TS_ASSERT( matC[4] == 23 );
         TS_ASSERT( matC[5] == 34 );
     }
+
+    void test_blocked_matrix_matrix()
+    {
+        // Large enough to span several blocks in every dimension
+        unsigned rowsA = 3;
+        unsigned columnsA = 150;
+        unsigned columnsB = 300;
+
+        double *matA = new double[rowsA * columnsA];
+        double *matB = new double[columnsA * columnsB];
+        double *matC = new double[rowsA * columnsB];
+
+        for ( unsigned i = 0; i < rowsA * columnsA; ++i )
+            matA[i] = ( i % 7 ) - 3;
+        for ( unsigned i = 0; i < columnsA * columnsB; ++i )
+            matB[i] = ( i % 5 ) - 2;
+        for ( unsigned i = 0; i < rowsA * columnsB; ++i )
+            matC[i] = 1;
+
+        matrixMultiplication( matA, matB, matC, rowsA, columnsA, columnsB );
+
+        for ( unsigned i = 0; i < rowsA; ++i )
+        {
+            for ( unsigned j = 0; j < columnsB; ++j )
+            {
+                double expected = 1;
+                for ( unsigned k = 0; k < columnsA; ++k )
+                    expected += matA[i * columnsA + k] * matB[k * columnsB + j];
+                TS_ASSERT_EQUALS( matC[i * columnsB + j], expected );
+            }
+        }
+
+        delete[] matA;
+        delete[] matB;
+        delete[] matC;
+    }
+
+    void test_symbolic_bound_multiplication()
+    {
+        double symbolicLb[] = { 1, -1, 0, 2 }; // [1,-1], [0,2]
+        double symbolicUb[] = { 2, 1, 1, 3 };  // [2,1], [1,3]
+
+        // Weights [1,-2], [-3,4]
+        double positiveWeights[] = { 1, 0, 0, 4 };
+        double negativeWeights[] = { 0, -2, -3, 0 };
+
+        double newSymbolicLb[4] = { 0 };
+        double newSymbolicUb[4] = { 1, 1, 1, 1 };
+
+        symbolicBoundMultiplication( symbolicLb,
+                                     symbolicUb,
+                                     positiveWeights,
+                                     negativeWeights,
+                                     newSymbolicLb,
+                                     newSymbolicUb,
+                                     2,
+                                     2,
+                                     2 );
+
+        // newUb = ub * pos + lb * neg (+ 1)
+        TS_ASSERT_EQUALS( newSymbolicUb[0], 1 + 2 * 1 + -1 * -3 );
+        TS_ASSERT_EQUALS( newSymbolicUb[1], 1 + 1 * 4 + 1 * -2 );
+        TS_ASSERT_EQUALS( newSymbolicUb[2], 1 + 1 * 1 + 2 * -3 );
+        TS_ASSERT_EQUALS( newSymbolicUb[3], 1 + 3 * 4 + 0 * -2 );
+
+        // newLb = lb * pos + ub * neg
+        TS_ASSERT_EQUALS( newSymbolicLb[0], 1 * 1 + 1 * -3 );
+        TS_ASSERT_EQUALS( newSymbolicLb[1], -1 * 4 + 2 * -2 );
+        TS_ASSERT_EQUALS( newSymbolicLb[2], 0 * 1 + 3 * -3 );
+        TS_ASSERT_EQUALS( newSymbolicLb[3], 2 * 4 + 1 * -2 );
+    }
 };
 
 //
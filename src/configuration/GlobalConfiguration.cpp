@@ -37,6 +37,7 @@ const bool GlobalConfiguration::USE_POLARITY_BASED_DIRECTION_HEURISTICS = true;
 
 const double GlobalConfiguration::DEFAULT_EPSILON_FOR_COMPARISONS = 0.0000000001;
 const unsigned GlobalConfiguration::DEFAULT_DOUBLE_TO_STRING_PRECISION = 10;
+const unsigned GlobalConfiguration::BINARY_QUERY_WRITE_BUFFER_SIZE = 1 << 20;
 const unsigned GlobalConfiguration::STATISTICS_PRINTING_FREQUENCY = 10000;
 const unsigned GlobalConfiguration::STATISTICS_PRINTING_FREQUENCY_GUROBI = 100;
 const double GlobalConfiguration::BOUND_COMPARISON_ADDITIVE_TOLERANCE = 0.0000001;
@@ -58,13 +59,24 @@ const double GlobalConfiguration::DEGRADATION_THRESHOLD = 0.1;
 const double GlobalConfiguration::ACCEPTABLE_SIMPLEX_PIVOT_THRESHOLD = 0.0001;
 const bool GlobalConfiguration::USE_COLUMN_MERGING_EQUATIONS = false;
 const double GlobalConfiguration::GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD = 0.1;
+const unsigned GlobalConfiguration::GAUSSIAN_ELIMINATION_MARKOWITZ_SEARCH_LIMIT = 4;
 const unsigned GlobalConfiguration::MAX_SIMPLEX_PIVOT_SEARCH_ITERATIONS = 5;
+const unsigned GlobalConfiguration::DUAL_SIMPLEX_MAX_STEPS_AFTER_SPLIT = 50;
+const bool GlobalConfiguration::USE_CONFLICT_ANALYSIS = true;
+const unsigned GlobalConfiguration::MAX_NUMBER_OF_LEARNED_CLAUSES = 10000;
+const GlobalConfiguration::SearchRestartPolicy GlobalConfiguration::SEARCH_RESTART_POLICY =
+    GlobalConfiguration::LUBY_RESTARTS;
+const unsigned GlobalConfiguration::RESTART_BASE_NUMBER_OF_CONFLICTS = 100;
+const double GlobalConfiguration::RESTART_GEOMETRIC_FACTOR = 1.5;
+const bool GlobalConfiguration::USE_PHASE_SAVING = true;
 const DivideStrategy GlobalConfiguration::SPLITTING_HEURISTICS = DivideStrategy::ReLUViolation;
 const unsigned GlobalConfiguration::INTERVAL_SPLITTING_FREQUENCY = 10;
 const unsigned GlobalConfiguration::INTERVAL_SPLITTING_THRESHOLD = 10;
 const unsigned GlobalConfiguration::BOUND_TIGHTING_ON_CONSTRAINT_MATRIX_FREQUENCY = 100;
 const unsigned GlobalConfiguration::ROW_BOUND_TIGHTENER_SATURATION_ITERATIONS = 20;
 const double GlobalConfiguration::COST_FUNCTION_ERROR_THRESHOLD = 0.0000000001;
+const unsigned GlobalConfiguration::COST_FUNCTION_MAX_INCREMENTAL_UPDATES = 100;
+const double GlobalConfiguration::COST_FUNCTION_INCREMENTAL_UPDATE_DENSITY_THRESHOLD = 0.1;
 
 const unsigned GlobalConfiguration::SIMULATION_RANDOM_SEED = 1;
 
@@ -74,6 +86,8 @@ const double GlobalConfiguration::SYMBOLIC_TIGHTENING_ROUNDING_CONSTANT = 0.0000
 const double GlobalConfiguration::LP_TIGHTENING_ROUNDING_CONSTANT = 0.00000001;
 
 const double GlobalConfiguration::SIGMOID_CUTOFF_CONSTANT = 20;
+const double GlobalConfiguration::NLR_SPARSE_WEIGHTS_DENSITY_THRESHOLD = 0.25;
+const unsigned GlobalConfiguration::LP_TIGHTENING_BATCHES_PER_WORKER = 4;
 
 const bool GlobalConfiguration::PREPROCESS_INPUT_QUERY = true;
 const bool GlobalConfiguration::PREPROCESSOR_ELIMINATE_VARIABLES = true;
@@ -91,6 +105,11 @@ const unsigned GlobalConfiguration::PSE_ITERATIONS_BEFORE_RESET = 1000;
 const double GlobalConfiguration::PSE_GAMMA_ERROR_THRESHOLD = 0.001;
 const double GlobalConfiguration::PSE_GAMMA_UPDATE_TOLERANCE = 0.000000001;
 
+const unsigned GlobalConfiguration::PARTIAL_PRICING_NUMBER_OF_SECTIONS = 4;
+const unsigned GlobalConfiguration::MULTIPLE_PRICING_NUMBER_OF_CANDIDATES = 8;
+const unsigned GlobalConfiguration::MULTIPLE_PRICING_MAX_REUSES = 8;
+const double GlobalConfiguration::MULTIPLE_PRICING_SCORE_DECAY = 0.5;
+
 const double GlobalConfiguration::CONSTRAINT_COMPARISON_TOLERANCE = 0.00001;
 
 const double GlobalConfiguration::SOFTMAX_LSE2_THRESHOLD = 0.6;
@@ -104,8 +123,13 @@ const bool GlobalConfiguration::EXPLICIT_BOUND_TIGHTENING_UNTIL_SATURATION = fal
 const double GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_ROUNDING_CONSTANT = 1e-6;
 
 const unsigned GlobalConfiguration::REFACTORIZATION_THRESHOLD = 100;
+const unsigned GlobalConfiguration::REFACTORIZATION_MAX_ETAS = 500;
+const double GlobalConfiguration::REFACTORIZATION_DEGRADATION_THRESHOLD = 0.000001;
+const double GlobalConfiguration::HYPERSPARSE_TRANSFORMATION_DENSITY_THRESHOLD = 0.1;
+const double GlobalConfiguration::ROW_WISE_TABLEAU_ROW_DENSITY_THRESHOLD = 0.1;
 const GlobalConfiguration::BasisFactorizationType GlobalConfiguration::BASIS_FACTORIZATION_TYPE =
     GlobalConfiguration::SPARSE_FORREST_TOMLIN_FACTORIZATION;
+const unsigned GlobalConfiguration::DENSE_BASIS_FACTORIZATION_MAX_SIZE = 40;
 
 const unsigned GlobalConfiguration::BABSR_CANDIDATES_THRESHOLD = 5;
 const unsigned GlobalConfiguration::POLARITY_CANDIDATES_THRESHOLD = 5;
@@ -119,6 +143,10 @@ const bool GlobalConfiguration::WRITE_JSON_PROOF = false;
 const unsigned GlobalConfiguration::BACKWARD_BOUND_PROPAGATION_DEPTH = 3;
 const unsigned GlobalConfiguration::MAX_ROUNDS_OF_BACKWARD_ANALYSIS = 10;
 
+const unsigned GlobalConfiguration::NATIVE_LP_SOLVER_MAX_ITERATIONS = 100000;
+const unsigned GlobalConfiguration::NATIVE_LP_SOLVER_DEGENERATE_ITERATIONS_BEFORE_BLANDS_RULE = 50;
+const unsigned GlobalConfiguration::NATIVE_LP_SOLVER_RECOMPUTE_ASSIGNMENT_FREQUENCY = 100;
+
 #ifdef ENABLE_GUROBI
 const unsigned GlobalConfiguration::GUROBI_NUMBER_OF_THREADS = 1;
 const bool GlobalConfiguration::GUROBI_LOGGING = false;
@@ -143,6 +171,7 @@ const bool GlobalConfiguration::ONNX_PARSER_LOGGING = false;
 const bool GlobalConfiguration::SOI_LOGGING = false;
 const bool GlobalConfiguration::SCORE_TRACKER_LOGGING = false;
 const bool GlobalConfiguration::CEGAR_LOGGING = false;
+const bool GlobalConfiguration::NATIVE_LP_SOLVER_LOGGING = false;
 
 const bool GlobalConfiguration::USE_SMART_FIX = false;
 const bool GlobalConfiguration::USE_LEAST_FIX = false;
@@ -154,6 +183,7 @@ void GlobalConfiguration::print()
     printf( "****************************\n" );
     printf( "  DEFAULT_EPSILON_FOR_COMPARISONS: %.15lf\n", DEFAULT_EPSILON_FOR_COMPARISONS );
     printf( "  DEFAULT_DOUBLE_TO_STRING_PRECISION: %u\n", DEFAULT_DOUBLE_TO_STRING_PRECISION );
+    printf( "  BINARY_QUERY_WRITE_BUFFER_SIZE: %u\n", BINARY_QUERY_WRITE_BUFFER_SIZE );
     printf( "  STATISTICS_PRINTING_FREQUENCY: %u\n", STATISTICS_PRINTING_FREQUENCY );
     printf( "  BOUND_COMPARISON_ADDITIVE_TOLERANCE: %.15lf\n",
             BOUND_COMPARISON_ADDITIVE_TOLERANCE );
@@ -173,10 +203,44 @@ void GlobalConfiguration::print()
     printf( "  USE_COLUMN_MERGING_EQUATIONS: %s\n", USE_COLUMN_MERGING_EQUATIONS ? "Yes" : "No" );
     printf( "  GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD: %.15lf\n",
             GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD );
+    printf( "  GAUSSIAN_ELIMINATION_MARKOWITZ_SEARCH_LIMIT: %u\n",
+            GAUSSIAN_ELIMINATION_MARKOWITZ_SEARCH_LIMIT );
     printf( "  MAX_SIMPLEX_PIVOT_SEARCH_ITERATIONS: %u\n", MAX_SIMPLEX_PIVOT_SEARCH_ITERATIONS );
+    printf( "  DUAL_SIMPLEX_MAX_STEPS_AFTER_SPLIT: %u\n", DUAL_SIMPLEX_MAX_STEPS_AFTER_SPLIT );
+    printf( "  USE_CONFLICT_ANALYSIS: %s\n", USE_CONFLICT_ANALYSIS ? "Yes" : "No" );
+    printf( "  MAX_NUMBER_OF_LEARNED_CLAUSES: %u\n", MAX_NUMBER_OF_LEARNED_CLAUSES );
+
+    String searchRestartPolicy;
+    switch ( SEARCH_RESTART_POLICY )
+    {
+    case NO_RESTARTS:
+        searchRestartPolicy = "None";
+        break;
+
+    case LUBY_RESTARTS:
+        searchRestartPolicy = "Luby";
+        break;
+
+    case GEOMETRIC_RESTARTS:
+        searchRestartPolicy = "Geometric";
+        break;
+
+    default:
+        searchRestartPolicy = "Unknown";
+        break;
+    }
+
+    printf( "  SEARCH_RESTART_POLICY: %s\n", searchRestartPolicy.ascii() );
+    printf( "  RESTART_BASE_NUMBER_OF_CONFLICTS: %u\n", RESTART_BASE_NUMBER_OF_CONFLICTS );
+    printf( "  RESTART_GEOMETRIC_FACTOR: %.15lf\n", RESTART_GEOMETRIC_FACTOR );
+    printf( "  USE_PHASE_SAVING: %s\n", USE_PHASE_SAVING ? "Yes" : "No" );
     printf( "  BOUND_TIGHTING_ON_CONSTRAINT_MATRIX_FREQUENCY: %u\n",
             BOUND_TIGHTING_ON_CONSTRAINT_MATRIX_FREQUENCY );
     printf( "  COST_FUNCTION_ERROR_THRESHOLD: %.15lf\n", COST_FUNCTION_ERROR_THRESHOLD );
+    printf( "  COST_FUNCTION_MAX_INCREMENTAL_UPDATES: %u\n",
+            COST_FUNCTION_MAX_INCREMENTAL_UPDATES );
+    printf( "  COST_FUNCTION_INCREMENTAL_UPDATE_DENSITY_THRESHOLD: %.15lf\n",
+            COST_FUNCTION_INCREMENTAL_UPDATE_DENSITY_THRESHOLD );
     printf( "  USE_HARRIS_RATIO_TEST: %s\n", USE_HARRIS_RATIO_TEST ? "Yes" : "No" );
 
     printf( "  PREPROCESS_INPUT_QUERY: %s\n", PREPROCESS_INPUT_QUERY ? "Yes" : "No" );
@@ -184,6 +248,11 @@ void GlobalConfiguration::print()
             PREPROCESSOR_ELIMINATE_VARIABLES ? "Yes" : "No" );
     printf( "  PSE_ITERATIONS_BEFORE_RESET: %u\n", PSE_ITERATIONS_BEFORE_RESET );
     printf( "  PSE_GAMMA_ERROR_THRESHOLD: %.15lf\n", PSE_GAMMA_ERROR_THRESHOLD );
+    printf( "  PARTIAL_PRICING_NUMBER_OF_SECTIONS: %u\n", PARTIAL_PRICING_NUMBER_OF_SECTIONS );
+    printf( "  MULTIPLE_PRICING_NUMBER_OF_CANDIDATES: %u\n",
+            MULTIPLE_PRICING_NUMBER_OF_CANDIDATES );
+    printf( "  MULTIPLE_PRICING_MAX_REUSES: %u\n", MULTIPLE_PRICING_MAX_REUSES );
+    printf( "  MULTIPLE_PRICING_SCORE_DECAY: %.15lf\n", MULTIPLE_PRICING_SCORE_DECAY );
     printf( "  CONSTRAINT_COMPARISON_TOLERANCE: %.15lf\n", CONSTRAINT_COMPARISON_TOLERANCE );
 
     String basisBoundTighteningType;
@@ -207,6 +276,13 @@ void GlobalConfiguration::print()
     printf( "  EXPLICIT_BOUND_TIGHTENING_UNTIL_SATURATION: %s\n",
             EXPLICIT_BOUND_TIGHTENING_UNTIL_SATURATION ? "Yes" : "No" );
     printf( "  REFACTORIZATION_THRESHOLD: %u\n", REFACTORIZATION_THRESHOLD );
+    printf( "  REFACTORIZATION_MAX_ETAS: %u\n", REFACTORIZATION_MAX_ETAS );
+    printf( "  REFACTORIZATION_DEGRADATION_THRESHOLD: %.15lf\n",
+            REFACTORIZATION_DEGRADATION_THRESHOLD );
+    printf( "  HYPERSPARSE_TRANSFORMATION_DENSITY_THRESHOLD: %.2lf\n",
+            HYPERSPARSE_TRANSFORMATION_DENSITY_THRESHOLD );
+    printf( "  ROW_WISE_TABLEAU_ROW_DENSITY_THRESHOLD: %.2lf\n",
+            ROW_WISE_TABLEAU_ROW_DENSITY_THRESHOLD );
 
     String basisFactorizationType;
     if ( GlobalConfiguration::BASIS_FACTORIZATION_TYPE == GlobalConfiguration::LU_FACTORIZATION )
@@ -217,10 +293,17 @@ void GlobalConfiguration::print()
     else if ( GlobalConfiguration::BASIS_FACTORIZATION_TYPE ==
               GlobalConfiguration::FORREST_TOMLIN_FACTORIZATION )
         basisFactorizationType = "FORREST_TOMLIN_FACTORIZATION";
+    else if ( GlobalConfiguration::BASIS_FACTORIZATION_TYPE ==
+              GlobalConfiguration::SPARSE_FORREST_TOMLIN_FACTORIZATION )
+        basisFactorizationType = "SPARSE_FORREST_TOMLIN_FACTORIZATION";
+    else if ( GlobalConfiguration::BASIS_FACTORIZATION_TYPE ==
+              GlobalConfiguration::DENSE_LU_FACTORIZATION )
+        basisFactorizationType = "DENSE_LU_FACTORIZATION";
     else
         basisFactorizationType = "Unknown";
 
     printf( "  BASIS_FACTORIZATION_TYPE: %s\n", basisFactorizationType.ascii() );
+    printf( "  DENSE_BASIS_FACTORIZATION_MAX_SIZE: %u\n", DENSE_BASIS_FACTORIZATION_MAX_SIZE );
     printf( "****************************\n" );
 }
 
@@ -46,6 +46,9 @@ public:
     // The precision level when convering doubles to strings
     static const unsigned DEFAULT_DOUBLE_TO_STRING_PRECISION;
 
+    // The number of bytes accumulated in memory before each write of a binary query file
+    static const unsigned BINARY_QUERY_WRITE_BUFFER_SIZE;
+
     // How often should the main loop print statistics?
     static const unsigned STATISTICS_PRINTING_FREQUENCY;
     static const unsigned STATISTICS_PRINTING_FREQUENCY_GUROBI;
@@ -126,9 +129,48 @@ public:
     // the largest element in the column, the elimination engine will attempt to pick another pivot.
     static const double GAUSSIAN_ELIMINATION_PIVOT_SCALE_THRESHOLD;
 
+    // Once an acceptable pivot has been found, how many more rows and columns of the active
+    // submatrix should the sparse Gaussian eliminator inspect in search of a better Markowitz cost?
+    static const unsigned GAUSSIAN_ELIMINATION_MARKOWITZ_SEARCH_LIMIT;
+
     // How many potential pivots should the engine inspect (at most) in every simplex iteration?
     static const unsigned MAX_SIMPLEX_PIVOT_SEARCH_ITERATIONS;
 
+    // After a case split or a backtrack, the engine reoptimizes from the current basis with up to
+    // this many dual simplex steps (with bound flipping) before returning to the primal simplex.
+    // Zero disables the dual simplex.
+    static const unsigned DUAL_SIMPLEX_MAX_STEPS_AFTER_SPLIT;
+
+    // When a subproblem is found infeasible, find the deepest decision level that the infeasible
+    // row depends on, backjump to it and learn a clause over the phase decisions up to that
+    // level. Not used when producing proofs.
+    static const bool USE_CONFLICT_ANALYSIS;
+
+    // The maximal number of learned phase clauses kept by the SMT core.
+    static const unsigned MAX_NUMBER_OF_LEARNED_CLAUSES;
+
+    enum SearchRestartPolicy {
+        // Never restart the search
+        NO_RESTARTS = 0,
+        // The number of conflicts between restarts follows the Luby sequence
+        LUBY_RESTARTS = 1,
+        // The number of conflicts between restarts grows geometrically
+        GEOMETRIC_RESTARTS = 2,
+    };
+
+    // Restart the search from the root after a number of conflicts that produced learned clauses.
+    // The learned clauses, the saved phases and the scores of the constraints are kept.
+    static const SearchRestartPolicy SEARCH_RESTART_POLICY;
+
+    // The number of conflicts before the first restart, which the restart policy then scales.
+    static const unsigned RESTART_BASE_NUMBER_OF_CONFLICTS;
+
+    // The growth factor of the number of conflicts between restarts, for geometric restarts.
+    static const double RESTART_GEOMETRIC_FACTOR;
+
+    // When splitting on a constraint, try the phase it last took in the search first.
+    static const bool USE_PHASE_SAVING;
+
     static const DivideStrategy SPLITTING_HEURISTICS;
 
     // The frequency to use interval splitting when largest interval splitting strategy is in use.
@@ -142,12 +184,21 @@ public:
     static const unsigned BOUND_TIGHTING_ON_CONSTRAINT_MATRIX_FREQUENCY;
 
     // When the row bound tightener is asked to run until saturation, it can enter an infinite loop
-    // due to tiny increments in bounds. This number limits the number of iterations it can perform.
+    // due to tiny increments in bounds. This number limits the number of iterations it can perform
+    // (for the constraint matrix, the number of rows examined, in units of the number of rows).
     static const unsigned ROW_BOUND_TIGHTENER_SATURATION_ITERATIONS;
 
     // If the cost function error exceeds this threshold, it is recomputed
     static const double COST_FUNCTION_ERROR_THRESHOLD;
 
+    // The number of times the cost function can be updated, by pivots or by changes to the basic
+    // costs, before it is recomputed from scratch
+    static const unsigned COST_FUNCTION_MAX_INCREMENTAL_UPDATES;
+
+    // If more than this fraction of the basic costs change at once, the cost function is
+    // recomputed from scratch instead of being updated
+    static const double COST_FUNCTION_INCREMENTAL_UPDATE_DENSITY_THRESHOLD;
+
     // Random seed for generating simulation values.
     static const unsigned SIMULATION_RANDOM_SEED;
 
@@ -161,6 +212,20 @@ public:
     // PSE's Gamma function's update tolerance
     static const double PSE_GAMMA_UPDATE_TOLERANCE;
 
+    // Partial pricing: the non-basic variables are divided into this many sections, and the
+    // search for entering candidates stops after the first sections that provide enough of them
+    static const unsigned PARTIAL_PRICING_NUMBER_OF_SECTIONS;
+
+    // Multiple pricing: the number of best-scoring entering candidates that are kept across
+    // simplex iterations, and the number of iterations for which they are reused before the
+    // candidates are searched for again
+    static const unsigned MULTIPLE_PRICING_NUMBER_OF_CANDIDATES;
+    static const unsigned MULTIPLE_PRICING_MAX_REUSES;
+
+    // The kept candidates are also searched for again once the best score among them drops
+    // below this fraction of the best score when they were found
+    static const double MULTIPLE_PRICING_SCORE_DECAY;
+
     // The tolerance for checking whether f = Constraint( b ), Constraint \in { ReLU, ABS, Sign}
     static const double CONSTRAINT_COMPARISON_TOLERANCE;
 
@@ -201,6 +266,16 @@ public:
 
     static const double SIGMOID_CUTOFF_CONSTANT;
 
+    // Weight matrices whose fraction of non-zero entries is at most this threshold are also
+    // stored in CSR format, and the symbolic, DeepPoly and interval passes iterate over the
+    // non-zero entries only.
+    static const double NLR_SPARSE_WEIGHTS_DENSITY_THRESHOLD;
+
+    // The neurons of a layer are tightened by the LP/MILP solvers in batches; each worker thread
+    // receives (roughly) this many batches per layer, which balances the load between workers
+    // while keeping the task queue short.
+    static const unsigned LP_TIGHTENING_BATCHES_PER_WORKER;
+
     /*
       Constraint fixing heuristics
     */
@@ -217,18 +292,43 @@ public:
       Basis factorization options
     */
 
-    // The number of accumualted eta matrices, after which the basis will be refactorized
+    // The number of accumualted eta matrices, after which the basis will be refactorized (by the
+    // dense factorizations; the sparse ones refactorize adaptively, see RefactorizationPolicy)
     static const unsigned REFACTORIZATION_THRESHOLD;
 
+    // The sparse factorizations refactorize when the growth of the factors makes the forward and
+    // backward transformations costlier than refactorizing, and at the latest after this many etas
+    static const unsigned REFACTORIZATION_MAX_ETAS;
+
+    // When the degradation checked by the engine exceeds this threshold (which is well below the
+    // one that requires precision restoration), the basis is refactorized
+    static const double REFACTORIZATION_DEGRADATION_THRESHOLD;
+
+    // The sparse basis factorizations perform hypersparse forward and backward transformations
+    // while the vector being transformed has at most this fraction of non-zero entries, and
+    // switch to the dense transformations otherwise
+    static const double HYPERSPARSE_TRANSFORMATION_DENSITY_THRESHOLD;
+
+    // When computing a row of the tableau, accumulate it by walking the rows of the constraint
+    // matrix that match the non-zero multipliers if at most this fraction of the multipliers is
+    // non-zero, and by taking a dot product with each non-basic column otherwise
+    static const double ROW_WISE_TABLEAU_ROW_DENSITY_THRESHOLD;
+
     // The kind of basis factorization algorithm in use
     enum BasisFactorizationType {
         LU_FACTORIZATION,
         SPARSE_LU_FACTORIZATION,
         FORREST_TOMLIN_FACTORIZATION,
         SPARSE_FORREST_TOMLIN_FACTORIZATION,
+        DENSE_LU_FACTORIZATION,
     };
     static const BasisFactorizationType BASIS_FACTORIZATION_TYPE;
 
+    // When one of the sparse factorizations is selected, bases of at most this size are
+    // factorized with the dense LU factorization instead, which has less overhead per pivot.
+    // Set to 0 to always use the selected factorization.
+    static const unsigned DENSE_BASIS_FACTORIZATION_MAX_SIZE;
+
     /* In the BaBSR-based branching heuristics, only this many earliest nodes are considered to
        branch on.
     */
@@ -263,6 +363,15 @@ public:
      */
     static const unsigned MAX_ROUNDS_OF_BACKWARD_ANALYSIS;
 
+    /*
+      The native LP solver used for LP-based bound tightening: the maximal number of simplex
+      iterations per solve, the number of consecutive degenerate iterations after which Bland's
+      rule is used to avoid cycling, and how often the basic assignment is recomputed from scratch.
+    */
+    static const unsigned NATIVE_LP_SOLVER_MAX_ITERATIONS;
+    static const unsigned NATIVE_LP_SOLVER_DEGENERATE_ITERATIONS_BEFORE_BLANDS_RULE;
+    static const unsigned NATIVE_LP_SOLVER_RECOMPUTE_ASSIGNMENT_FREQUENCY;
+
 #ifdef ENABLE_GUROBI
     /*
       The number of threads Gurobi spawns
@@ -292,6 +401,7 @@ public:
     static const bool SOI_LOGGING;
     static const bool SCORE_TRACKER_LOGGING;
     static const bool CEGAR_LOGGING;
+    static const bool NATIVE_LP_SOLVER_LOGGING;
 };
 
 #endif // __GlobalConfiguration_h__
@@ -109,7 +109,8 @@ void OptionParser::initialize()
         "query-dump-file",
         boost::program_options::value<std::string>( &( *_stringOptions )[Options::QUERY_DUMP_FILE] )
             ->default_value( ( *_stringOptions )[Options::QUERY_DUMP_FILE] ),
-        "Dump the verification query in Marabou's input query format." )(
+        "Dump the verification query in Marabou's input query format. The binary format is used if "
+        "the file name ends with .ipqb." )(
         "summary-file",
         boost::program_options::value<std::string>(
             &( ( *_stringOptions )[Options::SUMMARY_FILE] ) )
@@ -241,33 +242,33 @@ void OptionParser::initialize()
             &( *_boolOptions )[Options::DO_NOT_MERGE_CONSECUTIVE_WEIGHTED_SUM_LAYERS] )
             ->default_value(
                 ( *_boolOptions )[Options::DO_NOT_MERGE_CONSECUTIVE_WEIGHTED_SUM_LAYERS] ),
-        "Do no merge consecutive weighted-sum layers." )
+        "Do no merge consecutive weighted-sum layers." )(
+        "num-simulations",
+        boost::program_options::value<int>( &( ( *_intOptions )[Options::NUMBER_OF_SIMULATIONS] ) )
+            ->default_value( ( *_intOptions )[Options::NUMBER_OF_SIMULATIONS] ),
+        "Number of simulations generated per neuron." )(
+        "lp-tightening-after-split",
+        boost::program_options::bool_switch(
+            &( ( *_boolOptions )[Options::PERFORM_LP_TIGHTENING_AFTER_SPLIT] ) )
+            ->default_value( ( *_boolOptions )[Options::PERFORM_LP_TIGHTENING_AFTER_SPLIT] ),
+        "Whether to skip a LP tightening after a case split." )(
+        "milp-tightening",
+        boost::program_options::value<std::string>(
+            &( ( *_stringOptions )[Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE] ) )
+            ->default_value( ( *_stringOptions )[Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE] ),
+        "The MILP solver bound tightening type: "
+        "lp/backward-once/backward-converge/lp-inc/milp/milp-inc/iter-prop/none. "
+        "Without Gurobi, only the LP-based types are available, using the native LP solver." )
 #ifdef ENABLE_GUROBI
         ( "lp-solver",
           boost::program_options::value<std::string>( &( ( *_stringOptions )[Options::LP_SOLVER] ) )
               ->default_value( ( *_stringOptions )[Options::LP_SOLVER] ),
           "Solver for the LPs during the complete analysis: native/gurobi." )(
-            "num-simulations",
-            boost::program_options::value<int>(
-                &( ( *_intOptions )[Options::NUMBER_OF_SIMULATIONS] ) )
-                ->default_value( ( *_intOptions )[Options::NUMBER_OF_SIMULATIONS] ),
-            "Number of simulations generated per neuron." )(
-            "lp-tightening-after-split",
-            boost::program_options::bool_switch(
-                &( ( *_boolOptions )[Options::PERFORM_LP_TIGHTENING_AFTER_SPLIT] ) )
-                ->default_value( ( *_boolOptions )[Options::PERFORM_LP_TIGHTENING_AFTER_SPLIT] ),
-            "Whether to skip a LP tightening after a case split." )(
             "milp-timeout",
             boost::program_options::value<float>(
                 &( ( *_floatOptions )[Options::MILP_SOLVER_TIMEOUT] ) )
                 ->default_value( ( *_floatOptions )[Options::MILP_SOLVER_TIMEOUT] ),
-            "Per-ReLU timeout for iterative propagation." )(
-            "milp-tightening",
-            boost::program_options::value<std::string>(
-                &( ( *_stringOptions )[Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE] ) )
-                ->default_value( ( *_stringOptions )[Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE] ),
-            "The MILP solver bound tightening type: "
-            "lp/backward-once/backward-converge/lp-inc/milp/milp-inc/iter-prop/none." )
+            "Per-ReLU timeout for iterative propagation." )
 #endif
         ;
 
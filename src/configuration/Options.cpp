@@ -197,26 +197,29 @@ SymbolicBoundTighteningType Options::getSymbolicBoundTighteningType() const
 
 MILPSolverBoundTighteningType Options::getMILPSolverBoundTighteningType() const
 {
+    String strategyString =
+        String( _stringOptions.get( Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE ) );
+
+    // The LP-based types are also supported by the native LP solver
+    if ( strategyString == "lp" )
+        return MILPSolverBoundTighteningType::LP_RELAXATION;
+    else if ( strategyString == "lp-inc" )
+        return MILPSolverBoundTighteningType::LP_RELAXATION_INCREMENTAL;
+    if ( strategyString == "backward-once" )
+        return MILPSolverBoundTighteningType::BACKWARD_ANALYSIS_ONCE;
+    if ( strategyString == "backward-converge" )
+        return MILPSolverBoundTighteningType::BACKWARD_ANALYSIS_CONVERGE;
+    else if ( strategyString == "none" )
+        return MILPSolverBoundTighteningType::NONE;
+
     if ( gurobiEnabled() )
     {
-        String strategyString =
-            String( _stringOptions.get( Options::MILP_SOLVER_BOUND_TIGHTENING_TYPE ) );
-        if ( strategyString == "lp" )
-            return MILPSolverBoundTighteningType::LP_RELAXATION;
-        else if ( strategyString == "lp-inc" )
-            return MILPSolverBoundTighteningType::LP_RELAXATION_INCREMENTAL;
-        if ( strategyString == "backward-once" )
-            return MILPSolverBoundTighteningType::BACKWARD_ANALYSIS_ONCE;
-        if ( strategyString == "backward-converge" )
-            return MILPSolverBoundTighteningType::BACKWARD_ANALYSIS_CONVERGE;
-        else if ( strategyString == "milp" )
+        if ( strategyString == "milp" )
             return MILPSolverBoundTighteningType::MILP_ENCODING;
         else if ( strategyString == "milp-inc" )
             return MILPSolverBoundTighteningType::MILP_ENCODING_INCREMENTAL;
         else if ( strategyString == "iter-prop" )
             return MILPSolverBoundTighteningType::ITERATIVE_PROPAGATION;
-        else if ( strategyString == "none" )
-            return MILPSolverBoundTighteningType::NONE;
         else
             return MILPSolverBoundTighteningType::LP_RELAXATION;
     }
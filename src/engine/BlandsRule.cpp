@@ -22,38 +22,26 @@ bool BlandsRule::select( ITableau &tableau,
                          const List<unsigned> &candidates,
                          const Set<unsigned> &excluded )
 {
-    List<unsigned> remainingCandidates = candidates;
-
-    List<unsigned>::iterator it = remainingCandidates.begin();
-    while ( it != remainingCandidates.end() )
+    bool found = false;
+    unsigned minIndex = 0;
+    unsigned minVariable = 0;
+    for ( const auto &candidate : candidates )
     {
-        if ( excluded.exists( *it ) )
-            it = remainingCandidates.erase( it );
-        else
-            ++it;
-    }
-
-    if ( remainingCandidates.empty() )
-        return false;
-
-    it = remainingCandidates.begin();
-    unsigned minIndex = *it;
-    unsigned minVariable = tableau.nonBasicIndexToVariable( minIndex );
+        if ( excluded.exists( candidate ) )
+            continue;
 
-    ++it;
-    unsigned variable;
-    while ( it != remainingCandidates.end() )
-    {
-        variable = tableau.nonBasicIndexToVariable( *it );
-        if ( variable < minVariable )
+        unsigned variable = tableau.nonBasicIndexToVariable( candidate );
+        if ( !found || variable < minVariable )
         {
-            minIndex = *it;
+            found = true;
+            minIndex = candidate;
             minVariable = variable;
         }
-
-        ++it;
     }
 
+    if ( !found )
+        return false;
+
     tableau.setEnteringVariableIndex( minIndex );
     return true;
 }
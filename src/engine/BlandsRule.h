@@ -27,6 +27,15 @@ public:
     */
     bool
     select( ITableau &tableau, const List<unsigned> &candidates, const Set<unsigned> &excluded );
+
+    /*
+      Bland's rule prevents cycling only if it is applied to all of the
+      eligible candidates.
+    */
+    bool supportsPartialPricing() const
+    {
+        return false;
+    }
 };
 
 #endif // __BlandsRule_h__
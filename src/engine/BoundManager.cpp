@@ -135,6 +135,9 @@ unsigned BoundManager::registerNewVariable()
     *_tightenedLower[newVar] = false;
     *_tightenedUpper[newVar] = false;
 
+    _lowerBoundLevels.append( 0 );
+    _upperBoundLevels.append( 0 );
+
     return newVar;
 }
 
@@ -176,6 +179,7 @@ bool BoundManager::setLowerBound( unsigned variable, double value )
     if ( value > _lowerBounds[variable] )
     {
         _lowerBounds[variable] = value;
+        _lowerBoundLevels[variable] = _context.getLevel();
         *_tightenedLower[variable] = true;
         if ( !consistentBounds( variable ) )
             recordInconsistentBound( variable, value, Tightening::LB );
@@ -191,6 +195,7 @@ bool BoundManager::setUpperBound( unsigned variable, double value )
     if ( value < _upperBounds[variable] )
     {
         _upperBounds[variable] = value;
+        _upperBoundLevels[variable] = _context.getLevel();
         *_tightenedUpper[variable] = true;
         if ( !consistentBounds( variable ) )
             recordInconsistentBound( variable, value, Tightening::UB );
@@ -232,10 +237,16 @@ void BoundManager::storeLocalBounds()
 
 void BoundManager::restoreLocalBounds()
 {
+    unsigned level = _context.getLevel();
     for ( unsigned i = 0; i < _size; ++i )
     {
         _lowerBounds[i] = *_storedLowerBounds[i];
         _upperBounds[i] = *_storedUpperBounds[i];
+
+        if ( _lowerBoundLevels[i] > level )
+            _lowerBoundLevels[i] = level;
+        if ( _upperBoundLevels[i] > level )
+            _upperBoundLevels[i] = level;
     }
 }
 
@@ -566,6 +577,74 @@ double BoundManager::computeSparseRowBound( const SparseUnsortedList &row,
     return bound;
 }
 
+unsigned BoundManager::getBoundLevel( unsigned variable, bool isUpper ) const
+{
+    ASSERT( variable < _size );
+    return isUpper ? _upperBoundLevels[variable] : _lowerBoundLevels[variable];
+}
+
+unsigned BoundManager::computeRowBoundLevel( const TableauRow &row, const bool isUpper ) const
+{
+    unsigned level = 0;
+    unsigned varLevel;
+
+    for ( unsigned i = 0; i < row._size; ++i )
+    {
+        if ( FloatUtils::isZero( row[i] ) )
+            continue;
+
+        varLevel = getBoundLevel( row._row[i]._var,
+                                  ( isUpper && FloatUtils::isPositive( row[i] ) ) ||
+                                      ( !isUpper && FloatUtils::isNegative( row[i] ) ) );
+        if ( varLevel > level )
+            level = varLevel;
+    }
+
+    return level;
+}
+
+unsigned BoundManager::computeSparseRowBoundLevel( const SparseUnsortedList &row,
+                                                   const bool isUpper,
+                                                   const unsigned var ) const
+{
+    ASSERT( !row.empty() && var < _size );
+
+    double ci = 0;
+    for ( const auto &entry : row )
+    {
+        if ( entry._index == var )
+        {
+            ci = entry._value;
+            break;
+        }
+    }
+
+    ASSERT( !FloatUtils::isZero( ci ) );
+
+    unsigned level = 0;
+    unsigned varLevel;
+    double realCoefficient;
+
+    for ( const auto &entry : row )
+    {
+        if ( FloatUtils::isZero( entry._value ) || entry._index == var )
+            continue;
+
+        realCoefficient = entry._value / -ci;
+
+        if ( FloatUtils::isZero( realCoefficient ) )
+            continue;
+
+        varLevel = getBoundLevel( entry._index,
+                                  ( isUpper && realCoefficient > 0 ) ||
+                                      ( !isUpper && realCoefficient < 0 ) );
+        if ( varLevel > level )
+            level = varLevel;
+    }
+
+    return level;
+}
+
 bool BoundManager::isExplanationTrivial( unsigned var, bool isUpper ) const
 {
     return _boundExplainer->isExplanationTrivial( var, isUpper );
@@ -206,6 +206,22 @@ public:
     */
     double computeSparseRowBound( const SparseUnsortedList &row, bool isUpper, unsigned var ) const;
 
+    /*
+      Return the context level at which the current bound of a variable was set. A bound is
+      implied by the case splits performed up to its level. After a backtrack, bounds are
+      attributed to the level backtracked to, which never underestimates their level.
+    */
+    unsigned getBoundLevel( unsigned variable, bool isUpper ) const;
+
+    /*
+      Compute the deepest level of the bounds used by computeRowBound and
+      computeSparseRowBound for the same arguments
+    */
+    unsigned computeRowBoundLevel( const TableauRow &row, bool isUpper ) const;
+    unsigned computeSparseRowBoundLevel( const SparseUnsortedList &row,
+                                         bool isUpper,
+                                         unsigned var ) const;
+
     /*
       Return true iff an explanation is trivial (i.e. the zero vector)
     */
@@ -236,6 +252,12 @@ private:
     Vector<CVC4::context::CDO<bool> *> _tightenedLower;
     Vector<CVC4::context::CDO<bool> *> _tightenedUpper;
 
+    /*
+       The context level at which each of the current bounds was set
+     */
+    Vector<unsigned> _lowerBoundLevels;
+    Vector<unsigned> _upperBoundLevels;
+
     /*
        Record first tightening that violates bounds
      */
@@ -19,6 +19,7 @@
 #include "FloatUtils.h"
 #include "ITableau.h"
 #include "MarabouError.h"
+#include "Statistics.h"
 #include "TableauRow.h"
 
 CostFunctionManager::CostFunctionManager( ITableau *tableau )
@@ -29,7 +30,11 @@ CostFunctionManager::CostFunctionManager( ITableau *tableau )
     , _n( 0 )
     , _m( 0 )
     , _costFunctionStatus( COST_FUNCTION_INVALID )
+    , _costFunctionIsGiven( false )
+    , _numIncrementalUpdates( 0 )
+    , _statistics( NULL )
     , _ANColumn( NULL )
+    , _work( NULL )
 {
 }
 
@@ -57,6 +62,12 @@ void CostFunctionManager::freeMemoryIfNeeded()
         delete[] _costFunction;
         _costFunction = NULL;
     }
+
+    if ( _work )
+    {
+        delete[] _work;
+        _work = NULL;
+    }
 }
 
 void CostFunctionManager::initialize()
@@ -78,6 +89,12 @@ void CostFunctionManager::initialize()
     if ( !_multipliers )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "CostFunctionManager::multipliers" );
 
+    _work = new double[_m];
+    if ( !_work )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "CostFunctionManager::work" );
+
+    _basicCostChanges = SparseUnsortedList( _m );
+
     invalidateCostFunction();
 }
 
@@ -116,6 +133,9 @@ void CostFunctionManager::computeCostFunction( const Map<unsigned, double> &heur
     // Complete the calculation of the modified core cost function
     computeMultipliers();
     computeReducedCosts();
+
+    _costFunctionIsGiven = false;
+    _numIncrementalUpdates = 0;
 }
 
 void CostFunctionManager::computeGivenCostFunction( const Map<unsigned, double> &heuristicCost )
@@ -132,8 +152,71 @@ void CostFunctionManager::computeGivenCostFunction( const Map<unsigned, double>
     ASSERT( !_tableau->existsBasicOutOfBounds() );
     ASSERT( _tableau->isOptimizing() );
 
+    if ( _costFunctionIsGiven && !costFunctionInvalid() && !tooManyIncrementalUpdates() )
+    {
+        /*
+          The cost function is up to date with respect to the previous
+          given cost, so only the differences need to be applied: the
+          reduced cost of a non-basic variable changes by its own
+          change, and the changes of the basic variables are handled
+          like changes to the basic costs.
+        */
+        _basicCostChanges.clear();
+        bool changed = false;
+
+        auto applyChange = [&]( unsigned variable, double change ) {
+            if ( change == 0 )
+                return;
+
+            changed = true;
+            unsigned variableIndex = _tableau->variableToIndex( variable );
+            if ( _tableau->isBasic( variable ) )
+                _basicCostChanges.append( variableIndex, change );
+            else
+                _costFunction[variableIndex] += change;
+        };
+
+        // Both maps are sorted, so they can be merged
+        auto oldCost = _givenCost.begin();
+        auto newCost = heuristicCost.begin();
+        while ( oldCost != _givenCost.end() || newCost != heuristicCost.end() )
+        {
+            if ( newCost == heuristicCost.end() ||
+                 ( oldCost != _givenCost.end() && oldCost->first < newCost->first ) )
+            {
+                applyChange( oldCost->first, -oldCost->second );
+                ++oldCost;
+            }
+            else if ( oldCost == _givenCost.end() || newCost->first < oldCost->first )
+            {
+                applyChange( newCost->first, newCost->second );
+                ++newCost;
+            }
+            else
+            {
+                applyChange( newCost->first, newCost->second - oldCost->second );
+                ++oldCost;
+                ++newCost;
+            }
+        }
+
+        if ( !changed )
+            return;
+
+        _givenCost = heuristicCost;
+        if ( !_basicCostChanges.empty() )
+            applyBasicCostChanges();
+
+        ++_numIncrementalUpdates;
+        _costFunctionStatus = ICostFunctionManager::COST_FUNCTION_UPDATED;
+        if ( _statistics )
+            _statistics->incLongAttribute( Statistics::NUM_COST_FUNCTION_INCREMENTAL_UPDATES );
+        return;
+    }
+
     // Reset cost function
     std::fill( _costFunction, _costFunction + _n - _m, 0.0 );
+    std::fill( _basicCosts, _basicCosts + _m, 0.0 );
 
     // Iterate over the heuristic costs. Add any basic variables to the basic
     // cost vector, and the rest directly to the cost function.
@@ -152,7 +235,12 @@ void CostFunctionManager::computeGivenCostFunction( const Map<unsigned, double>
     computeMultipliers();
     computeReducedCosts();
 
+    _costFunctionIsGiven = true;
+    _givenCost = heuristicCost;
+    _numIncrementalUpdates = 0;
     _costFunctionStatus = ICostFunctionManager::COST_FUNCTION_JUST_COMPUTED;
+    if ( _statistics )
+        _statistics->incLongAttribute( Statistics::NUM_COST_FUNCTION_COMPUTATIONS );
 }
 
 double
@@ -201,67 +289,80 @@ void CostFunctionManager::computeCoreCostFunction()
     computeMultipliers();
     computeReducedCosts();
 
+    _costFunctionIsGiven = false;
+    _givenCost.clear();
+    _numIncrementalUpdates = 0;
     _costFunctionStatus = ICostFunctionManager::COST_FUNCTION_JUST_COMPUTED;
+    if ( _statistics )
+        _statistics->incLongAttribute( Statistics::NUM_COST_FUNCTION_COMPUTATIONS );
 }
 
 void CostFunctionManager::adjustBasicCostAccuracy()
 {
-    unsigned variable;
-    double assignment, lb, relaxedLb, ub, relaxedUb;
+    /*
+      After a pivot, the reduced costs have been updated for the new basis,
+      but the pivot may have also moved basic variables into or out of
+      bounds. The basic costs that no longer match the assignment are
+      corrected here, which yields the same cost function as computing
+      it from scratch.
+    */
+    if ( _costFunctionIsGiven || tooManyIncrementalUpdates() )
+    {
+        computeCoreCostFunction();
+        return;
+    }
+
+    computeBasicOOBCosts( _work );
 
-    bool needToRecompute = false;
+    _basicCostChanges.clear();
     for ( unsigned i = 0; i < _m; ++i )
     {
-        variable = _tableau->basicIndexToVariable( i );
-        assignment = _tableau->getBasicAssignment( i );
-
-        if ( _basicCosts[i] < 0 )
-        {
-            lb = _tableau->getLowerBound( variable );
-            relaxedLb = lb - ( GlobalConfiguration::BASIC_COSTS_ADDITIVE_TOLERANCE +
-                               GlobalConfiguration::BASIC_COSTS_MULTIPLICATIVE_TOLERANCE *
-                                   FloatUtils::abs( lb ) );
+        if ( _work[i] != _basicCosts[i] )
+            _basicCostChanges.append( i, _work[i] - _basicCosts[i] );
+    }
 
-            // Current basic cost is negative, assignment should be too small
-            if ( assignment >= relaxedLb )
-            {
-                needToRecompute = true;
-                _basicCosts[i] = 0;
-            }
-        }
-        else if ( _basicCosts[i] > 0 )
-        {
-            ub = _tableau->getUpperBound( variable );
-            relaxedUb = ub + ( GlobalConfiguration::BASIC_COSTS_ADDITIVE_TOLERANCE +
-                               GlobalConfiguration::BASIC_COSTS_MULTIPLICATIVE_TOLERANCE *
-                                   FloatUtils::abs( ub ) );
+    if ( _basicCostChanges.empty() )
+        return;
 
-            // Current basic cost is positive, assignment should be too large
-            if ( assignment <= relaxedUb )
-            {
-                needToRecompute = true;
-                _basicCosts[i] = 0;
-            }
-        }
-        else
-        {
-            /*
-              It seems to make sense to adjust anything that had cost 0 but should be
-              1 or -1, but apparently this leads to cycling.
-            */
-        }
+    if ( _basicCostChanges.getNnz() >
+         GlobalConfiguration::COST_FUNCTION_INCREMENTAL_UPDATE_DENSITY_THRESHOLD * _m )
+    {
+        computeCoreCostFunction();
+        return;
     }
 
-    if ( needToRecompute )
-    {
-        computeMultipliers();
-        computeReducedCosts();
+    applyBasicCostChanges();
 
-        _costFunctionStatus = ICostFunctionManager::COST_FUNCTION_JUST_COMPUTED;
-    }
+    ++_numIncrementalUpdates;
+    _costFunctionStatus = ICostFunctionManager::COST_FUNCTION_UPDATED;
+    if ( _statistics )
+        _statistics->incLongAttribute( Statistics::NUM_COST_FUNCTION_INCREMENTAL_UPDATES );
+}
+
+void CostFunctionManager::applyBasicCostChanges()
+{
+    /*
+      The reduced costs are -c * inv(B) * AN, and so a change d to the
+      basic costs changes them by d * inv(B) * -AN, i.e. by the
+      combination of the rows of the tableau with coefficients d.
+    */
+    _tableau->addTableauRowCombination( _basicCostChanges, _costFunction );
+
+    for ( const auto &entry : _basicCostChanges )
+        _basicCosts[entry._index] += entry._value;
+}
+
+bool CostFunctionManager::tooManyIncrementalUpdates() const
+{
+    return _numIncrementalUpdates >= GlobalConfiguration::COST_FUNCTION_MAX_INCREMENTAL_UPDATES;
 }
 
 void CostFunctionManager::computeBasicOOBCosts()
+{
+    computeBasicOOBCosts( _basicCosts );
+}
+
+void CostFunctionManager::computeBasicOOBCosts( double *basicCosts ) const
 {
     unsigned variable;
     double assignment, lb, relaxedLb, ub, relaxedUb;
@@ -277,7 +378,7 @@ void CostFunctionManager::computeBasicOOBCosts()
 
         if ( assignment < relaxedLb )
         {
-            _basicCosts[i] = -1;
+            basicCosts[i] = -1;
             continue;
         }
 
@@ -288,11 +389,11 @@ void CostFunctionManager::computeBasicOOBCosts()
 
         if ( assignment > relaxedUb )
         {
-            _basicCosts[i] = 1;
+            basicCosts[i] = 1;
             continue;
         }
 
-        _basicCosts[i] = 0;
+        basicCosts[i] = 0;
     }
 }
 
@@ -372,7 +473,10 @@ double CostFunctionManager::updateCostFunctionForPivot( unsigned enteringVariabl
       Finally, we need to adjust the cost to reflect the pivot operation itself.
       The entering variable was, and remains, within bounds. The leaving variable
       is pressed against one of its bounds. So, if it was previously out-of-bounds
-      (and contributed to the cost function), this needs to be removed.
+      (and contributed to the cost function), this needs to be removed. For a
+      given cost function the costs belong to the variables and not to their
+      bounds, so the leaving variable keeps its cost, and the entering variable
+      brings its own cost into the basis.
     */
 
     ASSERT( _tableau->getM() == _m );
@@ -383,7 +487,12 @@ double CostFunctionManager::updateCostFunctionForPivot( unsigned enteringVariabl
       _costFunction, but since we have the change column we can compute a
       more accurate version from scratch
     */
-    double enteringVariableCost = 0;
+    double enteringVariableGivenCost =
+        _costFunctionIsGiven
+            ? getGivenCost( _tableau->nonBasicIndexToVariable( enteringVariableIndex ) )
+            : 0;
+
+    double enteringVariableCost = enteringVariableGivenCost;
     for ( unsigned i = 0; i < _m; ++i )
         enteringVariableCost -= _basicCosts[i] * changeColumn[i];
 
@@ -400,15 +509,23 @@ double CostFunctionManager::updateCostFunctionForPivot( unsigned enteringVariabl
             _costFunction[i] -= ( *pivotRow )[i] * _costFunction[enteringVariableIndex];
     }
 
-    /*
-      The leaving variable might have contributed to the cost function, but it will
-      soon be made within bounds. So, we adjust the reduced costs accordingly.
-    */
-    _costFunction[enteringVariableIndex] -= _basicCosts[leavingVariableIndex];
-
-    // The entering varibale is non-basic, so it is within bounds.
-    _basicCosts[leavingVariableIndex] = 0;
+    if ( _costFunctionIsGiven )
+    {
+        _basicCosts[leavingVariableIndex] = enteringVariableGivenCost;
+    }
+    else
+    {
+        /*
+          The leaving variable might have contributed to the cost function, but it will
+          soon be made within bounds. So, we adjust the reduced costs accordingly.
+        */
+        _costFunction[enteringVariableIndex] -= _basicCosts[leavingVariableIndex];
+
+        // The entering varibale is non-basic, so it is within bounds.
+        _basicCosts[leavingVariableIndex] = 0;
+    }
 
+    ++_numIncrementalUpdates;
     _costFunctionStatus = ICostFunctionManager::COST_FUNCTION_UPDATED;
     return normalizedError;
 }
@@ -428,6 +545,16 @@ bool CostFunctionManager::costFunctionJustComputed() const
     return _costFunctionStatus == ICostFunctionManager::COST_FUNCTION_JUST_COMPUTED;
 }
 
+double CostFunctionManager::getGivenCost( unsigned variable ) const
+{
+    return _givenCost.exists( variable ) ? _givenCost.get( variable ) : 0;
+}
+
+void CostFunctionManager::setStatistics( Statistics *statistics )
+{
+    _statistics = statistics;
+}
+
 double CostFunctionManager::getBasicCost( unsigned basicIndex ) const
 {
     return _basicCosts[basicIndex];
@@ -21,6 +21,7 @@
 #include "SparseUnsortedList.h"
 
 class ITableau;
+class Statistics;
 
 class CostFunctionManager : public ICostFunctionManager
 {
@@ -43,6 +44,9 @@ public:
 
     /*
       Compute the given cost function without adding the core cost function.
+      If the current cost function was computed for a previous given cost,
+      and has since only been updated by pivots, only the differences
+      between the two given costs are applied.
     */
     void computeGivenCostFunction( const Map<unsigned, double> &heuristicCost );
 
@@ -83,7 +87,9 @@ public:
 
     /*
       Check whether the basic costs are accurate with respect to the current assignment.
-      Adjust them and recompute the reduced costs if they are not.
+      Adjust them and update the reduced costs if they are not. When only a few basic
+      costs change, the reduced costs are updated using the rows of the tableau that
+      correspond to them; otherwise, they are recomputed.
     */
     void adjustBasicCostAccuracy();
 
@@ -98,6 +104,11 @@ public:
     */
     const SparseUnsortedList *createRowOfCostFunction() const;
 
+    /*
+      Have the cost function manager start reporting statistics.
+    */
+    void setStatistics( Statistics *statistics );
+
 private:
     /*
       The tableau.
@@ -122,10 +133,31 @@ private:
     */
     CostFunctionStatus _costFunctionStatus;
 
+    /*
+      If the current cost function is a given one (and not the core
+      cost function), the given cost that it was computed for. The
+      costs of the variables are kept up to date across pivots.
+    */
+    bool _costFunctionIsGiven;
+    Map<unsigned, double> _givenCost;
+
+    /*
+      The number of incremental updates to the cost function since it
+      was last computed from scratch.
+    */
+    unsigned _numIncrementalUpdates;
+
+    /*
+      Statistics collection
+    */
+    Statistics *_statistics;
+
     /*
       Work memeory
     */
     const SparseUnsortedList *_ANColumn;
+    double *_work;
+    SparseUnsortedList _basicCostChanges;
 
     /*
       Free memory.
@@ -139,6 +171,28 @@ private:
     void computeMultipliers();
     void computeReducedCosts();
     void computeReducedCost( unsigned nonBasic );
+
+    /*
+      Compute the basic costs of the core cost function into the given array.
+    */
+    void computeBasicOOBCosts( double *basicCosts ) const;
+
+    /*
+      Update the reduced costs for the changes to the basic costs stored in
+      _basicCostChanges, and apply these changes to _basicCosts.
+    */
+    void applyBasicCostChanges();
+
+    /*
+      Return true iff the cost function has been updated incrementally too
+      many times, and should be recomputed from scratch.
+    */
+    bool tooManyIncrementalUpdates() const;
+
+    /*
+      Return the given cost of a variable.
+    */
+    double getGivenCost( unsigned variable ) const;
 };
 
 #endif // __CostFunctionManager_h__
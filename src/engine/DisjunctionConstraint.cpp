@@ -338,7 +338,7 @@ void DisjunctionConstraint::dump( String &output ) const
         output += Stringf( "\t%s\n", disjunctOutput.ascii() );
     }
 
-    output += Stringf( "Active? %s.", _constraintActive ? "Yes" : "No" );
+    output += Stringf( "Active? %s.", isActive() ? "Yes" : "No" );
 }
 
 void DisjunctionConstraint::updateVariableIndex( unsigned oldIndex, unsigned newIndex )
@@ -154,7 +154,7 @@ void DnCManager::solve()
 
     // Partition the input query into initial subqueries, and place these
     // queries in the queue
-    _workload = new WorkerQueue( 0 );
+    _workload = new WorkerQueue( numWorkers );
     if ( !_workload )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "DnCManager::workload" );
 
@@ -179,14 +179,17 @@ void DnCManager::solve()
     // Create objects shared across workers
     _numUnsolvedSubQueries = _runParallelDeepSoI ? 1 : subQueries.size();
     std::atomic_bool shouldQuitSolving( false );
-    WorkerQueue *workload = new WorkerQueue( 0 );
+    // Deal the initial subqueries to the workers' deques in a round-robin
+    // fashion. Idle workers later steal from the others.
+    unsigned workerId = 0;
     for ( auto &subQuery : subQueries )
     {
-        if ( !workload->push( subQuery ) )
+        if ( !_workload->push( subQuery, workerId ) )
         {
             // This should never happen
             ASSERT( false );
         }
+        workerId = ( workerId + 1 ) % _workload->getNumberOfWorkers();
     }
 
     unsigned onlineDivides = Options::get()->getInt( Options::NUM_ONLINE_DIVIDES );
@@ -206,7 +209,7 @@ void DnCManager::solve()
             inputQuery = std::unique_ptr<Query>( new Query( *( baseQuery ) ) );
 
         threads.push_back( std::thread( dncSolve,
-                                        workload,
+                                        _workload,
                                         _engines[threadId],
                                         threadId != 0 ? std::move( inputQuery ) : nullptr,
                                         std::ref( _numUnsolvedSubQueries ),
@@ -222,14 +225,19 @@ void DnCManager::solve()
     }
 
     // Wait until either all subQueries are solved or a satisfying assignment is
-    // found by some worker
+    // found by some worker. The workers interrupt the workload when that
+    // happens, which wakes up the manager.
     while ( !shouldQuitSolving.load() )
     {
         updateTimeoutReached( startTime, timeoutInMicroSeconds );
         if ( _timeoutReached )
+        {
             shouldQuitSolving = true;
+            _workload->interrupt();
+        }
         else
-            std::this_thread::sleep_for( std::chrono::milliseconds( numWorkers ) );
+            _workload->waitForInterrupt(
+                getRemainingTime( startTime, timeoutInMicroSeconds ) );
     }
 
 
@@ -446,6 +454,19 @@ void DnCManager::initialDivide( SubQueries &subQueries )
         pow( 2, initialDivides ), queryId, 0, *split, initialTimeout, subQueries );
 }
 
+std::chrono::microseconds DnCManager::getRemainingTime( timespec startTime,
+                                                        unsigned long long timeoutInMicroSeconds )
+{
+    // Without a timeout, only an interrupt can end the wait
+    if ( timeoutInMicroSeconds == 0 )
+        return std::chrono::hours( 1 );
+
+    struct timespec now = TimeUtils::sampleMicro();
+    unsigned long long passed = TimeUtils::timePassed( startTime, now );
+    return std::chrono::microseconds(
+        passed >= timeoutInMicroSeconds ? 0 : timeoutInMicroSeconds - passed );
+}
+
 void DnCManager::updateTimeoutReached( timespec startTime,
                                        unsigned long long timeoutInMicroSeconds )
 {
@@ -21,8 +21,10 @@
 #include "SnCDivideStrategy.h"
 #include "SubQuery.h"
 #include "Vector.h"
+#include "WorkerQueue.h"
 
 #include <atomic>
+#include <chrono>
 
 #define DNC_MANAGER_LOG( x, ... )                                                                  \
     LOG( GlobalConfiguration::DNC_MANAGER_LOGGING, "DnCManager: %s\n", x )
@@ -121,6 +123,12 @@ private:
     */
     void updateTimeoutReached( timespec startTime, unsigned long long timeoutInMicroSeconds );
 
+    /*
+      The time left until the timeout is reached
+    */
+    static std::chrono::microseconds getRemainingTime( timespec startTime,
+                                                       unsigned long long timeoutInMicroSeconds );
+
     /*
       The base engine that is used to perform the initial divides
     */
@@ -148,7 +156,7 @@ private:
     DnCExitCode _exitCode;
 
     /*
-      Set of subQueries to be solved by workers
+      Set of subQueries to be solved by workers, with one deque per worker
     */
     WorkerQueue *_workload;
 
@@ -28,9 +28,7 @@
 #include "TableauStateStorageLevel.h"
 
 #include <atomic>
-#include <chrono>
 #include <cmath>
-#include <thread>
 
 DnCWorker::DnCWorker( WorkerQueue *workload,
                       std::shared_ptr<IEngine> engine,
@@ -77,10 +75,10 @@ void DnCWorker::setQueryDivider( SnCDivideStrategy divideStrategy )
 void DnCWorker::popOneSubQueryAndSolve( bool restoreTreeStates )
 {
     SubQuery *subQuery = NULL;
-    // Boost queue stores the next element into the passed-in pointer
-    // and returns true if the pop is successful (aka, the queue is not empty
-    // in most cases)
-    if ( _workload->pop( subQuery ) )
+    // Pop from this worker's deque, or steal from another worker's.
+    // Blocks while all deques are empty, and returns false if the
+    // workload was interrupted in the meantime.
+    if ( _workload->waitAndPop( subQuery, _threadId ) )
     {
         String queryId = subQuery->_queryId;
         unsigned depth = subQuery->_depth;
@@ -124,7 +122,10 @@ void DnCWorker::popOneSubQueryAndSolve( bool restoreTreeStates )
             // If UNSAT, continue to solve
             *_numUnsolvedSubQueries -= 1;
             if ( _numUnsolvedSubQueries->load() == 0 || _parallelDeepSoI )
+            {
                 *_shouldQuitSolving = true;
+                _workload->interrupt();
+            }
             delete subQuery;
         }
         else if ( result == IEngine::TIMEOUT )
@@ -159,12 +160,14 @@ void DnCWorker::popOneSubQueryAndSolve( bool restoreTreeStates )
                     newSubQuery->_smtState = std::move( newSmtStates[i++] );
                 }
 
-                if ( !_workload->push( std::move( newSubQuery ) ) )
+                // Count the subquery before publishing it, so that a
+                // thief solving it cannot observe zero unsolved subqueries
+                *_numUnsolvedSubQueries += 1;
+
+                if ( !_workload->push( std::move( newSubQuery ), _threadId ) )
                 {
                     throw MarabouError( MarabouError::UNSUCCESSFUL_QUEUE_PUSH );
                 }
-
-                *_numUnsolvedSubQueries += 1;
             }
             *_numUnsolvedSubQueries -= 1;
             delete subQuery;
@@ -182,6 +185,7 @@ void DnCWorker::popOneSubQueryAndSolve( bool restoreTreeStates )
             // TIMEOUT. This way, the DnCManager will kill all the DnCWorkers.
 
             *_shouldQuitSolving = true;
+            _workload->interrupt();
             if ( result == IEngine::SAT )
             {
                 // case SAT
@@ -203,11 +207,6 @@ void DnCWorker::popOneSubQueryAndSolve( bool restoreTreeStates )
             }
         }
     }
-    else
-    {
-        // If the queue is empty but the pop fails, wait and retry
-        std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
-    }
 }
 
 void DnCWorker::printProgress( String queryId, IEngine::ExitCode result ) const
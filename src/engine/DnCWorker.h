@@ -20,6 +20,7 @@
 #include "PiecewiseLinearCaseSplit.h"
 #include "QueryDivider.h"
 #include "SnCDivideStrategy.h"
+#include "WorkerQueue.h"
 
 #include <atomic>
 
@@ -38,8 +39,9 @@ public:
                bool parallelDeepSoI );
 
     /*
-      Pop one subQuery, solve it and handle the result
-      Return true if the DnCWorker should continue running
+      Pop one subQuery, solve it and handle the result. If no subQuery
+      is available, block until one is pushed or the workload is
+      interrupted.
     */
     void popOneSubQueryAndSolve( bool restoreTreeStates = false );
 
@@ -60,7 +62,8 @@ private:
     void printProgress( String queryId, IEngine::ExitCode result ) const;
 
     /*
-      The queue of subqueries (shared across threads)
+      The queue of subqueries (shared across threads). Subqueries
+      created by this worker are pushed to its own deque.
     */
     WorkerQueue *_workload;
     std::shared_ptr<IEngine> _engine;
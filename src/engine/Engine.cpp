@@ -33,7 +33,9 @@
 #include "VariableOutOfBoundDuringOptimizationException.h"
 #include "Vector.h"
 
+#include <algorithm>
 #include <random>
+#include <vector>
 
 Engine::Engine()
     : _context()
@@ -63,7 +65,6 @@ Engine::Engine()
     , _milpEncoder( nullptr )
     , _soiManager( nullptr )
     , _simulationSize( Options::get()->getInt( Options::NUMBER_OF_SIMULATIONS ) )
-    , _isGurobyEnabled( Options::get()->gurobiEnabled() )
     , _performLpTighteningAfterSplit(
           Options::get()->getBool( Options::PERFORM_LP_TIGHTENING_AFTER_SPLIT ) )
     , _milpSolverBoundTighteningType( Options::get()->getMILPSolverBoundTighteningType() )
@@ -80,6 +81,8 @@ Engine::Engine()
 
     _activeEntryStrategy = _projectedSteepestEdgeRule;
     _activeEntryStrategy->setStatistics( &_statistics );
+    _pricingManager.setStatistics( &_statistics );
+    _costFunctionManager->setStatistics( &_statistics );
     _statistics.stampStartingTime();
     setRandomSeed( Options::get()->getInt( Options::SEED ) );
 
@@ -88,6 +91,7 @@ Engine::Engine()
     _statisticsPrintingFrequency = ( _lpSolverType == LPSolverType::NATIVE )
                                      ? GlobalConfiguration::STATISTICS_PRINTING_FREQUENCY
                                      : GlobalConfiguration::STATISTICS_PRINTING_FREQUENCY_GUROBI;
+    _dualSimplexStepsRemaining = 0;
 
     _UNSATCertificateCurrentPointer =
         _produceUNSATProofs ? new ( true )
@@ -292,9 +296,17 @@ bool Engine::solve( double timeoutInSeconds )
             // If true, we just entered a new subproblem
             if ( splitJustPerformed )
             {
-                performBoundTighteningAfterCaseSplit();
+                // Splits implied by the learned clauses may enable further tightenings
+                do
+                    performBoundTighteningAfterCaseSplit();
+                while ( _smtCore.propagateLearnedClauses() );
                 informLPSolverOfBounds();
                 splitJustPerformed = false;
+
+                // The current basis remains a good starting point for
+                // the new bounds, so reoptimize from it with the dual simplex
+                _dualSimplexStepsRemaining =
+                    GlobalConfiguration::DUAL_SIMPLEX_MAX_STEPS_AFTER_SPLIT;
             }
 
             // Perform any SmtCore-initiated case splits
@@ -376,7 +388,10 @@ bool Engine::solve( double timeoutInSeconds )
 
             // We have out-of-bounds variables.
             if ( _lpSolverType == LPSolverType::NATIVE )
-                performSimplexStep();
+            {
+                if ( !performDualSimplexStep() )
+                    performSimplexStep();
+            }
             else
             {
                 ENGINE_LOG( "Checking LP feasibility with Gurobi..." );
@@ -408,8 +423,15 @@ bool Engine::solve( double timeoutInSeconds )
             // If we're at level 0, the whole query is unsat.
             if ( _produceUNSATProofs )
                 explainSimplexFailure();
+            else
+                analyzeConflict();
 
-            if ( !_smtCore.popSplit() )
+            if ( _smtCore.shouldRestart() )
+            {
+                _smtCore.restart();
+                splitJustPerformed = true;
+            }
+            else if ( !_smtCore.popSplit() )
             {
                 mainLoopEnd = TimeUtils::sampleMicro();
                 _statistics.incLongAttribute( Statistics::TIME_MAIN_LOOP_MICRO,
@@ -494,6 +516,70 @@ void Engine::performBoundTighteningAfterCaseSplit()
             _networkLevelReasoner->getLayerIndexToLayer().size() - 1 );
 }
 
+void Engine::analyzeConflict()
+{
+    if ( !GlobalConfiguration::USE_CONFLICT_ANALYSIS || _produceUNSATProofs || _sncMode ||
+         _lpSolverType != LPSolverType::NATIVE || _smtCore.getStackDepth() == 0 )
+        return;
+
+    _smtCore.backjump( computeConflictLevel() );
+}
+
+unsigned Engine::computeConflictLevel()
+{
+    unsigned conflictLevel = _smtCore.getStackDepth();
+
+    // The bounds of a variable contradict each other
+    unsigned infeasibleVar = _boundManager.getInconsistentVariable();
+    if ( infeasibleVar != IBoundManager::NO_VARIABLE_FOUND &&
+         !_boundManager.consistentBounds( infeasibleVar ) )
+        conflictLevel = std::max( _boundManager.getBoundLevel( infeasibleVar, Tightening::LB ),
+                                  _boundManager.getBoundLevel( infeasibleVar, Tightening::UB ) );
+
+    if ( conflictLevel == 0 )
+        return conflictLevel;
+
+    /*
+      Otherwise, the simplex could not decrease the sum of infeasibilities of
+      the basic variables. With c_i = 1 for the basic variables above their
+      upper bounds and c_i = -1 for the ones below their lower bounds, the
+      combination of their rows then bounds sum( c_i * xB_i ) beyond what
+      the bounds of these basic variables allow.
+    */
+    unsigned m = _tableau->getM();
+    std::fill_n( _work, m, 0 );
+    double basicBound = 0;
+    unsigned basicLevel = 0;
+    for ( unsigned i = 0; i < m; ++i )
+    {
+        unsigned basicVar = _tableau->basicIndexToVariable( i );
+        bool isUpper;
+        if ( _tableau->basicTooHigh( i ) )
+            isUpper = true;
+        else if ( _tableau->basicTooLow( i ) )
+            isUpper = false;
+        else
+            continue;
+
+        _work[i] = isUpper ? 1 : -1;
+        basicBound += isUpper ? _boundManager.getUpperBound( basicVar )
+                              : -_boundManager.getLowerBound( basicVar );
+        basicLevel = std::max( basicLevel, _boundManager.getBoundLevel( basicVar, isUpper ) );
+    }
+
+    if ( basicLevel >= conflictLevel )
+        return conflictLevel;
+
+    TableauRow row( _tableau->getN() - m );
+    _tableau->getTableauRowCombination( _work, &row );
+    if ( FloatUtils::gt( _boundManager.computeRowBound( row, Tightening::LB ), basicBound ) )
+        conflictLevel = std::min(
+            conflictLevel,
+            std::max( basicLevel, _boundManager.computeRowBoundLevel( row, Tightening::LB ) ) );
+
+    return conflictLevel;
+}
+
 bool Engine::adjustAssignmentToSatisfyNonLinearConstraints()
 {
     ENGINE_LOG( "Linear constraints satisfied. Now trying to satisfy non-linear"
@@ -566,10 +652,28 @@ bool Engine::performPrecisionRestorationIfNeeded()
     _basisRestorationPerformed = Engine::NO_RESTORATION_PERFORMED;
 
     // Possible restoration due to preceision degradation
-    if ( shouldCheckDegradation() && highDegradation() )
+    if ( shouldCheckDegradation() )
     {
-        performPrecisionRestoration( PrecisionRestorer::RESTORE_BASICS );
-        return true;
+        if ( highDegradation() )
+        {
+            performPrecisionRestoration( PrecisionRestorer::RESTORE_BASICS );
+            return true;
+        }
+
+        /*
+          Milder degradation: refactorize the basis, so that the updates'
+          accumulated error is discarded, and recompute the basic
+          variables from it
+        */
+        if ( FloatUtils::gt( _statistics.getDoubleAttribute( Statistics::CURRENT_DEGRADATION ),
+                             GlobalConfiguration::REFACTORIZATION_DEGRADATION_THRESHOLD ) &&
+             !_tableau->basisMatrixAvailable() )
+        {
+            _tableau->refreshBasisFactorization();
+            _tableau->computeAssignment();
+            _costFunctionManager->invalidateCostFunction();
+            _statistics.incLongAttribute( Statistics::NUM_REFACTORIZATIONS_DUE_TO_DEGRADATION );
+        }
     }
 
     return false;
@@ -643,7 +747,7 @@ bool Engine::performSimplexStep()
 
     if ( _tableau->isOptimizing() )
         _costFunctionManager->computeGivenCostFunction( _heuristicCost._addends );
-    if ( _costFunctionManager->costFunctionInvalid() )
+    else if ( _costFunctionManager->costFunctionInvalid() )
         _costFunctionManager->computeCoreCostFunction();
     else
         _costFunctionManager->adjustBasicCostAccuracy();
@@ -677,9 +781,10 @@ bool Engine::performSimplexStep()
         }
     } );
 
-    // Obtain all eligible entering variables
+    // Obtain the entering candidates, which are all eligible
     List<unsigned> enteringVariableCandidates;
-    _tableau->getEntryCandidates( enteringVariableCandidates );
+    _pricingManager.getEntryCandidates(
+        _tableau, *_activeEntryStrategy, enteringVariableCandidates );
 
     unsigned bestLeaving = 0;
     double bestChangeRatio = 0.0;
@@ -817,7 +922,6 @@ bool Engine::performSimplexStep()
     _tableau->performPivot();
     _activeEntryStrategy->postPivotHook( _tableau, fakePivot );
     _boundManager.propagateTightenings();
-    _costFunctionManager->invalidateCostFunction();
 
     struct timespec end = TimeUtils::sampleMicro();
     _statistics.incLongAttribute( Statistics::TIME_SIMPLEX_STEPS_MICRO,
@@ -825,6 +929,46 @@ bool Engine::performSimplexStep()
     return false;
 }
 
+bool Engine::performDualSimplexStep()
+{
+    if ( _dualSimplexStepsRemaining == 0 || _tableau->isOptimizing() )
+        return false;
+
+    --_dualSimplexStepsRemaining;
+
+    // Statistics
+    _statistics.incLongAttribute( Statistics::NUM_DUAL_SIMPLEX_STEPS );
+    struct timespec start = TimeUtils::sampleMicro();
+
+    bool pivotFound = false;
+    if ( _tableau->pickDualLeavingVariable() )
+    {
+        _tableau->computePivotRow();
+        _rowBoundTightener->examinePivotRow();
+        pivotFound = _tableau->pickDualEnteringVariable();
+    }
+
+    if ( pivotFound )
+    {
+        _activeEntryStrategy->prePivotHook( _tableau, false );
+        _tableau->performDualPivot();
+        _activeEntryStrategy->postPivotHook( _tableau, false );
+        _boundManager.propagateTightenings();
+        _costFunctionManager->invalidateCostFunction();
+    }
+    else
+    {
+        // Leave the rest of this subproblem to the primal simplex, which
+        // also detects infeasibility
+        _dualSimplexStepsRemaining = 0;
+    }
+
+    struct timespec end = TimeUtils::sampleMicro();
+    _statistics.incLongAttribute( Statistics::TIME_DUAL_SIMPLEX_STEPS_MICRO,
+                                  TimeUtils::timePassed( start, end ) );
+    return pivotFound;
+}
+
 void Engine::fixViolatedPlConstraintIfPossible()
 {
     List<PiecewiseLinearConstraint::Fix> fixes;
@@ -1053,18 +1197,22 @@ void Engine::storeEquationsInDegradationChecker()
     _degradationChecker.storeEquations( *_preprocessedQuery );
 }
 
-double *Engine::createConstraintMatrix()
+void Engine::createConstraintMatrix( SparseUnsortedLists &constraintMatrix )
 {
     const List<Equation> &equations( _preprocessedQuery->getEquations() );
     unsigned m = equations.size();
     unsigned n = _preprocessedQuery->getNumberOfVariables();
 
-    // Step 1: create a constraint matrix from the equations
-    double *constraintMatrix = new double[n * m];
-    if ( !constraintMatrix )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Engine::constraintMatrix" );
-    std::fill_n( constraintMatrix, n * m, 0.0 );
+    /*
+      Create the rows of the constraint matrix directly from the addends
+      of the equations; the matrix is never stored in dense form. The
+      entries of every row are ordered by variable, and if a variable
+      appears in several addends of an equation, its last coefficient
+      is used.
+    */
+    constraintMatrix.initializeToEmpty( m, n );
 
+    std::vector<SparseUnsortedList::Entry> entries;
     unsigned equationIndex = 0;
     for ( const auto &equation : equations )
     {
@@ -1074,16 +1222,33 @@ double *Engine::createConstraintMatrix()
             throw MarabouError( MarabouError::NON_EQUALITY_INPUT_EQUATION_DISCOVERED );
         }
 
+        entries.clear();
         for ( const auto &addend : equation._addends )
-            constraintMatrix[equationIndex * n + addend._variable] = addend._coefficient;
+            entries.emplace_back( addend._variable, addend._coefficient );
+
+        std::stable_sort(
+            entries.begin(),
+            entries.end(),
+            []( const SparseUnsortedList::Entry &a, const SparseUnsortedList::Entry &b ) {
+                return a._index < b._index;
+            } );
+
+        SparseUnsortedList *row = constraintMatrix.getRow( equationIndex );
+        row->reserve( entries.size() );
+        for ( unsigned i = 0; i < entries.size(); ++i )
+        {
+            if ( i + 1 < entries.size() && entries[i + 1]._index == entries[i]._index )
+                continue;
+
+            if ( !FloatUtils::isZero( entries[i]._value ) )
+                row->append( entries[i]._index, entries[i]._value );
+        }
 
         ++equationIndex;
     }
-
-    return constraintMatrix;
 }
 
-void Engine::removeRedundantEquations( const double *constraintMatrix )
+void Engine::removeRedundantEquations( const SparseUnsortedLists &constraintMatrix )
 {
     const List<Equation> &equations( _preprocessedQuery->getEquations() );
     unsigned m = equations.size();
@@ -1091,7 +1256,7 @@ void Engine::removeRedundantEquations( const double *constraintMatrix )
 
     // Step 1: analyze the matrix to identify redundant rows
     AutoConstraintMatrixAnalyzer analyzer;
-    analyzer->analyze( constraintMatrix, m, n );
+    analyzer->analyze( constraintMatrix.getRows(), m, n );
 
     ENGINE_LOG(
         Stringf( "Number of redundant rows: %u out of %u", analyzer->getRedundantRows().size(), m )
@@ -1107,7 +1272,7 @@ void Engine::removeRedundantEquations( const double *constraintMatrix )
     }
 }
 
-void Engine::selectInitialVariablesForBasis( const double *constraintMatrix,
+void Engine::selectInitialVariablesForBasis( const SparseUnsortedLists &constraintMatrix,
                                              List<unsigned> &initialBasis,
                                              List<unsigned> &basicRows )
 {
@@ -1144,22 +1309,33 @@ void Engine::selectInitialVariablesForBasis( const double *constraintMatrix,
     unsigned *columnOrdering = new unsigned[n];
     unsigned *rowOrdering = new unsigned[m];
 
+    // The inverse orderings: the current positions of every row and column
+    unsigned *columnPosition = new unsigned[n];
+    unsigned *rowPosition = new unsigned[m];
+
     for ( unsigned i = 0; i < m; ++i )
+    {
         rowOrdering[i] = i;
+        rowPosition[i] = i;
+    }
 
     for ( unsigned i = 0; i < n; ++i )
+    {
         columnOrdering[i] = i;
+        columnPosition[i] = i;
+    }
+
+    // The columns of the constraint matrix are needed for updating the row counters
+    SparseUnsortedLists columns;
+    constraintMatrix.transposeIntoOther( &columns );
 
     // Initialize the counters
     for ( unsigned i = 0; i < m; ++i )
     {
-        for ( unsigned j = 0; j < n; ++j )
+        for ( const auto &entry : *constraintMatrix.getRow( i ) )
         {
-            if ( !FloatUtils::isZero( constraintMatrix[i * n + j] ) )
-            {
-                ++nnzInRow[i];
-                ++nnzInColumn[j];
-            }
+            ++nnzInRow[i];
+            ++nnzInColumn[entry._index];
         }
     }
 
@@ -1193,39 +1369,41 @@ void Engine::selectInitialVariablesForBasis( const double *constraintMatrix,
             temp = rowOrdering[singletonRow];
             rowOrdering[singletonRow] = rowOrdering[numTriangularRows];
             rowOrdering[numTriangularRows] = temp;
+            rowPosition[rowOrdering[singletonRow]] = singletonRow;
+            rowPosition[rowOrdering[numTriangularRows]] = numTriangularRows;
 
             temp = nnzInRow[numTriangularRows];
             nnzInRow[numTriangularRows] = nnzInRow[singletonRow];
             nnzInRow[singletonRow] = temp;
 
-            // Find the non-zero entry in the row and swap it to the diagonal
-            DEBUG( bool foundNonZero = false );
-            for ( unsigned i = numTriangularRows; i < n - numExcluded; ++i )
+            // Find the non-zero entry in the row that is still in the active
+            // columns, and swap it to the diagonal
+            unsigned nonZero = n - numExcluded;
+            for ( const auto &entry : *constraintMatrix.getRow( rowOrdering[numTriangularRows] ) )
             {
-                if ( !FloatUtils::isZero( constraintMatrix[rowOrdering[numTriangularRows] * n +
-                                                           columnOrdering[i]] ) )
-                {
-                    temp = columnOrdering[i];
-                    columnOrdering[i] = columnOrdering[numTriangularRows];
-                    columnOrdering[numTriangularRows] = temp;
+                unsigned position = columnPosition[entry._index];
+                if ( position >= numTriangularRows && position < nonZero )
+                    nonZero = position;
+            }
 
-                    temp = nnzInColumn[numTriangularRows];
-                    nnzInColumn[numTriangularRows] = nnzInColumn[i];
-                    nnzInColumn[i] = temp;
+            ASSERT( nonZero < n - numExcluded );
 
-                    DEBUG( foundNonZero = true );
-                    break;
-                }
-            }
+            temp = columnOrdering[nonZero];
+            columnOrdering[nonZero] = columnOrdering[numTriangularRows];
+            columnOrdering[numTriangularRows] = temp;
+            columnPosition[columnOrdering[nonZero]] = nonZero;
+            columnPosition[columnOrdering[numTriangularRows]] = numTriangularRows;
 
-            ASSERT( foundNonZero );
+            temp = nnzInColumn[numTriangularRows];
+            nnzInColumn[numTriangularRows] = nnzInColumn[nonZero];
+            nnzInColumn[nonZero] = temp;
 
             // Remove all entries under the diagonal entry from the row counters
-            for ( unsigned i = numTriangularRows + 1; i < m; ++i )
+            for ( const auto &entry : *columns.getRow( columnOrdering[numTriangularRows] ) )
             {
-                if ( !FloatUtils::isZero( constraintMatrix[rowOrdering[i] * n +
-                                                           columnOrdering[numTriangularRows]] ) )
-                    --nnzInRow[i];
+                unsigned position = rowPosition[entry._index];
+                if ( position > numTriangularRows )
+                    --nnzInRow[position];
             }
 
             ++numTriangularRows;
@@ -1246,17 +1424,19 @@ void Engine::selectInitialVariablesForBasis( const double *constraintMatrix,
             }
 
             // Update the row counters to account for the excluded column
-            for ( unsigned i = numTriangularRows; i < m; ++i )
+            for ( const auto &entry : *columns.getRow( columnOrdering[column] ) )
             {
-                double element = constraintMatrix[rowOrdering[i] * n + columnOrdering[column]];
-                if ( !FloatUtils::isZero( element ) )
+                unsigned position = rowPosition[entry._index];
+                if ( position >= numTriangularRows )
                 {
-                    ASSERT( nnzInRow[i] > 1 );
-                    --nnzInRow[i];
+                    ASSERT( nnzInRow[position] > 1 );
+                    --nnzInRow[position];
                 }
             }
 
+            columnPosition[columnOrdering[column]] = n - 1 - numExcluded;
             columnOrdering[column] = columnOrdering[n - 1 - numExcluded];
+            columnPosition[columnOrdering[column]] = column;
             nnzInColumn[column] = nnzInColumn[n - 1 - numExcluded];
             ++numExcluded;
         }
@@ -1280,6 +1460,8 @@ void Engine::selectInitialVariablesForBasis( const double *constraintMatrix,
     delete[] nnzInColumn;
     delete[] columnOrdering;
     delete[] rowOrdering;
+    delete[] columnPosition;
+    delete[] rowPosition;
 }
 
 void Engine::addAuxiliaryVariables()
@@ -1322,7 +1504,8 @@ void Engine::augmentInitialBasisIfNeeded( List<unsigned> &initialBasis,
     }
 }
 
-void Engine::initializeTableau( const double *constraintMatrix, const List<unsigned> &initialBasis )
+void Engine::initializeTableau( const SparseUnsortedLists &constraintMatrix,
+                                const List<unsigned> &initialBasis )
 {
     const List<Equation> &equations( _preprocessedQuery->getEquations() );
     unsigned m = equations.size();
@@ -1340,7 +1523,7 @@ void Engine::initializeTableau( const double *constraintMatrix, const List<unsig
     }
 
     // Populate constriant matrix
-    _tableau->setConstraintMatrix( constraintMatrix );
+    _tableau->setConstraintMatrix( constraintMatrix.getRows() );
 
     _tableau->registerToWatchAllVariables( _rowBoundTightener );
     _tableau->registerResizeWatcher( _rowBoundTightener );
@@ -1354,6 +1537,7 @@ void Engine::initializeTableau( const double *constraintMatrix, const List<unsig
     _costFunctionManager->initialize();
     _tableau->registerCostFunctionManager( _costFunctionManager );
     _activeEntryStrategy->initialize( _tableau );
+    _pricingManager.initialize( _tableau );
 }
 
 void Engine::initializeBoundsAndConstraintWatchersInTableau( unsigned numberOfVariables )
@@ -1454,12 +1638,12 @@ bool Engine::processInputQuery( const IQuery &inputQuery, bool preprocess )
 
         if ( _lpSolverType == LPSolverType::NATIVE )
         {
-            double *constraintMatrix = createConstraintMatrix();
+            SparseUnsortedLists constraintMatrix;
+            createConstraintMatrix( constraintMatrix );
             removeRedundantEquations( constraintMatrix );
 
             // The equations have changed, recreate the constraint matrix
-            delete[] constraintMatrix;
-            constraintMatrix = createConstraintMatrix();
+            createConstraintMatrix( constraintMatrix );
 
             List<unsigned> initialBasis;
             List<unsigned> basicRows;
@@ -1470,15 +1654,13 @@ bool Engine::processInputQuery( const IQuery &inputQuery, bool preprocess )
             storeEquationsInDegradationChecker();
 
             // The equations have changed, recreate the constraint matrix
-            delete[] constraintMatrix;
-            constraintMatrix = createConstraintMatrix();
+            createConstraintMatrix( constraintMatrix );
 
             unsigned n = _preprocessedQuery->getNumberOfVariables();
             _boundManager.initialize( n );
 
             initializeTableau( constraintMatrix, initialBasis );
             _boundManager.initializeBoundExplainer( n, _tableau->getM() );
-            delete[] constraintMatrix;
 
             if ( _produceUNSATProofs )
             {
@@ -1511,8 +1693,13 @@ bool Engine::processInputQuery( const IQuery &inputQuery, bool preprocess )
             initializeBoundsAndConstraintWatchersInTableau( n );
         }
 
+        // From now on, the search state of the constraints backtracks with the context
         for ( const auto &constraint : _plConstraints )
+        {
             constraint->registerTableau( _tableau );
+            if ( constraint->getContext() == nullptr )
+                constraint->initializeCDOs( &_context );
+        }
         for ( const auto &constraint : _nlConstraints )
             constraint->registerTableau( _tableau );
 
@@ -1569,7 +1756,8 @@ bool Engine::processInputQuery( const IQuery &inputQuery, bool preprocess )
 
 void Engine::performMILPSolverBoundedTightening( Query *inputQuery )
 {
-    if ( _networkLevelReasoner && Options::get()->gurobiEnabled() )
+    if ( _networkLevelReasoner &&
+         _milpSolverBoundTighteningType != MILPSolverBoundTighteningType::NONE )
     {
         // Obtain from and store bounds into inputquery if it is not null.
         if ( inputQuery )
@@ -1665,7 +1853,7 @@ void Engine::performMILPSolverBoundedTighteningForSingleLayer( unsigned targetIn
     if ( _produceUNSATProofs )
         return;
 
-    if ( _networkLevelReasoner && _isGurobyEnabled && _performLpTighteningAfterSplit &&
+    if ( _networkLevelReasoner && _performLpTighteningAfterSplit &&
          _milpSolverBoundTighteningType != MILPSolverBoundTighteningType::NONE )
     {
         _networkLevelReasoner->obtainCurrentBounds();
@@ -1819,7 +2007,14 @@ void Engine::storeState( EngineState &state, TableauStateStorageLevel level ) co
     state._tableauStateStorageLevel = level;
 
     for ( const auto &constraint : _plConstraints )
+    {
+        // Constraints that backtrack with the context are only stored in full snapshots
+        if ( level != TableauStateStorageLevel::STORE_ENTIRE_TABLEAU_STATE &&
+             constraint->searchStateIsContextDependent() )
+            continue;
+
         state._plConstraintToState[constraint] = constraint->duplicateConstraint();
+    }
 
     state._numPlConstraintsDisabledByValidSplits = _numPlConstraintsDisabledByValidSplits;
 }
@@ -1838,7 +2033,13 @@ void Engine::restoreState( const EngineState &state )
     for ( auto &constraint : _plConstraints )
     {
         if ( !state._plConstraintToState.exists( constraint ) )
+        {
+            // The context has already been popped to the matching level
+            if ( constraint->searchStateIsContextDependent() )
+                continue;
+
             throw MarabouError( MarabouError::MISSING_PL_CONSTRAINT_STATE );
+        }
 
         constraint->restoreState( state._plConstraintToState[constraint] );
     }
@@ -1847,11 +2048,28 @@ void Engine::restoreState( const EngineState &state )
 
     if ( _lpSolverType == LPSolverType::NATIVE )
     {
-        // Make sure the data structures are initialized to the correct size
-        _rowBoundTightener->setDimensions();
-        adjustWorkMemorySize();
-        _activeEntryStrategy->resizeHook( _tableau );
-        _costFunctionManager->initialize();
+        if ( state._tableauStateStorageLevel ==
+             TableauStateStorageLevel::STORE_ENTIRE_TABLEAU_STATE )
+        {
+            // Make sure the data structures are initialized to the correct size
+            _rowBoundTightener->setDimensions();
+            adjustWorkMemorySize();
+            _activeEntryStrategy->resizeHook( _tableau );
+            _pricingManager.initialize( _tableau );
+            _costFunctionManager->initialize();
+        }
+        else
+        {
+            /*
+              The tableau keeps its dimensions and basis when backtracking,
+              so the work memory is kept. Only what was derived from the
+              bounds that have just been restored is discarded.
+            */
+            _rowBoundTightener->resetExaminedBounds();
+            _activeEntryStrategy->resizeHook( _tableau );
+            _pricingManager.initialize( _tableau );
+            _costFunctionManager->invalidateCostFunction();
+        }
     }
 
     // Reset the violation counts in the SMT core
@@ -1954,6 +2172,10 @@ bool Engine::attemptToMergeVariables( unsigned x1, unsigned x2 )
 
     // Reset the entry strategy
     _activeEntryStrategy->initialize( _tableau );
+    _pricingManager.initialize( _tableau );
+
+    // The constraint matrix has changed, so the rows kept by the tightener are stale
+    _rowBoundTightener->setDimensions();
 
     return true;
 }
@@ -2038,6 +2260,7 @@ void Engine::applySplit( const PiecewiseLinearCaseSplit &split )
             // General case: add a new equation to the tableau
             unsigned auxVariable = _tableau->addEquation( equation );
             _activeEntryStrategy->resizeHook( _tableau );
+            _pricingManager.initialize( _tableau );
 
             switch ( equation._type )
             {
@@ -2439,9 +2662,15 @@ unsigned Engine::performSymbolicBoundTightening( Query *inputQuery )
         _networkLevelReasoner->obtainCurrentBounds();
     }
 
-    // Step 2: perform SBT
+    // Step 2: perform SBT. During the search, only the layers affected by
+    // bound changes since the previous invocation are recomputed.
     if ( _symbolicBoundTighteningType == SymbolicBoundTighteningType::SYMBOLIC_BOUND_TIGHTENING )
-        _networkLevelReasoner->symbolicBoundPropagation();
+    {
+        if ( inputQuery )
+            _networkLevelReasoner->symbolicBoundPropagation();
+        else
+            _networkLevelReasoner->incrementalSymbolicBoundPropagation();
+    }
     else if ( _symbolicBoundTighteningType == SymbolicBoundTighteningType::DEEP_POLY )
         _networkLevelReasoner->deepPolyPropagation();
 
@@ -2555,6 +2784,8 @@ void Engine::resetStatistics()
     _rowBoundTightener->setStatistics( &_statistics );
     _preprocessor.setStatistics( &_statistics );
     _activeEntryStrategy->setStatistics( &_statistics );
+    _pricingManager.setStatistics( &_statistics );
+    _costFunctionManager->setStatistics( &_statistics );
 
     _statistics.stampStartingTime();
 }
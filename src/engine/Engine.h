@@ -38,12 +38,14 @@
 #include "Options.h"
 #include "PrecisionRestorer.h"
 #include "Preprocessor.h"
+#include "PricingManager.h"
 #include "Query.h"
 #include "SignalHandler.h"
 #include "SmtCore.h"
 #include "SmtLibWriter.h"
 #include "SnCDivideStrategy.h"
 #include "SparseUnsortedList.h"
+#include "SparseUnsortedLists.h"
 #include "Statistics.h"
 #include "SumOfInfeasibilitiesManager.h"
 #include "SymbolicBoundTighteningType.h"
@@ -381,6 +383,11 @@ private:
     AutoProjectedSteepestEdgeRule _projectedSteepestEdgeRule;
     EntrySelectionStrategy *_activeEntryStrategy;
 
+    /*
+      Provides the entering candidates to the active pivot selection strategy.
+    */
+    PricingManager _pricingManager;
+
     /*
       Bound tightener.
     */
@@ -520,7 +527,6 @@ private:
       there is a chance that multiple Engine object be accessing the Options object.
     */
     unsigned _simulationSize;
-    bool _isGurobyEnabled;
     bool _performLpTighteningAfterSplit;
     MILPSolverBoundTighteningType _milpSolverBoundTighteningType;
 
@@ -540,6 +546,13 @@ private:
     */
     unsigned _statisticsPrintingFrequency;
 
+    /*
+      The number of dual simplex steps that may still be performed
+      before the engine returns to the primal simplex. Reset whenever
+      a new subproblem is entered.
+    */
+    unsigned _dualSimplexStepsRemaining;
+
     LinearExpression _heuristicCost;
 
     /*
@@ -550,6 +563,16 @@ private:
     */
     bool performSimplexStep();
 
+    /*
+      Perform a dual simplex step: pick the basic variable with the
+      largest bound violation as the leaving variable, and an entering
+      variable by the bound-flipping ratio test. Returns false (and
+      stops the dual simplex until the next subproblem) if no pivot
+      that reduces the sum of infeasibilities exists, in which case a
+      primal step should be taken.
+    */
+    bool performDualSimplexStep();
+
     /*
       Perform a constraint-fixing step: select a violated piece-wise
       linear constraint and attempt to fix it.
@@ -618,6 +641,21 @@ private:
     */
     void performBoundTighteningAfterCaseSplit();
 
+    /*
+      Called when the current subproblem is found infeasible. Unless proofs
+      are produced, find the deepest decision level that the infeasibility
+      depends on, and have the SMT core learn a clause and backjump to it.
+    */
+    void analyzeConflict();
+
+    /*
+      Return the lowest level over the infeasibility proofs found for the
+      current bounds: an inconsistent variable, an out-of-bounds row of the
+      tableau, or the row of the cost function. If no proof is found, return
+      the current decision level.
+    */
+    unsigned computeConflictLevel();
+
     /*
       Called after a satisfying assignment is found for the linear constraints.
       Now we try to satisfy the piecewise linear constraints with
@@ -720,14 +758,15 @@ private:
     void invokePreprocessor( const IQuery &inputQuery, bool preprocess );
     void printInputBounds( const IQuery &inputQuery ) const;
     void storeEquationsInDegradationChecker();
-    void removeRedundantEquations( const double *constraintMatrix );
-    void selectInitialVariablesForBasis( const double *constraintMatrix,
+    void removeRedundantEquations( const SparseUnsortedLists &constraintMatrix );
+    void selectInitialVariablesForBasis( const SparseUnsortedLists &constraintMatrix,
                                          List<unsigned> &initialBasis,
                                          List<unsigned> &basicRows );
-    void initializeTableau( const double *constraintMatrix, const List<unsigned> &initialBasis );
+    void initializeTableau( const SparseUnsortedLists &constraintMatrix,
+                            const List<unsigned> &initialBasis );
     void initializeBoundsAndConstraintWatchersInTableau( unsigned numberOfVariables );
     void initializeNetworkLevelReasoning();
-    double *createConstraintMatrix();
+    void createConstraintMatrix( SparseUnsortedLists &constraintMatrix );
     void addAuxiliaryVariables();
     void augmentInitialBasisIfNeeded( List<unsigned> &initialBasis,
                                       const List<unsigned> &basicRows );
@@ -15,6 +15,8 @@
 
 #include "EntrySelectionStrategy.h"
 
+#include "FloatUtils.h"
+
 #include <cstring>
 
 EntrySelectionStrategy::EntrySelectionStrategy()
@@ -27,6 +29,13 @@ void EntrySelectionStrategy::setStatistics( Statistics *statistics )
     _statistics = statistics;
 }
 
+double EntrySelectionStrategy::getPricingScore( const ITableau & /* tableau */,
+                                                const double *costFunction,
+                                                unsigned nonBasic ) const
+{
+    return FloatUtils::abs( costFunction[nonBasic] );
+}
+
 //
 // Local Variables:
 // compile-command: "make -C ../.. "
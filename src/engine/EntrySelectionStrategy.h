@@ -42,6 +42,27 @@ public:
                          const List<unsigned> &candidates,
                          const Set<unsigned> &excluded ) = 0;
 
+    /*
+      The score that this strategy assigns to an eligible entering
+      candidate: select() picks the candidate with the highest score.
+      The pricing manager uses the scores to keep the most promising
+      candidates across iterations. By default, this is the magnitude
+      of the reduced cost.
+    */
+    virtual double getPricingScore( const ITableau &tableau,
+                                    const double *costFunction,
+                                    unsigned nonBasic ) const;
+
+    /*
+      Return true iff this strategy may be applied to a subset of the
+      eligible candidates, i.e. if the pricing manager may perform
+      partial and multiple pricing for it.
+    */
+    virtual bool supportsPartialPricing() const
+    {
+        return true;
+    }
+
     /*
       This hook gets called after the entering and leaving variables
       have been selected, but before the actual pivot.
@@ -74,6 +74,7 @@ public:
       Serializes the query to a file which can then be loaded using QueryLoader.
     */
     virtual void saveQuery( const String &fileName ) = 0;
+    virtual void saveBinaryQuery( const String &fileName ) = 0;
 
     /*
       Generate a non-context-dependent version of the Query
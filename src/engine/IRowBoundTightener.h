@@ -31,6 +31,13 @@ public:
     */
     virtual void setDimensions() = 0;
 
+    /*
+      Forget the bounds that the rows of the constraint matrix were last
+      examined with, so that all of them are examined again. Used when
+      backtracking restores the bounds but not the dimensions.
+    */
+    virtual void resetExaminedBounds() = 0;
+
     /*
       Derive and enqueue new bounds for all varaibles, using the
       inverse of the explicit basis matrix, inv(B0), which should be available
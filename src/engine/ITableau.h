@@ -100,6 +100,7 @@ public:
 
     virtual void setDimensions( unsigned m, unsigned n ) = 0;
     virtual void setConstraintMatrix( const double *A ) = 0;
+    virtual void setConstraintMatrix( const SparseUnsortedList **rows ) = 0;
     virtual void setRightHandSide( const double *b ) = 0;
     virtual void setRightHandSide( unsigned index, double value ) = 0;
     virtual void markAsBasic( unsigned variable ) = 0;
@@ -163,13 +164,18 @@ public:
     virtual unsigned getM() const = 0;
     virtual unsigned getN() const = 0;
     virtual void getTableauRow( unsigned index, TableauRow *row ) = 0;
-    virtual const double *getAColumn( unsigned variable ) const = 0;
+    virtual void addTableauRowCombination( const SparseUnsortedList &coefficients,
+                                           double *result ) = 0;
+    virtual void getTableauRowCombination( const double *coefficients, TableauRow *row ) = 0;
     virtual void getSparseAColumn( unsigned variable, SparseUnsortedList *result ) const = 0;
     virtual void getSparseARow( unsigned row, SparseUnsortedList *result ) const = 0;
     virtual const SparseUnsortedList *getSparseAColumn( unsigned variable ) const = 0;
     virtual const SparseUnsortedList *getSparseARow( unsigned row ) const = 0;
     virtual const SparseMatrix *getSparseA() const = 0;
     virtual void performDegeneratePivot() = 0;
+    virtual bool pickDualLeavingVariable() = 0;
+    virtual bool pickDualEnteringVariable() = 0;
+    virtual void performDualPivot() = 0;
     virtual void storeState( TableauState &state, TableauStateStorageLevel level ) const = 0;
     virtual void restoreState( const TableauState &state, TableauStateStorageLevel level ) = 0;
     virtual void setGurobi( GurobiWrapper *gurobi ) = 0;
@@ -177,6 +183,7 @@ public:
     virtual const double *getRightHandSide() const = 0;
     virtual void forwardTransformation( const double *y, double *x ) const = 0;
     virtual void backwardTransformation( const double *y, double *x ) const = 0;
+    virtual void untrackedBackwardTransformation( const double *y, double *x ) const = 0;
     virtual double getSumOfInfeasibilities() const = 0;
     virtual BasicAssignmentStatus getBasicAssignmentStatus() const = 0;
     virtual double getBasicAssignment( unsigned basicIndex ) const = 0;
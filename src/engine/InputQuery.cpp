@@ -339,6 +339,13 @@ void InputQuery::saveQuery( const String &fileName )
     delete query;
 }
 
+void InputQuery::saveBinaryQuery( const String &fileName )
+{
+    Query *query = generateQuery();
+    query->saveBinaryQuery( fileName );
+    delete query;
+}
+
 void InputQuery::saveQueryAsSmtLib( const String &fileName ) const
 {
     Query *query = generateQuery();
@@ -136,6 +136,7 @@ public:
     */
     void saveQuery( const String &fileName );
     void saveQueryAsSmtLib( const String &filename ) const;
+    void saveBinaryQuery( const String &fileName );
 
     /*
       Generate a non-context-dependent version of the Query
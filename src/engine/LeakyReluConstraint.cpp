@@ -112,6 +112,11 @@ void LeakyReluConstraint::restoreState( const PiecewiseLinearConstraint *state )
     _cdInfeasibleCases = infeasibleCases;
 }
 
+bool LeakyReluConstraint::searchStateIsContextDependent() const
+{
+    return _context != nullptr && _boundManager != nullptr;
+}
+
 void LeakyReluConstraint::registerAsWatcher( ITableau *tableau )
 {
     tableau->registerToWatchVariable( this, _b );
@@ -403,7 +408,7 @@ List<PiecewiseLinearConstraint::Fix> LeakyReluConstraint::getSmartFixes( ITablea
 
 List<PiecewiseLinearCaseSplit> LeakyReluConstraint::getCaseSplits() const
 {
-    if ( _phaseStatus != PHASE_NOT_FIXED )
+    if ( getPhaseStatus() != PHASE_NOT_FIXED )
         throw MarabouError( MarabouError::REQUESTED_CASE_SPLITS_FROM_FIXED_CONSTRAINT );
 
     List<PiecewiseLinearCaseSplit> splits;
@@ -525,14 +530,14 @@ PiecewiseLinearCaseSplit LeakyReluConstraint::getActiveSplit() const
 
 bool LeakyReluConstraint::phaseFixed() const
 {
-    return _phaseStatus != PHASE_NOT_FIXED;
+    return getPhaseStatus() != PHASE_NOT_FIXED;
 }
 
 PiecewiseLinearCaseSplit LeakyReluConstraint::getImpliedCaseSplit() const
 {
-    ASSERT( _phaseStatus != PHASE_NOT_FIXED );
+    ASSERT( getPhaseStatus() != PHASE_NOT_FIXED );
 
-    if ( _phaseStatus == RELU_PHASE_ACTIVE )
+    if ( getPhaseStatus() == RELU_PHASE_ACTIVE )
         return getActiveSplit();
 
     return getInactiveSplit();
@@ -550,9 +555,9 @@ void LeakyReluConstraint::dump( String &output ) const
                       _f,
                       _b,
                       _slope,
-                      _constraintActive ? "Yes" : "No",
-                      _phaseStatus,
-                      phaseToString( _phaseStatus ).ascii() );
+                      isActive() ? "Yes" : "No",
+                      getPhaseStatus(),
+                      phaseToString( getPhaseStatus() ).ascii() );
 
     output +=
         Stringf( "b in [%s, %s], ",
@@ -625,18 +630,18 @@ void LeakyReluConstraint::eliminateVariable( __attribute__( ( unused ) ) unsigne
         {
             if ( FloatUtils::gt( fixedValue, 0 ) )
             {
-                ASSERT( _phaseStatus != RELU_PHASE_INACTIVE );
+                ASSERT( getPhaseStatus() != RELU_PHASE_INACTIVE );
             }
             else if ( FloatUtils::lt( fixedValue, 0 ) )
             {
-                ASSERT( _phaseStatus != RELU_PHASE_ACTIVE );
+                ASSERT( getPhaseStatus() != RELU_PHASE_ACTIVE );
             }
         }
         else if ( variable == _activeAux )
         {
             if ( FloatUtils::isPositive( fixedValue ) )
             {
-                ASSERT( _phaseStatus != RELU_PHASE_ACTIVE );
+                ASSERT( getPhaseStatus() != RELU_PHASE_ACTIVE );
             }
         }
         else
@@ -644,7 +649,7 @@ void LeakyReluConstraint::eliminateVariable( __attribute__( ( unused ) ) unsigne
             // This is the inactive aux variable
             if ( FloatUtils::isPositive( fixedValue ) )
             {
-                ASSERT( _phaseStatus != RELU_PHASE_INACTIVE );
+                ASSERT( getPhaseStatus() != RELU_PHASE_INACTIVE );
             }
         }
     } );
@@ -150,7 +150,10 @@ void Marabou::prepareQuery()
     String queryDumpFilePath = Options::get()->getString( Options::QUERY_DUMP_FILE );
     if ( queryDumpFilePath.length() > 0 )
     {
-        _inputQuery.saveQuery( queryDumpFilePath );
+        if ( queryDumpFilePath.endsWith( ".ipqb" ) )
+            _inputQuery.saveBinaryQuery( queryDumpFilePath );
+        else
+            _inputQuery.saveQuery( queryDumpFilePath );
         printf( "\nInput query successfully dumped to file\n" );
         exit( 0 );
     }
@@ -63,6 +63,7 @@ public:
         UNSUPPORTED_TRANSCENDENTAL_CONSTRAINT = 103,
         UNSUPPORTED_NON_LINEAR_CONSTRAINT = 104,
         ONNX_PARSER_ERROR = 105,
+        INVALID_QUERY_FILE = 106,
 
         FEATURE_NOT_YET_SUPPORTED = 900,
 
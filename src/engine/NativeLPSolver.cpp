@@ -0,0 +1,984 @@
+/*********************                                                        */
+/*! \file NativeLPSolver.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "NativeLPSolver.h"
+
+#include "BasisFactorizationFactory.h"
+#include "Debug.h"
+#include "FloatUtils.h"
+#include "GlobalConfiguration.h"
+#include "MStringf.h"
+#include "MalformedBasisException.h"
+#include "MarabouError.h"
+#include "SparseColumnsOfBasis.h"
+#include "TimeUtils.h"
+
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <string>
+
+NativeLPSolver::NativeLPSolver()
+    : _costConstant( 0 )
+    , _maximize( false )
+    , _cutoff( 0 )
+    , _cutoffInUse( false )
+    , _timeoutInSeconds( FloatUtils::infinity() )
+    , _columnsValid( false )
+    , _basisFactorization( NULL )
+    , _factorizedM( 0 )
+    , _factorizationValid( false )
+    , _basisValid( false )
+    , _savedStructure( 0 )
+    , _basicCosts( NULL )
+    , _multipliers( NULL )
+    , _changeColumn( NULL )
+    , _denseColumn( NULL )
+    , _rhs( NULL )
+    , _workSize( 0 )
+    , _status( NOT_SOLVED )
+    , _iterations( 0 )
+{
+}
+
+NativeLPSolver::~NativeLPSolver()
+{
+    freeColumns();
+    freeWorkMemory();
+
+    if ( _basisFactorization )
+    {
+        delete _basisFactorization;
+        _basisFactorization = NULL;
+    }
+}
+
+void NativeLPSolver::addVariable( String name, double lb, double ub, VariableType type )
+{
+    if ( type != CONTINUOUS )
+        throw MarabouError( MarabouError::FEATURE_NOT_YET_SUPPORTED,
+                            "NativeLPSolver only supports continuous variables" );
+
+    ASSERT( !_nameToColumn.exists( name ) );
+
+    unsigned column = getNumberOfColumns();
+    _nameToColumn[name] = column;
+    _columnToName.append( name );
+    _lowerBounds.append( lb );
+    _upperBounds.append( ub );
+    _costs.append( 0 );
+
+    _columnsValid = false;
+}
+
+void NativeLPSolver::setLowerBound( String name, double lb )
+{
+    _lowerBounds[getColumn( name )] = lb;
+}
+
+void NativeLPSolver::setUpperBound( String name, double ub )
+{
+    _upperBounds[getColumn( name )] = ub;
+}
+
+double NativeLPSolver::getLowerBound( const String &name ) const
+{
+    return _lowerBounds[getColumn( name )];
+}
+
+double NativeLPSolver::getUpperBound( const String &name ) const
+{
+    return _upperBounds[getColumn( name )];
+}
+
+bool NativeLPSolver::containsVariable( String name ) const
+{
+    return _nameToColumn.exists( name );
+}
+
+void NativeLPSolver::addLeqConstraint( const List<Term> &terms, double scalar )
+{
+    addConstraint( terms, scalar, 0, FloatUtils::infinity() );
+}
+
+void NativeLPSolver::addGeqConstraint( const List<Term> &terms, double scalar )
+{
+    addConstraint( terms, scalar, FloatUtils::negativeInfinity(), 0 );
+}
+
+void NativeLPSolver::addEqConstraint( const List<Term> &terms, double scalar )
+{
+    addConstraint( terms, scalar, 0, 0 );
+}
+
+void NativeLPSolver::addConstraint( const List<Term> &terms,
+                                    double scalar,
+                                    double slackLb,
+                                    double slackUb )
+{
+    // Merge repeated variables and drop zero coefficients
+    Map<unsigned, double> coefficients;
+    for ( const auto &term : terms )
+    {
+        unsigned column = getColumn( term._variable );
+        if ( !coefficients.exists( column ) )
+            coefficients[column] = 0;
+        coefficients[column] += term._coefficient;
+    }
+
+    Row row;
+    row._scalar = scalar;
+    for ( const auto &coefficient : coefficients )
+    {
+        if ( !FloatUtils::isZero( coefficient.second ) )
+            row._entries.append( SparseUnsortedList::Entry( coefficient.first, coefficient.second ) );
+    }
+
+    _slackToRow[getNumberOfColumns()] = _rows.size();
+    _rowToSlack.append( getNumberOfColumns() );
+    _rows.append( row );
+
+    _columnToName.append( "" );
+    _lowerBounds.append( slackLb );
+    _upperBounds.append( slackUb );
+    _costs.append( 0 );
+
+    _columnsValid = false;
+}
+
+void NativeLPSolver::setCost( const List<Term> &terms, double constant )
+{
+    setObjectiveTerms( terms, constant, false );
+}
+
+void NativeLPSolver::setObjective( const List<Term> &terms, double constant )
+{
+    setObjectiveTerms( terms, constant, true );
+}
+
+void NativeLPSolver::setObjectiveTerms( const List<Term> &terms, double constant, bool maximize )
+{
+    // Internally, the solver always minimizes
+    std::fill( _costs.begin(), _costs.end(), 0 );
+    for ( const auto &term : terms )
+        _costs[getColumn( term._variable )] +=
+            maximize ? -term._coefficient : term._coefficient;
+
+    _costConstant = constant;
+    _maximize = maximize;
+}
+
+void NativeLPSolver::setCutoff( double cutoff )
+{
+    _cutoff = cutoff;
+    _cutoffInUse = true;
+}
+
+void NativeLPSolver::setTimeLimit( double seconds )
+{
+    _timeoutInSeconds = seconds;
+}
+
+unsigned NativeLPSolver::getColumn( const String &name ) const
+{
+    if ( !_nameToColumn.exists( name ) )
+        throw MarabouError( MarabouError::VARIABLE_DOESNT_EXIST_IN_SOLUTION,
+                            Stringf( "Unknown LP variable %s", name.ascii() ).ascii() );
+    return _nameToColumn.get( name );
+}
+
+unsigned NativeLPSolver::getNumberOfRows() const
+{
+    return _rows.size();
+}
+
+unsigned NativeLPSolver::getNumberOfColumns() const
+{
+    return _lowerBounds.size();
+}
+
+void NativeLPSolver::buildColumns()
+{
+    freeColumns();
+
+    unsigned m = getNumberOfRows();
+    unsigned n = getNumberOfColumns();
+
+    for ( unsigned i = 0; i < n; ++i )
+        _columns.append( new SparseUnsortedList( m ) );
+
+    for ( unsigned i = 0; i < m; ++i )
+    {
+        for ( const auto &entry : _rows[i]._entries )
+            _columns[entry._index]->append( i, entry._value );
+        _columns[_rowToSlack[i]]->append( i, 1 );
+    }
+
+    _columnsValid = true;
+}
+
+void NativeLPSolver::freeColumns()
+{
+    for ( auto &column : _columns )
+        delete column;
+    _columns.clear();
+    _columnsValid = false;
+}
+
+void NativeLPSolver::allocateWorkMemory()
+{
+    unsigned m = getNumberOfRows();
+    if ( m == _workSize && _basicCosts )
+        return;
+
+    freeWorkMemory();
+
+    // Allocate at least one entry, so that empty models are handled uniformly
+    unsigned size = m > 0 ? m : 1;
+    _basicCosts = new double[size];
+    _multipliers = new double[size];
+    _changeColumn = new double[size];
+    _denseColumn = new double[size];
+    _rhs = new double[size];
+    _workSize = m;
+}
+
+void NativeLPSolver::freeWorkMemory()
+{
+    if ( _basicCosts )
+    {
+        delete[] _basicCosts;
+        _basicCosts = NULL;
+    }
+
+    if ( _multipliers )
+    {
+        delete[] _multipliers;
+        _multipliers = NULL;
+    }
+
+    if ( _changeColumn )
+    {
+        delete[] _changeColumn;
+        _changeColumn = NULL;
+    }
+
+    if ( _denseColumn )
+    {
+        delete[] _denseColumn;
+        _denseColumn = NULL;
+    }
+
+    if ( _rhs )
+    {
+        delete[] _rhs;
+        _rhs = NULL;
+    }
+
+    _workSize = 0;
+}
+
+void NativeLPSolver::initializeSlackBasis()
+{
+    unsigned m = getNumberOfRows();
+    unsigned n = getNumberOfColumns();
+
+    _variableStatus.clear();
+    for ( unsigned i = 0; i < n; ++i )
+        _variableStatus.append( AT_LOWER );
+
+    _basicIndexToColumn.clear();
+    for ( unsigned i = 0; i < m; ++i )
+    {
+        _basicIndexToColumn.append( _rowToSlack[i] );
+        _variableStatus[_rowToSlack[i]] = BASIC;
+    }
+
+    _values.clear();
+    for ( unsigned i = 0; i < n; ++i )
+        _values.append( 0 );
+
+    _basisValid = true;
+    _factorizationValid = false;
+}
+
+bool NativeLPSolver::restoreSavedBasis()
+{
+    unsigned m = getNumberOfRows();
+    unsigned n = getNumberOfColumns();
+
+    if ( _savedBasicVariables.size() + _savedBasicRows.size() != m ||
+         _savedStructure != computeStructureSignature() )
+        return false;
+
+    Vector<VariableStatus> status( n, AT_LOWER );
+    Vector<unsigned> basicIndexToColumn;
+
+    for ( const auto &name : _savedBasicVariables )
+    {
+        if ( !_nameToColumn.exists( name ) )
+            return false;
+        unsigned column = _nameToColumn[name];
+        status[column] = BASIC;
+        basicIndexToColumn.append( column );
+    }
+
+    for ( const auto &row : _savedBasicRows )
+    {
+        if ( row >= m )
+            return false;
+        status[_rowToSlack[row]] = BASIC;
+        basicIndexToColumn.append( _rowToSlack[row] );
+    }
+
+    for ( const auto &name : _savedAtUpper )
+    {
+        if ( _nameToColumn.exists( name ) && status[_nameToColumn[name]] != BASIC )
+            status[_nameToColumn[name]] = AT_UPPER;
+    }
+
+    _variableStatus = status;
+    _basicIndexToColumn = basicIndexToColumn;
+    _values = Vector<double>( n, 0 );
+
+    _basisValid = true;
+    _factorizationValid = false;
+    return true;
+}
+
+void NativeLPSolver::extendBasis()
+{
+    unsigned n = getNumberOfColumns();
+    if ( _variableStatus.size() == n )
+        return;
+
+    // New constraints enter the basis through their slacks, which keeps
+    // the basis matrix non-singular. New variables start as non-basic.
+    for ( unsigned i = _variableStatus.size(); i < n; ++i )
+    {
+        if ( _slackToRow.exists( i ) )
+        {
+            _variableStatus.append( BASIC );
+            _basicIndexToColumn.append( i );
+        }
+        else
+        {
+            _variableStatus.append( AT_LOWER );
+        }
+        _values.append( 0 );
+    }
+
+    _factorizationValid = false;
+}
+
+bool NativeLPSolver::factorizeBasis()
+{
+    unsigned m = getNumberOfRows();
+
+    if ( !_basisFactorization || _factorizedM != m )
+    {
+        if ( _basisFactorization )
+            delete _basisFactorization;
+        _basisFactorization = NULL;
+
+        if ( m == 0 )
+        {
+            _factorizedM = 0;
+            _factorizationValid = true;
+            return true;
+        }
+
+        _basisFactorization = BasisFactorizationFactory::createBasisFactorization( m, *this );
+        _factorizedM = m;
+    }
+
+    try
+    {
+        _basisFactorization->obtainFreshBasis();
+    }
+    catch ( const MalformedBasisException & )
+    {
+        return false;
+    }
+
+    _factorizationValid = true;
+    return true;
+}
+
+void NativeLPSolver::prepareBasis()
+{
+    if ( !_columnsValid )
+        buildColumns();
+
+    allocateWorkMemory();
+
+    if ( !_basisValid )
+    {
+        if ( !restoreSavedBasis() )
+            initializeSlackBasis();
+    }
+    else
+    {
+        extendBasis();
+    }
+
+    if ( !_factorizationValid && !factorizeBasis() )
+    {
+        NATIVE_LP_SOLVER_LOG( "Basis is singular, falling back to the slack basis" );
+        initializeSlackBasis();
+        if ( !factorizeBasis() )
+            throw MarabouError( MarabouError::RESTORATION_FAILED_TO_REFACTORIZE_BASIS );
+    }
+}
+
+void NativeLPSolver::placeNonBasicVariables()
+{
+    unsigned n = getNumberOfColumns();
+    for ( unsigned i = 0; i < n; ++i )
+    {
+        if ( _variableStatus[i] == BASIC )
+            continue;
+
+        bool finiteLb = FloatUtils::isFinite( _lowerBounds[i] );
+        bool finiteUb = FloatUtils::isFinite( _upperBounds[i] );
+
+        if ( _variableStatus[i] == AT_UPPER && finiteUb )
+            _values[i] = _upperBounds[i];
+        else if ( finiteLb )
+        {
+            _variableStatus[i] = AT_LOWER;
+            _values[i] = _lowerBounds[i];
+        }
+        else if ( finiteUb )
+        {
+            _variableStatus[i] = AT_UPPER;
+            _values[i] = _upperBounds[i];
+        }
+        else
+        {
+            _variableStatus[i] = FREE;
+            _values[i] = 0;
+        }
+    }
+}
+
+void NativeLPSolver::computeBasicAssignment()
+{
+    unsigned m = getNumberOfRows();
+    if ( m == 0 )
+        return;
+
+    // B * xB = b - N * xN
+    for ( unsigned i = 0; i < m; ++i )
+        _rhs[i] = _rows[i]._scalar;
+
+    unsigned n = getNumberOfColumns();
+    for ( unsigned i = 0; i < n; ++i )
+    {
+        if ( _variableStatus[i] == BASIC || _values[i] == 0 )
+            continue;
+
+        for ( const auto &entry : *_columns[i] )
+            _rhs[entry._index] -= entry._value * _values[i];
+    }
+
+    _basisFactorization->forwardTransformation( _rhs, _changeColumn );
+
+    for ( unsigned i = 0; i < m; ++i )
+        _values[_basicIndexToColumn[i]] = _changeColumn[i];
+}
+
+static double boundTolerance( double bound )
+{
+    return GlobalConfiguration::BOUND_COMPARISON_ADDITIVE_TOLERANCE +
+           GlobalConfiguration::BOUND_COMPARISON_MULTIPLICATIVE_TOLERANCE * std::fabs( bound );
+}
+
+double NativeLPSolver::computeInfeasibility( unsigned column ) const
+{
+    double value = _values[column];
+    double lb = _lowerBounds[column];
+    double ub = _upperBounds[column];
+
+    if ( FloatUtils::isFinite( lb ) && value < lb - boundTolerance( lb ) )
+        return -1;
+    if ( FloatUtils::isFinite( ub ) && value > ub + boundTolerance( ub ) )
+        return 1;
+    return 0;
+}
+
+bool NativeLPSolver::computeBasicCosts()
+{
+    unsigned m = getNumberOfRows();
+
+    // Phase one: minimize the sum of infeasibilities of the basic variables
+    bool phaseOne = false;
+    for ( unsigned i = 0; i < m; ++i )
+    {
+        _basicCosts[i] = computeInfeasibility( _basicIndexToColumn[i] );
+        if ( _basicCosts[i] != 0 )
+            phaseOne = true;
+    }
+
+    // Phase two: minimize the actual cost
+    if ( !phaseOne )
+    {
+        for ( unsigned i = 0; i < m; ++i )
+            _basicCosts[i] = _costs[_basicIndexToColumn[i]];
+    }
+
+    return phaseOne;
+}
+
+bool NativeLPSolver::pickEnteringVariable( bool phaseOne,
+                                           bool useBlandsRule,
+                                           unsigned &entering,
+                                           double &reducedCost )
+{
+    unsigned m = getNumberOfRows();
+    unsigned n = getNumberOfColumns();
+
+    // Compute the simplex multipliers, y = cB * inv(B)
+    if ( m > 0 )
+        _basisFactorization->backwardTransformation( _basicCosts, _multipliers );
+
+    bool found = false;
+    double bestScore = 0;
+
+    for ( unsigned i = 0; i < n; ++i )
+    {
+        VariableStatus status = _variableStatus[i];
+        if ( status == BASIC )
+            continue;
+
+        bool canIncrease = ( status == FREE ) ||
+                           ( status == AT_LOWER && _upperBounds[i] > _lowerBounds[i] );
+        bool canDecrease = ( status == FREE ) ||
+                           ( status == AT_UPPER && _upperBounds[i] > _lowerBounds[i] );
+        if ( !canIncrease && !canDecrease )
+            continue;
+
+        double d = phaseOne ? 0 : _costs[i];
+        for ( const auto &entry : *_columns[i] )
+            d -= _multipliers[entry._index] * entry._value;
+
+        bool eligible = ( canIncrease && d < -GlobalConfiguration::ENTRY_ELIGIBILITY_TOLERANCE ) ||
+                        ( canDecrease && d > GlobalConfiguration::ENTRY_ELIGIBILITY_TOLERANCE );
+        if ( !eligible )
+            continue;
+
+        if ( useBlandsRule )
+        {
+            entering = i;
+            reducedCost = d;
+            return true;
+        }
+
+        if ( std::fabs( d ) > bestScore )
+        {
+            bestScore = std::fabs( d );
+            entering = i;
+            reducedCost = d;
+            found = true;
+        }
+    }
+
+    return found;
+}
+
+void NativeLPSolver::performIteration( unsigned entering,
+                                       double reducedCost,
+                                       bool &unbounded,
+                                       bool &degenerate )
+{
+    unsigned m = getNumberOfRows();
+
+    // The entering variable increases if its reduced cost is negative
+    double direction = reducedCost < 0 ? 1 : -1;
+
+    if ( m > 0 )
+    {
+        _columns[entering]->toDense( _denseColumn );
+        _basisFactorization->forwardTransformation( _denseColumn, _changeColumn );
+    }
+
+    // The entering variable may be blocked by its own opposite bound
+    double stepSize = FloatUtils::infinity();
+    if ( FloatUtils::isFinite( _lowerBounds[entering] ) &&
+         FloatUtils::isFinite( _upperBounds[entering] ) )
+        stepSize = _upperBounds[entering] - _lowerBounds[entering];
+
+    int leavingIndex = -1;
+    double leavingTarget = 0;
+    double leavingPivot = 0;
+
+    for ( unsigned i = 0; i < m; ++i )
+    {
+        double pivot = _changeColumn[i];
+        if ( std::fabs( pivot ) < GlobalConfiguration::PIVOT_CHANGE_COLUMN_TOLERANCE )
+            continue;
+
+        unsigned column = _basicIndexToColumn[i];
+        double value = _values[column];
+        double lb = _lowerBounds[column];
+        double ub = _upperBounds[column];
+        double rate = -direction * pivot;
+
+        /*
+          A basic variable is blocked by the first bound it hits. An
+          infeasible variable moving towards its bounds stops once it
+          becomes feasible; one moving away from them is not blocked.
+        */
+        double target;
+        if ( rate > 0 )
+        {
+            if ( FloatUtils::isFinite( lb ) && value < lb - boundTolerance( lb ) )
+                target = lb;
+            else if ( FloatUtils::isFinite( ub ) && value <= ub + boundTolerance( ub ) )
+                target = ub;
+            else
+                continue;
+        }
+        else
+        {
+            if ( FloatUtils::isFinite( ub ) && value > ub + boundTolerance( ub ) )
+                target = ub;
+            else if ( FloatUtils::isFinite( lb ) && value >= lb - boundTolerance( lb ) )
+                target = lb;
+            else
+                continue;
+        }
+
+        double ratio = ( target - value ) / rate;
+        if ( ratio < 0 )
+            ratio = 0;
+
+        // Prefer larger pivots among (almost) tied candidates
+        if ( ratio < stepSize - GlobalConfiguration::DEFAULT_EPSILON_FOR_COMPARISONS ||
+             ( ratio <= stepSize + GlobalConfiguration::DEFAULT_EPSILON_FOR_COMPARISONS &&
+               leavingIndex >= 0 && std::fabs( pivot ) > std::fabs( leavingPivot ) ) )
+        {
+            stepSize = ratio;
+            leavingIndex = i;
+            leavingTarget = target;
+            leavingPivot = pivot;
+        }
+    }
+
+    unbounded = !FloatUtils::isFinite( stepSize );
+    if ( unbounded )
+        return;
+
+    degenerate = stepSize < GlobalConfiguration::DEFAULT_EPSILON_FOR_COMPARISONS;
+    ++_iterations;
+
+    // Update the assignment
+    _values[entering] += direction * stepSize;
+    for ( unsigned i = 0; i < m; ++i )
+    {
+        if ( _changeColumn[i] != 0 )
+            _values[_basicIndexToColumn[i]] -= direction * stepSize * _changeColumn[i];
+    }
+
+    if ( leavingIndex < 0 )
+    {
+        // A bound flip, the basis does not change
+        if ( direction > 0 )
+        {
+            _variableStatus[entering] = AT_UPPER;
+            _values[entering] = _upperBounds[entering];
+        }
+        else
+        {
+            _variableStatus[entering] = AT_LOWER;
+            _values[entering] = _lowerBounds[entering];
+        }
+        return;
+    }
+
+    unsigned leaving = _basicIndexToColumn[leavingIndex];
+    _values[leaving] = leavingTarget;
+    _variableStatus[leaving] = ( leavingTarget == _lowerBounds[leaving] ) ? AT_LOWER : AT_UPPER;
+
+    _variableStatus[entering] = BASIC;
+    _basicIndexToColumn[leavingIndex] = entering;
+    _basisFactorization->updateToAdjacentBasis( leavingIndex, _changeColumn, _denseColumn );
+}
+
+void NativeLPSolver::solve()
+{
+    _status = NOT_SOLVED;
+    _iterations = 0;
+
+    prepareBasis();
+    placeNonBasicVariables();
+    computeBasicAssignment();
+
+    struct timespec start = TimeUtils::sampleMicro();
+    bool checkTime = FloatUtils::isFinite( _timeoutInSeconds );
+
+    unsigned degenerateIterations = 0;
+    bool assignmentJustComputed = true;
+
+    while ( true )
+    {
+        if ( _iterations >= GlobalConfiguration::NATIVE_LP_SOLVER_MAX_ITERATIONS )
+        {
+            _status = TIMEOUT;
+            break;
+        }
+
+        if ( checkTime && _iterations % 100 == 0 )
+        {
+            struct timespec now = TimeUtils::sampleMicro();
+            if ( TimeUtils::timePassed( start, now ) > _timeoutInSeconds * 1000000 )
+            {
+                _status = TIMEOUT;
+                break;
+            }
+        }
+
+        bool phaseOne = computeBasicCosts();
+
+        unsigned entering = 0;
+        double reducedCost = 0;
+        bool useBlandsRule =
+            degenerateIterations >
+            GlobalConfiguration::NATIVE_LP_SOLVER_DEGENERATE_ITERATIONS_BEFORE_BLANDS_RULE;
+
+        if ( !pickEnteringVariable( phaseOne, useBlandsRule, entering, reducedCost ) )
+        {
+            // Confirm the result against a freshly computed assignment
+            if ( !assignmentJustComputed )
+            {
+                computeBasicAssignment();
+                assignmentJustComputed = true;
+                continue;
+            }
+
+            _status = phaseOne ? INFEASIBLE : OPTIMAL;
+            break;
+        }
+
+        bool unbounded = false;
+        bool degenerate = false;
+        performIteration( entering, reducedCost, unbounded, degenerate );
+
+        if ( unbounded )
+        {
+            // In phase one this can only be caused by numerical trouble,
+            // in which case only the trivial bound is reported
+            _status = phaseOne ? TIMEOUT : UNBOUNDED;
+            break;
+        }
+
+        degenerateIterations = degenerate ? degenerateIterations + 1 : 0;
+        assignmentJustComputed = false;
+
+        if ( _iterations % GlobalConfiguration::NATIVE_LP_SOLVER_RECOMPUTE_ASSIGNMENT_FREQUENCY ==
+             0 )
+        {
+            computeBasicAssignment();
+            assignmentJustComputed = true;
+        }
+    }
+
+    if ( _status == OPTIMAL && _cutoffInUse )
+    {
+        double value = computeObjectiveValue();
+        if ( ( _maximize && value < _cutoff ) || ( !_maximize && value > _cutoff ) )
+            _status = CUTOFF;
+    }
+
+    NATIVE_LP_SOLVER_LOG(
+        Stringf( "Solve done. Status: %u, iterations: %u", _status, _iterations ).ascii() );
+}
+
+double NativeLPSolver::computeObjectiveValue() const
+{
+    double result = 0;
+    unsigned n = getNumberOfColumns();
+    for ( unsigned i = 0; i < n; ++i )
+    {
+        if ( _costs[i] != 0 )
+            result += _costs[i] * _values[i];
+    }
+
+    return ( _maximize ? -result : result ) + _costConstant;
+}
+
+bool NativeLPSolver::optimal()
+{
+    return _status == OPTIMAL;
+}
+
+bool NativeLPSolver::cutoffOccurred()
+{
+    return _status == CUTOFF;
+}
+
+bool NativeLPSolver::infeasible()
+{
+    return _status == INFEASIBLE;
+}
+
+bool NativeLPSolver::timeout()
+{
+    return _status == TIMEOUT;
+}
+
+bool NativeLPSolver::haveFeasibleSolution()
+{
+    return _status == OPTIMAL || _status == CUTOFF;
+}
+
+void NativeLPSolver::extractSolution( Map<String, double> &values, double &costOrObjective )
+{
+    values.clear();
+
+    unsigned n = getNumberOfColumns();
+    for ( unsigned i = 0; i < n; ++i )
+    {
+        if ( !_slackToRow.exists( i ) )
+            values[_columnToName[i]] = _values[i];
+    }
+
+    costOrObjective = computeObjectiveValue();
+}
+
+double NativeLPSolver::getObjectiveBound()
+{
+    if ( _status == OPTIMAL || _status == CUTOFF )
+        return computeObjectiveValue();
+
+    return _maximize ? FloatUtils::infinity() : FloatUtils::negativeInfinity();
+}
+
+double NativeLPSolver::getAssignment( const String &name ) const
+{
+    return _values[getColumn( name )];
+}
+
+unsigned NativeLPSolver::getNumberOfSimplexIterations() const
+{
+    return _iterations;
+}
+
+NativeLPSolver::Status NativeLPSolver::getStatus() const
+{
+    return _status;
+}
+
+void NativeLPSolver::reset()
+{
+    _status = NOT_SOLVED;
+}
+
+std::size_t NativeLPSolver::computeStructureSignature() const
+{
+    // Combine the names of the variables participating in every
+    // constraint, and the constraint types
+    std::hash<std::string> hashName;
+    std::size_t signature = _rows.size();
+    for ( unsigned i = 0; i < _rows.size(); ++i )
+    {
+        for ( const auto &entry : _rows[i]._entries )
+            signature = signature * 31 + hashName( _columnToName[entry._index].ascii() );
+
+        unsigned slack = _rowToSlack[i];
+        signature = signature * 31 + ( FloatUtils::isFinite( _lowerBounds[slack] ) ? 1 : 0 ) +
+                    ( FloatUtils::isFinite( _upperBounds[slack] ) ? 2 : 0 );
+    }
+    return signature;
+}
+
+void NativeLPSolver::saveBasis()
+{
+    _savedBasicVariables.clear();
+    _savedBasicRows.clear();
+    _savedAtUpper.clear();
+
+    if ( !_basisValid )
+        return;
+
+    _savedStructure = computeStructureSignature();
+
+    for ( const auto &column : _basicIndexToColumn )
+    {
+        if ( _slackToRow.exists( column ) )
+            _savedBasicRows.append( _slackToRow[column] );
+        else
+            _savedBasicVariables.append( _columnToName[column] );
+    }
+
+    for ( unsigned i = 0; i < _variableStatus.size(); ++i )
+    {
+        if ( _variableStatus[i] == AT_UPPER && !_slackToRow.exists( i ) )
+            _savedAtUpper.insert( _columnToName[i] );
+    }
+}
+
+void NativeLPSolver::resetModel()
+{
+    saveBasis();
+
+    _nameToColumn.clear();
+    _columnToName.clear();
+    _rows.clear();
+    _rowToSlack.clear();
+    _slackToRow.clear();
+    _lowerBounds.clear();
+    _upperBounds.clear();
+    _costs.clear();
+    _costConstant = 0;
+    _maximize = false;
+    _cutoffInUse = false;
+
+    freeColumns();
+
+    _basicIndexToColumn.clear();
+    _variableStatus.clear();
+    _values.clear();
+    _basisValid = false;
+    _factorizationValid = false;
+
+    _status = NOT_SOLVED;
+}
+
+void NativeLPSolver::getColumnOfBasis( unsigned column, double *result ) const
+{
+    ASSERT( column < _basicIndexToColumn.size() );
+    _columns[_basicIndexToColumn[column]]->toDense( result );
+}
+
+void NativeLPSolver::getColumnOfBasis( unsigned column, SparseUnsortedList *result ) const
+{
+    ASSERT( column < _basicIndexToColumn.size() );
+    _columns[_basicIndexToColumn[column]]->storeIntoOther( result );
+}
+
+void NativeLPSolver::getSparseBasis( SparseColumnsOfBasis &basis ) const
+{
+    for ( unsigned i = 0; i < _basicIndexToColumn.size(); ++i )
+        basis._columns[i] = _columns[_basicIndexToColumn[i]];
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
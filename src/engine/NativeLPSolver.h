@@ -0,0 +1,257 @@
+/*********************                                                        */
+/*! \file NativeLPSolver.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** A bounded-variable, revised primal simplex solver for the LPs issued by
+ ** the LP-based bound tightening of the network level reasoner. The basis
+ ** is factorized using Marabou's own basis factorizations, so that the LP
+ ** tightening modes are available also when Gurobi is not.
+ **
+ ** Successive solves warm-start from the last basis: changing the
+ ** objective or the bounds keeps the basis, and adding variables and
+ ** constraints extends it. When the model is reset and re-created (as is
+ ** done for every neuron by the LPFormulator), the last basis is re-used
+ ** if the new model has the same shape.
+
+**/
+
+#ifndef __NativeLPSolver_h__
+#define __NativeLPSolver_h__
+
+#include "IBasisFactorization.h"
+#include "ILPSolver.h"
+#include "List.h"
+#include "MString.h"
+#include "Map.h"
+#include "Set.h"
+#include "SparseUnsortedList.h"
+#include "Vector.h"
+
+#include <cstddef>
+
+#define NATIVE_LP_SOLVER_LOG( x, ... )                                                             \
+    LOG( GlobalConfiguration::NATIVE_LP_SOLVER_LOGGING, "NativeLPSolver: %s\n", x )
+
+class NativeLPSolver
+    : public ILPSolver
+    , public IBasisFactorization::BasisColumnOracle
+{
+public:
+    enum Status {
+        NOT_SOLVED = 0,
+        OPTIMAL = 1,
+        INFEASIBLE = 2,
+        UNBOUNDED = 3,
+        CUTOFF = 4,
+        TIMEOUT = 5,
+    };
+
+    NativeLPSolver();
+    ~NativeLPSolver();
+
+    /*
+      Building the model. Only continuous variables are supported.
+    */
+    void addVariable( String name, double lb, double ub, VariableType type = CONTINUOUS );
+    void setLowerBound( String name, double lb );
+    void setUpperBound( String name, double ub );
+    double getLowerBound( const String &name ) const;
+    double getUpperBound( const String &name ) const;
+    bool containsVariable( String name ) const;
+
+    void addLeqConstraint( const List<Term> &terms, double scalar );
+    void addGeqConstraint( const List<Term> &terms, double scalar );
+    void addEqConstraint( const List<Term> &terms, double scalar );
+
+    /*
+      A cost function to minimize, or an objective function to
+      maximize. Setting the objective keeps the current basis.
+    */
+    void setCost( const List<Term> &terms, double constant = 0 );
+    void setObjective( const List<Term> &terms, double constant = 0 );
+
+    /*
+      If the optimal value is worse than the cutoff value (smaller
+      when maximizing, greater when minimizing), the solve reports
+      that the cutoff occurred.
+    */
+    void setCutoff( double cutoff );
+    void setTimeLimit( double seconds );
+
+    /*
+      Solving and extracting the result
+    */
+    void solve();
+    bool optimal();
+    bool cutoffOccurred();
+    bool infeasible();
+    bool timeout();
+    bool haveFeasibleSolution();
+    void extractSolution( Map<String, double> &values, double &costOrObjective );
+
+    /*
+      A valid bound on the optimal value: the optimal value itself if
+      the solve completed, or the trivial bound otherwise.
+    */
+    double getObjectiveBound();
+
+    double getAssignment( const String &name ) const;
+    unsigned getNumberOfSimplexIterations() const;
+    Status getStatus() const;
+
+    /*
+      Reset the status of the last solve. The basis is kept, so the
+      next solve is warm-started.
+    */
+    void reset();
+
+    /*
+      Clear the model. The last basis is remembered, and is used for
+      the first solve of the new model if its shape matches.
+    */
+    void resetModel();
+
+    /*
+      BasisColumnOracle methods
+    */
+    void getColumnOfBasis( unsigned column, double *result ) const;
+    void getColumnOfBasis( unsigned column, SparseUnsortedList *result ) const;
+    void getSparseBasis( SparseColumnsOfBasis &basis ) const;
+
+private:
+    enum VariableStatus {
+        BASIC = 0,
+        AT_LOWER = 1,
+        AT_UPPER = 2,
+        FREE = 3,
+    };
+
+    struct Row
+    {
+        List<SparseUnsortedList::Entry> _entries;
+        double _scalar;
+    };
+
+    /*
+      The model. Every structural variable and every constraint is
+      given a column; the column of a constraint is its slack, s = b - ax,
+      whose bounds encode the type of the constraint.
+    */
+    Map<String, unsigned> _nameToColumn;
+    Vector<String> _columnToName;
+    Vector<Row> _rows;
+    Vector<unsigned> _rowToSlack;
+    Map<unsigned, unsigned> _slackToRow;
+    Vector<double> _lowerBounds;
+    Vector<double> _upperBounds;
+    Vector<double> _costs;
+    double _costConstant;
+    bool _maximize;
+    double _cutoff;
+    bool _cutoffInUse;
+    double _timeoutInSeconds;
+
+    /*
+      The sparse columns of the constraint matrix [A | I], built
+      lazily when the model changes.
+    */
+    Vector<SparseUnsortedList *> _columns;
+    bool _columnsValid;
+
+    /*
+      The basis and the current assignment
+    */
+    IBasisFactorization *_basisFactorization;
+    unsigned _factorizedM;
+    bool _factorizationValid;
+    Vector<unsigned> _basicIndexToColumn;
+    Vector<VariableStatus> _variableStatus;
+    Vector<double> _values;
+    bool _basisValid;
+
+    /*
+      The basis of the last solve, for warm-starting a re-created
+      model, and a signature of the structure of the model it belongs
+      to. The basis is only re-used if the signatures match.
+    */
+    List<String> _savedBasicVariables;
+    List<unsigned> _savedBasicRows;
+    Set<String> _savedAtUpper;
+    std::size_t _savedStructure;
+
+    /*
+      Work memory
+    */
+    double *_basicCosts;
+    double *_multipliers;
+    double *_changeColumn;
+    double *_denseColumn;
+    double *_rhs;
+    unsigned _workSize;
+
+    Status _status;
+    unsigned _iterations;
+
+    void addConstraint( const List<Term> &terms, double scalar, double slackLb, double slackUb );
+    void setObjectiveTerms( const List<Term> &terms, double constant, bool maximize );
+    unsigned getColumn( const String &name ) const;
+    unsigned getNumberOfRows() const;
+    unsigned getNumberOfColumns() const;
+
+    void buildColumns();
+    void freeColumns();
+    void allocateWorkMemory();
+    void freeWorkMemory();
+
+    /*
+      Basis management: construct the slack basis, restore the saved
+      basis, or extend the current basis to newly added variables and
+      constraints. Factorizing returns false if the basis is singular.
+    */
+    void initializeSlackBasis();
+    bool restoreSavedBasis();
+    void extendBasis();
+    bool factorizeBasis();
+    void prepareBasis();
+
+    /*
+      Move non-basic variables to their (possibly changed) bounds, and
+      compute the basic assignment from scratch.
+    */
+    void placeNonBasicVariables();
+    void computeBasicAssignment();
+
+    /*
+      Compute the costs of the basic variables: the phase one costs if
+      some basic variable is out of bounds (in which case true is
+      returned), or the actual costs otherwise.
+    */
+    double computeInfeasibility( unsigned column ) const;
+    bool computeBasicCosts();
+    bool pickEnteringVariable( bool phaseOne,
+                               bool useBlandsRule,
+                               unsigned &entering,
+                               double &reducedCost );
+    void
+    performIteration( unsigned entering, double reducedCost, bool &unbounded, bool &degenerate );
+    double computeObjectiveValue() const;
+    void saveBasis();
+    std::size_t computeStructureSignature() const;
+};
+
+#endif // __NativeLPSolver_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -402,6 +402,17 @@ public:
     /*             Context-dependent Search State Interface               */
     /**********************************************************************/
 
+    /*
+       Returns true if all of the state that the constraint changes during the
+       search is kept in context-dependent objects and in the bound manager. Such
+       a constraint backtracks together with the context, and need not be stored
+       in the engine state when splitting.
+     */
+    virtual bool searchStateIsContextDependent() const
+    {
+        return false;
+    }
+
     /*
        Mark that an exploredCase is infeasible, reducing the remaining search space.
      */
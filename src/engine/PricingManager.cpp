@@ -0,0 +1,190 @@
+/*********************                                                        */
+/*! \file PricingManager.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "PricingManager.h"
+
+#include "EntrySelectionStrategy.h"
+#include "GlobalConfiguration.h"
+#include "ITableau.h"
+#include "Statistics.h"
+
+#include <algorithm>
+#include <functional>
+
+PricingManager::PricingManager()
+    : _numNonBasics( 0 )
+    , _numSections( 1 )
+    , _sectionSize( 0 )
+    , _nextSection( 0 )
+    , _bestScoreAtRefill( 0 )
+    , _numReuses( 0 )
+    , _statistics( NULL )
+{
+}
+
+void PricingManager::initialize( const ITableau &tableau )
+{
+    _numNonBasics = tableau.getN() - tableau.getM();
+
+    _numSections = GlobalConfiguration::PARTIAL_PRICING_NUMBER_OF_SECTIONS;
+    if ( _numSections == 0 )
+        _numSections = 1;
+    if ( _numSections > _numNonBasics )
+        _numSections = _numNonBasics > 0 ? _numNonBasics : 1;
+    _sectionSize = ( _numNonBasics + _numSections - 1 ) / _numSections;
+    _nextSection = 0;
+
+    invalidate();
+}
+
+void PricingManager::invalidate()
+{
+    _pool.clear();
+    _bestScoreAtRefill = 0;
+    _numReuses = 0;
+}
+
+void PricingManager::getEntryCandidates( const ITableau &tableau,
+                                         const EntrySelectionStrategy &strategy,
+                                         List<unsigned> &candidates )
+{
+    candidates.clear();
+
+    if ( _numNonBasics != tableau.getN() - tableau.getM() )
+        initialize( tableau );
+
+    const double *costFunction = tableau.getCostFunction();
+
+    if ( !strategy.supportsPartialPricing() )
+    {
+        invalidate();
+        for ( unsigned i = 0; i < _numNonBasics; ++i )
+        {
+            if ( tableau.eligibleForEntry( i, costFunction ) )
+                candidates.append( i );
+        }
+        return;
+    }
+
+    if ( refreshPool( tableau, strategy ) )
+    {
+        ++_numReuses;
+        if ( _statistics )
+            _statistics->incLongAttribute( Statistics::NUM_PRICING_POOL_REUSES );
+    }
+    else
+    {
+        refillPool( tableau, strategy );
+        if ( _statistics )
+            _statistics->incLongAttribute( Statistics::NUM_PRICING_POOL_REFILLS );
+    }
+
+    for ( const auto &candidate : _pool )
+        candidates.append( candidate._index );
+}
+
+bool PricingManager::refreshPool( const ITableau &tableau, const EntrySelectionStrategy &strategy )
+{
+    if ( _pool.empty() || _numReuses >= GlobalConfiguration::MULTIPLE_PRICING_MAX_REUSES )
+        return false;
+
+    const double *costFunction = tableau.getCostFunction();
+
+    double bestScore = 0;
+    unsigned kept = 0;
+    for ( unsigned i = 0; i < _pool.size(); ++i )
+    {
+        unsigned index = _pool[i]._index;
+        if ( !tableau.eligibleForEntry( index, costFunction ) )
+            continue;
+
+        double score = strategy.getPricingScore( tableau, costFunction, index );
+        if ( score > bestScore )
+            bestScore = score;
+        _pool[kept++] = Candidate( index, score );
+    }
+
+    _pool.resize( kept );
+
+    return kept > 0 &&
+           bestScore >= GlobalConfiguration::MULTIPLE_PRICING_SCORE_DECAY * _bestScoreAtRefill;
+}
+
+void PricingManager::refillPool( const ITableau &tableau, const EntrySelectionStrategy &strategy )
+{
+    const double *costFunction = tableau.getCostFunction();
+    unsigned poolSize = GlobalConfiguration::MULTIPLE_PRICING_NUMBER_OF_CANDIDATES;
+
+    _pool.clear();
+    for ( unsigned scanned = 0; scanned < _numSections; ++scanned )
+    {
+        unsigned begin = _nextSection * _sectionSize;
+        unsigned end = begin + _sectionSize;
+        if ( end > _numNonBasics )
+            end = _numNonBasics;
+
+        for ( unsigned i = begin; i < end; ++i )
+        {
+            if ( !tableau.eligibleForEntry( i, costFunction ) )
+                continue;
+
+            _pool.push_back( Candidate( i, strategy.getPricingScore( tableau, costFunction, i ) ) );
+        }
+
+        _nextSection = ( _nextSection + 1 ) % _numSections;
+
+        if ( poolSize > 0 && _pool.size() >= poolSize )
+            break;
+    }
+
+    // Keep only the best-scoring candidates
+    if ( poolSize > 0 && _pool.size() > poolSize )
+    {
+        std::partial_sort(
+            _pool.begin(), _pool.begin() + poolSize, _pool.end(), std::greater<Candidate>() );
+        _pool.resize( poolSize );
+    }
+
+    _bestScoreAtRefill = 0;
+    for ( const auto &candidate : _pool )
+    {
+        if ( candidate._score > _bestScoreAtRefill )
+            _bestScoreAtRefill = candidate._score;
+    }
+    _numReuses = 0;
+}
+
+void PricingManager::setStatistics( Statistics *statistics )
+{
+    _statistics = statistics;
+}
+
+unsigned PricingManager::getPoolSize() const
+{
+    return _pool.size();
+}
+
+unsigned PricingManager::getNextSection() const
+{
+    return _nextSection;
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
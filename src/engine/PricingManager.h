@@ -0,0 +1,141 @@
+/*********************                                                        */
+/*! \file PricingManager.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** The pricing manager provides the candidates for the entering
+ ** variable of a simplex step. Instead of scanning all the non-basic
+ ** variables in every step, it keeps a small pool of the best-scoring
+ ** candidates across steps (multiple pricing), and when the pool needs
+ ** to be refilled it scans the non-basic variables section by section,
+ ** stopping once enough candidates have been found (partial pricing).
+
+ **/
+
+#ifndef __PricingManager_h__
+#define __PricingManager_h__
+
+#include "List.h"
+
+#include <vector>
+
+class EntrySelectionStrategy;
+class ITableau;
+class Statistics;
+
+class PricingManager
+{
+public:
+    PricingManager();
+
+    /*
+      Resize the pricing manager according to the dimensions of the
+      tableau, and forget the pool of candidates.
+    */
+    void initialize( const ITableau &tableau );
+
+    /*
+      Forget the pool of candidates, e.g. after the basis has been
+      restored. The next call to getEntryCandidates() searches for
+      candidates again.
+    */
+    void invalidate();
+
+    /*
+      Store in candidates the non-basic indices of entering candidates,
+      scored according to the given strategy. If the strategy does not
+      support partial pricing, all eligible candidates are returned. An
+      empty list is only returned after all the non-basic variables
+      have been examined, i.e. if there are no eligible candidates.
+    */
+    void getEntryCandidates( const ITableau &tableau,
+                             const EntrySelectionStrategy &strategy,
+                             List<unsigned> &candidates );
+
+    /*
+      Have the pricing manager start reporting statistics.
+    */
+    void setStatistics( Statistics *statistics );
+
+    /*
+      Functions made public strictly for testing, not part of the interface
+    */
+    unsigned getPoolSize() const;
+    unsigned getNextSection() const;
+
+private:
+    struct Candidate
+    {
+        Candidate()
+            : _index( 0 )
+            , _score( 0 )
+        {
+        }
+
+        Candidate( unsigned index, double score )
+            : _index( index )
+            , _score( score )
+        {
+        }
+
+        bool operator>( const Candidate &other ) const
+        {
+            return _score > other._score;
+        }
+
+        unsigned _index;
+        double _score;
+    };
+
+    /*
+      The number of non-basic variables, and how they are divided into
+      sections. The next refill starts from section _nextSection.
+    */
+    unsigned _numNonBasics;
+    unsigned _numSections;
+    unsigned _sectionSize;
+    unsigned _nextSection;
+
+    /*
+      The pool of candidates, the best score in the pool when it was
+      last refilled, and the number of times it has since been reused.
+    */
+    std::vector<Candidate> _pool;
+    double _bestScoreAtRefill;
+    unsigned _numReuses;
+
+    /*
+      Statistics collection
+    */
+    Statistics *_statistics;
+
+    /*
+      Drop the candidates that are no longer eligible from the pool,
+      re-score the others, and return true iff the pool can still be
+      used.
+    */
+    bool refreshPool( const ITableau &tableau, const EntrySelectionStrategy &strategy );
+
+    /*
+      Scan the sections, starting from _nextSection, until enough
+      candidates have been found or all sections have been scanned,
+      and keep the best-scoring ones in the pool.
+    */
+    void refillPool( const ITableau &tableau, const EntrySelectionStrategy &strategy );
+};
+
+#endif // __PricingManager_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
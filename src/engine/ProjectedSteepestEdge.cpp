@@ -114,23 +114,6 @@ bool ProjectedSteepestEdgeRule::select( ITableau &tableau,
                                         const List<unsigned> &candidates,
                                         const Set<unsigned> &excluded )
 {
-    List<unsigned> remainingCandidates = candidates;
-
-    List<unsigned>::iterator it = remainingCandidates.begin();
-    while ( it != remainingCandidates.end() )
-    {
-        if ( excluded.exists( *it ) )
-            it = remainingCandidates.erase( it );
-        else
-            ++it;
-    }
-
-    if ( remainingCandidates.empty() )
-    {
-        PSE_LOG( "No candidates, select returning false" );
-        return false;
-    }
-
     // Obtain the cost function
     const double *costFunction = tableau.getCostFunction();
 
@@ -145,29 +128,27 @@ bool ProjectedSteepestEdgeRule::select( ITableau &tableau,
       is maximal.
     */
 
-    it = remainingCandidates.begin();
-    unsigned bestCandidate = *it;
-    double gammaValue = _gamma[*it];
-    double bestValue =
-        ( gammaValue < DBL_EPSILON ) ? 0 : ( costFunction[*it] * costFunction[*it] ) / gammaValue;
-
-    ++it;
-
-    while ( it != remainingCandidates.end() )
+    bool found = false;
+    unsigned bestCandidate = 0;
+    double bestValue = 0;
+    for ( const auto &candidate : candidates )
     {
-        unsigned contender = *it;
-        gammaValue = _gamma[*it];
-        double contenderValue = ( gammaValue < DBL_EPSILON )
-                                  ? 0
-                                  : ( costFunction[*it] * costFunction[*it] ) / gammaValue;
+        if ( excluded.exists( candidate ) )
+            continue;
 
-        if ( contenderValue > bestValue )
+        double contenderValue = getPricingScore( tableau, costFunction, candidate );
+        if ( !found || contenderValue > bestValue )
         {
-            bestCandidate = contender;
+            found = true;
+            bestCandidate = candidate;
             bestValue = contenderValue;
         }
+    }
 
-        ++it;
+    if ( !found )
+    {
+        PSE_LOG( "No candidates, select returning false" );
+        return false;
     }
 
     tableau.setEnteringVariableIndex( bestCandidate );
@@ -178,6 +159,17 @@ bool ProjectedSteepestEdgeRule::select( ITableau &tableau,
     return true;
 }
 
+double ProjectedSteepestEdgeRule::getPricingScore( const ITableau & /* tableau */,
+                                                   const double *costFunction,
+                                                   unsigned nonBasic ) const
+{
+    double gammaValue = _gamma[nonBasic];
+    if ( gammaValue < DBL_EPSILON )
+        return 0;
+
+    return ( costFunction[nonBasic] * costFunction[nonBasic] ) / gammaValue;
+}
+
 void ProjectedSteepestEdgeRule::prePivotHook( const ITableau &tableau, bool fakePivot )
 {
     PSE_LOG( "PrePivotHook called" );
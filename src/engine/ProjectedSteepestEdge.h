@@ -39,6 +39,12 @@ public:
     bool
     select( ITableau &tableau, const List<unsigned> &candidates, const Set<unsigned> &excluded );
 
+    /*
+      The score of a candidate is costFunction[i]^2 / gamma[i].
+    */
+    double
+    getPricingScore( const ITableau &tableau, const double *costFunction, unsigned nonBasic ) const;
+
     /*
       We use this hook to update gamma according to the entering
       and leaving variables.
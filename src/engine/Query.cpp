@@ -17,6 +17,7 @@
 
 #include "AutoFile.h"
 #include "BilinearConstraint.h"
+#include "BinaryQueryFormat.h"
 #include "Debug.h"
 #include "FloatUtils.h"
 #include "LeakyReluConstraint.h"
@@ -28,6 +29,8 @@
 #include "SoftmaxConstraint.h"
 #include "SymbolicBoundTighteningType.h"
 
+#include <string>
+
 #define INPUT_QUERY_LOG( x, ... )                                                                  \
     LOG( GlobalConfiguration::INPUT_QUERY_LOGGING, "Input Query: %s\n", x )
 
@@ -581,6 +584,104 @@ void Query::saveQuery( const String &fileName )
     queryFile->close();
 }
 
+template <typename T> static void appendToBuffer( std::string &buffer, const T &value )
+{
+    buffer.append( (const char *)&value, sizeof( T ) );
+}
+
+static void flushBuffer( IFile &file, std::string &buffer, bool force )
+{
+    if ( force || buffer.size() >= GlobalConfiguration::BINARY_QUERY_WRITE_BUFFER_SIZE )
+    {
+        file.write( String( buffer.data(), buffer.size() ) );
+        buffer.clear();
+    }
+}
+
+void Query::saveBinaryQuery( const String &fileName )
+{
+    AutoFile queryFile( fileName );
+    queryFile->open( IFile::MODE_WRITE_TRUNCATE );
+
+    BinaryQueryFormat::Header header;
+    memcpy( header._magic, BinaryQueryFormat::MAGIC, sizeof( header._magic ) );
+    header._version = BinaryQueryFormat::VERSION;
+    header._byteOrderMark = BinaryQueryFormat::BYTE_ORDER_MARK;
+    header._numberOfVariables = _numberOfVariables;
+    header._numberOfInputVariables = getNumInputVariables();
+    header._numberOfOutputVariables = getNumOutputVariables();
+    header._numberOfLowerBounds = _lowerBounds.size();
+    header._numberOfUpperBounds = _upperBounds.size();
+    header._numberOfEquations = _equations.size();
+    header._numberOfConstraints = _plConstraints.size() + _nlConstraints.size();
+
+    std::string buffer;
+    appendToBuffer( buffer, header );
+
+    // Input and output variables
+    uint32_t i = 0;
+    for ( const auto &inVar : getInputVariables() )
+    {
+        appendToBuffer( buffer, i++ );
+        appendToBuffer( buffer, (uint32_t)inVar );
+    }
+
+    i = 0;
+    for ( const auto &outVar : getOutputVariables() )
+    {
+        appendToBuffer( buffer, i++ );
+        appendToBuffer( buffer, (uint32_t)outVar );
+    }
+
+    // Bounds
+    for ( const auto &lb : _lowerBounds )
+    {
+        appendToBuffer( buffer, (uint32_t)lb.first );
+        appendToBuffer( buffer, lb.second );
+    }
+
+    for ( const auto &ub : _upperBounds )
+    {
+        appendToBuffer( buffer, (uint32_t)ub.first );
+        appendToBuffer( buffer, ub.second );
+    }
+    flushBuffer( queryFile, buffer, false );
+
+    // Equations
+    for ( const auto &e : _equations )
+    {
+        appendToBuffer( buffer, (uint32_t)e._type );
+        appendToBuffer( buffer, e._scalar );
+        appendToBuffer( buffer, (uint32_t)e._addends.size() );
+        for ( const auto &a : e._addends )
+        {
+            appendToBuffer( buffer, (uint32_t)a._variable );
+            appendToBuffer( buffer, a._coefficient );
+        }
+        flushBuffer( queryFile, buffer, false );
+    }
+
+    // Piecewise-linear and nonlinear constraints
+    for ( const auto &constraint : _plConstraints )
+    {
+        String serialized = constraint->serializeToString();
+        appendToBuffer( buffer, (uint32_t)serialized.length() );
+        buffer.append( serialized.ascii(), serialized.length() );
+        flushBuffer( queryFile, buffer, false );
+    }
+
+    for ( const auto &constraint : _nlConstraints )
+    {
+        String serialized = constraint->serializeToString();
+        appendToBuffer( buffer, (uint32_t)serialized.length() );
+        buffer.append( serialized.ascii(), serialized.length() );
+        flushBuffer( queryFile, buffer, false );
+    }
+
+    flushBuffer( queryFile, buffer, true );
+    queryFile->close();
+}
+
 void Query::saveQueryAsSmtLib( const String &fileName ) const
 {
     if ( !_nlConstraints.empty() )
@@ -127,6 +127,12 @@ public:
     void saveQuery( const String &fileName );
     void saveQueryAsSmtLib( const String &fileName ) const;
 
+    /*
+      Serializes the query in the binary query format, which QueryLoader
+      loads much faster than the text format.
+    */
+    void saveBinaryQuery( const String &fileName );
+
     /*
       Print input and output bounds
     */
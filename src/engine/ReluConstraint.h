@@ -80,6 +80,11 @@ public:
     */
     void restoreState( const PiecewiseLinearConstraint *state ) override;
 
+    /*
+      True once the CDOs are initialized and a bound manager is registered.
+    */
+    bool searchStateIsContextDependent() const override;
+
     /*
       Register/unregister the constraint with a talbeau.
      */
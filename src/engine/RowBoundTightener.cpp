@@ -21,6 +21,8 @@
 #include "SparseUnsortedList.h"
 #include "Statistics.h"
 
+#include <cmath>
+
 RowBoundTightener::RowBoundTightener( const ITableau &tableau )
     : _tableau( tableau )
     , _boundManager( tableau.getBoundManager() )
@@ -28,9 +30,17 @@ RowBoundTightener::RowBoundTightener( const ITableau &tableau )
     , _upperBounds( nullptr )
     , _rows( NULL )
     , _z( NULL )
-    , _ciTimesLb( NULL )
-    , _ciTimesUb( NULL )
+    , _ANColumn( NULL )
+    , _unitVector( NULL )
+    , _combinedRow( NULL )
+    , _invertedBasisRowComputed( NULL )
+    , _termLowerBound( NULL )
+    , _termUpperBound( NULL )
     , _ciSign( NULL )
+    , _invertedBasisRowDirty( NULL )
+    , _constraintRowQueued( NULL )
+    , _queuedLowerBounds( NULL )
+    , _queuedUpperBounds( NULL )
     , _statistics( NULL )
 {
 }
@@ -48,6 +58,13 @@ void RowBoundTightener::setDimensions()
         _rows = new TableauRow *[_m];
         for ( unsigned i = 0; i < _m; ++i )
             _rows[i] = new TableauRow( _n - _m );
+
+        _z = new double[_m];
+        _unitVector = new double[_m];
+        std::fill_n( _unitVector, _m, 0 );
+        _combinedRow = new double[_n];
+        _invertedBasisRowComputed = new char[_m];
+        std::fill_n( _invertedBasisRowComputed, _m, false );
     }
     else if ( GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_TYPE ==
               GlobalConfiguration::USE_IMPLICIT_INVERTED_BASIS_MATRIX )
@@ -57,11 +74,35 @@ void RowBoundTightener::setDimensions()
             _rows[i] = new TableauRow( _n - _m );
 
         _z = new double[_m];
+        _ANColumn = new double[_m];
     }
 
-    _ciTimesLb = new double[_n];
-    _ciTimesUb = new double[_n];
+    if ( _rows )
+        _invertedBasisRowDirty = new char[_m];
+
+    _termLowerBound = new double[_n];
+    _termUpperBound = new double[_n];
     _ciSign = new char[_n];
+
+    _constraintRowQueued = new char[_m];
+    _queuedLowerBounds = new double[_n];
+    _queuedUpperBounds = new double[_n];
+
+    // No row has been examined yet, so all of them will be queued
+    resetExaminedBounds();
+}
+
+void RowBoundTightener::resetExaminedBounds()
+{
+    _constraintRowQueue.clear();
+    std::fill_n( _constraintRowQueued, _m, false );
+    std::fill_n( _queuedLowerBounds, _n, NAN );
+    std::fill_n( _queuedUpperBounds, _n, NAN );
+}
+
+void RowBoundTightener::notifyDimensionChange( unsigned /* m */, unsigned /* n */ )
+{
+    setDimensions();
 }
 
 RowBoundTightener::~RowBoundTightener()
@@ -85,16 +126,40 @@ void RowBoundTightener::freeMemoryIfNeeded()
         _z = NULL;
     }
 
-    if ( _ciTimesLb )
+    if ( _ANColumn )
     {
-        delete[] _ciTimesLb;
-        _ciTimesLb = NULL;
+        delete[] _ANColumn;
+        _ANColumn = NULL;
     }
 
-    if ( _ciTimesUb )
+    if ( _unitVector )
     {
-        delete[] _ciTimesUb;
-        _ciTimesUb = NULL;
+        delete[] _unitVector;
+        _unitVector = NULL;
+    }
+
+    if ( _combinedRow )
+    {
+        delete[] _combinedRow;
+        _combinedRow = NULL;
+    }
+
+    if ( _invertedBasisRowComputed )
+    {
+        delete[] _invertedBasisRowComputed;
+        _invertedBasisRowComputed = NULL;
+    }
+
+    if ( _termLowerBound )
+    {
+        delete[] _termLowerBound;
+        _termLowerBound = NULL;
+    }
+
+    if ( _termUpperBound )
+    {
+        delete[] _termUpperBound;
+        _termUpperBound = NULL;
     }
 
     if ( _ciSign )
@@ -102,6 +167,30 @@ void RowBoundTightener::freeMemoryIfNeeded()
         delete[] _ciSign;
         _ciSign = NULL;
     }
+
+    if ( _invertedBasisRowDirty )
+    {
+        delete[] _invertedBasisRowDirty;
+        _invertedBasisRowDirty = NULL;
+    }
+
+    if ( _constraintRowQueued )
+    {
+        delete[] _constraintRowQueued;
+        _constraintRowQueued = NULL;
+    }
+
+    if ( _queuedLowerBounds )
+    {
+        delete[] _queuedLowerBounds;
+        _queuedLowerBounds = NULL;
+    }
+
+    if ( _queuedUpperBounds )
+    {
+        delete[] _queuedUpperBounds;
+        _queuedUpperBounds = NULL;
+    }
 }
 
 void RowBoundTightener::examineImplicitInvertedBasisMatrix( bool untilSaturation )
@@ -125,8 +214,8 @@ void RowBoundTightener::examineImplicitInvertedBasisMatrix( bool untilSaturation
     for ( unsigned i = 0; i < _n - _m; ++i )
     {
         unsigned nonBasic = _tableau.nonBasicIndexToVariable( i );
-        const double *ANColumn = _tableau.getAColumn( nonBasic );
-        _tableau.forwardTransformation( ANColumn, _z );
+        _tableau.getSparseAColumn( nonBasic )->toDense( _ANColumn );
+        _tableau.forwardTransformation( _ANColumn, _z );
 
         for ( unsigned j = 0; j < _m; ++j )
         {
@@ -138,20 +227,7 @@ void RowBoundTightener::examineImplicitInvertedBasisMatrix( bool untilSaturation
     // We now have all the rows, can use them for tightening.
     // The tightening procedure may throw an exception, in which case we need
     // to release the rows.
-    unsigned newBoundsLearned;
-    unsigned maxNumberOfIterations =
-        untilSaturation ? GlobalConfiguration::ROW_BOUND_TIGHTENER_SATURATION_ITERATIONS : 1;
-    do
-    {
-        newBoundsLearned = onePassOverInvertedBasisRows();
-
-        if ( _statistics && ( newBoundsLearned > 0 ) )
-            _statistics->incLongAttribute( Statistics::NUM_TIGHTENINGS_FROM_EXPLICIT_BASIS,
-                                           newBoundsLearned );
-
-        --maxNumberOfIterations;
-    }
-    while ( ( maxNumberOfIterations != 0 ) && ( newBoundsLearned > 0 ) );
+    examineInvertedBasisRows( untilSaturation );
 }
 
 void RowBoundTightener::examineInvertedBasisMatrix( bool untilSaturation )
@@ -161,79 +237,157 @@ void RowBoundTightener::examineInvertedBasisMatrix( bool untilSaturation )
 
          xB = inv(B)*b - inv(B)*An
 
-      We compute one row at a time.
+      We compute one row at a time, without forming inv(B). A row is an
+      equation that expresses a basic variable in terms of the non-basic
+      ones, so a row computed for a previous basis is still the row of
+      its basic variable as long as the variables that appear in it are
+      still non-basic. In particular, a pivot only changes the rows in
+      which the entering variable appears.
     */
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        if ( invertedBasisRowIsCurrent( i ) )
+            continue;
 
-    const double *b = _tableau.getRightHandSide();
-    const double *invB = _tableau.getInverseBasisMatrix();
+        computeInvertedBasisRow( i );
 
-    try
-    {
-        for ( unsigned i = 0; i < _m; ++i )
-        {
-            TableauRow *row = _rows[i];
-            // First, compute the scalar, using inv(B)*b
-            row->_scalar = 0;
-            for ( unsigned j = 0; j < _m; ++j )
-                row->_scalar += ( invB[i * _m + j] * b[j] );
+        if ( _statistics )
+            _statistics->incLongAttribute( Statistics::NUM_INVERTED_BASIS_ROWS_COMPUTED );
+    }
 
-            // Now update the row's coefficients for basic variable i
-            for ( unsigned j = 0; j < _n - _m; ++j )
-            {
-                row->_row[j]._var = _tableau.nonBasicIndexToVariable( j );
+    // We now have all the rows, can use them for tightening.
+    examineInvertedBasisRows( untilSaturation );
+}
 
-                // Dot product of the i'th row of inv(B) with the appropriate
-                // column of An
+bool RowBoundTightener::invertedBasisRowIsCurrent( unsigned index )
+{
+    TableauRow &row = *_rows[index];
 
-                const SparseUnsortedList *column = _tableau.getSparseAColumn( row->_row[j]._var );
-                row->_row[j]._coefficient = 0;
+    if ( !_invertedBasisRowComputed[index] || row._lhs != _tableau.basicIndexToVariable( index ) )
+        return false;
 
-                for ( const auto &entry : *column )
-                    row->_row[j]._coefficient -= invB[i * _m + entry._index] * entry._value;
-            }
+    for ( unsigned i = 0; i < _n - _m; ++i )
+    {
+        unsigned nonBasic = _tableau.nonBasicIndexToVariable( i );
+        if ( row._row[i]._var == nonBasic )
+            continue;
 
-            // Store the lhs variable
-            row->_lhs = _tableau.basicIndexToVariable( i );
-        }
+        if ( row._row[i]._coefficient != 0 )
+            return false;
 
-        // We now have all the rows, can use them for tightening.
-        // The tightening procedure may throw an exception, in which case we need
-        // to release the rows.
+        row._row[i]._var = nonBasic;
+    }
 
-        unsigned newBoundsLearned;
-        unsigned maxNumberOfIterations =
-            untilSaturation ? GlobalConfiguration::ROW_BOUND_TIGHTENER_SATURATION_ITERATIONS : 1;
-        do
-        {
-            newBoundsLearned = onePassOverInvertedBasisRows();
+    return true;
+}
 
-            if ( _statistics && ( newBoundsLearned > 0 ) )
-                _statistics->incLongAttribute( Statistics::NUM_TIGHTENINGS_FROM_EXPLICIT_BASIS,
-                                               newBoundsLearned );
+void RowBoundTightener::computeInvertedBasisRow( unsigned index )
+{
+    // Compute the index'th row of inv(B), by solving e * inv(B) with a BTRAN
+    _unitVector[index] = 1;
+    _tableau.untrackedBackwardTransformation( _unitVector, _z );
+    _unitVector[index] = 0;
 
-            --maxNumberOfIterations;
-        }
-        while ( ( maxNumberOfIterations != 0 ) && ( newBoundsLearned > 0 ) );
+    // Combine the rows of A and the entries of b accordingly
+    const double *b = _tableau.getRightHandSide();
+    TableauRow *row = _rows[index];
+
+    row->_scalar = 0;
+    std::fill_n( _combinedRow, _n, 0 );
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        double multiplier = _z[i];
+        if ( multiplier == 0 )
+            continue;
+
+        row->_scalar += multiplier * b[i];
+        for ( const auto &entry : *_tableau.getSparseARow( i ) )
+            _combinedRow[entry._index] -= multiplier * entry._value;
     }
-    catch ( ... )
+
+    // Keep the entries of the non-basic variables
+    for ( unsigned i = 0; i < _n - _m; ++i )
     {
-        delete[] invB;
-        throw;
+        unsigned nonBasic = _tableau.nonBasicIndexToVariable( i );
+        row->_row[i]._var = nonBasic;
+        row->_row[i]._coefficient = _combinedRow[nonBasic];
     }
 
-    delete[] invB;
+    // Store the lhs variable
+    row->_lhs = _tableau.basicIndexToVariable( index );
+    _invertedBasisRowComputed[index] = true;
+}
+
+void RowBoundTightener::examineInvertedBasisRows( bool untilSaturation )
+{
+    /*
+      A row can only yield new bounds if the bounds of one of its
+      variables changed since it was last examined, so every pass after
+      the first only examines the rows of the variables tightened by the
+      previous pass.
+    */
+    std::fill_n( _invertedBasisRowDirty, _m, true );
+
+    unsigned newBoundsLearned;
+    unsigned maxNumberOfIterations =
+        untilSaturation ? GlobalConfiguration::ROW_BOUND_TIGHTENER_SATURATION_ITERATIONS : 1;
+    do
+    {
+        newBoundsLearned = onePassOverInvertedBasisRows();
+
+        if ( _statistics && ( newBoundsLearned > 0 ) )
+            _statistics->incLongAttribute( Statistics::NUM_TIGHTENINGS_FROM_EXPLICIT_BASIS,
+                                           newBoundsLearned );
+
+        --maxNumberOfIterations;
+    }
+    while ( ( maxNumberOfIterations != 0 ) && ( newBoundsLearned > 0 ) );
 }
 
 unsigned RowBoundTightener::onePassOverInvertedBasisRows()
 {
     unsigned newBounds = 0;
 
+    _tightenedVariables.clear();
     for ( unsigned i = 0; i < _m; ++i )
+    {
+        if ( !_invertedBasisRowDirty[i] )
+            continue;
+
+        _invertedBasisRowDirty[i] = false;
         newBounds += tightenOnSingleInvertedBasisRow( *( _rows[i] ) );
 
+        if ( _statistics )
+            _statistics->incLongAttribute( Statistics::NUM_INVERTED_BASIS_ROWS_EXAMINED );
+    }
+
+    if ( newBounds > 0 )
+        markRowsOfTightenedVariables();
+
     return newBounds;
 }
 
+void RowBoundTightener::markRowsOfTightenedVariables()
+{
+    for ( const auto &variable : _tightenedVariables )
+    {
+        if ( _tableau.isBasic( variable ) )
+        {
+            _invertedBasisRowDirty[_tableau.variableToIndex( variable )] = true;
+            continue;
+        }
+
+        unsigned nonBasicIndex = _tableau.variableToIndex( variable );
+        for ( unsigned i = 0; i < _m; ++i )
+        {
+            if ( !FloatUtils::isZero( _rows[i]->_row[nonBasicIndex]._coefficient ) )
+                _invertedBasisRowDirty[i] = true;
+        }
+    }
+
+    _tightenedVariables.clear();
+}
+
 unsigned RowBoundTightener::tightenOnSingleInvertedBasisRow( const TableauRow &row )
 {
     /*
@@ -248,13 +402,7 @@ unsigned RowBoundTightener::tightenOnSingleInvertedBasisRow( const TableauRow &r
 
     unsigned result = 0;
 
-    // Compute ci * lb, ci * ub, flag signs for all entries
-    enum {
-        ZERO = 0,
-        POSITIVE = 1,
-        NEGATIVE = 2,
-    };
-
+    // Compute the bounds of ci * xi, flag signs for all entries
     for ( unsigned i = 0; i < n - m; ++i )
     {
         double ci = row[i];
@@ -262,48 +410,49 @@ unsigned RowBoundTightener::tightenOnSingleInvertedBasisRow( const TableauRow &r
         if ( FloatUtils::isZero( ci ) )
         {
             _ciSign[i] = ZERO;
-            _ciTimesLb[i] = 0;
-            _ciTimesUb[i] = 0;
+            _termLowerBound[i] = 0;
+            _termUpperBound[i] = 0;
             continue;
         }
 
-        _ciSign[i] = FloatUtils::isPositive( ci ) ? POSITIVE : NEGATIVE;
-
         unsigned xi = row._row[i]._var;
-        _ciTimesLb[i] = ci * getLowerBound( xi );
-        _ciTimesUb[i] = ci * getUpperBound( xi );
+        computeTermBounds( i, ci, getLowerBound( xi ), getUpperBound( xi ) );
     }
 
     // Start with a pass for y
     unsigned y = row._lhs;
     double upperBound = row._scalar;
     double lowerBound = row._scalar;
+    unsigned infiniteLowerTerms = 0;
+    unsigned infiniteUpperTerms = 0;
 
     unsigned xi;
     double ci;
 
     for ( unsigned i = 0; i < n - m; ++i )
     {
-        if ( _ciSign[i] == POSITIVE )
-        {
-            lowerBound += _ciTimesLb[i];
-            upperBound += _ciTimesUb[i];
-        }
-        else
-        {
-            lowerBound += _ciTimesUb[i];
-            upperBound += _ciTimesLb[i];
-        }
+        lowerBound += _termLowerBound[i];
+        upperBound += _termUpperBound[i];
+
+        if ( _ciSign[i] & INFINITE_LOWER_TERM )
+            ++infiniteLowerTerms;
+        if ( _ciSign[i] & INFINITE_UPPER_TERM )
+            ++infiniteUpperTerms;
     }
 
-    result += registerTighterLowerBound(
-        y,
-        lowerBound - GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_ROUNDING_CONSTANT,
-        row );
-    result += registerTighterUpperBound(
-        y,
-        upperBound + GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_ROUNDING_CONSTANT,
-        row );
+    lowerBound -= GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_ROUNDING_CONSTANT;
+    upperBound += GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_ROUNDING_CONSTANT;
+
+    if ( infiniteLowerTerms == 0 && registerTighterLowerBound( y, lowerBound, row ) )
+    {
+        ++result;
+        _tightenedVariables.push_back( y );
+    }
+    if ( infiniteUpperTerms == 0 && registerTighterUpperBound( y, upperBound, row ) )
+    {
+        ++result;
+        _tightenedVariables.push_back( y );
+    }
     if ( FloatUtils::gt( getLowerBound( y ), getUpperBound( y ) ) )
     {
         ASSERT(
@@ -326,22 +475,20 @@ unsigned RowBoundTightener::tightenOnSingleInvertedBasisRow( const TableauRow &r
     // Then, when we consider xi we adjust the computed lower and upper
     // boudns accordingly.
 
-    double auxLb = getLowerBound( y ) - row._scalar;
-    double auxUb = getUpperBound( y ) - row._scalar;
+    double yLowerBound = getLowerBound( y );
+    double yUpperBound = getUpperBound( y );
+    double auxLb = ( FloatUtils::isFinite( yLowerBound ) ? yLowerBound : 0 ) - row._scalar;
+    double auxUb = ( FloatUtils::isFinite( yUpperBound ) ? yUpperBound : 0 ) - row._scalar;
+    unsigned infiniteAuxLbTerms =
+        infiniteUpperTerms + ( FloatUtils::isFinite( yLowerBound ) ? 0 : 1 );
+    unsigned infiniteAuxUbTerms =
+        infiniteLowerTerms + ( FloatUtils::isFinite( yUpperBound ) ? 0 : 1 );
 
     // Now add ALL xi's
     for ( unsigned i = 0; i < n - m; ++i )
     {
-        if ( _ciSign[i] == NEGATIVE )
-        {
-            auxLb -= _ciTimesLb[i];
-            auxUb -= _ciTimesUb[i];
-        }
-        else
-        {
-            auxLb -= _ciTimesUb[i];
-            auxUb -= _ciTimesLb[i];
-        }
+        auxLb -= _termUpperBound[i];
+        auxUb -= _termLowerBound[i];
     }
 
     // Now consider each individual xi
@@ -353,43 +500,49 @@ unsigned RowBoundTightener::tightenOnSingleInvertedBasisRow( const TableauRow &r
                              GlobalConfiguration::MINIMAL_COEFFICIENT_FOR_TIGHTENING ) )
             continue;
 
-        lowerBound = auxLb;
-        upperBound = auxUb;
+        // Adjust the aux bounds to remove xi. A bound of the remaining
+        // expression is only finite if all its other terms are finite.
+        bool lowerBoundIsFinite =
+            infiniteAuxLbTerms == ( ( _ciSign[i] & INFINITE_UPPER_TERM ) ? 1u : 0u );
+        bool upperBoundIsFinite =
+            infiniteAuxUbTerms == ( ( _ciSign[i] & INFINITE_LOWER_TERM ) ? 1u : 0u );
+        if ( !lowerBoundIsFinite && !upperBoundIsFinite )
+            continue;
 
-        // Adjust the aux bounds to remove xi
-        if ( _ciSign[i] == NEGATIVE )
-        {
-            lowerBound += _ciTimesLb[i];
-            upperBound += _ciTimesUb[i];
-        }
-        else
-        {
-            lowerBound += _ciTimesUb[i];
-            upperBound += _ciTimesLb[i];
-        }
+        lowerBound = auxLb + _termUpperBound[i];
+        upperBound = auxUb + _termLowerBound[i];
 
         // Now divide everything by ci, switching signs if needed.
         ci = row[i];
         lowerBound = lowerBound / ci;
         upperBound = upperBound / ci;
 
-        if ( _ciSign[i] == NEGATIVE )
+        if ( _ciSign[i] & NEGATIVE )
         {
             double temp = upperBound;
             upperBound = lowerBound;
             lowerBound = temp;
+
+            bool tempIsFinite = upperBoundIsFinite;
+            upperBoundIsFinite = lowerBoundIsFinite;
+            lowerBoundIsFinite = tempIsFinite;
         }
 
         // If a tighter bound is found, store it
         xi = row._row[i]._var;
-        result += registerTighterLowerBound(
-            xi,
-            lowerBound - GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_ROUNDING_CONSTANT,
-            row );
-        result += registerTighterUpperBound(
-            xi,
-            upperBound + GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_ROUNDING_CONSTANT,
-            row );
+        lowerBound -= GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_ROUNDING_CONSTANT;
+        upperBound += GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_ROUNDING_CONSTANT;
+
+        if ( lowerBoundIsFinite && registerTighterLowerBound( xi, lowerBound, row ) )
+        {
+            ++result;
+            _tightenedVariables.push_back( xi );
+        }
+        if ( upperBoundIsFinite && registerTighterUpperBound( xi, upperBound, row ) )
+        {
+            ++result;
+            _tightenedVariables.push_back( xi );
+        }
         if ( FloatUtils::gt( getLowerBound( xi ), getUpperBound( xi ) ) )
         {
             ASSERT( FloatUtils::gt( _boundManager.getLowerBound( xi ),
@@ -401,39 +554,107 @@ unsigned RowBoundTightener::tightenOnSingleInvertedBasisRow( const TableauRow &r
     return result;
 }
 
+void RowBoundTightener::computeTermBounds( unsigned i, double ci, double lb, double ub )
+{
+    /*
+      The term ci * xi is smallest when xi is at its lower bound if ci is
+      positive, and when xi is at its upper bound otherwise. Infinite
+      bounds are flagged instead of being multiplied, so that they do not
+      swallow (or cancel out with) the other terms of a row.
+    */
+    _ciSign[i] = FloatUtils::isPositive( ci ) ? POSITIVE : NEGATIVE;
+
+    double lowerBoundOfXi = ( _ciSign[i] == POSITIVE ) ? lb : ub;
+    double upperBoundOfXi = ( _ciSign[i] == POSITIVE ) ? ub : lb;
+
+    if ( FloatUtils::isFinite( lowerBoundOfXi ) )
+        _termLowerBound[i] = ci * lowerBoundOfXi;
+    else
+    {
+        _termLowerBound[i] = 0;
+        _ciSign[i] |= INFINITE_LOWER_TERM;
+    }
+
+    if ( FloatUtils::isFinite( upperBoundOfXi ) )
+        _termUpperBound[i] = ci * upperBoundOfXi;
+    else
+    {
+        _termUpperBound[i] = 0;
+        _ciSign[i] |= INFINITE_UPPER_TERM;
+    }
+}
+
 void RowBoundTightener::examineConstraintMatrix( bool untilSaturation )
 {
-    unsigned newBoundsLearned;
+    queueRowsWithChangedBounds();
 
     /*
-      If working until saturation, do single passes over the matrix until no new bounds
-      are learned. Otherwise, just do a single pass.
+      Tightening the bounds of a variable queues the rows that contain
+      it. If working until saturation, examine rows until the queue is
+      empty, but no more rows than the given number of full passes over
+      the matrix would examine. Otherwise, examine at most one pass worth
+      of rows. Rows that are left in the queue are examined next time.
     */
-    unsigned maxNumberOfIterations =
-        untilSaturation ? GlobalConfiguration::ROW_BOUND_TIGHTENER_SATURATION_ITERATIONS : 1;
-    do
+    unsigned maxNumberOfRows =
+        untilSaturation ? GlobalConfiguration::ROW_BOUND_TIGHTENER_SATURATION_ITERATIONS * _m
+                        : _m;
+
+    unsigned newBoundsLearned = 0;
+    unsigned rowsExamined = 0;
+    while ( !_constraintRowQueue.empty() && rowsExamined < maxNumberOfRows )
     {
-        newBoundsLearned = onePassOverConstraintMatrix();
+        unsigned row = _constraintRowQueue.peak();
+        _constraintRowQueue.pop();
+        _constraintRowQueued[row] = false;
+        ++rowsExamined;
 
-        if ( _statistics && ( newBoundsLearned > 0 ) )
-            _statistics->incLongAttribute( Statistics::NUM_TIGHTENINGS_FROM_CONSTRAINT_MATRIX,
-                                           newBoundsLearned );
+        if ( _statistics )
+            _statistics->incLongAttribute( Statistics::NUM_CONSTRAINT_MATRIX_ROWS_EXAMINED );
 
-        --maxNumberOfIterations;
+        try
+        {
+            newBoundsLearned += tightenOnSingleConstraintRow( row );
+        }
+        catch ( ... )
+        {
+            // The row was not examined in full
+            queueConstraintRow( row );
+            throw;
+        }
     }
-    while ( ( maxNumberOfIterations != 0 ) && ( newBoundsLearned > 0 ) );
+
+    if ( _statistics && ( newBoundsLearned > 0 ) )
+        _statistics->incLongAttribute( Statistics::NUM_TIGHTENINGS_FROM_CONSTRAINT_MATRIX,
+                                       newBoundsLearned );
 }
 
-unsigned RowBoundTightener::onePassOverConstraintMatrix()
+void RowBoundTightener::queueRowsWithChangedBounds()
 {
-    unsigned result = 0;
+    // The recorded bounds start out as NaN, which differs from any bound
+    for ( unsigned i = 0; i < _n; ++i )
+    {
+        if ( !( _queuedLowerBounds[i] == getLowerBound( i ) ) ||
+             !( _queuedUpperBounds[i] == getUpperBound( i ) ) )
+            queueRowsOfVariable( i );
+    }
+}
 
-    unsigned m = _tableau.getM();
+void RowBoundTightener::queueRowsOfVariable( unsigned variable )
+{
+    _queuedLowerBounds[variable] = getLowerBound( variable );
+    _queuedUpperBounds[variable] = getUpperBound( variable );
 
-    for ( unsigned i = 0; i < m; ++i )
-        result += tightenOnSingleConstraintRow( i );
+    for ( const auto &entry : *_tableau.getSparseAColumn( variable ) )
+        queueConstraintRow( entry._index );
+}
 
-    return result;
+void RowBoundTightener::queueConstraintRow( unsigned row )
+{
+    if ( _constraintRowQueued[row] )
+        return;
+
+    _constraintRowQueued[row] = true;
+    _constraintRowQueue.push( row );
 }
 
 unsigned RowBoundTightener::tightenOnSingleConstraintRow( unsigned row )
@@ -447,9 +668,10 @@ unsigned RowBoundTightener::tightenOnSingleConstraintRow( unsigned row )
       We first compute the lower and upper bounds for the expression
 
           sum ci xi - b
-   */
-    unsigned n = _tableau.getN();
 
+      Only the non-zero entries of the row are visited, and the work
+      arrays are indexed by the position of the entry in the row.
+   */
     unsigned result = 0;
 
     const SparseUnsortedList *sparseRow = _tableau.getSparseARow( row );
@@ -458,25 +680,13 @@ unsigned RowBoundTightener::tightenOnSingleConstraintRow( unsigned row )
     double ci;
     unsigned index;
 
-    // Compute ci * lb, ci * ub, flag signs for all entries
-    enum {
-        ZERO = 0,
-        POSITIVE = 1,
-        NEGATIVE = 2,
-    };
-
-    std::fill_n( _ciSign, n, ZERO );
-    std::fill_n( _ciTimesLb, n, 0 );
-    std::fill_n( _ciTimesUb, n, 0 );
-
+    // Compute the bounds of ci * xi, flag signs for all entries
+    unsigned position = 0;
     for ( const auto &entry : *sparseRow )
     {
         index = entry._index;
-        ci = entry._value;
-
-        _ciSign[index] = FloatUtils::isPositive( ci ) ? POSITIVE : NEGATIVE;
-        _ciTimesLb[index] = ci * getLowerBound( index );
-        _ciTimesUb[index] = ci * getUpperBound( index );
+        computeTermBounds( position, entry._value, getLowerBound( index ), getUpperBound( index ) );
+        ++position;
     }
 
     /*
@@ -498,63 +708,77 @@ unsigned RowBoundTightener::tightenOnSingleConstraintRow( unsigned row )
 
     double auxLb = b[row];
     double auxUb = b[row];
+    unsigned infiniteAuxLbTerms = 0;
+    unsigned infiniteAuxUbTerms = 0;
 
     // Now add ALL xi's
-    for ( unsigned i = 0; i < n; ++i )
+    for ( unsigned i = 0; i < position; ++i )
     {
-        if ( _ciSign[i] == NEGATIVE )
-        {
-            auxLb -= _ciTimesLb[i];
-            auxUb -= _ciTimesUb[i];
-        }
-        else
-        {
-            auxLb -= _ciTimesUb[i];
-            auxUb -= _ciTimesLb[i];
-        }
+        auxLb -= _termUpperBound[i];
+        auxUb -= _termLowerBound[i];
+
+        if ( _ciSign[i] & INFINITE_UPPER_TERM )
+            ++infiniteAuxLbTerms;
+        if ( _ciSign[i] & INFINITE_LOWER_TERM )
+            ++infiniteAuxUbTerms;
     }
 
+    // Nothing can be learned if more than one term is unbounded in each direction
+    if ( infiniteAuxLbTerms > 1 && infiniteAuxUbTerms > 1 )
+        return 0;
+
     double lowerBound;
     double upperBound;
 
     // Now consider each individual xi with non zero coefficient
+    position = 0;
     for ( const auto &entry : *sparseRow )
     {
+        unsigned i = position++;
         index = entry._index;
 
-        lowerBound = auxLb;
-        upperBound = auxUb;
-
-        // Adjust the aux bounds to remove xi
-        if ( _ciSign[index] == NEGATIVE )
-        {
-            lowerBound += _ciTimesLb[index];
-            upperBound += _ciTimesUb[index];
-        }
-        else
-        {
-            lowerBound += _ciTimesUb[index];
-            upperBound += _ciTimesLb[index];
-        }
-
-        // Now divide everything by ci, switching signs if needed.
         ci = entry._value;
         if ( FloatUtils::lt( abs( ci ), GlobalConfiguration::MINIMAL_COEFFICIENT_FOR_TIGHTENING ) )
             continue;
 
+        // Adjust the aux bounds to remove xi
+        bool lowerBoundIsFinite =
+            infiniteAuxLbTerms == ( ( _ciSign[i] & INFINITE_UPPER_TERM ) ? 1u : 0u );
+        bool upperBoundIsFinite =
+            infiniteAuxUbTerms == ( ( _ciSign[i] & INFINITE_LOWER_TERM ) ? 1u : 0u );
+        if ( !lowerBoundIsFinite && !upperBoundIsFinite )
+            continue;
+
+        lowerBound = auxLb + _termUpperBound[i];
+        upperBound = auxUb + _termLowerBound[i];
+
+        // Now divide everything by ci, switching signs if needed.
         lowerBound = lowerBound / ci;
         upperBound = upperBound / ci;
 
-        if ( _ciSign[index] == NEGATIVE )
+        if ( _ciSign[i] & NEGATIVE )
         {
             double temp = upperBound;
             upperBound = lowerBound;
             lowerBound = temp;
+
+            bool tempIsFinite = upperBoundIsFinite;
+            upperBoundIsFinite = lowerBoundIsFinite;
+            lowerBoundIsFinite = tempIsFinite;
         }
 
-        // If a tighter bound is found, store it
-        result += registerTighterLowerBound( index, lowerBound, *sparseRow );
-        result += registerTighterUpperBound( index, upperBound, *sparseRow );
+        // If a tighter bound is found, store it, and queue the rows of xi
+        unsigned newBounds = 0;
+        if ( lowerBoundIsFinite )
+            newBounds += registerTighterLowerBound( index, lowerBound, *sparseRow );
+        if ( upperBoundIsFinite )
+            newBounds += registerTighterUpperBound( index, upperBound, *sparseRow );
+
+        if ( newBounds > 0 )
+        {
+            result += newBounds;
+            queueRowsOfVariable( index );
+        }
 
         if ( FloatUtils::gt( getLowerBound( index ), getUpperBound( index ) ) )
             throw InfeasibleQueryException();
@@ -570,6 +794,7 @@ void RowBoundTightener::examinePivotRow()
 
     const TableauRow &row( *_tableau.getPivotRow() );
     unsigned newBoundsLearned = tightenOnSingleInvertedBasisRow( row );
+    _tightenedVariables.clear();
 
     if ( _statistics && ( newBoundsLearned > 0 ) )
         _statistics->incLongAttribute( Statistics::NUM_TIGHTENINGS_FROM_ROWS, newBoundsLearned );
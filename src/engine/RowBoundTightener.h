@@ -24,6 +24,8 @@
 #include "TableauRow.h"
 #include "Tightening.h"
 
+#include <vector>
+
 class RowBoundTightener : public IRowBoundTightener
 {
 public:
@@ -35,6 +37,17 @@ public:
     */
     void setDimensions();
 
+    /*
+      Forget the bounds with which the rows of the constraint matrix were
+      last examined.
+    */
+    void resetExaminedBounds();
+
+    /*
+      The tableau has been resized: reallocate the work memory.
+    */
+    void notifyDimensionChange( unsigned m, unsigned n );
+
     /*
        Method obtains lower bound of *var*.
      */
@@ -113,6 +126,10 @@ public:
       inverse of the explicit basis matrix, inv(B0), which should be available
       through the tableau. Can also do this until saturation, meaning that we
       continue until no new bounds are learned.
+
+      The rows of inv(B0) * An are computed one at a time, with BTRANs,
+      and are kept between invocations. Only the rows that are no longer
+      rows of the current basis are recomputed.
      */
     void examineInvertedBasisMatrix( bool untilSaturation );
 
@@ -130,6 +147,9 @@ public:
       original constraint matrix A and right hands side vector b. Can
       also do this until saturation, meaning that we continue until no
       new bounds are learned.
+
+      Only the rows that contain a variable whose bounds have changed
+      since the row was last examined are examined.
     */
     void examineConstraintMatrix( bool untilSaturation );
 
@@ -177,10 +197,53 @@ private:
     */
     TableauRow **_rows;
     double *_z;
-    double *_ciTimesLb;
-    double *_ciTimesUb;
+    double *_ANColumn;
+
+    /*
+      Work space for computing the rows of the inverted basis matrix, and
+      for every basic index, whether its row has been computed since the
+      last call to setDimensions().
+    */
+    double *_unitVector;
+    double *_combinedRow;
+    char *_invertedBasisRowComputed;
+
+    /*
+      Work space for a single row: the bounds of every term ci * xi, and
+      the sign of ci together with flags for the terms whose bounds are
+      infinite.
+    */
+    enum {
+        ZERO = 0,
+        POSITIVE = 1,
+        NEGATIVE = 2,
+        INFINITE_LOWER_TERM = 4,
+        INFINITE_UPPER_TERM = 8,
+    };
+
+    double *_termLowerBound;
+    double *_termUpperBound;
     char *_ciSign;
 
+    /*
+      The rows of the inverted basis matrix that should be examined in
+      the next pass, and the variables tightened during the current pass.
+    */
+    char *_invertedBasisRowDirty;
+    std::vector<unsigned> _tightenedVariables;
+
+    /*
+      The rows of the constraint matrix that need to be examined, and
+      for every variable, the bounds it had when its rows were last
+      queued. A row that is not in the queue has already been examined
+      with the current bounds of all its variables, and so cannot yield
+      new bounds.
+    */
+    Queue<unsigned> _constraintRowQueue;
+    char *_constraintRowQueued;
+    double *_queuedLowerBounds;
+    double *_queuedUpperBounds;
+
     /*
       Statistics collection
     */
@@ -192,10 +255,17 @@ private:
     void freeMemoryIfNeeded();
 
     /*
-      Do a single pass over the constraint matrix and derive any
-      tighter bounds. Return the number of new bounds learned.
+      Queue the rows of the constraint matrix that contain a variable
+      whose bounds changed since its rows were last queued.
+    */
+    void queueRowsWithChangedBounds();
+
+    /*
+      Queue the rows of the constraint matrix that contain the given
+      variable, and record its current bounds.
     */
-    unsigned onePassOverConstraintMatrix();
+    void queueRowsOfVariable( unsigned variable );
+    void queueConstraintRow( unsigned row );
 
     /*
       Process the tableau row and attempt to derive tighter
@@ -205,11 +275,45 @@ private:
     unsigned tightenOnSingleConstraintRow( unsigned row );
 
     /*
-      Do a single pass over the inverted basis rows and derive any
+      Store the bounds of the term ci * xi, given the bounds of xi, in
+      entry i of the row work space.
+    */
+    void computeTermBounds( unsigned i, double ci, double lb, double ub );
+
+    /*
+      Return true iff the stored row of the given basic index is the row
+      of the current basis, i.e. if it was computed for the same basic
+      variable, and all the variables with non-zero coefficients in it
+      are still non-basic (at the same non-basic indices). The non-basic
+      variables of the zero entries are updated.
+    */
+    bool invertedBasisRowIsCurrent( unsigned index );
+
+    /*
+      Compute the row of the given basic index, by solving e * inv(B)
+      with a BTRAN and multiplying the result by b and by -An.
+    */
+    void computeInvertedBasisRow( unsigned index );
+
+    /*
+      Pass over the inverted basis rows until no new bounds are learned
+      (or for a single pass). Every pass after the first only examines
+      the rows that contain a variable tightened by the previous pass.
+    */
+    void examineInvertedBasisRows( bool untilSaturation );
+
+    /*
+      Do a single pass over the dirty inverted basis rows and derive any
       tighter bounds. Return the number of new bounds learned.
     */
     unsigned onePassOverInvertedBasisRows();
 
+    /*
+      Mark the inverted basis rows that contain the variables tightened
+      during the last pass.
+    */
+    void markRowsOfTightenedVariables();
+
     /*
       Process the inverted basis row and attempt to derive tighter
       lower/upper bounds for the specified variable. Return the number
@@ -21,6 +21,7 @@
 #include "FloatUtils.h"
 #include "GlobalConfiguration.h"
 #include "IEngine.h"
+#include "InfeasibleQueryException.h"
 #include "MStringf.h"
 #include "MarabouError.h"
 #include "Options.h"
@@ -28,6 +29,9 @@
 #include "ReluConstraint.h"
 #include "UnsatCertificateNode.h"
 
+#include <climits>
+#include <cmath>
+
 SmtCore::SmtCore( IEngine *engine )
     : _statistics( NULL )
     , _engine( engine )
@@ -41,6 +45,8 @@ SmtCore::SmtCore( IEngine *engine )
     , _branchingHeuristic( Options::get()->getDivideStrategy() )
     , _scoreTracker( nullptr )
     , _numRejectedPhasePatternProposal( 0 )
+    , _numConflictsSinceRestart( 0 )
+    , _numRestarts( 0 )
 {
 }
 
@@ -71,6 +77,10 @@ void SmtCore::reset()
     _stateId = 0;
     _constraintToViolationCount.clear();
     _numRejectedPhasePatternProposal = 0;
+    _learnedClauses.clear();
+    _numConflictsSinceRestart = 0;
+    _numRestarts = 0;
+    _savedPhases.clear();
 }
 
 void SmtCore::reportViolatedConstraint( PiecewiseLinearConstraint *constraint )
@@ -162,6 +172,8 @@ void SmtCore::performSplit()
     List<PiecewiseLinearCaseSplit> splits = _constraintForSplitting->getCaseSplits();
     ASSERT( !splits.empty() );
     ASSERT( splits.size() >= 2 ); // Not really necessary, can add code to handle this case.
+    if ( GlobalConfiguration::USE_PHASE_SAVING )
+        trySavedPhaseFirst( _constraintForSplitting, splits );
     _constraintForSplitting->setActiveConstraint( false );
 
     // Obtain the current state of the engine
@@ -199,6 +211,12 @@ void SmtCore::performSplit()
 
     _engine->applySplit( *split );
     stackEntry->_activeSplit = *split;
+    // Constraints created only for splitting (e.g., on input intervals) are
+    // not kept alive, so only constraints whose phase is kept in the context
+    // are recorded for conflict analysis
+    if ( _constraintForSplitting->searchStateIsContextDependent() )
+        stackEntry->_constraint = _constraintForSplitting;
+    savePhase( *stackEntry );
 
     // Store the remaining splits on the stack, for later
     stackEntry->_engineState = stateBeforeSplits;
@@ -357,6 +375,7 @@ bool SmtCore::popSplit()
 
         stackEntry->_activeSplit = *split;
         stackEntry->_alternativeSplits.erase( split );
+        savePhase( *stackEntry );
 
         inconsistent = !_engine->consistentBounds();
 
@@ -380,6 +399,273 @@ bool SmtCore::popSplit()
     return true;
 }
 
+void SmtCore::backjump( unsigned conflictLevel )
+{
+    unsigned depth = getStackDepth();
+    ASSERT( conflictLevel <= depth );
+
+    if ( conflictLevel > 0 && learnClause( conflictLevel ) )
+    {
+        ++_numConflictsSinceRestart;
+        if ( _statistics )
+            _statistics->incUnsignedAttribute( Statistics::NUM_LEARNED_CLAUSES );
+    }
+
+    if ( conflictLevel == depth )
+        return;
+
+    SMT_LOG( Stringf( "Backjumping from level %u to level %u", depth, conflictLevel ).ascii() );
+
+    // The subtrees of the alternative splits above the conflict level are
+    // infeasible as well
+    while ( _stack.size() > conflictLevel )
+    {
+        delete _stack.back()->_engineState;
+        delete _stack.back();
+        _stack.popBack();
+        popContext();
+    }
+
+    if ( _statistics )
+    {
+        _statistics->incUnsignedAttribute( Statistics::NUM_BACKJUMPS );
+        _statistics->incUnsignedAttribute( Statistics::NUM_LEVELS_SKIPPED_BY_BACKJUMPS,
+                                           depth - conflictLevel );
+    }
+}
+
+bool SmtCore::learnClause( unsigned numberOfEntries )
+{
+    if ( _learnedClauses.size() >= GlobalConfiguration::MAX_NUMBER_OF_LEARNED_CLAUSES )
+        return false;
+
+    LearnedClause clause;
+    auto stackEntry = _stack.begin();
+    for ( unsigned i = 0; i < numberOfEntries; ++i, ++stackEntry )
+    {
+        PiecewiseLinearConstraint *constraint = ( *stackEntry )->_constraint;
+        if ( !constraint || !constraint->phaseFixed() )
+            return false;
+
+        // Only constraints that keep track of their phase can take part in
+        // the clause
+        PhaseStatus phase = constraint->getPhaseStatus();
+        if ( phase == PHASE_NOT_FIXED ||
+             !( constraint->getCaseSplit( phase ) == ( *stackEntry )->_activeSplit ) )
+            return false;
+
+        clause._literals.append( { constraint, phase } );
+    }
+
+    // The clause is violated under the current phases, so which literals are
+    // watched is settled when the clause is first visited
+    clause._watched[0] = 0;
+    clause._watched[1] = numberOfEntries > 1 ? 1 : 0;
+    _learnedClauses.append( clause );
+    return true;
+}
+
+bool SmtCore::literalHolds( const PhaseLiteral &literal )
+{
+    return literal._constraint->phaseFixed() &&
+           literal._constraint->getPhaseStatus() == literal._phase;
+}
+
+bool SmtCore::propagateLearnedClauses()
+{
+    if ( _learnedClauses.empty() )
+        return false;
+
+    // Make sure the phases of the constraints reflect the current bounds
+    _engine->propagateBoundManagerTightenings();
+
+    bool appliedSplit = false;
+    for ( auto &clause : _learnedClauses )
+        if ( propagateClause( clause ) )
+            appliedSplit = true;
+
+    return appliedSplit;
+}
+
+bool SmtCore::propagateClause( LearnedClause &clause )
+{
+    Vector<PhaseLiteral> &literals = clause._literals;
+    unsigned *watched = clause._watched;
+
+    if ( literals.size() > 1 && !literalHolds( literals[watched[0]] ) &&
+         !literalHolds( literals[watched[1]] ) )
+        return false;
+
+    // Watch other literals instead of the ones that hold, if possible
+    for ( unsigned w = 0; w < 2 && literals.size() > 1; ++w )
+    {
+        if ( !literalHolds( literals[watched[w]] ) )
+            continue;
+
+        for ( unsigned i = 0; i < literals.size(); ++i )
+        {
+            if ( i != watched[0] && i != watched[1] && !literalHolds( literals[i] ) )
+            {
+                watched[w] = i;
+                break;
+            }
+        }
+    }
+
+    bool firstHolds = literalHolds( literals[watched[0]] );
+    bool secondHolds = literalHolds( literals[watched[1]] );
+    if ( firstHolds && secondHolds )
+        throw InfeasibleQueryException();
+
+    if ( literals.size() > 1 && !firstHolds && !secondHolds )
+        return false;
+
+    // All the other literals hold, so the constraint of the remaining literal
+    // has to take its other phase
+    const PhaseLiteral &literal = literals[firstHolds ? watched[1] : watched[0]];
+    PiecewiseLinearConstraint *constraint = literal._constraint;
+    if ( !constraint->isActive() || constraint->phaseFixed() )
+        return false;
+
+    List<PhaseStatus> cases = constraint->getAllCases();
+    if ( cases.size() != 2 || !cases.exists( literal._phase ) )
+        return false;
+
+    PhaseStatus otherPhase =
+        ( cases.front() == literal._phase ) ? cases.back() : cases.front();
+    _engine->applySplit( constraint->getCaseSplit( otherPhase ) );
+
+    if ( _statistics )
+        _statistics->incUnsignedAttribute( Statistics::NUM_CLAUSE_IMPLIED_SPLITS );
+
+    return true;
+}
+
+unsigned SmtCore::getNumberOfLearnedClauses() const
+{
+    return _learnedClauses.size();
+}
+
+bool SmtCore::shouldRestart() const
+{
+    return GlobalConfiguration::SEARCH_RESTART_POLICY != GlobalConfiguration::NO_RESTARTS &&
+           !_stack.empty() && _numConflictsSinceRestart >= getRestartThreshold();
+}
+
+void SmtCore::restart()
+{
+    ASSERT( !_stack.empty() );
+
+    SMT_LOG( Stringf( "Restarting the search from level %u", getStackDepth() ).ascii() );
+
+    struct timespec start = TimeUtils::sampleMicro();
+
+    // The first entry stores the state of the engine before any split
+    EngineState *rootState = _stack.front()->_engineState;
+    _stack.front()->_engineState = NULL;
+
+    while ( !_stack.empty() )
+    {
+        delete _stack.back()->_engineState;
+        delete _stack.back();
+        _stack.popBack();
+        popContext();
+    }
+
+    _engine->postContextPopHook();
+    _engine->restoreState( *rootState );
+    delete rootState;
+
+    _needToSplit = false;
+    _constraintForSplitting = NULL;
+    _constraintToViolationCount.clear();
+    _numRejectedPhasePatternProposal = 0;
+
+    _numConflictsSinceRestart = 0;
+    ++_numRestarts;
+
+    if ( _statistics )
+    {
+        _statistics->incUnsignedAttribute( Statistics::NUM_RESTARTS );
+        _statistics->incUnsignedAttribute( Statistics::NUM_VISITED_TREE_STATES );
+        _statistics->setUnsignedAttribute( Statistics::CURRENT_DECISION_LEVEL, 0 );
+        struct timespec end = TimeUtils::sampleMicro();
+        _statistics->incLongAttribute( Statistics::TOTAL_TIME_SMT_CORE_MICRO,
+                                       TimeUtils::timePassed( start, end ) );
+    }
+}
+
+unsigned SmtCore::getRestartThreshold() const
+{
+    unsigned base = GlobalConfiguration::RESTART_BASE_NUMBER_OF_CONFLICTS;
+
+    if ( GlobalConfiguration::SEARCH_RESTART_POLICY == GlobalConfiguration::LUBY_RESTARTS )
+        return base * luby( _numRestarts );
+
+    double threshold = base * std::pow( GlobalConfiguration::RESTART_GEOMETRIC_FACTOR,
+                                        (double)_numRestarts );
+    if ( threshold >= (double)UINT_MAX )
+        return UINT_MAX;
+    return (unsigned)threshold;
+}
+
+unsigned SmtCore::luby( unsigned index )
+{
+    // Find the smallest complete subsequence, of length 2^k - 1, that
+    // contains the index, and descend into the copy of the previous
+    // subsequence that the index falls in
+    unsigned size = 1;
+    unsigned exponent = 0;
+    while ( size < index + 1 )
+    {
+        size = 2 * size + 1;
+        ++exponent;
+    }
+
+    while ( size - 1 != index )
+    {
+        size = ( size - 1 ) / 2;
+        --exponent;
+        index = index % size;
+    }
+
+    return 1u << exponent;
+}
+
+void SmtCore::savePhase( const SmtStackEntry &stackEntry )
+{
+    PiecewiseLinearConstraint *constraint = stackEntry._constraint;
+    if ( !GlobalConfiguration::USE_PHASE_SAVING || !constraint )
+        return;
+
+    for ( const auto &phase : constraint->getAllCases() )
+    {
+        if ( constraint->getCaseSplit( phase ) == stackEntry._activeSplit )
+        {
+            _savedPhases[constraint] = phase;
+            return;
+        }
+    }
+}
+
+void SmtCore::trySavedPhaseFirst( PiecewiseLinearConstraint *constraint,
+                                  List<PiecewiseLinearCaseSplit> &splits ) const
+{
+    if ( !_savedPhases.exists( constraint ) )
+        return;
+
+    PiecewiseLinearCaseSplit savedSplit = constraint->getCaseSplit( _savedPhases[constraint] );
+    for ( auto split = splits.begin(); split != splits.end(); ++split )
+    {
+        if ( *split == savedSplit )
+        {
+            splits.erase( split );
+            splits.appendHead( savedSplit );
+            return;
+        }
+    }
+}
+
 void SmtCore::resetSplitConditions()
 {
     _constraintToViolationCount.clear();
@@ -24,6 +24,7 @@
 #include "SmtState.h"
 #include "Stack.h"
 #include "Statistics.h"
+#include "Vector.h"
 #include "context/context.h"
 
 #include <memory>
@@ -113,6 +114,37 @@ public:
     */
     bool popSplit();
 
+    /*
+      Called when the current subproblem is infeasible, and the infeasibility
+      only depends on the splits up to the given decision level. Learn a
+      clause that forbids the phases chosen by these splits, and pop the stack
+      entries above that level without trying their alternative splits. The
+      following popSplit() then backtracks the split at that level.
+    */
+    void backjump( unsigned conflictLevel );
+
+    /*
+      Apply the splits implied by the learned clauses under the current
+      phases of the constraints. Return true iff a split was applied. Throw
+      an InfeasibleQueryException if all the phases of a clause are taken.
+    */
+    bool propagateLearnedClauses();
+
+    unsigned getNumberOfLearnedClauses() const;
+
+    /*
+      Returns true iff the restart policy calls for restarting the search,
+      based on the number of clauses learned since the last restart.
+    */
+    bool shouldRestart() const;
+
+    /*
+      Restart the search: pop all the splits and restore the engine to its
+      state before the first one. The learned clauses, the saved phases and
+      the scores of the constraints are kept.
+    */
+    void restart();
+
     /*
          Pop _context, record statistics
      */
@@ -181,6 +213,71 @@ public:
     bool splitAllowsStoredSolution( const PiecewiseLinearCaseSplit &split, String &error ) const;
 
 private:
+    /*
+      A learned clause states that its constraints cannot all take the
+      listed phases. Two literals that do not currently hold are watched,
+      and the rest of the clause is only visited when one of them holds.
+    */
+    struct PhaseLiteral
+    {
+        PiecewiseLinearConstraint *_constraint;
+        PhaseStatus _phase;
+    };
+
+    struct LearnedClause
+    {
+        Vector<PhaseLiteral> _literals;
+        unsigned _watched[2];
+    };
+
+    Vector<LearnedClause> _learnedClauses;
+
+    /*
+      Learn a clause over the phases of the splits on the first
+      numberOfEntries entries of the stack. Return false if the phase of
+      some split is unknown.
+    */
+    bool learnClause( unsigned numberOfEntries );
+
+    /*
+      Update the watched literals of a clause, and apply the split that it
+      implies, if any. Return true iff a split was applied.
+    */
+    bool propagateClause( LearnedClause &clause );
+
+    static bool literalHolds( const PhaseLiteral &literal );
+
+    /*
+      The number of clauses learned since the last restart, and the number
+      of restarts so far.
+    */
+    unsigned _numConflictsSinceRestart;
+    unsigned _numRestarts;
+
+    /*
+      The phase that each constraint took the last time it was split upon.
+    */
+    Map<PiecewiseLinearConstraint *, PhaseStatus> _savedPhases;
+
+    /*
+      The number of conflicts after which the search is restarted next.
+    */
+    unsigned getRestartThreshold() const;
+
+    /*
+      The index-th element (starting from 0) of the Luby sequence
+      1, 1, 2, 1, 1, 2, 4, 1, 1, 2, ...
+    */
+    static unsigned luby( unsigned index );
+
+    /*
+      Save the phase of the split that the stack entry applies, and move the
+      split of the saved phase of a constraint to the front of its splits.
+    */
+    void savePhase( const SmtStackEntry &stackEntry );
+    void trySavedPhaseFirst( PiecewiseLinearConstraint *constraint,
+                             List<PiecewiseLinearCaseSplit> &splits ) const;
+
     /*
       Valid splits that were implied by level 0 of the stack.
     */
@@ -19,10 +19,14 @@
 #include "EngineState.h"
 #include "PiecewiseLinearCaseSplit.h"
 
+class PiecewiseLinearConstraint;
+
 /*
   A stack entry consists of the engine state before the split,
   the active split, the alternative splits (in case of backtrack),
   and also any implied splits that were discovered subsequently.
+  For conflict analysis, the entry also points to the constraint that was
+  split upon, if the constraint keeps its phase in the context.
 */
 struct SmtStackEntry
 {
@@ -31,6 +35,7 @@ public:
     List<PiecewiseLinearCaseSplit> _impliedValidSplits;
     List<PiecewiseLinearCaseSplit> _alternativeSplits;
     EngineState *_engineState;
+    PiecewiseLinearConstraint *_constraint = nullptr;
 
     /*
       Create a copy of the SmtStackEntry on the stack and returns a pointer to
@@ -46,6 +51,7 @@ public:
         copy->_impliedValidSplits = _impliedValidSplits;
         copy->_alternativeSplits = _alternativeSplits;
         copy->_engineState = NULL;
+        copy->_constraint = _constraint;
 
         return copy;
     }
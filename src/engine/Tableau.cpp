@@ -44,15 +44,20 @@ Tableau::Tableau( IBoundManager &boundManager )
     , _A( NULL )
     , _sparseColumnsOfA( NULL )
     , _sparseRowsOfA( NULL )
-    , _denseA( NULL )
     , _changeColumn( NULL )
+    , _changeColumnIndices( NULL )
+    , _changeColumnNnz( 0 )
+    , _changeColumnIndicesValid( false )
     , _pivotRow( NULL )
     , _b( NULL )
     , _workM( NULL )
     , _workN( NULL )
-    , _unitVector( NULL )
+    , _sparseUnitVector( NULL )
     , _basisFactorization( NULL )
     , _multipliers( NULL )
+    , _multipliersIndices( NULL )
+    , _multipliersNnz( 0 )
+    , _multipliersIndicesValid( false )
     , _basicIndexToVariable( NULL )
     , _nonBasicIndexToVariable( NULL )
     , _variableToIndex( NULL )
@@ -63,6 +68,8 @@ Tableau::Tableau( IBoundManager &boundManager )
     , _statistics( NULL )
     , _costFunctionManager( NULL )
     , _rhsIsAllZeros( true )
+    , _transformedRightHandSide( NULL )
+    , _transformedRightHandSideValid( false )
     , _lpSolverType( Options::get()->getLPSolverType() )
     , _gurobi( nullptr )
 {
@@ -111,18 +118,18 @@ void Tableau::freeMemoryIfNeeded()
         _sparseRowsOfA = NULL;
     }
 
-    if ( _denseA )
-    {
-        delete[] _denseA;
-        _denseA = NULL;
-    }
-
     if ( _changeColumn )
     {
         delete[] _changeColumn;
         _changeColumn = NULL;
     }
 
+    if ( _changeColumnIndices )
+    {
+        delete[] _changeColumnIndices;
+        _changeColumnIndices = NULL;
+    }
+
     if ( _pivotRow )
     {
         delete _pivotRow;
@@ -135,10 +142,10 @@ void Tableau::freeMemoryIfNeeded()
         _b = NULL;
     }
 
-    if ( _unitVector )
+    if ( _sparseUnitVector )
     {
-        delete[] _unitVector;
-        _unitVector = NULL;
+        delete _sparseUnitVector;
+        _sparseUnitVector = NULL;
     }
 
     if ( _multipliers )
@@ -147,6 +154,12 @@ void Tableau::freeMemoryIfNeeded()
         _multipliers = NULL;
     }
 
+    if ( _multipliersIndices )
+    {
+        delete[] _multipliersIndices;
+        _multipliersIndices = NULL;
+    }
+
     if ( _basicIndexToVariable )
     {
         delete[] _basicIndexToVariable;
@@ -200,6 +213,12 @@ void Tableau::freeMemoryIfNeeded()
         delete[] _workN;
         _workN = NULL;
     }
+
+    if ( _transformedRightHandSide )
+    {
+        delete[] _transformedRightHandSide;
+        _transformedRightHandSide = NULL;
+    }
 }
 
 void Tableau::setDimensions( unsigned m, unsigned n )
@@ -236,14 +255,15 @@ void Tableau::setDimensions( unsigned m, unsigned n )
                 throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::sparseRowOfA[i]" );
         }
 
-        _denseA = new double[m * n];
-        if ( !_denseA )
-            throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::denseA" );
-
         _changeColumn = new double[m];
         if ( !_changeColumn )
             throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::changeColumn" );
 
+        _changeColumnIndices = new unsigned[m];
+        if ( !_changeColumnIndices )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::changeColumnIndices" );
+        _changeColumnIndicesValid = false;
+
         _pivotRow = new TableauRow( n - m );
         if ( !_pivotRow )
             throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::pivotRow" );
@@ -252,14 +272,19 @@ void Tableau::setDimensions( unsigned m, unsigned n )
         if ( !_b )
             throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::b" );
 
-        _unitVector = new double[m];
-        if ( !_unitVector )
-            throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::unitVector" );
+        _sparseUnitVector = new SparseUnsortedList( m );
+        if ( !_sparseUnitVector )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::sparseUnitVector" );
 
         _multipliers = new double[m];
         if ( !_multipliers )
             throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::multipliers" );
 
+        _multipliersIndices = new unsigned[m];
+        if ( !_multipliersIndices )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::multipliersIndices" );
+        _multipliersIndicesValid = false;
+
         _basicIndexToVariable = new unsigned[m];
         if ( !_basicIndexToVariable )
             throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::basicIndexToVariable" );
@@ -298,6 +323,12 @@ void Tableau::setDimensions( unsigned m, unsigned n )
         if ( !_workN )
             throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::work" );
 
+        _transformedRightHandSide = new double[m];
+        if ( !_transformedRightHandSide )
+            throw MarabouError( MarabouError::ALLOCATION_FAILED,
+                                "Tableau::transformedRightHandSide" );
+        _transformedRightHandSideValid = false;
+
         if ( _statistics )
         {
             _statistics->setUnsignedAttribute( Statistics::CURRENT_TABLEAU_M, _m );
@@ -310,16 +341,41 @@ void Tableau::setConstraintMatrix( const double *A )
 {
     _A->initialize( A, _m, _n );
 
-    for ( unsigned column = 0; column < _n; ++column )
-    {
-        for ( unsigned row = 0; row < _m; ++row )
-            _denseA[column * _m + row] = A[row * _n + column];
+    for ( unsigned row = 0; row < _m; ++row )
+        _sparseRowsOfA[row]->initialize( A + ( row * _n ), _n );
 
-        _sparseColumnsOfA[column]->initialize( _denseA + ( column * _m ), _m );
+    initializeSparseColumnsOfA();
+}
+
+void Tableau::setConstraintMatrix( const SparseUnsortedList **rows )
+{
+    _A->initialize( rows, _m, _n );
+
+    for ( unsigned row = 0; row < _m; ++row )
+    {
+        _sparseRowsOfA[row]->clear();
+        _sparseRowsOfA[row]->reserve( rows[row]->getNnz() );
+        for ( const auto &entry : *rows[row] )
+        {
+            if ( !FloatUtils::isZero( entry._value ) )
+                _sparseRowsOfA[row]->append( entry._index, entry._value );
+        }
     }
 
+    initializeSparseColumnsOfA();
+}
+
+void Tableau::initializeSparseColumnsOfA()
+{
+    // Going over the rows in order keeps the entries of every column ordered by row
+    for ( unsigned column = 0; column < _n; ++column )
+        _sparseColumnsOfA[column]->clear();
+
     for ( unsigned row = 0; row < _m; ++row )
-        _sparseRowsOfA[row]->initialize( A + ( row * _n ), _n );
+    {
+        for ( const auto &entry : *_sparseRowsOfA[row] )
+            _sparseColumnsOfA[entry._index]->append( row, entry._value );
+    }
 }
 
 void Tableau::markAsBasic( unsigned variable )
@@ -368,6 +424,7 @@ void Tableau::initializeTableau( const List<unsigned> &initialBasicVariables )
 
     // Factorize the basis
     _basisFactorization->obtainFreshBasis();
+    _transformedRightHandSideValid = false;
 
     // Compute assignment
     computeAssignment();
@@ -528,6 +585,7 @@ unsigned Tableau::variableToIndex( unsigned index ) const
 void Tableau::setRightHandSide( const double *b )
 {
     memcpy( _b, b, sizeof( double ) * _m );
+    _transformedRightHandSideValid = false;
 
     for ( unsigned i = 0; i < _m; ++i )
     {
@@ -539,6 +597,7 @@ void Tableau::setRightHandSide( const double *b )
 void Tableau::setRightHandSide( unsigned index, double value )
 {
     _b[index] = value;
+    _transformedRightHandSideValid = false;
 
     if ( !FloatUtils::isZero( value ) )
         _rhsIsAllZeros = false;
@@ -581,6 +640,29 @@ void Tableau::computeCostFunction()
 void Tableau::computeMultipliers( double *rowCoefficients )
 {
     _basisFactorization->backwardTransformation( rowCoefficients, _multipliers );
+    _multipliersIndicesValid = false;
+}
+
+void Tableau::computeMultipliers( const SparseUnsortedList &rowCoefficients )
+{
+    clearSparseVector( _multipliers, _multipliersIndices, _multipliersNnz, _multipliersIndicesValid );
+    _basisFactorization->backwardTransformation(
+        rowCoefficients, _multipliers, _multipliersIndices, _multipliersNnz );
+    _multipliersIndicesValid = true;
+}
+
+void Tableau::clearSparseVector( double *vector,
+                                 const unsigned *indices,
+                                 unsigned nnz,
+                                 bool indicesValid ) const
+{
+    if ( indicesValid )
+    {
+        for ( unsigned i = 0; i < nnz; ++i )
+            vector[indices[i]] = 0;
+    }
+    else
+        std::fill_n( vector, _m, 0 );
 }
 
 unsigned Tableau::getBasicStatus( unsigned basic )
@@ -789,8 +871,9 @@ void Tableau::performPivot()
 
     // Update the basis factorization. The column corresponding to the
     // leaving variable is the one that has changed
-    _basisFactorization->updateToAdjacentBasis(
-        _leavingVariable, _changeColumn, getAColumn( currentNonBasic ) );
+    _sparseColumnsOfA[currentNonBasic]->toDense( _workM );
+    _basisFactorization->updateToAdjacentBasis( _leavingVariable, _changeColumn, _workM );
+    _transformedRightHandSideValid = false;
 
     if ( _statistics )
     {
@@ -831,8 +914,9 @@ void Tableau::performDegeneratePivot()
     _variableToIndex[currentNonBasic] = _leavingVariable;
 
     // Update the basis factorization
-    _basisFactorization->updateToAdjacentBasis(
-        _leavingVariable, _changeColumn, getAColumn( currentNonBasic ) );
+    _sparseColumnsOfA[currentNonBasic]->toDense( _workM );
+    _basisFactorization->updateToAdjacentBasis( _leavingVariable, _changeColumn, _workM );
+    _transformedRightHandSideValid = false;
 
     // Switch assignment values. No call to notify is required,
     // because values haven't changed.
@@ -849,6 +933,269 @@ void Tableau::performDegeneratePivot()
     }
 }
 
+bool Tableau::pickDualLeavingVariable()
+{
+    bool found = false;
+    double largestViolation = 0;
+
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        if ( !basicOutOfBounds( i ) )
+            continue;
+
+        unsigned variable = _basicIndexToVariable[i];
+        double violation = basicTooLow( i ) ? getLowerBound( variable ) - _basicAssignment[i]
+                                            : _basicAssignment[i] - getUpperBound( variable );
+
+        if ( !found || violation > largestViolation )
+        {
+            found = true;
+            largestViolation = violation;
+            _leavingVariable = i;
+        }
+    }
+
+    if ( !found )
+        return false;
+
+    _leavingVariableIncreases = basicTooLow( _leavingVariable );
+    return true;
+}
+
+double Tableau::dualRatioTestBound( unsigned nonBasic, double coefficient ) const
+{
+    // The leaving variable equals scalar + sum( coefficient * nonBasic ),
+    // so the non-basic should increase iff the signs agree
+    unsigned variable = _nonBasicIndexToVariable[nonBasic];
+    bool increase = ( coefficient > 0 ) == _leavingVariableIncreases;
+    return increase ? getUpperBound( variable ) : getLowerBound( variable );
+}
+
+bool Tableau::pickDualEnteringVariable()
+{
+    ASSERT( _leavingVariable < _m );
+    ASSERT( _pivotRow->_lhs == _basicIndexToVariable[_leavingVariable] );
+
+    unsigned leaving = _basicIndexToVariable[_leavingVariable];
+    double remainingViolation = _leavingVariableIncreases
+                                  ? getLowerBound( leaving ) - _basicAssignment[_leavingVariable]
+                                  : _basicAssignment[_leavingVariable] - getUpperBound( leaving );
+
+    _boundFlips.clear();
+
+    /*
+      Since the engine seeks feasibility rather than optimality, all
+      reduced costs are zero and so are all the dual ratios. The tie
+      is broken in favor of non-basics that can close the violation
+      without leaving their own bounds, and then in favor of the
+      largest pivot element, for stability.
+    */
+    bool found = false;
+    bool foundCovering = false;
+    double largestCoefficient = 0;
+    for ( unsigned i = 0; i < _n - _m; ++i )
+    {
+        double coefficient = FloatUtils::abs( _pivotRow->_row[i]._coefficient );
+        if ( coefficient < GlobalConfiguration::ACCEPTABLE_SIMPLEX_PIVOT_THRESHOLD )
+            continue;
+
+        double range = FloatUtils::abs(
+            dualRatioTestBound( i, _pivotRow->_row[i]._coefficient ) - _nonBasicAssignment[i] );
+        if ( !FloatUtils::isPositive( range ) )
+            continue;
+
+        bool covering = FloatUtils::gte( coefficient * range, remainingViolation );
+        if ( foundCovering && !covering )
+            continue;
+
+        if ( ( covering && !foundCovering ) || coefficient > largestCoefficient )
+        {
+            found = true;
+            foundCovering = covering;
+            largestCoefficient = coefficient;
+            _enteringVariable = i;
+        }
+    }
+
+    if ( !found )
+        return false;
+
+    /*
+      If the entering variable would have to leave its own bounds to
+      close the violation, flip other bounded non-basics to the
+      opposite bounds first, as long as each flip does not overshoot
+      the violated bound.
+    */
+    if ( !foundCovering )
+    {
+        double enteringCapacity =
+            largestCoefficient *
+            FloatUtils::abs( dualRatioTestBound( _enteringVariable,
+                                                 _pivotRow->_row[_enteringVariable]._coefficient ) -
+                             _nonBasicAssignment[_enteringVariable] );
+
+        for ( unsigned i = 0; i < _n - _m && remainingViolation > enteringCapacity; ++i )
+        {
+            double coefficient = _pivotRow->_row[i]._coefficient;
+            if ( i == _enteringVariable || FloatUtils::isZero( coefficient ) )
+                continue;
+
+            double bound = dualRatioTestBound( i, coefficient );
+            if ( !FloatUtils::isFinite( bound ) )
+                continue;
+
+            double capacity = FloatUtils::abs( coefficient * ( bound - _nonBasicAssignment[i] ) );
+            if ( !FloatUtils::isPositive( capacity ) || capacity > remainingViolation )
+                continue;
+
+            _boundFlips[i] = bound;
+            remainingViolation -= capacity;
+        }
+    }
+
+    /*
+      With no objective, the dual simplex has no other measure of
+      progress: only accept the pivot if it reduces the sum of
+      infeasibilities.
+    */
+    computeChangeColumn();
+    if ( FloatUtils::abs( _changeColumn[_leavingVariable] ) <
+         GlobalConfiguration::ACCEPTABLE_SIMPLEX_PIVOT_THRESHOLD )
+    {
+        _boundFlips.clear();
+        return false;
+    }
+
+    computeDualPivotStep();
+
+    double before = 0;
+    double after = 0;
+    for ( unsigned i = 0; i < _m; ++i )
+    {
+        unsigned variable = _basicIndexToVariable[i];
+        before += boundViolation( variable, _basicAssignment[i] );
+
+        if ( i != _leavingVariable )
+            after += boundViolation( variable,
+                                     _basicAssignment[i] - _workN[i] -
+                                         _changeColumn[i] * _changeRatio );
+    }
+    after += boundViolation( _nonBasicIndexToVariable[_enteringVariable],
+                             _nonBasicAssignment[_enteringVariable] + _changeRatio );
+
+    if ( !FloatUtils::lt( after, before ) )
+    {
+        _boundFlips.clear();
+        return false;
+    }
+
+    return true;
+}
+
+double Tableau::boundViolation( unsigned variable, double value ) const
+{
+    if ( FloatUtils::lt( value, getLowerBound( variable ) ) )
+        return getLowerBound( variable ) - value;
+    if ( FloatUtils::gt( value, getUpperBound( variable ) ) )
+        return value - getUpperBound( variable );
+    return 0;
+}
+
+void Tableau::computeDualPivotStep()
+{
+    // The change in the basic assignment caused by the bound flips
+    std::fill_n( _workN, _m, 0.0 );
+    if ( !_boundFlips.empty() )
+    {
+        std::fill_n( _workM, _m, 0.0 );
+        for ( const auto &flip : _boundFlips )
+        {
+            unsigned nonBasic = flip.first;
+            double delta = flip.second - _nonBasicAssignment[nonBasic];
+
+            for ( const auto &entry : *_sparseColumnsOfA[_nonBasicIndexToVariable[nonBasic]] )
+                _workM[entry._index] += entry._value * delta;
+        }
+
+        _basisFactorization->forwardTransformation( _workM, _workN );
+    }
+
+    // The change in the entering variable that then brings the leaving
+    // variable to the bound that it violates
+    unsigned leaving = _basicIndexToVariable[_leavingVariable];
+    double leavingBound =
+        _leavingVariableIncreases ? getLowerBound( leaving ) : getUpperBound( leaving );
+    _changeRatio =
+        ( _basicAssignment[_leavingVariable] - _workN[_leavingVariable] - leavingBound ) /
+        _changeColumn[_leavingVariable];
+}
+
+void Tableau::performDualPivot()
+{
+    struct timespec pivotStart;
+    if ( _statistics )
+    {
+        pivotStart = TimeUtils::sampleMicro();
+        _statistics->incLongAttribute( Statistics::NUM_TABLEAU_PIVOTS );
+        _statistics->incLongAttribute( Statistics::NUM_DUAL_SIMPLEX_BOUND_FLIPS,
+                                       _boundFlips.size() );
+    }
+
+    ASSERT( _enteringVariable < _n - _m );
+    ASSERT( _leavingVariable < _m );
+
+    unsigned currentBasic = _basicIndexToVariable[_leavingVariable];
+    unsigned currentNonBasic = _nonBasicIndexToVariable[_enteringVariable];
+
+    // As in a primal pivot, check that the pivot row and column agree
+    double pivotEntryByColumn = -_changeColumn[_leavingVariable];
+    double pivotEntryByRow = _pivotRow->_row[_enteringVariable]._coefficient;
+    if ( !FloatUtils::isZero( pivotEntryByRow - pivotEntryByColumn,
+                              GlobalConfiguration::PIVOT_ROW_AND_COLUMN_TOLERANCE ) )
+        throw MalformedBasisException();
+
+    // Flip the non-basics chosen by the ratio test, and move the
+    // entering variable until the leaving variable reaches the bound
+    // that it violates. The changes were computed by the ratio test.
+    for ( const auto &flip : _boundFlips )
+        _nonBasicAssignment[flip.first] = flip.second;
+    _boundFlips.clear();
+
+    for ( unsigned i = 0; i < _m; ++i )
+        _basicAssignment[i] -= _workN[i] + _changeColumn[i] * _changeRatio;
+
+    double leavingBound = _leavingVariableIncreases ? getLowerBound( currentBasic )
+                                                    : getUpperBound( currentBasic );
+    double enteringValue = _nonBasicAssignment[_enteringVariable] + _changeRatio;
+
+    // Update the database
+    _basicVariables.insert( currentNonBasic );
+    _basicVariables.erase( currentBasic );
+
+    // Adjust the tableau indexing
+    _basicIndexToVariable[_leavingVariable] = currentNonBasic;
+    _nonBasicIndexToVariable[_enteringVariable] = currentBasic;
+    _variableToIndex[currentBasic] = _enteringVariable;
+    _variableToIndex[currentNonBasic] = _leavingVariable;
+
+    // Update the basis factorization
+    _sparseColumnsOfA[currentNonBasic]->toDense( _workM );
+    _basisFactorization->updateToAdjacentBasis( _leavingVariable, _changeColumn, _workM );
+    _transformedRightHandSideValid = false;
+
+    _basicAssignment[_leavingVariable] = enteringValue;
+    _nonBasicAssignment[_enteringVariable] = leavingBound;
+    _basicAssignmentStatus = ITableau::BASIC_ASSIGNMENT_UPDATED;
+    computeBasicStatus();
+
+    if ( _statistics )
+    {
+        struct timespec pivotEnd = TimeUtils::sampleMicro();
+        _statistics->incLongAttribute( Statistics::TIME_PIVOTS_MICRO,
+                                       TimeUtils::timePassed( pivotStart, pivotEnd ) );
+    }
+}
+
 double Tableau::ratioConstraintPerBasic( unsigned basicIndex, double coefficient, bool decrease )
 {
     unsigned basic = _basicIndexToVariable[basicIndex];
@@ -1451,9 +1798,17 @@ void Tableau::setChangeRatio( double changeRatio )
 
 void Tableau::computeChangeColumn()
 {
-    // Compute d = inv(B) * a using the basis factorization
-    const double *a = getAColumn( _nonBasicIndexToVariable[_enteringVariable] );
-    _basisFactorization->forwardTransformation( a, _changeColumn );
+    /*
+      Compute d = inv(B) * a using the basis factorization. The column
+      a is typically very sparse, and so is d, so a hypersparse forward
+      transformation is used.
+    */
+    const SparseUnsortedList *a = _sparseColumnsOfA[_nonBasicIndexToVariable[_enteringVariable]];
+    clearSparseVector(
+        _changeColumn, _changeColumnIndices, _changeColumnNnz, _changeColumnIndicesValid );
+    _basisFactorization->forwardTransformation(
+        *a, _changeColumn, _changeColumnIndices, _changeColumnNnz );
+    _changeColumnIndicesValid = true;
 }
 
 const double *Tableau::getChangeColumn() const
@@ -1464,6 +1819,7 @@ const double *Tableau::getChangeColumn() const
 void Tableau::setChangeColumn( const double *column )
 {
     memcpy( _changeColumn, column, _m * sizeof( double ) );
+    _changeColumnIndicesValid = false;
 }
 
 void Tableau::computePivotRow()
@@ -1575,20 +1931,15 @@ void Tableau::getTableauRow( unsigned index, TableauRow *row )
 
     ASSERT( index < _m );
 
-    std::fill( _unitVector, _unitVector + _m, 0.0 );
-    _unitVector[index] = 1;
-    computeMultipliers( _unitVector );
-
-    for ( unsigned i = 0; i < _n - _m; ++i )
-    {
-        row->_row[i]._var = _nonBasicIndexToVariable[i];
-        row->_row[i]._coefficient = 0;
+    _sparseUnitVector->clear();
+    _sparseUnitVector->append( index, 1 );
+    computeMultipliers( *_sparseUnitVector );
 
-        SparseUnsortedList *column = _sparseColumnsOfA[_nonBasicIndexToVariable[i]];
-
-        for ( const auto &entry : *column )
-            row->_row[i]._coefficient -= ( _multipliers[entry._index] * entry._value );
-    }
+    if ( _multipliersIndicesValid &&
+         _multipliersNnz <= GlobalConfiguration::ROW_WISE_TABLEAU_ROW_DENSITY_THRESHOLD * _m )
+        computeTableauRowByRows( row );
+    else
+        computeTableauRowByColumns( row );
 
     /*
       If the rhs vector is all zeros, the row's scalar will be 0. This is
@@ -1599,21 +1950,119 @@ void Tableau::getTableauRow( unsigned index, TableauRow *row )
         row->_scalar = 0;
     else
     {
-        _basisFactorization->forwardTransformation( _b, _workM );
-        row->_scalar = _workM[index];
+        if ( !_transformedRightHandSideValid )
+        {
+            _basisFactorization->forwardTransformation( _b, _transformedRightHandSide );
+            _transformedRightHandSideValid = true;
+        }
+        row->_scalar = _transformedRightHandSide[index];
     }
 
     row->_lhs = _basicIndexToVariable[index];
 }
 
-const SparseMatrix *Tableau::getSparseA() const
+void Tableau::addTableauRowCombination( const SparseUnsortedList &coefficients, double *result )
 {
-    return _A;
+    /*
+      As for a single row, the combination y * inv(B) * -AN is computed
+      by first solving y * inv(B) with BTRAN.
+    */
+    computeMultipliers( coefficients );
+
+    if ( _multipliersIndicesValid &&
+         _multipliersNnz <= GlobalConfiguration::ROW_WISE_TABLEAU_ROW_DENSITY_THRESHOLD * _m )
+    {
+        for ( unsigned i = 0; i < _multipliersNnz; ++i )
+        {
+            unsigned rowIndex = _multipliersIndices[i];
+            double multiplier = _multipliers[rowIndex];
+            if ( multiplier == 0.0 )
+                continue;
+
+            for ( const auto &entry : *_sparseRowsOfA[rowIndex] )
+            {
+                // Skip the basic variables
+                unsigned nonBasicIndex = _variableToIndex[entry._index];
+                if ( nonBasicIndex >= _n - _m ||
+                     _nonBasicIndexToVariable[nonBasicIndex] != entry._index )
+                    continue;
+
+                result[nonBasicIndex] -= ( multiplier * entry._value );
+            }
+        }
+    }
+    else
+    {
+        for ( unsigned i = 0; i < _n - _m; ++i )
+        {
+            SparseUnsortedList *column = _sparseColumnsOfA[_nonBasicIndexToVariable[i]];
+            for ( const auto &entry : *column )
+                result[i] -= ( _multipliers[entry._index] * entry._value );
+        }
+    }
+}
+
+void Tableau::getTableauRowCombination( const double *coefficients, TableauRow *row )
+{
+    _basisFactorization->untrackedBackwardTransformation( coefficients, _multipliers );
+    _multipliersIndicesValid = false;
+
+    computeTableauRowByColumns( row );
+
+    // The scalar of the combination is y * inv(B) * b
+    row->_scalar = 0;
+    if ( !_rhsIsAllZeros )
+    {
+        for ( unsigned i = 0; i < _m; ++i )
+            row->_scalar += _multipliers[i] * _b[i];
+    }
+}
+
+void Tableau::computeTableauRowByColumns( TableauRow *row ) const
+{
+    for ( unsigned i = 0; i < _n - _m; ++i )
+    {
+        row->_row[i]._var = _nonBasicIndexToVariable[i];
+        row->_row[i]._coefficient = 0;
+
+        SparseUnsortedList *column = _sparseColumnsOfA[_nonBasicIndexToVariable[i]];
+
+        for ( const auto &entry : *column )
+            row->_row[i]._coefficient -= ( _multipliers[entry._index] * entry._value );
+    }
 }
 
-const double *Tableau::getAColumn( unsigned variable ) const
+void Tableau::computeTableauRowByRows( TableauRow *row ) const
 {
-    return _denseA + ( variable * _m );
+    for ( unsigned i = 0; i < _n - _m; ++i )
+    {
+        row->_row[i]._var = _nonBasicIndexToVariable[i];
+        row->_row[i]._coefficient = 0;
+    }
+
+    for ( unsigned i = 0; i < _multipliersNnz; ++i )
+    {
+        unsigned rowIndex = _multipliersIndices[i];
+        double multiplier = _multipliers[rowIndex];
+        if ( multiplier == 0.0 )
+            continue;
+
+        for ( const auto &entry : *_sparseRowsOfA[rowIndex] )
+        {
+            // Skip the basic variables
+            unsigned nonBasicIndex = _variableToIndex[entry._index];
+            if ( nonBasicIndex >= _n - _m ||
+                 _nonBasicIndexToVariable[nonBasicIndex] != entry._index )
+                continue;
+
+            row->_row[nonBasicIndex]._coefficient -= ( multiplier * entry._value );
+        }
+    }
+}
+
+const SparseMatrix *Tableau::getSparseA() const
+{
+    return _A;
 }
 
 void Tableau::getSparseAColumn( unsigned variable, SparseUnsortedList *result ) const
@@ -1667,7 +2116,6 @@ void Tableau::storeState( TableauState &state, TableauStateStorageLevel level )
             _sparseColumnsOfA[i]->storeIntoOther( state._sparseColumnsOfA[i] );
         for ( unsigned i = 0; i < _m; ++i )
             _sparseRowsOfA[i]->storeIntoOther( state._sparseRowsOfA[i] );
-        memcpy( state._denseA, _denseA, sizeof( double ) * _m * _n );
 
         // Store right hand side vector _b
         memcpy( state._b, _b, sizeof( double ) * _m );
@@ -1734,7 +2182,6 @@ void Tableau::restoreState( const TableauState &state, TableauStateStorageLevel
             state._sparseColumnsOfA[i]->storeIntoOther( _sparseColumnsOfA[i] );
         for ( unsigned i = 0; i < _m; ++i )
             state._sparseRowsOfA[i]->storeIntoOther( _sparseRowsOfA[i] );
-        memcpy( _denseA, state._denseA, sizeof( double ) * _m * _n );
 
         // Restore right hand side vector _b
         memcpy( _b, state._b, sizeof( double ) * _m );
@@ -1756,6 +2203,7 @@ void Tableau::restoreState( const TableauState &state, TableauStateStorageLevel
 
         // Restore the basis factorization
         _basisFactorization->restoreFactorization( state._basisFactorization );
+        _transformedRightHandSideValid = false;
 
         // Restore the merged variables
         _mergedVariables = state._mergedVariables;
@@ -1876,13 +2324,11 @@ unsigned Tableau::addEquation( const Equation &equation )
         _workN[addend._variable] = addend._coefficient;
         _sparseColumnsOfA[addend._variable]->set( _m - 1, addend._coefficient );
         _sparseRowsOfA[_m - 1]->set( addend._variable, addend._coefficient );
-        _denseA[( addend._variable * _m ) + _m - 1] = addend._coefficient;
     }
 
     _workN[auxVariable] = 1;
     _sparseColumnsOfA[auxVariable]->set( _m - 1, 1 );
     _sparseRowsOfA[_m - 1]->set( auxVariable, 1 );
-    _denseA[( auxVariable * _m ) + _m - 1] = 1;
     _A->addLastRow( _workN );
 
     // Invalidate the cost function, so that it is recomputed in the next iteration.
@@ -1915,6 +2361,7 @@ unsigned Tableau::addEquation( const Equation &equation )
 
     // Populate the new row of b
     _b[_m - 1] = equation._scalar;
+    _transformedRightHandSideValid = false;
 
     if ( !FloatUtils::isZero( _b[_m - 1] ) )
         _rhsIsAllZeros = false;
@@ -2028,21 +2475,6 @@ void Tableau::addRow()
     delete[] _sparseRowsOfA;
     _sparseRowsOfA = newSparseRowsOfA;
 
-    // Allocate a larger _denseA, keep old entries
-    double *newDenseA = new double[newM * newN];
-    if ( !newDenseA )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newDenseA" );
-
-    for ( unsigned column = 0; column < _n; ++column )
-    {
-        memcpy( newDenseA + ( column * newM ), _denseA + ( column * _m ), sizeof( double ) * _m );
-        newDenseA[column * newM + newM - 1] = 0.0;
-    }
-    std::fill_n( newDenseA + ( newN - 1 ) * newM, newM, 0.0 );
-
-    delete[] _denseA;
-    _denseA = newDenseA;
-
     // Allocate a new changeColumn. Don't need to initialize
     double *newChangeColumn = new double[newM];
     if ( !newChangeColumn )
@@ -2050,6 +2482,13 @@ void Tableau::addRow()
     delete[] _changeColumn;
     _changeColumn = newChangeColumn;
 
+    unsigned *newChangeColumnIndices = new unsigned[newM];
+    if ( !newChangeColumnIndices )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newChangeColumnIndices" );
+    delete[] _changeColumnIndices;
+    _changeColumnIndices = newChangeColumnIndices;
+    _changeColumnIndicesValid = false;
+
     // Allocate a new b and copy the old values
     double *newB = new double[newM];
     if ( !newB )
@@ -2059,12 +2498,8 @@ void Tableau::addRow()
     delete[] _b;
     _b = newB;
 
-    // Allocate a new unit vector. Don't need to initialize
-    double *newUnitVector = new double[newM];
-    if ( !newUnitVector )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newUnitVector" );
-    delete[] _unitVector;
-    _unitVector = newUnitVector;
+    // Resize the unit vector
+    _sparseUnitVector->incrementSize();
 
     // Allocate new multipliers. Don't need to initialize
     double *newMultipliers = new double[newM];
@@ -2073,6 +2508,13 @@ void Tableau::addRow()
     delete[] _multipliers;
     _multipliers = newMultipliers;
 
+    unsigned *newMultipliersIndices = new unsigned[newM];
+    if ( !newMultipliersIndices )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED, "Tableau::newMultipliersIndices" );
+    delete[] _multipliersIndices;
+    _multipliersIndices = newMultipliersIndices;
+    _multipliersIndicesValid = false;
+
     // Allocate new index arrays. Copy old indices, but don't assign indices to new variables yet.
     unsigned *newBasicIndexToVariable = new unsigned[newM];
     if ( !newBasicIndexToVariable )
@@ -2128,6 +2570,14 @@ void Tableau::addRow()
     delete[] _workN;
     _workN = newWorkN;
 
+    double *newTransformedRightHandSide = new double[newM];
+    if ( !newTransformedRightHandSide )
+        throw MarabouError( MarabouError::ALLOCATION_FAILED,
+                            "Tableau::newTransformedRightHandSide" );
+    delete[] _transformedRightHandSide;
+    _transformedRightHandSide = newTransformedRightHandSide;
+    _transformedRightHandSideValid = false;
+
     _m = newM;
     _n = newN;
     _costFunctionManager->initialize();
@@ -2202,6 +2652,11 @@ void Tableau::backwardTransformation( const double *y, double *x ) const
     _basisFactorization->backwardTransformation( y, x );
 }
 
+void Tableau::untrackedBackwardTransformation( const double *y, double *x ) const
+{
+    _basisFactorization->untrackedBackwardTransformation( y, x );
+}
+
 double Tableau::getSumOfInfeasibilities() const
 {
     double result = 0;
@@ -2584,11 +3039,6 @@ void Tableau::mergeColumns( unsigned x1, unsigned x2 )
     for ( unsigned i = 0; i < _m; ++i )
         _sparseRowsOfA[i]->mergeEntries( x2, x1 );
 
-    // And the dense ones, too
-    for ( unsigned i = 0; i < _m; ++i )
-        _denseA[x1 * _m + i] += _denseA[x2 * _m + i];
-    std::fill_n( _denseA + x2 * _m, _m, 0 );
-
     computeAssignment();
     computeCostFunction();
 
@@ -2614,8 +3064,8 @@ bool Tableau::areLinearlyDependent( unsigned x1,
     unsigned nonBasic = oneIsBasic ? x2 : x1;
 
     // Find the column of the non-basic
-    const double *a = getAColumn( nonBasic );
-    _basisFactorization->forwardTransformation( a, _workM );
+    _sparseColumnsOfA[nonBasic]->toDense( _workN );
+    _basisFactorization->forwardTransformation( _workN, _workM );
 
     // Find the correct entry in the column
     unsigned basicIndex = _variableToIndex[basic];
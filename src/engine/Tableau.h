@@ -52,9 +52,11 @@ public:
     void setDimensions( unsigned m, unsigned n );
 
     /*
-      Initialize the constraint matrix
+      Initialize the constraint matrix, from a dense matrix or from its
+      m sparse rows. The matrix is only stored in sparse form.
     */
     void setConstraintMatrix( const double *A );
+    void setConstraintMatrix( const SparseUnsortedList **rows );
 
     /*
       Set which variable will enter the basis. The input is the
@@ -87,6 +89,13 @@ public:
     void forwardTransformation( const double *y, double *x ) const;
     void backwardTransformation( const double *y, double *x ) const;
 
+    /*
+      A backward transformation that is not part of the simplex
+      iterations, and so does not affect the decision of when to
+      refactorize the basis.
+    */
+    void untrackedBackwardTransformation( const double *y, double *x ) const;
+
     /*
       Mark a variable as basic in the initial basis
      */
@@ -258,6 +267,36 @@ public:
      */
     void performDegeneratePivot();
 
+    /*
+      The steps of the dual simplex, which restores the feasibility of
+      the basic variables while keeping the current basis as a
+      starting point (e.g., after a case split):
+
+      pickDualLeavingVariable() picks the basic variable with the
+      largest bound violation as the leaving variable. Returns false
+      if all basic variables are within bounds.
+
+      pickDualEnteringVariable() performs the bound-flipping ratio
+      test over the pivot row of the leaving variable, which requires
+      computePivotRow() to have been called. Among the non-basics that
+      can move the leaving variable towards its violated bound, it
+      prefers those that can close the violation without leaving their
+      own bounds, and then the largest coefficient (above the pivot
+      threshold). If the entering variable cannot close the violation
+      by itself, other non-basics are flipped to their opposite bounds
+      first. The change column is computed, and the pivot is only
+      accepted if it reduces the sum of infeasibilities. Returns false
+      if no acceptable pivot exists.
+
+      performDualPivot() flips the selected non-basics, moves the
+      entering variable until the leaving variable reaches its
+      violated bound, and switches the two. It must directly follow a
+      successful pickDualEnteringVariable().
+    */
+    bool pickDualLeavingVariable();
+    bool pickDualEnteringVariable();
+    void performDualPivot();
+
     /*
       Calculate the ratio constraint for the entering variable
       imposed by a basic variable.
@@ -297,8 +336,10 @@ public:
 
     /*
       Compute the multipliers for a given list of row coefficient.
+      The sparse version uses a hypersparse backward transformation.
     */
     void computeMultipliers( double *rowCoefficients );
+    void computeMultipliers( const SparseUnsortedList &rowCoefficients );
 
     /*
       Access the cost function.
@@ -335,11 +376,25 @@ public:
     void getTableauRow( unsigned index, TableauRow *row );
 
     /*
-      Get the original constraint matrix A or a column thereof,
-      in dense form.
+      Add to result (indexed by non-basic indices) the combination of the
+      rows of the tableau with the given coefficients (indexed by basic
+      indices).
+    */
+    void addTableauRowCombination( const SparseUnsortedList &coefficients, double *result );
+
+    /*
+      Store in row the combination of the rows of the tableau with the given
+      coefficients (indexed by basic indices), including its scalar. This is
+      used to analyze infeasible subproblems, so the refactorization policy
+      does not take its transformation into account.
+    */
+    void getTableauRowCombination( const double *coefficients, TableauRow *row );
+
+    /*
+      Get the original constraint matrix A or a row or column thereof,
+      in sparse form.
     */
     const SparseMatrix *getSparseA() const;
-    const double *getAColumn( unsigned variable ) const;
     void getSparseAColumn( unsigned variable, SparseUnsortedList *result ) const;
     void getSparseARow( unsigned row, SparseUnsortedList *result ) const;
     const SparseUnsortedList *getSparseAColumn( unsigned variable ) const;
@@ -516,18 +571,22 @@ private:
 
     /*
       The constraint matrix A, and a collection of its
-      sparse columns. The matrix is also stored in dense
-      form (column-major).
+      sparse columns and rows.
     */
     SparseMatrix *_A;
     SparseUnsortedList **_sparseColumnsOfA;
     SparseUnsortedList **_sparseRowsOfA;
-    double *_denseA;
 
     /*
-      Used to compute inv(B)*a
+      Used to compute inv(B)*a. When the change column is computed by a
+      hypersparse forward transformation, its possibly non-zero entries
+      are listed in _changeColumnIndices, so that they can be cleared
+      before the next transformation without touching all m entries.
     */
     double *_changeColumn;
+    unsigned *_changeColumnIndices;
+    unsigned _changeColumnNnz;
+    bool _changeColumnIndicesValid;
 
     /*
       Used to store the pivot row
@@ -546,9 +605,9 @@ private:
     double *_workN;
 
     /*
-      A unit vector of size m
+      A unit vector of size m, stored sparsely
     */
-    double *_unitVector;
+    SparseUnsortedList *_sparseUnitVector;
 
     /*
       The current factorization of the basis
@@ -556,9 +615,13 @@ private:
     IBasisFactorization *_basisFactorization;
 
     /*
-      The multiplier vector
+      The multiplier vector, and the list of its possibly non-zero
+      entries (valid when computed by a hypersparse transformation)
     */
     double *_multipliers;
+    unsigned *_multipliersIndices;
+    unsigned _multipliersNnz;
+    bool _multipliersIndicesValid;
 
     /*
       Mapping between basic variables and indices (length m)
@@ -616,6 +679,12 @@ private:
     */
     bool _leavingVariableIncreases;
 
+    /*
+      The non-basic variables (by index) that the dual ratio test has
+      chosen to flip, and the bounds they are flipped to
+    */
+    Map<unsigned, double> _boundFlips;
+
     /*
       The status of the basic assignment
     */
@@ -644,6 +713,14 @@ private:
      */
     bool _rhsIsAllZeros;
 
+    /*
+      inv(B) * b, which gives the scalars of the rows of the tableau when
+      the rhs vector is not all zeros. It is computed on demand, and
+      remains valid until the basis or b change.
+    */
+    double *_transformedRightHandSide;
+    bool _transformedRightHandSideValid;
+
     /*
       True if and only if we are using the native Simplex implementation for
       LP solving.
@@ -662,12 +739,54 @@ private:
     */
     void addRow();
 
+    /*
+      Compute the sparse columns of A from its sparse rows.
+    */
+    void initializeSparseColumnsOfA();
+
     /*
       Update the variable assignment to reflect a pivot operation,
       without re-computing it from scratch.
      */
     void updateAssignmentForPivot();
 
+    /*
+      The bound that a non-basic variable moves towards in the dual
+      ratio test, in order to move the leaving variable towards its
+      violated bound, given its coefficient in the pivot row
+    */
+    double dualRatioTestBound( unsigned nonBasic, double coefficient ) const;
+
+    /*
+      For a dual pivot: compute the change in the basic assignment
+      caused by the bound flips (stored in _workN), and the change
+      ratio of the entering variable
+    */
+    void computeDualPivotStep();
+
+    /*
+      The amount by which a value violates the bounds of a variable
+    */
+    double boundViolation( unsigned variable, double value ) const;
+
+    /*
+      Compute the coefficients of a row of the tableau from the current
+      multipliers, either by a dot product with each non-basic column of
+      A, or by walking the rows of A that match the non-zero multipliers.
+    */
+    void computeTableauRowByColumns( TableauRow *row ) const;
+    void computeTableauRowByRows( TableauRow *row ) const;
+
+    /*
+      Zero out a vector of size m before a hypersparse transformation
+      writes into it: only the listed entries if the list is valid, or
+      the entire vector otherwise.
+    */
+    void clearSparseVector( double *vector,
+                            const unsigned *indices,
+                            unsigned nnz,
+                            bool indicesValid ) const;
+
     /*
       Ratio tests for determining the leaving variable
     */
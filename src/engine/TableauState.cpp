@@ -24,7 +24,6 @@ TableauState::TableauState()
     : _A( NULL )
     , _sparseColumnsOfA( NULL )
     , _sparseRowsOfA( NULL )
-    , _denseA( NULL )
     , _b( NULL )
     , _lowerBounds( NULL )
     , _upperBounds( NULL )
@@ -75,12 +74,6 @@ TableauState::~TableauState()
         _sparseRowsOfA = NULL;
     }
 
-    if ( _denseA )
-    {
-        delete[] _denseA;
-        _denseA = NULL;
-    }
-
     if ( _b )
     {
         delete[] _b;
@@ -170,10 +163,6 @@ void TableauState::setDimensions( unsigned m,
             throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::sparseRowsOfA[i]" );
     }
 
-    _denseA = new double[m * n];
-    if ( !_denseA )
-        throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::denseA" );
-
     _b = new double[m];
     if ( !_b )
         throw MarabouError( MarabouError::ALLOCATION_FAILED, "TableauState::b" );
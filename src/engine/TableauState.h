@@ -62,7 +62,6 @@ public:
     SparseMatrix *_A;
     SparseUnsortedList **_sparseColumnsOfA;
     SparseUnsortedList **_sparseRowsOfA;
-    double *_denseA;
 
     /*
       The right hand side
@@ -0,0 +1,139 @@
+/*********************                                                        */
+/*! \file WorkerQueue.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "WorkerQueue.h"
+
+#include "Debug.h"
+
+WorkerQueue::WorkerQueue( unsigned numberOfWorkers )
+    : _deques( numberOfWorkers > 0 ? numberOfWorkers : 1 )
+    , _size( 0 )
+    , _interrupted( false )
+{
+}
+
+WorkerQueue::~WorkerQueue()
+{
+}
+
+bool WorkerQueue::push( SubQuery *subQuery, unsigned workerId )
+{
+    WorkerDeque &deque = _deques[workerId % _deques.size()];
+    {
+        std::lock_guard<std::mutex> lock( deque._mutex );
+        deque._subQueries.push_back( subQuery );
+    }
+
+    {
+        std::lock_guard<std::mutex> lock( _mutex );
+        ++_size;
+    }
+    _condition.notify_one();
+
+    return true;
+}
+
+bool WorkerQueue::pop( SubQuery *&subQuery, unsigned workerId )
+{
+    workerId %= _deques.size();
+    return popFromOwnDeque( subQuery, workerId ) || stealFromOtherDeque( subQuery, workerId );
+}
+
+bool WorkerQueue::popFromOwnDeque( SubQuery *&subQuery, unsigned workerId )
+{
+    WorkerDeque &deque = _deques[workerId];
+    std::lock_guard<std::mutex> lock( deque._mutex );
+    if ( deque._subQueries.empty() )
+        return false;
+
+    // The most recently created subquery is the most likely to share
+    // state with the one the worker just solved
+    subQuery = deque._subQueries.back();
+    deque._subQueries.pop_back();
+    --_size;
+    return true;
+}
+
+bool WorkerQueue::stealFromOtherDeque( SubQuery *&subQuery, unsigned workerId )
+{
+    unsigned numberOfDeques = _deques.size();
+    for ( unsigned i = 1; i < numberOfDeques; ++i )
+    {
+        WorkerDeque &deque = _deques[( workerId + i ) % numberOfDeques];
+        std::lock_guard<std::mutex> lock( deque._mutex );
+        if ( deque._subQueries.empty() )
+            continue;
+
+        // Steal the oldest subquery, which is typically the largest
+        subQuery = deque._subQueries.front();
+        deque._subQueries.pop_front();
+        --_size;
+        return true;
+    }
+
+    return false;
+}
+
+bool WorkerQueue::waitAndPop( SubQuery *&subQuery, unsigned workerId )
+{
+    while ( true )
+    {
+        if ( pop( subQuery, workerId ) )
+            return true;
+
+        std::unique_lock<std::mutex> lock( _mutex );
+        _condition.wait( lock, [this] { return _interrupted || _size.load() > 0; } );
+        if ( _interrupted && _size.load() == 0 )
+            return false;
+    }
+}
+
+void WorkerQueue::interrupt()
+{
+    {
+        std::lock_guard<std::mutex> lock( _mutex );
+        _interrupted = true;
+    }
+    _condition.notify_all();
+}
+
+bool WorkerQueue::waitForInterrupt( std::chrono::microseconds timeout )
+{
+    std::unique_lock<std::mutex> lock( _mutex );
+    return _condition.wait_for( lock, timeout, [this] { return _interrupted; } );
+}
+
+bool WorkerQueue::empty() const
+{
+    return _size.load() == 0;
+}
+
+unsigned WorkerQueue::size() const
+{
+    return _size.load();
+}
+
+unsigned WorkerQueue::getNumberOfWorkers() const
+{
+    return _deques.size();
+}
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,114 @@
+/*********************                                                        */
+/*! \file WorkerQueue.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** A work-stealing queue of subqueries, shared by the DnC workers.
+ ** Each worker owns a deque: it pushes and pops the subqueries it
+ ** creates at the back of its own deque, and when that deque is empty
+ ** it steals from the front of the other workers' deques. Idle workers
+ ** block on a condition variable instead of polling.
+
+**/
+
+#ifndef __WorkerQueue_h__
+#define __WorkerQueue_h__
+
+#include "SubQuery.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+class WorkerQueue
+{
+public:
+    /*
+      Create a queue with one deque per worker. A queue created with
+      zero workers has a single deque.
+    */
+    WorkerQueue( unsigned numberOfWorkers );
+
+    /*
+      The queue does not own the subqueries it holds: they must be
+      popped and deleted by the caller.
+    */
+    ~WorkerQueue();
+
+    /*
+      Push a subquery onto the back of the deque of the given worker,
+      and wake up one idle worker. Return true if the push succeeded.
+    */
+    bool push( SubQuery *subQuery, unsigned workerId = 0 );
+
+    /*
+      Pop a subquery without blocking: first from the back of the
+      worker's own deque, and if it is empty, steal from the front of
+      the other deques. Return false if all deques are empty.
+    */
+    bool pop( SubQuery *&subQuery, unsigned workerId = 0 );
+
+    /*
+      Pop a subquery, blocking until one becomes available or until
+      the queue is interrupted. Return false if interrupted with no
+      subquery available.
+    */
+    bool waitAndPop( SubQuery *&subQuery, unsigned workerId );
+
+    /*
+      Wake up all blocked workers and make all future waits return
+      immediately. Called when the solving should stop.
+    */
+    void interrupt();
+
+    /*
+      Block until the queue is interrupted or the timeout elapses.
+      Return true if the queue was interrupted.
+    */
+    bool waitForInterrupt( std::chrono::microseconds timeout );
+
+    bool empty() const;
+    unsigned size() const;
+    unsigned getNumberOfWorkers() const;
+
+private:
+    struct WorkerDeque
+    {
+        std::mutex _mutex;
+        std::deque<SubQuery *> _subQueries;
+    };
+
+    std::vector<WorkerDeque> _deques;
+
+    /*
+      The total number of queued subqueries. Increments and the
+      interrupt flag are updated under _mutex, so that blocked workers
+      never miss a wakeup.
+    */
+    std::atomic_uint _size;
+    bool _interrupted;
+    std::mutex _mutex;
+    std::condition_variable _condition;
+
+    bool popFromOwnDeque( SubQuery *&subQuery, unsigned workerId );
+    bool stealFromOtherDeque( SubQuery *&subQuery, unsigned workerId );
+};
+
+#endif // __WorkerQueue_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -139,6 +139,10 @@ public:
     {
     }
 
+    void setStatistics( Statistics * /* statistics */ )
+    {
+    }
+
     const SparseUnsortedList *createRowOfCostFunction() const
     {
         return NULL;
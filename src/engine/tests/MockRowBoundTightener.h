@@ -27,6 +27,7 @@ public:
         wasDiscarded = false;
 
         setDimensionsWasCalled = false;
+        resetExaminedBoundsWasCalled = false;
     }
 
     ~MockRowBoundTightener()
@@ -61,6 +62,12 @@ public:
     {
     }
 
+    bool resetExaminedBoundsWasCalled;
+    void resetExaminedBounds()
+    {
+        resetExaminedBoundsWasCalled = true;
+    }
+
     void clear()
     {
     }
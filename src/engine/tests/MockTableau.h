@@ -152,6 +152,17 @@ public:
         memcpy( lastEntries, A, sizeof( double ) * lastM * lastN );
     }
 
+    void setConstraintMatrix( const SparseUnsortedList **rows )
+    {
+        TS_ASSERT( setDimensionsCalled );
+        std::fill_n( lastEntries, lastM * lastN, 0 );
+        for ( unsigned i = 0; i < lastM; ++i )
+        {
+            for ( const auto &entry : *rows[i] )
+                lastEntries[i * lastN + entry._index] = entry._value;
+        }
+    }
+
     double *lastRightHandSide;
     void setRightHandSide( const double *b )
     {
@@ -487,14 +498,24 @@ public:
         row->_scalar = nextRow->_scalar;
     }
 
-    Map<unsigned, const double *> nextAColumn;
-    const double *getAColumn( unsigned index ) const
+    Map<unsigned, double> lastRowCombinationCoefficients;
+    Map<unsigned, double> nextRowCombination;
+    void addTableauRowCombination( const SparseUnsortedList &coefficients, double *result )
+    {
+        lastRowCombinationCoefficients.clear();
+        for ( const auto &entry : coefficients )
+            lastRowCombinationCoefficients[entry._index] = entry._value;
+
+        for ( const auto &entry : nextRowCombination )
+            result[entry.first] += entry.second;
+    }
+
+    void getTableauRowCombination( const double * /* coefficients */, TableauRow * /* row */ )
     {
-        TS_ASSERT( nextAColumn.exists( index ) );
-        TS_ASSERT( nextAColumn.get( index ) );
-        return nextAColumn.get( index );
     }
 
+    Map<unsigned, const double *> nextAColumn;
+
     void getSparseAColumn( unsigned index, SparseUnsortedList *result ) const
     {
         TS_ASSERT( nextAColumn.exists( index ) );
@@ -509,6 +530,17 @@ public:
     mutable SparseUnsortedList sparseColumn;
     const SparseUnsortedList *getSparseAColumn( unsigned index ) const
     {
+        if ( !nextAColumn.exists( index ) )
+        {
+            // Fall back to the column of the dense constraint matrix
+            double *temp = new double[lastM];
+            for ( unsigned i = 0; i < lastM; ++i )
+                temp[i] = A[i * lastN + index];
+            sparseColumn.initialize( temp, lastM );
+            delete[] temp;
+            return &sparseColumn;
+        }
+
         TS_ASSERT( nextAColumn.get( index ) );
         sparseColumn.initialize( nextAColumn.get( index ), lastM );
         return &sparseColumn;
@@ -545,6 +577,20 @@ public:
     {
     }
 
+    bool pickDualLeavingVariable()
+    {
+        return false;
+    }
+
+    bool pickDualEnteringVariable()
+    {
+        return false;
+    }
+
+    void performDualPivot()
+    {
+    }
+
     void storeState( TableauState & /* state */, TableauStateStorageLevel /*level*/ ) const
     {
     }
@@ -632,6 +678,11 @@ public:
         memcpy( output, nextBtranOutput, lastM * sizeof( double ) );
     }
 
+    void untrackedBackwardTransformation( const double *input, double *output ) const
+    {
+        backwardTransformation( input, output );
+    }
+
     double getSumOfInfeasibilities() const
     {
         return 0;
@@ -1634,16 +1634,20 @@ public:
         context.push();
         abs.notifyUpperBound( b, -1 );
         TS_ASSERT_EQUALS( abs.getPhaseStatus(), ABS_PHASE_NEGATIVE );
+        TS_ASSERT( abs.phaseFixed() );
 
         context.pop();
         TS_ASSERT_EQUALS( abs.getPhaseStatus(), PHASE_NOT_FIXED );
+        TS_ASSERT( !abs.phaseFixed() );
         context.push();
 
         abs.notifyLowerBound( b, 1 );
         TS_ASSERT_EQUALS( abs.getPhaseStatus(), ABS_PHASE_POSITIVE );
+        TS_ASSERT( abs.phaseFixed() );
 
         context.pop();
         TS_ASSERT_EQUALS( abs.getPhaseStatus(), PHASE_NOT_FIXED );
+        TS_ASSERT( !abs.phaseFixed() );
     }
 
     void test_get_cost_function_component()
@@ -18,6 +18,7 @@
 #include "MarabouError.h"
 #include "MockErrno.h"
 #include "MockTableau.h"
+#include "TableauRow.h"
 
 #include <cxxtest/TestSuite.h>
 #include <string.h>
@@ -258,6 +259,175 @@ public:
 
         TS_ASSERT_THROWS_NOTHING( delete manager );
     }
+
+    void test_given_cost_function_is_updated_incrementally()
+    {
+        CostFunctionManager *manager = NULL;
+        MockTableau tableau;
+
+        unsigned n = 5;
+        unsigned m = 3;
+        tableau.setDimensions( m, n );
+
+        TS_ASSERT( manager = new CostFunctionManager( &tableau ) );
+        TS_ASSERT_THROWS_NOTHING( manager->initialize() );
+
+        double multipliers[3] = { 0, 2, -3 };
+        memcpy( tableau.nextBtranOutput, multipliers, sizeof( double ) * 3 );
+        tableau.nextNonBasicIndexToVariable[0] = 4;
+        tableau.nextNonBasicIndexToVariable[1] = 3;
+        double columnFour[] = { 1, -1, 2 };
+        double columnThree[] = { 3, 1, 0 };
+        tableau.nextAColumn[4] = columnFour;
+        tableau.nextAColumn[3] = columnThree;
+
+        // Variable 2 is basic #0, variable 3 is non-basic #1
+        Map<unsigned, double> heuristicCost;
+        tableau.nextVariableToIndex[2] = 0;
+        tableau.nextIsBasic.insert( 2 );
+        heuristicCost[2] = 1;
+        tableau.nextVariableToIndex[3] = 1;
+        heuristicCost[3] = 4;
+
+        tableau.toggleOptimization( true );
+        TS_ASSERT_THROWS_NOTHING( manager->computeGivenCostFunction( heuristicCost ) );
+        TS_ASSERT( manager->costFunctionJustComputed() );
+
+        const double *costFunction = manager->getCostFunction();
+        TS_ASSERT_EQUALS( costFunction[0], -( 0 - 2 - 6 ) );
+        TS_ASSERT_EQUALS( costFunction[1], -( 0 + 2 + 0 ) + 4 );
+        TS_ASSERT_EQUALS( manager->getBasicCost( 0 ), 1 );
+
+        // The same cost again: nothing changes
+        TS_ASSERT_THROWS_NOTHING( manager->computeGivenCostFunction( heuristicCost ) );
+        TS_ASSERT( manager->costFunctionJustComputed() );
+
+        // Change the cost of the basic variable and of the non-basic variable. Only the row
+        // of basic #0 is needed to update the cost function.
+        heuristicCost[2] = 3;
+        heuristicCost[3] = 5;
+        tableau.nextRowCombination[0] = 10;
+        tableau.nextRowCombination[1] = 20;
+
+        TS_ASSERT_THROWS_NOTHING( manager->computeGivenCostFunction( heuristicCost ) );
+        TS_ASSERT_EQUALS( manager->getCostFunctionStatus(),
+                          ICostFunctionManager::COST_FUNCTION_UPDATED );
+        TS_ASSERT_EQUALS( tableau.lastRowCombinationCoefficients.size(), 1U );
+        TS_ASSERT_EQUALS( tableau.lastRowCombinationCoefficients[0], 2 );
+
+        TS_ASSERT_EQUALS( costFunction[0], 8 + 10 );
+        TS_ASSERT_EQUALS( costFunction[1], 2 + 1 + 20 );
+        TS_ASSERT_EQUALS( manager->getBasicCost( 0 ), 3 );
+
+        // Pivot: variable 3 enters, variable 2 leaves. The pivot row is x2 = 2x3 - x4, and the
+        // change column is consistent with it.
+        TableauRow pivotRow( 2 );
+        pivotRow._row[0] = TableauRow::Entry( 4, -1 );
+        pivotRow._row[1] = TableauRow::Entry( 3, 2 );
+        double changeColumn[] = { -2, 1, 0 };
+
+        // The reduced cost of the entering variable is its cost minus basicCosts * changeColumn
+        TS_ASSERT_THROWS_NOTHING( manager->updateCostFunctionForPivot(
+            1, 0, 2, &pivotRow, changeColumn ) );
+        TS_ASSERT_EQUALS( costFunction[1], ( 5 + 6 ) / 2.0 );
+        TS_ASSERT_EQUALS( costFunction[0], 18 + ( 5 + 6 ) / 2.0 );
+
+        // The entering variable brings its own cost into the basis
+        TS_ASSERT_EQUALS( manager->getBasicCost( 0 ), 5 );
+
+        // After the pivot, variable 3 is basic #0 and variable 2 is non-basic #1
+        tableau.nextIsBasic.erase( 2 );
+        tableau.nextIsBasic.insert( 3 );
+        tableau.nextVariableToIndex[2] = 1;
+        tableau.nextVariableToIndex[3] = 0;
+        tableau.nextRowCombination.clear();
+
+        heuristicCost[2] = 4;
+        TS_ASSERT_THROWS_NOTHING( manager->computeGivenCostFunction( heuristicCost ) );
+        TS_ASSERT_EQUALS( costFunction[1], ( 5 + 6 ) / 2.0 + 1 );
+        TS_ASSERT_EQUALS( manager->getBasicCost( 0 ), 5 );
+
+        TS_ASSERT_THROWS_NOTHING( delete manager );
+    }
+
+    void test_adjust_basic_cost_accuracy()
+    {
+        CostFunctionManager *manager = NULL;
+        MockTableau tableau;
+
+        // Enough basic variables for a few basic cost changes to be handled incrementally
+        unsigned m = 40;
+        unsigned n = m + 2;
+        tableau.setDimensions( m, n );
+
+        TS_ASSERT( manager = new CostFunctionManager( &tableau ) );
+        TS_ASSERT_THROWS_NOTHING( manager->initialize() );
+
+        std::fill_n( tableau.nextBtranOutput, m, 0 );
+        tableau.nextBtranOutput[0] = 1;
+        double *columnZero = new double[m];
+        double *columnOne = new double[m];
+        std::fill_n( columnZero, m, 0 );
+        std::fill_n( columnOne, m, 0 );
+        columnZero[0] = 2;
+        columnOne[0] = -1;
+        tableau.nextNonBasicIndexToVariable[0] = 0;
+        tableau.nextNonBasicIndexToVariable[1] = 1;
+        tableau.nextAColumn[0] = columnZero;
+        tableau.nextAColumn[1] = columnOne;
+
+        for ( unsigned i = 0; i < m; ++i )
+        {
+            tableau.nextBasicIndexToVariable[i] = i + 2;
+            tableau.lowerBounds[i + 2] = 0;
+            tableau.upperBounds[i + 2] = 1;
+            tableau.nextValues[i + 2] = 0.5;
+        }
+
+        // Basic #0 is too high
+        tableau.nextValues[2] = 3;
+
+        TS_ASSERT_THROWS_NOTHING( manager->computeCoreCostFunction() );
+        TS_ASSERT( manager->costFunctionJustComputed() );
+        TS_ASSERT_EQUALS( tableau.lastBtranInput[0], 1 );
+
+        const double *costFunction = manager->getCostFunction();
+        TS_ASSERT_EQUALS( costFunction[0], -2 );
+        TS_ASSERT_EQUALS( costFunction[1], 1 );
+
+        // Nothing changed
+        TS_ASSERT_THROWS_NOTHING( manager->adjustBasicCostAccuracy() );
+        TS_ASSERT( manager->costFunctionJustComputed() );
+
+        // Basic #0 is now within bounds, and basic #1 is too low
+        tableau.nextValues[2] = 0.5;
+        tableau.nextValues[3] = -1;
+        tableau.nextRowCombination[0] = 5;
+
+        TS_ASSERT_THROWS_NOTHING( manager->adjustBasicCostAccuracy() );
+        TS_ASSERT_EQUALS( manager->getCostFunctionStatus(),
+                          ICostFunctionManager::COST_FUNCTION_UPDATED );
+        TS_ASSERT_EQUALS( tableau.lastRowCombinationCoefficients.size(), 2U );
+        TS_ASSERT_EQUALS( tableau.lastRowCombinationCoefficients[0], -1 );
+        TS_ASSERT_EQUALS( tableau.lastRowCombinationCoefficients[1], -1 );
+        TS_ASSERT_EQUALS( costFunction[0], -2 + 5 );
+        TS_ASSERT_EQUALS( costFunction[1], 1 );
+        TS_ASSERT_EQUALS( manager->getBasicCost( 0 ), 0 );
+        TS_ASSERT_EQUALS( manager->getBasicCost( 1 ), -1 );
+
+        // Many basic variables are suddenly too high: the cost function is recomputed
+        for ( unsigned i = 0; i < m; ++i )
+            tableau.nextValues[i + 2] = 2;
+
+        TS_ASSERT_THROWS_NOTHING( manager->adjustBasicCostAccuracy() );
+        TS_ASSERT( manager->costFunctionJustComputed() );
+        for ( unsigned i = 0; i < m; ++i )
+            TS_ASSERT_EQUALS( tableau.lastBtranInput[i], 1 );
+
+        TS_ASSERT_THROWS_NOTHING( delete manager );
+        delete[] columnZero;
+        delete[] columnOne;
+    }
 };
 
 //
@@ -879,16 +879,20 @@ public:
 
         lrelu.notifyLowerBound( f, 1 );
         TS_ASSERT_EQUALS( lrelu.getPhaseStatus(), RELU_PHASE_ACTIVE );
+        TS_ASSERT( lrelu.phaseFixed() );
 
         context.pop();
         TS_ASSERT_EQUALS( lrelu.getPhaseStatus(), PHASE_NOT_FIXED );
+        TS_ASSERT( !lrelu.phaseFixed() );
 
         context.push();
         lrelu.notifyUpperBound( b, -1 );
         TS_ASSERT_EQUALS( lrelu.getPhaseStatus(), RELU_PHASE_INACTIVE );
+        TS_ASSERT( lrelu.phaseFixed() );
 
         context.pop();
         TS_ASSERT_EQUALS( lrelu.getPhaseStatus(), PHASE_NOT_FIXED );
+        TS_ASSERT( !lrelu.phaseFixed() );
     }
 
     /*
@@ -0,0 +1,288 @@
+/*********************                                                        */
+/*! \file Test_NativeLPSolver.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "FloatUtils.h"
+#include "MarabouError.h"
+#include "NativeLPSolver.h"
+
+#include <cxxtest/TestSuite.h>
+
+class NativeLPSolverTestSuite : public CxxTest::TestSuite
+{
+public:
+    typedef ILPSolver::Term Term;
+
+    /*
+      max x + y
+      s.t. x + 2y <= 4
+           3x + y <= 6
+           0 <= x, y <= 10
+
+      The optimum is at x = 1.6, y = 1.2, with objective 2.8
+    */
+    void createSimpleModel( NativeLPSolver &solver )
+    {
+        solver.addVariable( "x", 0, 10 );
+        solver.addVariable( "y", 0, 10 );
+
+        List<Term> terms;
+        terms.append( Term( 1, "x" ) );
+        terms.append( Term( 2, "y" ) );
+        solver.addLeqConstraint( terms, 4 );
+
+        terms.clear();
+        terms.append( Term( 3, "x" ) );
+        terms.append( Term( 1, "y" ) );
+        solver.addLeqConstraint( terms, 6 );
+
+        terms.clear();
+        terms.append( Term( 1, "x" ) );
+        terms.append( Term( 1, "y" ) );
+        solver.setObjective( terms );
+    }
+
+    void test_maximize()
+    {
+        NativeLPSolver solver;
+        createSimpleModel( solver );
+
+        TS_ASSERT_THROWS_NOTHING( solver.solve() );
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( solver.haveFeasibleSolution() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getObjectiveBound(), 2.8 ) );
+
+        Map<String, double> solution;
+        double objective;
+        solver.extractSolution( solution, objective );
+        TS_ASSERT( FloatUtils::areEqual( objective, 2.8 ) );
+        TS_ASSERT( FloatUtils::areEqual( solution["x"], 1.6 ) );
+        TS_ASSERT( FloatUtils::areEqual( solution["y"], 1.2 ) );
+    }
+
+    void test_minimize_with_negative_bounds()
+    {
+        NativeLPSolver solver;
+        solver.addVariable( "x", -5, 5 );
+        solver.addVariable( "y", -5, 5 );
+
+        // x - y >= -2
+        List<Term> terms;
+        terms.append( Term( 1, "x" ) );
+        terms.append( Term( -1, "y" ) );
+        solver.addGeqConstraint( terms, -2 );
+
+        // min x + y + 1
+        terms.clear();
+        terms.append( Term( 1, "x" ) );
+        terms.append( Term( 1, "y" ) );
+        solver.setCost( terms, 1 );
+
+        solver.solve();
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getObjectiveBound(), -9 ) );
+        TS_ASSERT( FloatUtils::areEqual( solver.getAssignment( "x" ), -5 ) );
+        TS_ASSERT( FloatUtils::areEqual( solver.getAssignment( "y" ), -5 ) );
+    }
+
+    void test_equality_constraint()
+    {
+        NativeLPSolver solver;
+        solver.addVariable( "x", 0, 10 );
+        solver.addVariable( "y", 0, 10 );
+        solver.addVariable( "z", -10, 10 );
+
+        // z = x - 2y
+        List<Term> terms;
+        terms.append( Term( 1, "z" ) );
+        terms.append( Term( -1, "x" ) );
+        terms.append( Term( 2, "y" ) );
+        solver.addEqConstraint( terms, 0 );
+
+        // x + y = 3
+        terms.clear();
+        terms.append( Term( 1, "x" ) );
+        terms.append( Term( 1, "y" ) );
+        solver.addEqConstraint( terms, 3 );
+
+        terms.clear();
+        terms.append( Term( 1, "z" ) );
+        solver.setObjective( terms );
+        solver.solve();
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getObjectiveBound(), 3 ) );
+
+        solver.setCost( terms );
+        solver.solve();
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getObjectiveBound(), -6 ) );
+    }
+
+    void test_infeasible()
+    {
+        NativeLPSolver solver;
+        solver.addVariable( "x", 0, 1 );
+        solver.addVariable( "y", 0, 1 );
+
+        // x + y >= 3
+        List<Term> terms;
+        terms.append( Term( 1, "x" ) );
+        terms.append( Term( 1, "y" ) );
+        solver.addGeqConstraint( terms, 3 );
+        solver.setObjective( terms );
+
+        solver.solve();
+        TS_ASSERT( solver.infeasible() );
+        TS_ASSERT( !solver.optimal() );
+        TS_ASSERT( !solver.haveFeasibleSolution() );
+    }
+
+    void test_warm_start_after_bound_change()
+    {
+        NativeLPSolver solver;
+        createSimpleModel( solver );
+
+        solver.solve();
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getObjectiveBound(), 2.8 ) );
+
+        // Tighten x, so that the second constraint is no longer binding
+        solver.setUpperBound( "x", 1 );
+        solver.reset();
+        solver.solve();
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getObjectiveBound(), 2.5 ) );
+
+        // Make the model infeasible and then feasible again
+        solver.setLowerBound( "y", 3 );
+        solver.reset();
+        solver.solve();
+        TS_ASSERT( solver.infeasible() );
+
+        solver.setLowerBound( "y", 0 );
+        solver.setUpperBound( "x", 10 );
+        solver.reset();
+        solver.solve();
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getObjectiveBound(), 2.8 ) );
+    }
+
+    void test_incremental_constraints()
+    {
+        NativeLPSolver solver;
+        createSimpleModel( solver );
+
+        solver.solve();
+        TS_ASSERT( FloatUtils::areEqual( solver.getObjectiveBound(), 2.8 ) );
+
+        // x + y <= 2
+        List<Term> terms;
+        terms.append( Term( 1, "x" ) );
+        terms.append( Term( 1, "y" ) );
+        solver.addLeqConstraint( terms, 2 );
+
+        solver.solve();
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getObjectiveBound(), 2 ) );
+
+        // A new variable w = x - y, maximized
+        solver.addVariable( "w", -10, 10 );
+        terms.clear();
+        terms.append( Term( 1, "w" ) );
+        terms.append( Term( -1, "x" ) );
+        terms.append( Term( 1, "y" ) );
+        solver.addEqConstraint( terms, 0 );
+
+        terms.clear();
+        terms.append( Term( 1, "w" ) );
+        solver.setObjective( terms );
+        solver.solve();
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getObjectiveBound(), 2 ) );
+    }
+
+    void test_reset_model_reuses_basis()
+    {
+        NativeLPSolver solver;
+        createSimpleModel( solver );
+        solver.solve();
+        TS_ASSERT( solver.optimal() );
+        unsigned coldIterations = solver.getNumberOfSimplexIterations();
+        TS_ASSERT( coldIterations > 0 );
+
+        // Re-creating the same model starts from the optimal basis
+        solver.resetModel();
+        TS_ASSERT( !solver.containsVariable( "x" ) );
+        createSimpleModel( solver );
+        TS_ASSERT( solver.containsVariable( "x" ) );
+        solver.solve();
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getObjectiveBound(), 2.8 ) );
+        TS_ASSERT_EQUALS( solver.getNumberOfSimplexIterations(), 0U );
+
+        // A model with a different shape is solved from scratch
+        solver.resetModel();
+        solver.addVariable( "a", 0, 1 );
+        solver.addVariable( "b", 0, 1 );
+        List<Term> terms;
+        terms.append( Term( 1, "a" ) );
+        terms.append( Term( -1, "b" ) );
+        solver.addEqConstraint( terms, 0 );
+        terms.clear();
+        terms.append( Term( 1, "a" ) );
+        solver.addLeqConstraint( terms, 0.5 );
+        terms.clear();
+        terms.append( Term( 1, "b" ) );
+        solver.setObjective( terms );
+        solver.solve();
+        TS_ASSERT( solver.optimal() );
+        TS_ASSERT( FloatUtils::areEqual( solver.getObjectiveBound(), 0.5 ) );
+    }
+
+    void test_cutoff()
+    {
+        NativeLPSolver solver;
+        createSimpleModel( solver );
+
+        // The optimum, 2.8, is worse than the cutoff
+        solver.setCutoff( 3 );
+        solver.solve();
+        TS_ASSERT( solver.cutoffOccurred() );
+        TS_ASSERT( !solver.optimal() );
+
+        solver.setCutoff( 2 );
+        solver.reset();
+        solver.solve();
+        TS_ASSERT( !solver.cutoffOccurred() );
+        TS_ASSERT( solver.optimal() );
+    }
+
+    void test_unknown_variable()
+    {
+        NativeLPSolver solver;
+        solver.addVariable( "x", 0, 1 );
+        TS_ASSERT_THROWS_EQUALS( solver.setUpperBound( "y", 1 ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::VARIABLE_DOESNT_EXIST_IN_SOLUTION );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -0,0 +1,177 @@
+/*********************                                                        */
+/*! \file Test_PricingManager.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Guy Katz
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "BlandsRule.h"
+#include "DantzigsRule.h"
+#include "GlobalConfiguration.h"
+#include "MockTableau.h"
+#include "PricingManager.h"
+
+#include <cxxtest/TestSuite.h>
+
+class MockForPricingManager
+{
+public:
+};
+
+class PricingManagerTestSuite : public CxxTest::TestSuite
+{
+public:
+    MockForPricingManager *mock;
+    MockTableau *tableau;
+
+    void setUp()
+    {
+        TS_ASSERT( mock = new MockForPricingManager );
+        TS_ASSERT( tableau = new MockTableau );
+    }
+
+    void tearDown()
+    {
+        TS_ASSERT_THROWS_NOTHING( delete tableau );
+        TS_ASSERT_THROWS_NOTHING( delete mock );
+    }
+
+    void makeCandidates( unsigned numberOfNonBasics )
+    {
+        // Every non-basic variable is eligible, and later ones have larger costs
+        tableau->mockCandidates.clear();
+        for ( unsigned i = 0; i < numberOfNonBasics; ++i )
+        {
+            tableau->mockCandidates.append( i );
+            tableau->nextCostFunction[i] = ( i % 2 == 0 ) ? -(double)( i + 1 ) : i + 1;
+        }
+    }
+
+    void test_all_candidates_for_blands_rule()
+    {
+        PricingManager pricingManager;
+        BlandsRule blandsRule;
+
+        tableau->setDimensions( 10, 110 );
+        makeCandidates( 100 );
+        tableau->mockCandidates.erase( 7 );
+
+        List<unsigned> candidates;
+        pricingManager.getEntryCandidates( *tableau, blandsRule, candidates );
+        TS_ASSERT_EQUALS( candidates.size(), 99U );
+        TS_ASSERT( !candidates.exists( 7 ) );
+        TS_ASSERT_EQUALS( pricingManager.getPoolSize(), 0U );
+    }
+
+    void test_partial_and_multiple_pricing()
+    {
+        PricingManager pricingManager;
+        DantzigsRule dantzigsRule;
+
+        unsigned numberOfNonBasics = 100;
+        unsigned numberOfSections = GlobalConfiguration::PARTIAL_PRICING_NUMBER_OF_SECTIONS;
+        unsigned poolSize = GlobalConfiguration::MULTIPLE_PRICING_NUMBER_OF_CANDIDATES;
+        unsigned sectionSize = numberOfNonBasics / numberOfSections;
+
+        tableau->setDimensions( 10, 10 + numberOfNonBasics );
+        makeCandidates( numberOfNonBasics );
+        pricingManager.initialize( *tableau );
+
+        // The first section has enough candidates, and the best ones of it are kept
+        List<unsigned> candidates;
+        pricingManager.getEntryCandidates( *tableau, dantzigsRule, candidates );
+        TS_ASSERT_EQUALS( candidates.size(), poolSize );
+        TS_ASSERT_EQUALS( pricingManager.getNextSection(), 1U % numberOfSections );
+        for ( unsigned i = sectionSize - poolSize; i < sectionSize; ++i )
+            TS_ASSERT( candidates.exists( i ) );
+
+        // The candidates are reused, except for those that are no longer eligible
+        tableau->mockCandidates.erase( sectionSize - 1 );
+        pricingManager.getEntryCandidates( *tableau, dantzigsRule, candidates );
+        TS_ASSERT_EQUALS( candidates.size(), poolSize - 1 );
+        TS_ASSERT( !candidates.exists( sectionSize - 1 ) );
+        TS_ASSERT_EQUALS( pricingManager.getNextSection(), 1U % numberOfSections );
+
+        // Once the scores of the kept candidates decay, the next section is scanned
+        for ( unsigned i = sectionSize - poolSize; i < sectionSize; ++i )
+            tableau->nextCostFunction[i] = 0.001;
+        pricingManager.getEntryCandidates( *tableau, dantzigsRule, candidates );
+        TS_ASSERT_EQUALS( candidates.size(), poolSize );
+        TS_ASSERT_EQUALS( pricingManager.getNextSection(), 2U % numberOfSections );
+        for ( unsigned i = 2 * sectionSize - poolSize; i < 2 * sectionSize; ++i )
+            TS_ASSERT( candidates.exists( i ) );
+
+        // Dantzig's rule picks the best of the candidates
+        Set<unsigned> excluded;
+        TS_ASSERT( dantzigsRule.select( *tableau, candidates, excluded ) );
+        TS_ASSERT_EQUALS( tableau->mockEnteringVariable, 2 * sectionSize - 1 );
+    }
+
+    void test_sections_are_scanned_until_candidates_are_found()
+    {
+        PricingManager pricingManager;
+        DantzigsRule dantzigsRule;
+
+        tableau->setDimensions( 10, 110 );
+        makeCandidates( 100 );
+        pricingManager.initialize( *tableau );
+
+        // A single eligible candidate, in the last section
+        tableau->mockCandidates.clear();
+        tableau->mockCandidates.append( 98 );
+
+        List<unsigned> candidates;
+        pricingManager.getEntryCandidates( *tableau, dantzigsRule, candidates );
+        TS_ASSERT_EQUALS( candidates.size(), 1U );
+        TS_ASSERT_EQUALS( *candidates.begin(), 98U );
+
+        // No eligible candidates at all
+        tableau->mockCandidates.clear();
+        pricingManager.getEntryCandidates( *tableau, dantzigsRule, candidates );
+        TS_ASSERT( candidates.empty() );
+        TS_ASSERT_EQUALS( pricingManager.getPoolSize(), 0U );
+
+        // Candidates are found again after the pool is invalidated
+        tableau->mockCandidates.append( 3 );
+        pricingManager.invalidate();
+        pricingManager.getEntryCandidates( *tableau, dantzigsRule, candidates );
+        TS_ASSERT_EQUALS( candidates.size(), 1U );
+        TS_ASSERT_EQUALS( *candidates.begin(), 3U );
+    }
+
+    void test_resize()
+    {
+        PricingManager pricingManager;
+        DantzigsRule dantzigsRule;
+
+        tableau->setDimensions( 10, 110 );
+        makeCandidates( 100 );
+        pricingManager.initialize( *tableau );
+
+        List<unsigned> candidates;
+        pricingManager.getEntryCandidates( *tableau, dantzigsRule, candidates );
+        TS_ASSERT( !candidates.empty() );
+
+        // A change in the number of non-basic variables resets the pool and the sections
+        tableau->setBoundDimension( 13 );
+        makeCandidates( 3 );
+        pricingManager.getEntryCandidates( *tableau, dantzigsRule, candidates );
+        TS_ASSERT_EQUALS( candidates.size(), 3U );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
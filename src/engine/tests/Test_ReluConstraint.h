@@ -1349,16 +1349,42 @@ public:
 
         relu.notifyLowerBound( f, 1 );
         TS_ASSERT_EQUALS( relu.getPhaseStatus(), RELU_PHASE_ACTIVE );
+        TS_ASSERT( relu.phaseFixed() );
 
         context.pop();
         TS_ASSERT_EQUALS( relu.getPhaseStatus(), PHASE_NOT_FIXED );
+        TS_ASSERT( !relu.phaseFixed() );
 
         context.push();
         relu.notifyUpperBound( b, -1 );
         TS_ASSERT_EQUALS( relu.getPhaseStatus(), RELU_PHASE_INACTIVE );
+        TS_ASSERT( relu.phaseFixed() );
 
         context.pop();
         TS_ASSERT_EQUALS( relu.getPhaseStatus(), PHASE_NOT_FIXED );
+        TS_ASSERT( !relu.phaseFixed() );
+    }
+
+    void test_search_state_is_context_dependent()
+    {
+        Context context;
+        BoundManager boundManager( context );
+        boundManager.initialize( 5 );
+
+        ReluConstraint relu( 1, 4 );
+        TS_ASSERT( !relu.searchStateIsContextDependent() );
+
+        relu.initializeCDOs( &context );
+        TS_ASSERT( !relu.searchStateIsContextDependent() );
+
+        // The bounds must also be kept in a context-dependent manner
+        relu.registerBoundManager( &boundManager );
+        TS_ASSERT( relu.searchStateIsContextDependent() );
+
+        // The duplicated state is context dependent as well
+        PiecewiseLinearConstraint *duplicate = relu.duplicateConstraint();
+        TS_ASSERT( duplicate->searchStateIsContextDependent() );
+        TS_ASSERT_THROWS_NOTHING( delete duplicate );
     }
 
     /*
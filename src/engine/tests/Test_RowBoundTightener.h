@@ -16,6 +16,7 @@
 #include "GlobalConfiguration.h"
 #include "MockTableau.h"
 #include "RowBoundTightener.h"
+#include "Statistics.h"
 
 #include <cxxtest/TestSuite.h>
 
@@ -418,4 +419,211 @@ public:
                                       Tightening( 2U, 2.0, Tightening::UB ) ),
                            tightenings.end() );
     }
+
+    void test_examine_constraint_matrix_only_rows_with_changed_bounds()
+    {
+        RowBoundTightener tightener( *tableau );
+        Statistics statistics;
+        tightener.setStatistics( &statistics );
+
+        tableau->setDimensions( 2, 5 );
+        tightener.setBoundsPointers( tableau->getBoundManager().getLowerBounds(),
+                                     tableau->getBoundManager().getUpperBounds() );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 0, -10 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 0, 10 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 1, -10 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 1, 10 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 2, 0 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 2, 1 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 3, -10 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 3, 10 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 4, -10 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 4, 10 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tightener.setDimensions() );
+
+        /*
+           Equations:
+                x0 - x1            = 0
+                     x1 - x2       = 0
+
+           The second equation gives us that x1 is in [0, 1], and then
+           the first one gives us the same for x0.
+        */
+        double A[] = {
+            1, -1, 0, 0, 0, //
+            0, 1, -1, 0, 0, //
+        };
+        double b[] = { 0, 0 };
+
+        tableau->A = A;
+        tableau->b = b;
+
+        const IBoundManager &boundManager = tableau->getBoundManager();
+
+        List<Tightening> dontCare;
+        TS_ASSERT_THROWS_NOTHING( tightener.getRowTightenings( dontCare ) );
+
+        // A single pass examines both rows, and learns the bounds of x1
+        TS_ASSERT_THROWS_NOTHING( tightener.examineConstraintMatrix( false ) );
+        TS_ASSERT_EQUALS(
+            statistics.getLongAttribute( Statistics::NUM_CONSTRAINT_MATRIX_ROWS_EXAMINED ), 2U );
+        TS_ASSERT_EQUALS( boundManager.getLowerBound( 1 ), 0 );
+        TS_ASSERT_EQUALS( boundManager.getUpperBound( 1 ), 1 );
+        TS_ASSERT_EQUALS( boundManager.getUpperBound( 0 ), 10 );
+
+        // The first row, which contains x1, is still queued
+        TS_ASSERT_THROWS_NOTHING( tightener.examineConstraintMatrix( true ) );
+        TS_ASSERT_EQUALS( boundManager.getLowerBound( 0 ), 0 );
+        TS_ASSERT_EQUALS( boundManager.getUpperBound( 0 ), 1 );
+
+        // Nothing changed, so there is nothing to examine
+        unsigned long long rowsExamined =
+            statistics.getLongAttribute( Statistics::NUM_CONSTRAINT_MATRIX_ROWS_EXAMINED );
+        TS_ASSERT_THROWS_NOTHING( tightener.examineConstraintMatrix( true ) );
+        TS_ASSERT_EQUALS(
+            statistics.getLongAttribute( Statistics::NUM_CONSTRAINT_MATRIX_ROWS_EXAMINED ),
+            rowsExamined );
+
+        /*
+          A bound that changed elsewhere queues the second row. Tightening
+          x1 then queues both rows, and tightening x0 the first one again.
+        */
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 2, 0.5 ) );
+        TS_ASSERT_THROWS_NOTHING( tightener.examineConstraintMatrix( true ) );
+        TS_ASSERT_EQUALS( boundManager.getUpperBound( 1 ), 0.5 );
+        TS_ASSERT_EQUALS( boundManager.getUpperBound( 0 ), 0.5 );
+        TS_ASSERT_EQUALS(
+            statistics.getLongAttribute( Statistics::NUM_CONSTRAINT_MATRIX_ROWS_EXAMINED ),
+            rowsExamined + 4 );
+
+        // After a reset, e.g. when backtracking, all rows are examined again
+        TS_ASSERT_THROWS_NOTHING( tightener.resetExaminedBounds() );
+        TS_ASSERT_THROWS_NOTHING( tightener.examineConstraintMatrix( true ) );
+        TS_ASSERT_EQUALS(
+            statistics.getLongAttribute( Statistics::NUM_CONSTRAINT_MATRIX_ROWS_EXAMINED ),
+            rowsExamined + 6 );
+    }
+
+    void test_examine_constraint_matrix_infinite_bounds()
+    {
+        RowBoundTightener tightener( *tableau );
+
+        tableau->setDimensions( 1, 3 );
+        tightener.setBoundsPointers( tableau->getBoundManager().getLowerBounds(),
+                                     tableau->getBoundManager().getUpperBounds() );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 0, FloatUtils::negativeInfinity() ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 0, FloatUtils::infinity() ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 1, 0 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 1, 1 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 2, FloatUtils::negativeInfinity() ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 2, 1 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tightener.setDimensions() );
+
+        /*
+           Equation:
+                x0 + x1 - x2 = 0
+
+           Since x0 = x2 - x1, we get that x0 <= 1. Nothing else can be
+           learned, because x0 and x2 are unbounded from below.
+        */
+        double A[] = { 1, 1, -1 };
+        double b[] = { 0 };
+
+        tableau->A = A;
+        tableau->b = b;
+
+        List<Tightening> dontCare;
+        TS_ASSERT_THROWS_NOTHING( tightener.getRowTightenings( dontCare ) );
+
+        TS_ASSERT_THROWS_NOTHING( tightener.examineConstraintMatrix( true ) );
+
+        List<Tightening> tightenings;
+        TS_ASSERT_THROWS_NOTHING( tightener.getRowTightenings( tightenings ) );
+        TS_ASSERT_EQUALS( tightenings.size(), 1U );
+        TS_ASSERT_EQUALS( *tightenings.begin(), Tightening( 0U, 1.0, Tightening::UB ) );
+    }
+
+    void test_examine_inverted_basis_matrix_reuses_rows()
+    {
+        if ( GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_TYPE !=
+             GlobalConfiguration::COMPUTE_INVERTED_BASIS_MATRIX )
+            return;
+
+        RowBoundTightener tightener( *tableau );
+        Statistics statistics;
+        tightener.setStatistics( &statistics );
+
+        tableau->setDimensions( 1, 3 );
+        tightener.setBoundsPointers( tableau->getBoundManager().getLowerBounds(),
+                                     tableau->getBoundManager().getUpperBounds() );
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 0, 0 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 0, 1 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 1, 0 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 1, 2 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( 2, -10 ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 2, 10 ) );
+
+        TS_ASSERT_THROWS_NOTHING( tightener.setDimensions() );
+
+        /*
+           Equation:
+                x0 + x1 - x2 = 0
+
+           With x2 basic, inv(B) = -1 and the row is x2 = x0 + x1, which
+           gives us that x2 is in [0, 3].
+        */
+        double A[] = { 1, 1, -1 };
+        double b[] = { 0 };
+
+        tableau->A = A;
+        tableau->b = b;
+        tableau->nextBtranOutput[0] = -1;
+
+        tableau->nextBasicIndexToVariable[0] = 2;
+        tableau->nextNonBasicIndexToVariable[0] = 0;
+        tableau->nextNonBasicIndexToVariable[1] = 1;
+        tableau->nextIsBasic.insert( 2 );
+        tableau->nextVariableToIndex[0] = 0;
+        tableau->nextVariableToIndex[1] = 1;
+        tableau->nextVariableToIndex[2] = 0;
+
+        const IBoundManager &boundManager = tableau->getBoundManager();
+        double roundingConstant =
+            GlobalConfiguration::EXPLICIT_BASIS_BOUND_TIGHTENING_ROUNDING_CONSTANT;
+
+        TS_ASSERT_THROWS_NOTHING( tightener.examineInvertedBasisMatrix( false ) );
+        TS_ASSERT_EQUALS( tableau->lastBtranInput[0], 1 );
+        TS_ASSERT( FloatUtils::areEqual( boundManager.getLowerBound( 2 ), -roundingConstant ) );
+        TS_ASSERT( FloatUtils::areEqual( boundManager.getUpperBound( 2 ), 3 + roundingConstant ) );
+        TS_ASSERT_EQUALS(
+            statistics.getLongAttribute( Statistics::NUM_INVERTED_BASIS_ROWS_COMPUTED ), 1U );
+
+        // The basis did not change, so the row is not computed again
+        TS_ASSERT_THROWS_NOTHING( tightener.examineInvertedBasisMatrix( false ) );
+        TS_ASSERT_EQUALS(
+            statistics.getLongAttribute( Statistics::NUM_INVERTED_BASIS_ROWS_COMPUTED ), 1U );
+
+        /*
+          After x0 enters the basis and x2 leaves it, inv(B) = 1 and the
+          row is x0 = -x1 + x2.
+        */
+        tableau->nextBtranOutput[0] = 1;
+        tableau->nextBasicIndexToVariable[0] = 0;
+        tableau->nextNonBasicIndexToVariable[0] = 2;
+        tableau->nextIsBasic.clear();
+        tableau->nextIsBasic.insert( 0 );
+        tableau->nextVariableToIndex[0] = 0;
+        tableau->nextVariableToIndex[2] = 0;
+
+        TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( 2, 1 ) );
+        TS_ASSERT_THROWS_NOTHING( tightener.examineInvertedBasisMatrix( false ) );
+        TS_ASSERT_EQUALS(
+            statistics.getLongAttribute( Statistics::NUM_INVERTED_BASIS_ROWS_COMPUTED ), 2U );
+        TS_ASSERT( FloatUtils::areEqual( boundManager.getUpperBound( 1 ), 1 + roundingConstant ) );
+    }
 };
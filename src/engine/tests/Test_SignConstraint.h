@@ -1104,16 +1104,20 @@ public:
         context.push();
         sign.notifyUpperBound( b, -1 );
         TS_ASSERT_EQUALS( sign.getPhaseStatus(), SIGN_PHASE_NEGATIVE );
+        TS_ASSERT( sign.phaseFixed() );
 
         context.pop();
         TS_ASSERT_EQUALS( sign.getPhaseStatus(), PHASE_NOT_FIXED );
+        TS_ASSERT( !sign.phaseFixed() );
         context.push();
 
         sign.notifyLowerBound( b, 3 );
         TS_ASSERT_EQUALS( sign.getPhaseStatus(), SIGN_PHASE_POSITIVE );
+        TS_ASSERT( sign.phaseFixed() );
 
         context.pop();
         TS_ASSERT_EQUALS( sign.getPhaseStatus(), PHASE_NOT_FIXED );
+        TS_ASSERT( !sign.phaseFixed() );
     }
 
     void test_get_cost_function_component()
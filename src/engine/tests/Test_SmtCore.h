@@ -13,6 +13,8 @@
 
  **/
 
+#include "BoundManager.h"
+#include "InfeasibleQueryException.h"
 #include "MockEngine.h"
 #include "MockErrno.h"
 #include "Options.h"
@@ -561,6 +563,85 @@ public:
         TS_ASSERT_THROWS_NOTHING( smtCore.popSplit() );
     }
 
+    void splitOnInactivePhase( SmtCore &smtCore, ReluConstraint &relu, BoundManager &boundManager )
+    {
+        for ( unsigned i = 0;
+              i < (unsigned)Options::get()->getInt( Options::CONSTRAINT_VIOLATION_THRESHOLD );
+              ++i )
+            smtCore.reportViolatedConstraint( &relu );
+
+        // Without an assignment, the inactive phase is tried first
+        TS_ASSERT_THROWS_NOTHING( smtCore.performSplit() );
+        boundManager.setUpperBound( relu.getB(), 0 );
+        relu.notifyUpperBound( relu.getB(), 0 );
+        TS_ASSERT_EQUALS( relu.getPhaseStatus(), RELU_PHASE_INACTIVE );
+    }
+
+    void test_backjump_and_learned_clauses()
+    {
+        Context &context = engine->getContext();
+        Query inputQuery;
+        inputQuery.setNumberOfVariables( 6 );
+
+        ReluConstraint relu1( 0, 1 );
+        ReluConstraint relu2( 2, 3 );
+        ReluConstraint relu3( 4, 5 );
+
+        BoundManager boundManager( context );
+        boundManager.initialize( 9 );
+        for ( ReluConstraint *relu : { &relu1, &relu2, &relu3 } )
+        {
+            relu->transformToUseAuxVariables( inputQuery );
+            relu->initializeCDOs( &context );
+            relu->registerBoundManager( &boundManager );
+        }
+
+        Statistics statistics;
+        SmtCore smtCore( engine );
+        smtCore.setStatistics( &statistics );
+
+        splitOnInactivePhase( smtCore, relu1, boundManager );
+        splitOnInactivePhase( smtCore, relu2, boundManager );
+        splitOnInactivePhase( smtCore, relu3, boundManager );
+        TS_ASSERT_EQUALS( smtCore.getStackDepth(), 3U );
+
+        // The conflict only depends on the first two splits: the third one is
+        // discarded along with its alternative
+        TS_ASSERT_THROWS_NOTHING( smtCore.backjump( 2 ) );
+        TS_ASSERT_EQUALS( smtCore.getStackDepth(), 2U );
+        TS_ASSERT_EQUALS( smtCore.getNumberOfLearnedClauses(), 1U );
+        TS_ASSERT_EQUALS( statistics.getUnsignedAttribute( Statistics::NUM_BACKJUMPS ), 1U );
+        TS_ASSERT_EQUALS(
+            statistics.getUnsignedAttribute( Statistics::NUM_LEVELS_SKIPPED_BY_BACKJUMPS ), 1U );
+
+        // Backtracking the second split restores relu3 and applies the other
+        // phase of relu2
+        TS_ASSERT( smtCore.popSplit() );
+        TS_ASSERT_EQUALS( smtCore.getStackDepth(), 2U );
+        TS_ASSERT( !relu3.phaseFixed() );
+        TS_ASSERT( relu3.isActive() );
+        TS_ASSERT( !relu2.phaseFixed() );
+
+        // The learned clause implies nothing while relu2 is not inactive
+        engine->lastLowerBounds.clear();
+        engine->lastUpperBounds.clear();
+        TS_ASSERT( !smtCore.propagateLearnedClauses() );
+        TS_ASSERT( engine->lastLowerBounds.empty() );
+        TS_ASSERT( engine->lastUpperBounds.empty() );
+
+        // ... but relu2 turning inactive again violates it
+        boundManager.setUpperBound( 2, 0 );
+        relu2.notifyUpperBound( 2, 0 );
+        TS_ASSERT_THROWS( smtCore.propagateLearnedClauses(), InfeasibleQueryException );
+
+        // A conflict at the current level is not a backjump, and the current
+        // phases no longer match the decisions on the stack
+        TS_ASSERT_THROWS_NOTHING( smtCore.backjump( 2 ) );
+        TS_ASSERT_EQUALS( smtCore.getStackDepth(), 2U );
+        TS_ASSERT_EQUALS( smtCore.getNumberOfLearnedClauses(), 1U );
+        TS_ASSERT_EQUALS( statistics.getUnsignedAttribute( Statistics::NUM_BACKJUMPS ), 1U );
+    }
+
     void clearSmtState( SmtState &smtState )
     {
         for ( const auto &stackEntry : smtState._stack )
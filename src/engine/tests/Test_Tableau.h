@@ -127,6 +127,77 @@ public:
         TS_ASSERT_THROWS_NOTHING( delete tableau );
     }
 
+    void test_set_constraint_matrix_from_sparse_rows()
+    {
+        Context context;
+        BoundManager boundManager( context );
+        TS_ASSERT_THROWS_NOTHING( boundManager.initialize( 7 ) );
+
+        Tableau *dense = NULL;
+        TS_ASSERT( dense = new Tableau( boundManager ) );
+        TS_ASSERT_THROWS_NOTHING( dense->setDimensions( 3, 7 ) );
+        initializeTableauValues( *dense );
+
+        // The same matrix as in initializeTableauValues(), given as unsorted sparse rows
+        double A[] = {
+            3, 2, 1, 2, 1, 0, 0, //
+            1, 1, 1, 1, 0, 1, 0, //
+            4, 3, 3, 4, 0, 0, 1, //
+        };
+
+        SparseUnsortedList *rows[3];
+        for ( unsigned i = 0; i < 3; ++i )
+        {
+            rows[i] = new SparseUnsortedList( 7 );
+            for ( unsigned j = 7; j-- > 0; )
+            {
+                if ( A[i * 7 + j] != 0 )
+                    rows[i]->append( j, A[i * 7 + j] );
+            }
+        }
+
+        Tableau *sparse = NULL;
+        TS_ASSERT( sparse = new Tableau( boundManager ) );
+        TS_ASSERT_THROWS_NOTHING( sparse->setDimensions( 3, 7 ) );
+        TS_ASSERT_THROWS_NOTHING(
+            sparse->setConstraintMatrix( (const SparseUnsortedList **)rows ) );
+
+        double denseEntries[7];
+        double sparseEntries[7];
+        for ( unsigned i = 0; i < 3; ++i )
+        {
+            for ( unsigned j = 0; j < 7; ++j )
+                TS_ASSERT_EQUALS( sparse->getSparseA()->get( i, j ), A[i * 7 + j] );
+
+            dense->getSparseARow( i )->toDense( denseEntries );
+            sparse->getSparseARow( i )->toDense( sparseEntries );
+            for ( unsigned j = 0; j < 7; ++j )
+                TS_ASSERT_EQUALS( sparseEntries[j], denseEntries[j] );
+        }
+
+        // The columns are ordered by row, as when initialized from a dense matrix
+        for ( unsigned j = 0; j < 7; ++j )
+        {
+            const SparseUnsortedList *denseColumn = dense->getSparseAColumn( j );
+            const SparseUnsortedList *sparseColumn = sparse->getSparseAColumn( j );
+            TS_ASSERT_EQUALS( sparseColumn->getNnz(), denseColumn->getNnz() );
+
+            auto it = denseColumn->begin();
+            for ( const auto &entry : *sparseColumn )
+            {
+                TS_ASSERT_EQUALS( entry._index, it->_index );
+                TS_ASSERT_EQUALS( entry._value, it->_value );
+                ++it;
+            }
+        }
+
+        for ( unsigned i = 0; i < 3; ++i )
+            delete rows[i];
+
+        TS_ASSERT_THROWS_NOTHING( delete sparse );
+        TS_ASSERT_THROWS_NOTHING( delete dense );
+    }
+
     void test_initalize_basis_get_value()
     {
         Tableau *tableau = NULL;
@@ -752,6 +823,236 @@ public:
         TS_ASSERT_THROWS_NOTHING( delete tableau );
     }
 
+    void checkTableauRows( Tableau &tableau, unsigned m, unsigned n )
+    {
+        TableauRow row( n - m );
+        for ( unsigned i = 0; i < m; ++i )
+        {
+            TS_ASSERT_THROWS_NOTHING( tableau.getTableauRow( i, &row ) );
+
+            double value = row._scalar;
+            for ( unsigned j = 0; j < n - m; ++j )
+                value += row._row[j]._coefficient * tableau.getValue( row._row[j]._var );
+
+            TS_ASSERT( FloatUtils::areEqual( value, tableau.getValue( row._lhs ) ) );
+        }
+    }
+
+    void test_get_row_sparse()
+    {
+        /*
+          A larger, sparse tableau with a non-zero right hand side. The
+          multipliers of each row are sparse, so the rows are computed by
+          walking the rows of A. Every row must agree with the current
+          assignment, also after pivots.
+        */
+        const unsigned m = 20;
+        const unsigned n = 60;
+
+        Tableau *tableau = NULL;
+        MockCostFunctionManager costFunctionManager;
+        Context context;
+        BoundManager boundManager( context );
+
+        TS_ASSERT_THROWS_NOTHING( boundManager.initialize( n ) );
+        TS_ASSERT( tableau = new Tableau( boundManager ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setDimensions( m, n ) );
+        tableau->registerCostFunctionManager( &costFunctionManager );
+
+        double A[m * n];
+        std::fill_n( A, m * n, 0 );
+        double b[m];
+        for ( unsigned i = 0; i < m; ++i )
+        {
+            A[i * n + ( 3 * i ) % ( n - m )] = 1 + i % 3;
+            A[i * n + ( 7 * i + 5 ) % ( n - m )] = -1;
+            A[i * n + n - m + i] = 1;
+            b[i] = i + 1;
+        }
+        tableau->setConstraintMatrix( A );
+        tableau->setRightHandSide( b );
+
+        List<unsigned> basics;
+        for ( unsigned i = 0; i < n; ++i )
+        {
+            TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( i, i < n - m ? 1 : -1000 ) );
+            TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( i, i < n - m ? 10 : 1000 ) );
+            if ( i >= n - m )
+            {
+                tableau->assignIndexToBasicVariable( i, i - ( n - m ) );
+                basics.append( i );
+            }
+        }
+
+        TS_ASSERT_THROWS_NOTHING( tableau->initializeTableau( basics ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->computeCostFunction() );
+
+        checkTableauRows( *tableau, m, n );
+
+        // Bring structural variables into the basis, one at a time
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            unsigned leaving = 5 * i;
+            unsigned entering = tableau->variableToIndex( ( 3 * leaving ) % ( n - m ) );
+
+            tableau->setEnteringVariableIndex( entering );
+            tableau->setLeavingVariableIndex( leaving );
+            TS_ASSERT_THROWS_NOTHING( tableau->computeChangeColumn() );
+            TS_ASSERT_THROWS_NOTHING( tableau->computePivotRow() );
+            TS_ASSERT_THROWS_NOTHING( tableau->performDegeneratePivot() );
+
+            checkTableauRows( *tableau, m, n );
+        }
+
+        TS_ASSERT_THROWS_NOTHING( delete tableau );
+    }
+
+    void test_dual_pivot_with_bound_flips()
+    {
+        /*
+          x0 + x1 + 10 x2 - x3 = 0, with x3 basic. The non-basics start
+          at their lower bounds, so x3 = 0 < 2.5. No single non-basic
+          can bring x3 to 2.5 within its bounds: x2 (the largest
+          coefficient) enters, after x0 and x1 are flipped to their
+          upper bounds.
+        */
+        Tableau *tableau = NULL;
+        MockCostFunctionManager costFunctionManager;
+        Context context;
+        BoundManager boundManager( context );
+
+        TS_ASSERT_THROWS_NOTHING( boundManager.initialize( 4 ) );
+        TS_ASSERT( tableau = new Tableau( boundManager ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setDimensions( 1, 4 ) );
+        tableau->registerCostFunctionManager( &costFunctionManager );
+
+        double A[] = { 1, 1, 10, -1 };
+        double b[] = { 0 };
+        tableau->setConstraintMatrix( A );
+        tableau->setRightHandSide( b );
+
+        tableau->setLowerBound( 0, 0 );
+        tableau->setUpperBound( 0, 1 );
+        tableau->setLowerBound( 1, 0 );
+        tableau->setUpperBound( 1, 1 );
+        tableau->setLowerBound( 2, 0 );
+        tableau->setUpperBound( 2, 0.1 );
+        tableau->setLowerBound( 3, 2.5 );
+        tableau->setUpperBound( 3, 100 );
+
+        List<unsigned> basics = { 3 };
+        tableau->assignIndexToBasicVariable( 3, 0 );
+        TS_ASSERT_THROWS_NOTHING( tableau->initializeTableau( basics ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 3 ), 0 ) );
+
+        TS_ASSERT( tableau->pickDualLeavingVariable() );
+        TS_ASSERT_EQUALS( tableau->getLeavingVariable(), 3u );
+        TS_ASSERT_THROWS_NOTHING( tableau->computePivotRow() );
+        TS_ASSERT( tableau->pickDualEnteringVariable() );
+        TS_ASSERT_EQUALS( tableau->getEnteringVariable(), 2u );
+        TS_ASSERT_THROWS_NOTHING( tableau->performDualPivot() );
+
+        TS_ASSERT( tableau->isBasic( 2 ) );
+        TS_ASSERT( !tableau->isBasic( 3 ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 0 ), 1 ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 1 ), 1 ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 2 ), 0.05 ) );
+        TS_ASSERT( FloatUtils::areEqual( tableau->getValue( 3 ), 2.5 ) );
+        TS_ASSERT( !tableau->existsBasicOutOfBounds() );
+
+        // Nothing left to fix
+        TS_ASSERT( !tableau->pickDualLeavingVariable() );
+
+        TS_ASSERT_THROWS_NOTHING( delete tableau );
+    }
+
+    void test_dual_simplex()
+    {
+        /*
+          A sparse tableau with tight bounds on the basic slacks. Every
+          dual pivot must reduce the sum of infeasibilities and keep the
+          assignment consistent, with the leaving variable at the bound
+          that it violated. The rows are independent, so the dual
+          simplex reaches a feasible assignment.
+        */
+        const unsigned m = 20;
+        const unsigned n = 60;
+
+        Tableau *tableau = NULL;
+        MockCostFunctionManager costFunctionManager;
+        Context context;
+        BoundManager boundManager( context );
+
+        TS_ASSERT_THROWS_NOTHING( boundManager.initialize( n ) );
+        TS_ASSERT( tableau = new Tableau( boundManager ) );
+        TS_ASSERT_THROWS_NOTHING( tableau->setDimensions( m, n ) );
+        tableau->registerCostFunctionManager( &costFunctionManager );
+
+        double A[m * n];
+        std::fill_n( A, m * n, 0 );
+        double b[m];
+        for ( unsigned i = 0; i < m; ++i )
+        {
+            A[i * n + i] = 1 + i % 3;
+            A[i * n + m + i] = -1;
+            A[i * n + n - m + i] = 1;
+            b[i] = i + 1;
+        }
+        tableau->setConstraintMatrix( A );
+        tableau->setRightHandSide( b );
+
+        List<unsigned> basics;
+        for ( unsigned i = 0; i < n; ++i )
+        {
+            TS_ASSERT_THROWS_NOTHING( tableau->setLowerBound( i, i < n - m ? 1 : -2 ) );
+            TS_ASSERT_THROWS_NOTHING( tableau->setUpperBound( i, i < n - m ? 100 : 2 ) );
+            if ( i >= n - m )
+            {
+                tableau->assignIndexToBasicVariable( i, i - ( n - m ) );
+                basics.append( i );
+            }
+        }
+
+        TS_ASSERT_THROWS_NOTHING( tableau->initializeTableau( basics ) );
+        TS_ASSERT( tableau->existsBasicOutOfBounds() );
+
+        unsigned pivots = 0;
+        double sumOfInfeasibilities = tableau->getSumOfInfeasibilities();
+        while ( tableau->pickDualLeavingVariable() && pivots < 2 * m )
+        {
+            unsigned leaving = tableau->getLeavingVariable();
+            double bound = tableau->basicTooLow( tableau->getLeavingVariableIndex() )
+                             ? tableau->getLowerBound( leaving )
+                             : tableau->getUpperBound( leaving );
+
+            TS_ASSERT_THROWS_NOTHING( tableau->computePivotRow() );
+            if ( !tableau->pickDualEnteringVariable() )
+                break;
+            TS_ASSERT_THROWS_NOTHING( tableau->performDualPivot() );
+            ++pivots;
+
+            TS_ASSERT( !tableau->isBasic( leaving ) );
+            TS_ASSERT( FloatUtils::areEqual( tableau->getValue( leaving ), bound ) );
+            TS_ASSERT( FloatUtils::lt( tableau->getSumOfInfeasibilities(), sumOfInfeasibilities ) );
+            sumOfInfeasibilities = tableau->getSumOfInfeasibilities();
+
+            checkTableauRows( *tableau, m, n );
+
+            // The incrementally updated assignment matches a fresh one
+            double assignment[n];
+            for ( unsigned i = 0; i < n; ++i )
+                assignment[i] = tableau->getValue( i );
+            TS_ASSERT_THROWS_NOTHING( tableau->computeAssignment() );
+            for ( unsigned i = 0; i < n; ++i )
+                TS_ASSERT( FloatUtils::areEqual( assignment[i], tableau->getValue( i ) ) );
+        }
+
+        TS_ASSERT( pivots > 0 );
+        TS_ASSERT( !tableau->existsBasicOutOfBounds() );
+
+        TS_ASSERT_THROWS_NOTHING( delete tableau );
+    }
+
     void test_degenerate_pivot()
     {
         Tableau *tableau = NULL;
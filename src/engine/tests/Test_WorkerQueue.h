@@ -0,0 +1,145 @@
+/*********************                                                        */
+/*! \file Test_WorkerQueue.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+**/
+
+#include "WorkerQueue.h"
+
+#include <cxxtest/TestSuite.h>
+#include <thread>
+
+class WorkerQueueTestSuite : public CxxTest::TestSuite
+{
+public:
+    SubQuery *createSubQuery( String queryId )
+    {
+        SubQuery *subQuery = new SubQuery;
+        subQuery->_queryId = queryId;
+        subQuery->_timeoutInSeconds = 0;
+        subQuery->_depth = 0;
+        return subQuery;
+    }
+
+    void test_push_and_pop()
+    {
+        WorkerQueue workload( 2 );
+        TS_ASSERT( workload.empty() );
+        TS_ASSERT_EQUALS( workload.getNumberOfWorkers(), 2U );
+
+        TS_ASSERT( workload.push( createSubQuery( "1" ), 0 ) );
+        TS_ASSERT( workload.push( createSubQuery( "2" ), 0 ) );
+        TS_ASSERT( workload.push( createSubQuery( "3" ), 1 ) );
+        TS_ASSERT_EQUALS( workload.size(), 3U );
+
+        // A worker pops its own most recent subquery first
+        SubQuery *subQuery = NULL;
+        TS_ASSERT( workload.pop( subQuery, 0 ) );
+        TS_ASSERT_EQUALS( subQuery->_queryId, "2" );
+        delete subQuery;
+
+        TS_ASSERT( workload.pop( subQuery, 1 ) );
+        TS_ASSERT_EQUALS( subQuery->_queryId, "3" );
+        delete subQuery;
+
+        // Worker 1's deque is empty, so it steals from worker 0
+        TS_ASSERT( workload.pop( subQuery, 1 ) );
+        TS_ASSERT_EQUALS( subQuery->_queryId, "1" );
+        delete subQuery;
+
+        TS_ASSERT( workload.empty() );
+        TS_ASSERT( !workload.pop( subQuery, 0 ) );
+    }
+
+    void test_steal_oldest()
+    {
+        WorkerQueue workload( 3 );
+
+        TS_ASSERT( workload.push( createSubQuery( "1" ), 2 ) );
+        TS_ASSERT( workload.push( createSubQuery( "2" ), 2 ) );
+
+        SubQuery *subQuery = NULL;
+        TS_ASSERT( workload.pop( subQuery, 0 ) );
+        TS_ASSERT_EQUALS( subQuery->_queryId, "1" );
+        delete subQuery;
+
+        TS_ASSERT( workload.pop( subQuery, 2 ) );
+        TS_ASSERT_EQUALS( subQuery->_queryId, "2" );
+        delete subQuery;
+    }
+
+    void test_zero_workers()
+    {
+        WorkerQueue workload( 0 );
+        TS_ASSERT_EQUALS( workload.getNumberOfWorkers(), 1U );
+
+        TS_ASSERT( workload.push( createSubQuery( "1" ) ) );
+        TS_ASSERT( !workload.empty() );
+
+        SubQuery *subQuery = NULL;
+        TS_ASSERT( workload.pop( subQuery ) );
+        TS_ASSERT_EQUALS( subQuery->_queryId, "1" );
+        delete subQuery;
+    }
+
+    void test_wait_and_pop()
+    {
+        WorkerQueue workload( 2 );
+
+        // A blocked worker is woken up by a push to another deque
+        std::thread producer( [this, &workload] {
+            std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+            workload.push( createSubQuery( "1" ), 1 );
+        } );
+
+        SubQuery *subQuery = NULL;
+        TS_ASSERT( workload.waitAndPop( subQuery, 0 ) );
+        TS_ASSERT_EQUALS( subQuery->_queryId, "1" );
+        delete subQuery;
+        producer.join();
+
+        // An interrupt releases a blocked worker without a subquery
+        std::thread interrupter( [&workload] {
+            std::this_thread::sleep_for( std::chrono::milliseconds( 10 ) );
+            workload.interrupt();
+        } );
+
+        subQuery = NULL;
+        TS_ASSERT( !workload.waitAndPop( subQuery, 0 ) );
+        TS_ASSERT( !subQuery );
+        interrupter.join();
+
+        // After the interrupt, remaining subqueries can still be popped
+        TS_ASSERT( workload.push( createSubQuery( "2" ), 1 ) );
+        TS_ASSERT( workload.waitAndPop( subQuery, 0 ) );
+        TS_ASSERT_EQUALS( subQuery->_queryId, "2" );
+        delete subQuery;
+    }
+
+    void test_wait_for_interrupt()
+    {
+        WorkerQueue workload( 1 );
+
+        TS_ASSERT( !workload.waitForInterrupt( std::chrono::microseconds( 100 ) ) );
+
+        workload.interrupt();
+        TS_ASSERT( workload.waitForInterrupt( std::chrono::microseconds( 100 ) ) );
+    }
+};
+
+//
+// Local Variables:
+// compile-command: "make -C ../../.. "
+// tags-file-name: "../../../TAGS"
+// c-basic-offset: 4
+// End:
+//
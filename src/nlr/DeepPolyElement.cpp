@@ -54,9 +54,9 @@ bool DeepPolyElement::hasPredecessor()
     return !_layer->getSourceLayers().empty();
 }
 
-const Map<unsigned, unsigned> &DeepPolyElement::getPredecessorIndices() const
+const FlatMap<unsigned, unsigned> &DeepPolyElement::getPredecessorIndices() const
 {
-    const Map<unsigned, unsigned> &sourceLayers = _layer->getSourceLayers();
+    const FlatMap<unsigned, unsigned> &sourceLayers = _layer->getSourceLayers();
     return sourceLayers;
 }
 
@@ -54,7 +54,7 @@ void DeepPolyWeightedSumElement::computeBoundWithBackSubstitution(
 
     // Start with the symbolic upper-/lower- bounds of this layer with
     // respect to its immediate predecessor.
-    Map<unsigned, unsigned> predecessorIndices = getPredecessorIndices();
+    FlatMap<unsigned, unsigned> predecessorIndices = getPredecessorIndices();
 
     unsigned counter = 0;
     unsigned numPredecessors = predecessorIndices.size();
@@ -392,18 +392,48 @@ void DeepPolyWeightedSumElement::symbolicBoundInTermsOfPredecessor(
 
     // newSymbolicLb = weights * symbolicLb
     // newSymbolicUb = weights * symbolicUb
-    matrixMultiplication( weights,
-                          symbolicLb,
-                          symbolicLbInTermsOfPredecessor,
-                          predecessorSize,
-                          _size,
-                          targetLayerSize );
-    matrixMultiplication( weights,
-                          symbolicUb,
-                          symbolicUbInTermsOfPredecessor,
-                          predecessorSize,
-                          _size,
-                          targetLayerSize );
+    const CSRMatrix *sparseWeights = _layer->getSparseWeights( predecessorIndex );
+    if ( sparseWeights )
+    {
+        // Each non-zero weight adds a scaled row of the symbolic bounds
+        const double *A = sparseWeights->getA();
+        const unsigned *IA = sparseWeights->getIA();
+        const unsigned *JA = sparseWeights->getJA();
+
+        for ( unsigned i = 0; i < predecessorSize; ++i )
+        {
+            double *lbRow = symbolicLbInTermsOfPredecessor + i * targetLayerSize;
+            double *ubRow = symbolicUbInTermsOfPredecessor + i * targetLayerSize;
+
+            for ( unsigned entry = IA[i]; entry < IA[i + 1]; ++entry )
+            {
+                double weight = A[entry];
+                const double *symbolicLbRow = symbolicLb + JA[entry] * targetLayerSize;
+                const double *symbolicUbRow = symbolicUb + JA[entry] * targetLayerSize;
+
+                for ( unsigned j = 0; j < targetLayerSize; ++j )
+                {
+                    lbRow[j] += weight * symbolicLbRow[j];
+                    ubRow[j] += weight * symbolicUbRow[j];
+                }
+            }
+        }
+    }
+    else
+    {
+        matrixMultiplication( weights,
+                              symbolicLb,
+                              symbolicLbInTermsOfPredecessor,
+                              predecessorSize,
+                              _size,
+                              targetLayerSize );
+        matrixMultiplication( weights,
+                              symbolicUb,
+                              symbolicUbInTermsOfPredecessor,
+                              predecessorSize,
+                              _size,
+                              targetLayerSize );
+    }
 
     // symbolicLowerBias = biases * symbolicLb
     // symbolicUpperBias = biases * symbolicUb
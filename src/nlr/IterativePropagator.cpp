@@ -24,7 +24,6 @@
 #include "TimeUtils.h"
 #include "Vector.h"
 
-#include <boost/thread.hpp>
 
 namespace NLR {
 
@@ -40,27 +39,16 @@ IterativePropagator::~IterativePropagator()
 {
 }
 
+ILPSolver *IterativePropagator::createSolver()
+{
+    return new GurobiWrapper();
+}
+
 void IterativePropagator::optimizeBoundsWithIterativePropagation(
     const Map<unsigned, Layer *> &layers )
 {
-    unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
-
-    // Time to wait if no idle worker is availble
-    boost::chrono::milliseconds waitTime( numberOfWorkers - 1 );
-
-    Map<GurobiWrapper *, unsigned> solverToIndex;
-    // Create a queue of free workers
-    // When a worker is working, it is popped off the queue, when it is done, it
-    // is added back to the queue.
-    SolverQueue freeSolvers( numberOfWorkers );
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        GurobiWrapper *gurobi = new GurobiWrapper();
-        solverToIndex[gurobi] = i;
-        enqueueSolver( freeSolvers, gurobi );
-    }
+    SolverThreadPool &threadPool = getThreadPool();
 
-    std::vector<boost::thread> threads( numberOfWorkers );
     std::mutex mtx;
     std::atomic_bool infeasible( false );
 
@@ -124,6 +112,11 @@ void IterativePropagator::optimizeBoundsWithIterativePropagation(
                 currentLb = layer->getLb( i );
                 currentUb = layer->getUb( i );
 
+                // Wait until there is an idle worker, so that the
+                // progress check below accounts for the neurons that
+                // were handled so far
+                threadPool.waitForIdleWorker();
+
                 mtx.lock();
                 bool progressMade = lastFixedNeuronThisIteration != lastIndex;
                 mtx.unlock();
@@ -136,11 +129,6 @@ void IterativePropagator::optimizeBoundsWithIterativePropagation(
                     if ( Options::get()->getInt( Options::VERBOSITY ) > 0 )
                         printf( "No progress made this iteration, quitting...\n" );
 
-                    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-                    {
-                        threads[i].interrupt();
-                        threads[i].join();
-                    }
                     shouldQuit = true;
                     break;
                 }
@@ -153,53 +141,53 @@ void IterativePropagator::optimizeBoundsWithIterativePropagation(
 
                 if ( infeasible )
                 {
-                    // infeasibility is derived, interupt all active threads
-                    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-                    {
-                        threads[i].interrupt();
-                        threads[i].join();
-                    }
-                    clearSolverQueue( freeSolvers );
+                    // infeasibility is derived, wait for the active workers
+                    threadPool.waitForCompletion();
                     throw InfeasibleQueryException();
                 }
 
-                // Wait until there is an idle solver
-                GurobiWrapper *freeSolver;
-                while ( !freeSolvers.pop( freeSolver ) )
-                    boost::this_thread::sleep_for( waitTime );
+                // tighten the bounds for the current variable on the next idle worker
+                threadPool.submit( [this,
+                                    &layers,
+                                    &mtx,
+                                    &infeasible,
+                                    &tighterBoundCounter,
+                                    &signChanges,
+                                    &cutoffs,
+                                    &lastFixedNeuronThisIteration,
+                                    layer,
+                                    i,
+                                    currentLb,
+                                    currentUb]( ILPSolver &solver ) {
+                    solver.resetModel();
 
-                freeSolver->resetModel();
-                mtx.lock();
-                _milpFormulator.createMILPEncoding(
-                    layers, *freeSolver, _layerOwner->getNumberOfLayers() );
-                mtx.unlock();
+                    {
+                        std::lock_guard<std::mutex> lock( mtx );
+                        _milpFormulator.createMILPEncoding(
+                            layers, solver, _layerOwner->getNumberOfLayers() );
+                    }
 
-                // spawn a thread to tighten the bounds for the current variable
-                ThreadArgument argument( freeSolver,
-                                         layer,
-                                         i,
-                                         currentLb,
-                                         currentUb,
-                                         _cutoffInUse,
-                                         _cutoffValue,
-                                         _layerOwner,
-                                         std::ref( freeSolvers ),
-                                         std::ref( mtx ),
-                                         std::ref( infeasible ),
-                                         std::ref( tighterBoundCounter ),
-                                         std::ref( signChanges ),
-                                         std::ref( cutoffs ),
-                                         &lastFixedNeuronThisIteration );
-
-                threads[solverToIndex[freeSolver]] =
-                    boost::thread( tightenSingleVariableBounds, argument );
+                    ThreadArgument argument( &solver,
+                                             layer,
+                                             i,
+                                             currentLb,
+                                             currentUb,
+                                             _cutoffInUse,
+                                             _cutoffValue,
+                                             _layerOwner,
+                                             std::ref( mtx ),
+                                             std::ref( infeasible ),
+                                             std::ref( tighterBoundCounter ),
+                                             std::ref( signChanges ),
+                                             std::ref( cutoffs ),
+                                             &lastFixedNeuronThisIteration );
+
+                    tightenSingleVariableBounds( argument );
+                } );
             }
         }
 
-        for ( unsigned i = 0; i < numberOfWorkers; ++i )
-        {
-            threads[i].join();
-        }
+        threadPool.waitForCompletion();
 
         if ( Options::get()->getInt( Options::VERBOSITY ) > 0 )
             printf( "Number of tighter bounds found by Gurobi after this iteration: %u. Sign "
@@ -222,8 +210,6 @@ void IterativePropagator::optimizeBoundsWithIterativePropagation(
                                       TimeUtils::timePassed( gurobiStart, gurobiEnd ) / 1000000 )
                                  .ascii() );
 
-    clearSolverQueue( freeSolvers );
-
     if ( infeasible )
         throw InfeasibleQueryException();
 }
@@ -235,7 +221,7 @@ void IterativePropagator::setCutoff( double cutoff )
 }
 
 
-double IterativePropagator::optimizeWithGurobi( GurobiWrapper &gurobi,
+double IterativePropagator::optimizeWithGurobi( ILPSolver &gurobi,
                                                 MinOrMax minOrMax,
                                                 String variableName,
                                                 double cutoffValue,
@@ -282,32 +268,22 @@ double IterativePropagator::optimizeWithGurobi( GurobiWrapper &gurobi,
 
 void IterativePropagator::tightenSingleVariableBounds( ThreadArgument &argument )
 {
-    try
+    // try the phase corresponding to the larger interval first
+    if ( -argument._currentLb < argument._currentUb )
     {
-        // try the phase corresponding to the larger interval first
-        if ( -argument._currentLb < argument._currentUb )
-        {
-            if ( tightenSingleVariableLowerBounds( argument ) )
-                tightenSingleVariableUpperBounds( argument );
-        }
-        else
-        {
-            if ( tightenSingleVariableUpperBounds( argument ) )
-                tightenSingleVariableLowerBounds( argument );
-        }
-        SolverQueue &freeSolvers = argument._freeSolvers;
-        GurobiWrapper *gurobi = argument._gurobi;
-        enqueueSolver( freeSolvers, gurobi );
+        if ( tightenSingleVariableLowerBounds( argument ) )
+            tightenSingleVariableUpperBounds( argument );
     }
-    catch ( boost::thread_interrupted & )
+    else
     {
-        enqueueSolver( argument._freeSolvers, argument._gurobi );
+        if ( tightenSingleVariableUpperBounds( argument ) )
+            tightenSingleVariableLowerBounds( argument );
     }
 }
 
 bool IterativePropagator::tightenSingleVariableLowerBounds( ThreadArgument &argument )
 {
-    GurobiWrapper *gurobi = argument._gurobi;
+    ILPSolver *gurobi = argument._gurobi;
     Layer *layer = argument._layer;
     unsigned index = argument._index;
     double currentLb = argument._currentLb;
@@ -360,7 +336,7 @@ bool IterativePropagator::tightenSingleVariableLowerBounds( ThreadArgument &argu
 
 bool IterativePropagator::tightenSingleVariableUpperBounds( ThreadArgument &argument )
 {
-    GurobiWrapper *gurobi = argument._gurobi;
+    ILPSolver *gurobi = argument._gurobi;
     Layer *layer = argument._layer;
     unsigned index = argument._index;
     double currentUb = argument._currentUb;
@@ -59,7 +59,7 @@ private:
       Optimize for the min/max value of variableName with respect to the constraints
       encoded in gurobi. If the query is infeasible, *infeasible is set to true.
     */
-    static double optimizeWithGurobi( GurobiWrapper &gurobi,
+    static double optimizeWithGurobi( ILPSolver &gurobi,
                                       MinOrMax minOrMax,
                                       String variableName,
                                       double cutoffValue,
@@ -73,6 +73,8 @@ private:
     static bool tightenSingleVariableLowerBounds( ThreadArgument &argument );
 
     static bool tightenSingleVariableUpperBounds( ThreadArgument &argument );
+
+    ILPSolver *createSolver();
 };
 
 } // namespace NLR
@@ -21,10 +21,13 @@
 #include "Layer.h"
 #include "MStringf.h"
 #include "NLRError.h"
+#include "NativeLPSolver.h"
 #include "Options.h"
 #include "TimeUtils.h"
 #include "Vector.h"
 
+#include <memory>
+
 namespace NLR {
 
 LPFormulator::LPFormulator( LayerOwner *layerOwner )
@@ -38,7 +41,19 @@ LPFormulator::~LPFormulator()
 {
 }
 
-double LPFormulator::solveLPRelaxation( GurobiWrapper &gurobi,
+ILPSolver *LPFormulator::createLPSolver()
+{
+    if ( Options::get()->gurobiEnabled() )
+        return new GurobiWrapper();
+    return new NativeLPSolver();
+}
+
+ILPSolver *LPFormulator::createSolver()
+{
+    return createLPSolver();
+}
+
+double LPFormulator::solveLPRelaxation( ILPSolver &gurobi,
                                         const Map<unsigned, Layer *> &layers,
                                         MinOrMax minOrMax,
                                         String variableName,
@@ -49,14 +64,14 @@ double LPFormulator::solveLPRelaxation( GurobiWrapper &gurobi,
     return optimizeWithGurobi( gurobi, minOrMax, variableName, _cutoffValue );
 }
 
-double LPFormulator::optimizeWithGurobi( GurobiWrapper &gurobi,
+double LPFormulator::optimizeWithGurobi( ILPSolver &gurobi,
                                          MinOrMax minOrMax,
                                          String variableName,
                                          double cutoffValue,
                                          std::atomic_bool *infeasible )
 {
-    List<GurobiWrapper::Term> terms;
-    terms.append( GurobiWrapper::Term( 1, variableName ) );
+    List<ILPSolver::Term> terms;
+    terms.append( ILPSolver::Term( 1, variableName ) );
 
     if ( minOrMax == MAX )
         gurobi.setObjective( terms );
@@ -98,9 +113,10 @@ double LPFormulator::optimizeWithGurobi( GurobiWrapper &gurobi,
 
 void LPFormulator::optimizeBoundsWithIncrementalLpRelaxation( const Map<unsigned, Layer *> &layers )
 {
-    GurobiWrapper gurobi;
+    std::unique_ptr<ILPSolver> solver( createLPSolver() );
+    ILPSolver &gurobi = *solver;
 
-    List<GurobiWrapper::Term> terms;
+    List<ILPSolver::Term> terms;
     Map<String, double> dontCare;
     double lb = 0;
     double ub = 0;
@@ -143,7 +159,7 @@ void LPFormulator::optimizeBoundsWithIncrementalLpRelaxation( const Map<unsigned
             Stringf variableName( "x%u", variable );
 
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, variableName ) );
+            terms.append( ILPSolver::Term( 1, variableName ) );
 
             // Maximize
             gurobi.reset();
@@ -251,21 +267,6 @@ void LPFormulator::optimizeBoundsWithIncrementalLpRelaxation( const Map<unsigned
 void LPFormulator::optimizeBoundsWithLpRelaxation( const Map<unsigned, Layer *> &layers,
                                                    bool backward )
 {
-    unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
-
-    Map<GurobiWrapper *, unsigned> solverToIndex;
-    // Create a queue of free workers
-    // When a worker is working, it is popped off the queue, when it is done, it
-    // is added back to the queue.
-    SolverQueue freeSolvers( numberOfWorkers );
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        GurobiWrapper *gurobi = new GurobiWrapper();
-        solverToIndex[gurobi] = i;
-        enqueueSolver( freeSolvers, gurobi );
-    }
-
-    boost::thread *threads = new boost::thread[numberOfWorkers];
     std::mutex mtx;
     std::atomic_bool infeasible( false );
 
@@ -290,27 +291,19 @@ void LPFormulator::optimizeBoundsWithLpRelaxation( const Map<unsigned, Layer *>
 
         ThreadArgument argument( layer,
                                  &layers,
-                                 std::ref( freeSolvers ),
                                  std::ref( mtx ),
                                  std::ref( infeasible ),
                                  std::ref( tighterBoundCounter ),
                                  std::ref( signChanges ),
                                  std::ref( cutoffs ),
                                  layer->getLayerIndex(),
-                                 layerIndex,
-                                 threads,
-                                 &solverToIndex );
+                                 layerIndex );
 
         // optimize every neuron of layer
         optimizeBoundsOfNeuronsWithLpRlaxation( argument, backward );
         LPFormulator_LOG( Stringf( "Tightening bound for layer %u - done", layerIndex ).ascii() );
     }
 
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        threads[i].join();
-    }
-
     gurobiEnd = TimeUtils::sampleMicro();
 
     LPFormulator_LOG(
@@ -322,38 +315,11 @@ void LPFormulator::optimizeBoundsWithLpRelaxation( const Map<unsigned, Layer *>
     LPFormulator_LOG( Stringf( "Seconds spent Gurobiing: %llu\n",
                                TimeUtils::timePassed( gurobiStart, gurobiEnd ) / 1000000 )
                           .ascii() );
-
-    // Clean up
-    clearSolverQueue( freeSolvers );
-
-    if ( threads )
-    {
-        delete[] threads;
-        threads = NULL;
-    }
-
-    if ( infeasible )
-        throw InfeasibleQueryException();
 }
 
 void LPFormulator::optimizeBoundsOfOneLayerWithLpRelaxation( const Map<unsigned, Layer *> &layers,
                                                              unsigned targetIndex )
 {
-    unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
-
-    Map<GurobiWrapper *, unsigned> solverToIndex;
-    // Create a queue of free workers
-    // When a worker is working, it is popped off the queue, when it is done, it
-    // is added back to the queue.
-    SolverQueue freeSolvers( numberOfWorkers );
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        GurobiWrapper *gurobi = new GurobiWrapper();
-        solverToIndex[gurobi] = i;
-        enqueueSolver( freeSolvers, gurobi );
-    }
-
-    boost::thread *threads = new boost::thread[numberOfWorkers];
     std::mutex mtx;
     std::atomic_bool infeasible( false );
 
@@ -372,25 +338,17 @@ void LPFormulator::optimizeBoundsOfOneLayerWithLpRelaxation( const Map<unsigned,
 
     ThreadArgument argument( layer,
                              &layers,
-                             std::ref( freeSolvers ),
                              std::ref( mtx ),
                              std::ref( infeasible ),
                              std::ref( tighterBoundCounter ),
                              std::ref( signChanges ),
                              std::ref( cutoffs ),
                              layers.size() - 1,
-                             targetIndex,
-                             threads,
-                             &solverToIndex );
+                             targetIndex );
 
     // optimize every neuron of layer
     optimizeBoundsOfNeuronsWithLpRlaxation( argument, false );
 
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        threads[i].join();
-    }
-
     gurobiEnd = TimeUtils::sampleMicro();
 
     LPFormulator_LOG(
@@ -402,36 +360,14 @@ void LPFormulator::optimizeBoundsOfOneLayerWithLpRelaxation( const Map<unsigned,
     LPFormulator_LOG( Stringf( "Seconds spent Gurobiing: %llu\n",
                                TimeUtils::timePassed( gurobiStart, gurobiEnd ) / 1000000 )
                           .ascii() );
-
-    clearSolverQueue( freeSolvers );
-
-    if ( infeasible )
-        throw InfeasibleQueryException();
 }
 
 void LPFormulator::optimizeBoundsOfNeuronsWithLpRlaxation( ThreadArgument &args, bool backward )
 {
-    unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
-
-    // Time to wait if no idle worker is availble
-    boost::chrono::milliseconds waitTime( numberOfWorkers - 1 );
+    SolverThreadPool &threadPool = getThreadPool();
 
     Layer *layer = args._layer;
-    const Map<unsigned, Layer *> layers = *args._layers;
     unsigned targetIndex = args._targetIndex;
-    unsigned lastIndexOfRelaxation = args._lastIndexOfRelaxation;
-
-    const Map<GurobiWrapper *, unsigned> solverToIndex = *args._solverToIndex;
-    SolverQueue &freeSolvers = args._freeSolvers;
-    std::mutex &mtx = args._mtx;
-    std::atomic_bool &infeasible = args._infeasible;
-    std::atomic_uint &tighterBoundCounter = args._tighterBoundCounter;
-    std::atomic_uint &signChanges = args._signChanges;
-    std::atomic_uint &cutoffs = args._cutoffs;
-    boost::thread *threads = args._threads;
-
-    double currentLb;
-    double currentUb;
 
     bool skipTightenLb = false; // If true, skip lower bound tightening
     bool skipTightenUb = false; // If true, skip upper bound tightening
@@ -441,13 +377,14 @@ void LPFormulator::optimizeBoundsOfNeuronsWithLpRlaxation( ThreadArgument &args,
     const Vector<Vector<double>> *simulations =
         _layerOwner->getLayer( targetIndex )->getSimulations();
 
+    Vector<NeuronToTighten> neurons;
     for ( unsigned i = 0; i < layer->getSize(); ++i )
     {
         if ( layer->neuronEliminated( i ) )
             continue;
 
-        currentLb = layer->getLb( i );
-        currentUb = layer->getUb( i );
+        double currentLb = layer->getLb( i );
+        double currentUb = layer->getUb( i );
 
         if ( _cutoffInUse && ( currentLb >= _cutoffValue || currentUb <= _cutoffValue ) )
             continue;
@@ -492,161 +429,147 @@ void LPFormulator::optimizeBoundsOfNeuronsWithLpRlaxation( ThreadArgument &args,
                     .ascii() );
         }
 
-        if ( infeasible )
-        {
-            // infeasibility is derived, interupt all active threads
-            for ( unsigned i = 0; i < numberOfWorkers; ++i )
-            {
-                threads[i].interrupt();
-                threads[i].join();
-            }
+        neurons.append( NeuronToTighten{ i, currentLb, currentUb, skipTightenLb, skipTightenUb } );
+    }
 
-            // Clean up
-            clearSolverQueue( freeSolvers );
+    Vector<Batch> batches;
+    createBatches( neurons, threadPool.getNumberOfWorkers(), batches );
 
-            if ( threads )
+    for ( const auto &batch : batches )
+    {
+        threadPool.submit( [this, &threadPool, &args, batch, backward]( ILPSolver &solver ) {
+            for ( const auto &neuron : batch )
             {
-                delete[] threads;
-                threads = NULL;
-            }
+                // Once infeasibility is derived, the remaining neurons are dropped
+                if ( args._infeasible )
+                {
+                    threadPool.cancelPendingTasks();
+                    return;
+                }
 
-            throw InfeasibleQueryException();
-        }
+                solver.resetModel();
 
-        // Wait until there is an idle solver
-        GurobiWrapper *freeSolver;
-        while ( !freeSolvers.pop( freeSolver ) )
-            boost::this_thread::sleep_for( waitTime );
+                {
+                    std::lock_guard<std::mutex> lock( args._mtx );
+                    if ( backward )
+                        createLPRelaxationAfter(
+                            *args._layers, solver, args._lastIndexOfRelaxation );
+                    else
+                        createLPRelaxation( *args._layers, solver, args._lastIndexOfRelaxation );
+                }
 
-        freeSolver->resetModel();
+                ThreadArgument argument( &solver,
+                                         args._layer,
+                                         neuron._index,
+                                         neuron._currentLb,
+                                         neuron._currentUb,
+                                         _cutoffInUse,
+                                         _cutoffValue,
+                                         _layerOwner,
+                                         std::ref( args._mtx ),
+                                         std::ref( args._infeasible ),
+                                         std::ref( args._tighterBoundCounter ),
+                                         std::ref( args._signChanges ),
+                                         std::ref( args._cutoffs ),
+                                         neuron._skipTightenLb,
+                                         neuron._skipTightenUb );
+
+                tightenSingleVariableBoundsWithLPRelaxation( argument );
+            }
+        } );
+    }
 
-        mtx.lock();
-        if ( backward )
-            createLPRelaxationAfter( layers, *freeSolver, lastIndexOfRelaxation );
-        else
-            createLPRelaxation( layers, *freeSolver, lastIndexOfRelaxation );
-        mtx.unlock();
-
-        // spawn a thread to tighten the bounds for the current variable
-        ThreadArgument argument( freeSolver,
-                                 layer,
-                                 i,
-                                 currentLb,
-                                 currentUb,
-                                 _cutoffInUse,
-                                 _cutoffValue,
-                                 _layerOwner,
-                                 std::ref( freeSolvers ),
-                                 std::ref( mtx ),
-                                 std::ref( infeasible ),
-                                 std::ref( tighterBoundCounter ),
-                                 std::ref( signChanges ),
-                                 std::ref( cutoffs ),
-                                 skipTightenLb,
-                                 skipTightenUb );
+    // The next layer's relaxation depends on this layer's bounds, so
+    // wait for all of its neurons to be tightened
+    threadPool.waitForCompletion();
 
-        if ( numberOfWorkers == 1 )
-            tightenSingleVariableBoundsWithLPRelaxation( argument );
-        else
-            threads[solverToIndex[freeSolver]] =
-                boost::thread( tightenSingleVariableBoundsWithLPRelaxation, argument );
-    }
+    if ( args._infeasible )
+        throw InfeasibleQueryException();
 }
 
-
 void LPFormulator::tightenSingleVariableBoundsWithLPRelaxation( ThreadArgument &argument )
 {
-    try
+    ILPSolver *gurobi = argument._gurobi;
+    Layer *layer = argument._layer;
+    unsigned index = argument._index;
+    double currentLb = argument._currentLb;
+    double currentUb = argument._currentUb;
+    bool cutoffInUse = argument._cutoffInUse;
+    double cutoffValue = argument._cutoffValue;
+    LayerOwner *layerOwner = argument._layerOwner;
+    std::mutex &mtx = argument._mtx;
+    std::atomic_bool &infeasible = argument._infeasible;
+    std::atomic_uint &tighterBoundCounter = argument._tighterBoundCounter;
+    std::atomic_uint &signChanges = argument._signChanges;
+    std::atomic_uint &cutoffs = argument._cutoffs;
+    bool skipTightenLb = argument._skipTightenLb;
+    bool skipTightenUb = argument._skipTightenUb;
+
+    LPFormulator_LOG(
+        Stringf( "Tightening bounds for layer %u index %u", layer->getLayerIndex(), index )
+            .ascii() );
+
+    unsigned variable = layer->neuronToVariable( index );
+    Stringf variableName( "x%u", variable );
+
+    if ( !skipTightenUb )
     {
-        GurobiWrapper *gurobi = argument._gurobi;
-        Layer *layer = argument._layer;
-        unsigned index = argument._index;
-        double currentLb = argument._currentLb;
-        double currentUb = argument._currentUb;
-        bool cutoffInUse = argument._cutoffInUse;
-        double cutoffValue = argument._cutoffValue;
-        LayerOwner *layerOwner = argument._layerOwner;
-        SolverQueue &freeSolvers = argument._freeSolvers;
-        std::mutex &mtx = argument._mtx;
-        std::atomic_bool &infeasible = argument._infeasible;
-        std::atomic_uint &tighterBoundCounter = argument._tighterBoundCounter;
-        std::atomic_uint &signChanges = argument._signChanges;
-        std::atomic_uint &cutoffs = argument._cutoffs;
-        bool skipTightenLb = argument._skipTightenLb;
-        bool skipTightenUb = argument._skipTightenUb;
-
-        LPFormulator_LOG(
-            Stringf( "Tightening bounds for layer %u index %u", layer->getLayerIndex(), index )
-                .ascii() );
-
-        unsigned variable = layer->neuronToVariable( index );
-        Stringf variableName( "x%u", variable );
-
-        if ( !skipTightenUb )
+        LPFormulator_LOG( Stringf( "Computing upperbound..." ).ascii() );
+        double ub = optimizeWithGurobi(
+                        *gurobi, MinOrMax::MAX, variableName, cutoffValue, &infeasible ) +
+                    GlobalConfiguration::LP_TIGHTENING_ROUNDING_CONSTANT;
+        ;
+        LPFormulator_LOG( Stringf( "Upperbound computed %f", ub ).ascii() );
+
+        // Store the new bound if it is tighter
+        if ( ub < currentUb )
         {
-            LPFormulator_LOG( Stringf( "Computing upperbound..." ).ascii() );
-            double ub = optimizeWithGurobi(
-                            *gurobi, MinOrMax::MAX, variableName, cutoffValue, &infeasible ) +
-                        GlobalConfiguration::LP_TIGHTENING_ROUNDING_CONSTANT;
-            ;
-            LPFormulator_LOG( Stringf( "Upperbound computed %f", ub ).ascii() );
-
-            // Store the new bound if it is tighter
-            if ( ub < currentUb )
-            {
-                if ( FloatUtils::isPositive( currentUb ) && !FloatUtils::isPositive( ub ) )
-                    ++signChanges;
+            if ( FloatUtils::isPositive( currentUb ) && !FloatUtils::isPositive( ub ) )
+                ++signChanges;
 
-                mtx.lock();
-                layer->setUb( index, ub );
-                layerOwner->receiveTighterBound( Tightening( variable, ub, Tightening::UB ) );
-                mtx.unlock();
+            mtx.lock();
+            layer->setUb( index, ub );
+            layerOwner->receiveTighterBound( Tightening( variable, ub, Tightening::UB ) );
+            mtx.unlock();
 
-                ++tighterBoundCounter;
+            ++tighterBoundCounter;
 
-                if ( cutoffInUse && ub < cutoffValue )
-                {
-                    ++cutoffs;
-                    enqueueSolver( freeSolvers, gurobi );
-                    return;
-                }
+            if ( cutoffInUse && ub < cutoffValue )
+            {
+                ++cutoffs;
+                return;
             }
         }
+    }
 
-        if ( !skipTightenLb )
+    if ( !skipTightenLb )
+    {
+        LPFormulator_LOG( Stringf( "Computing lowerbound..." ).ascii() );
+        gurobi->reset();
+        double lb = optimizeWithGurobi(
+                        *gurobi, MinOrMax::MIN, variableName, cutoffValue, &infeasible ) -
+                    GlobalConfiguration::LP_TIGHTENING_ROUNDING_CONSTANT;
+        LPFormulator_LOG( Stringf( "Lowerbound computed: %f", lb ).ascii() );
+        // Store the new bound if it is tighter
+        if ( lb > currentLb )
         {
-            LPFormulator_LOG( Stringf( "Computing lowerbound..." ).ascii() );
-            gurobi->reset();
-            double lb = optimizeWithGurobi(
-                            *gurobi, MinOrMax::MIN, variableName, cutoffValue, &infeasible ) -
-                        GlobalConfiguration::LP_TIGHTENING_ROUNDING_CONSTANT;
-            LPFormulator_LOG( Stringf( "Lowerbound computed: %f", lb ).ascii() );
-            // Store the new bound if it is tighter
-            if ( lb > currentLb )
-            {
-                if ( FloatUtils::isNegative( currentLb ) && !FloatUtils::isNegative( lb ) )
-                    ++signChanges;
+            if ( FloatUtils::isNegative( currentLb ) && !FloatUtils::isNegative( lb ) )
+                ++signChanges;
 
-                mtx.lock();
-                layer->setLb( index, lb );
-                layerOwner->receiveTighterBound( Tightening( variable, lb, Tightening::LB ) );
-                mtx.unlock();
-                ++tighterBoundCounter;
+            mtx.lock();
+            layer->setLb( index, lb );
+            layerOwner->receiveTighterBound( Tightening( variable, lb, Tightening::LB ) );
+            mtx.unlock();
+            ++tighterBoundCounter;
 
-                if ( cutoffInUse && lb > cutoffValue )
-                    ++cutoffs;
-            }
+            if ( cutoffInUse && lb > cutoffValue )
+                ++cutoffs;
         }
-        enqueueSolver( freeSolvers, gurobi );
-    }
-    catch ( boost::thread_interrupted & )
-    {
-        enqueueSolver( argument._freeSolvers, argument._gurobi );
     }
 }
 
 void LPFormulator::createLPRelaxation( const Map<unsigned, Layer *> &layers,
-                                       GurobiWrapper &gurobi,
+                                       ILPSolver &gurobi,
                                        unsigned lastLayer )
 {
     for ( const auto &layer : layers )
@@ -659,7 +582,7 @@ void LPFormulator::createLPRelaxation( const Map<unsigned, Layer *> &layers,
 }
 
 void LPFormulator::createLPRelaxationAfter( const Map<unsigned, Layer *> &layers,
-                                            GurobiWrapper &gurobi,
+                                            ILPSolver &gurobi,
                                             unsigned firstLayer )
 {
     unsigned depth = GlobalConfiguration::BACKWARD_BOUND_PROPAGATION_DEPTH;
@@ -690,7 +613,7 @@ void LPFormulator::createLPRelaxationAfter( const Map<unsigned, Layer *> &layers
     }
 }
 
-void LPFormulator::addLayerToModel( GurobiWrapper &gurobi,
+void LPFormulator::addLayerToModel( ILPSolver &gurobi,
                                     const Layer *layer,
                                     bool createVariables )
 {
@@ -746,7 +669,7 @@ void LPFormulator::addLayerToModel( GurobiWrapper &gurobi,
     }
 }
 
-void LPFormulator::addInputLayerToLpRelaxation( GurobiWrapper &gurobi, const Layer *layer )
+void LPFormulator::addInputLayerToLpRelaxation( ILPSolver &gurobi, const Layer *layer )
 {
     for ( unsigned i = 0; i < layer->getSize(); ++i )
     {
@@ -755,7 +678,7 @@ void LPFormulator::addInputLayerToLpRelaxation( GurobiWrapper &gurobi, const Lay
     }
 }
 
-void LPFormulator::addReluLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addReluLayerToLpRelaxation( ILPSolver &gurobi,
                                                const Layer *layer,
                                                bool createVariables )
 {
@@ -795,16 +718,16 @@ void LPFormulator::addReluLayerToLpRelaxation( GurobiWrapper &gurobi,
                 if ( sourceLb < 0 )
                     sourceLb = 0;
 
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
                 gurobi.addEqConstraint( terms, 0 );
             }
             else if ( !FloatUtils::isPositive( sourceUb ) )
             {
                 // The ReLU is inactive, y = 0
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                 gurobi.addEqConstraint( terms, 0 );
             }
             else
@@ -820,14 +743,14 @@ void LPFormulator::addReluLayerToLpRelaxation( GurobiWrapper &gurobi,
                 */
 
                 // y >= 0
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                 gurobi.addGeqConstraint( terms, 0 );
 
                 // y >= x, i.e. y - x >= 0
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
                 gurobi.addGeqConstraint( terms, 0 );
 
                 /*
@@ -836,8 +759,8 @@ void LPFormulator::addReluLayerToLpRelaxation( GurobiWrapper &gurobi,
                        u - l     u - l
                 */
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -sourceUb / ( sourceUb - sourceLb ),
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -sourceUb / ( sourceUb - sourceLb ),
                                                    Stringf( "x%u", sourceVariable ) ) );
                 gurobi.addLeqConstraint( terms,
                                          ( -sourceUb * sourceLb ) / ( sourceUb - sourceLb ) );
@@ -847,7 +770,7 @@ void LPFormulator::addReluLayerToLpRelaxation( GurobiWrapper &gurobi,
 }
 
 
-void LPFormulator::addRoundLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addRoundLayerToLpRelaxation( ILPSolver &gurobi,
                                                 const Layer *layer,
                                                 bool createVariables )
 {
@@ -887,24 +810,24 @@ void LPFormulator::addRoundLayerToLpRelaxation( GurobiWrapper &gurobi,
             // If u = l:  y = round(u)
             if ( FloatUtils::areEqual( sourceUb, sourceLb ) )
             {
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                 gurobi.addEqConstraint( terms, ub );
             }
 
             else
             {
-                List<GurobiWrapper::Term> terms;
+                List<ILPSolver::Term> terms;
                 // y <= x + 0.5, i.e. y - x <= 0.5
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
                 gurobi.addLeqConstraint( terms, 0.5 );
 
                 // y >= x - 0.5, i.e. y - x >= -0.5
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
                 gurobi.addGeqConstraint( terms, -0.5 );
             }
         }
@@ -912,7 +835,7 @@ void LPFormulator::addRoundLayerToLpRelaxation( GurobiWrapper &gurobi,
 }
 
 
-void LPFormulator::addAbsoluteValueLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addAbsoluteValueLayerToLpRelaxation( ILPSolver &gurobi,
                                                         const Layer *layer,
                                                         bool createVariables )
 {
@@ -954,9 +877,9 @@ void LPFormulator::addAbsoluteValueLayerToLpRelaxation( GurobiWrapper &gurobi,
                 double lb = std::max( sourceLb, layer->getLb( i ) );
                 gurobi.addVariable( Stringf( "x%u", targetVariable ), lb, ub );
 
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
                 gurobi.addEqConstraint( terms, 0 );
             }
             else if ( !FloatUtils::isPositive( sourceUb ) )
@@ -966,9 +889,9 @@ void LPFormulator::addAbsoluteValueLayerToLpRelaxation( GurobiWrapper &gurobi,
                 gurobi.addVariable( Stringf( "x%u", targetVariable ), lb, ub );
 
                 // The AbsoluteValue is inactive, y = -x, i.e. y + x = 0
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", sourceVariable ) ) );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", sourceVariable ) ) );
                 gurobi.addEqConstraint( terms, 0 );
             }
             else
@@ -981,13 +904,13 @@ void LPFormulator::addAbsoluteValueLayerToLpRelaxation( GurobiWrapper &gurobi,
                   The phase of this AbsoluteValue is not yet fixed, 0 <= y <= max(-lb, ub).
                 */
                 // y >= 0
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                 gurobi.addGeqConstraint( terms, 0 );
 
                 // y <= max(-lb, ub)
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                 gurobi.addLeqConstraint( terms, ub );
             }
         }
@@ -995,7 +918,7 @@ void LPFormulator::addAbsoluteValueLayerToLpRelaxation( GurobiWrapper &gurobi,
 }
 
 
-void LPFormulator::addSigmoidLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addSigmoidLayerToLpRelaxation( ILPSolver &gurobi,
                                                   const Layer *layer,
                                                   bool createVariables )
 {
@@ -1039,15 +962,15 @@ void LPFormulator::addSigmoidLayerToLpRelaxation( GurobiWrapper &gurobi,
             // If u = l:  y = sigmoid(u)
             if ( FloatUtils::areEqual( sourceUb, sourceLb ) )
             {
-                List<GurobiWrapper::Term> terms;
+                List<ILPSolver::Term> terms;
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                 gurobi.addEqConstraint( terms, ub );
             }
 
             else
             {
-                List<GurobiWrapper::Term> terms;
+                List<ILPSolver::Term> terms;
                 double lambda = ( ub - lb ) / ( sourceUb - sourceLb );
                 double lambdaPrime = std::min( SigmoidConstraint::sigmoidDerivative( sourceLb ),
                                                SigmoidConstraint::sigmoidDerivative( sourceUb ) );
@@ -1058,9 +981,9 @@ void LPFormulator::addSigmoidLayerToLpRelaxation( GurobiWrapper &gurobi,
                     // y >= lambda * (x - l) + sigmoid(lb), i.e. y - lambda * x >= sigmoid(lb) -
                     // lambda * l
                     terms.clear();
-                    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                     terms.append(
-                        GurobiWrapper::Term( -lambda, Stringf( "x%u", sourceVariable ) ) );
+                        ILPSolver::Term( -lambda, Stringf( "x%u", sourceVariable ) ) );
                     gurobi.addGeqConstraint( terms, sourceLbSigmoid - sourceLb * lambda );
                 }
 
@@ -1069,9 +992,9 @@ void LPFormulator::addSigmoidLayerToLpRelaxation( GurobiWrapper &gurobi,
                     // y >= lambda' * (x - l) + sigmoid(lb), i.e. y - lambda' * x >= sigmoid(lb) -
                     // lambda' * l
                     terms.clear();
-                    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                     terms.append(
-                        GurobiWrapper::Term( -lambdaPrime, Stringf( "x%u", sourceVariable ) ) );
+                        ILPSolver::Term( -lambdaPrime, Stringf( "x%u", sourceVariable ) ) );
                     gurobi.addGeqConstraint( terms, sourceLbSigmoid - sourceLb * lambdaPrime );
                 }
 
@@ -1081,9 +1004,9 @@ void LPFormulator::addSigmoidLayerToLpRelaxation( GurobiWrapper &gurobi,
                     // y <= lambda * (x - u) + sigmoid(ub), i.e. y - lambda * x <= sigmoid(ub) -
                     // lambda * u
                     terms.clear();
-                    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                     terms.append(
-                        GurobiWrapper::Term( -lambda, Stringf( "x%u", sourceVariable ) ) );
+                        ILPSolver::Term( -lambda, Stringf( "x%u", sourceVariable ) ) );
                     gurobi.addLeqConstraint( terms, sourceUbSigmoid - sourceUb * lambda );
                 }
                 else
@@ -1091,9 +1014,9 @@ void LPFormulator::addSigmoidLayerToLpRelaxation( GurobiWrapper &gurobi,
                     // y <= lambda' * (x - u) + sigmoid(ub), i.e. y - lambda' * x <= sigmoid(ub) -
                     // lambda' * u
                     terms.clear();
-                    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                     terms.append(
-                        GurobiWrapper::Term( -lambdaPrime, Stringf( "x%u", sourceVariable ) ) );
+                        ILPSolver::Term( -lambdaPrime, Stringf( "x%u", sourceVariable ) ) );
                     gurobi.addLeqConstraint( terms, sourceUbSigmoid - sourceUb * lambdaPrime );
                 }
             }
@@ -1102,7 +1025,7 @@ void LPFormulator::addSigmoidLayerToLpRelaxation( GurobiWrapper &gurobi,
 }
 
 
-void LPFormulator::addSignLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addSignLayerToLpRelaxation( ILPSolver &gurobi,
                                                const Layer *layer,
                                                bool createVariables )
 {
@@ -1166,9 +1089,9 @@ void LPFormulator::addSignLayerToLpRelaxation( GurobiWrapper &gurobi,
               y <= ----- x + 1
                     - l
             */
-            List<GurobiWrapper::Term> terms;
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-            terms.append( GurobiWrapper::Term( 2.0 / sourceLb, Stringf( "x%u", sourceVariable ) ) );
+            List<ILPSolver::Term> terms;
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            terms.append( ILPSolver::Term( 2.0 / sourceLb, Stringf( "x%u", sourceVariable ) ) );
             gurobi.addLeqConstraint( terms, 1 );
 
             /*
@@ -1177,16 +1100,16 @@ void LPFormulator::addSignLayerToLpRelaxation( GurobiWrapper &gurobi,
                      u
             */
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
             terms.append(
-                GurobiWrapper::Term( -2.0 / sourceUb, Stringf( "x%u", sourceVariable ) ) );
+                ILPSolver::Term( -2.0 / sourceUb, Stringf( "x%u", sourceVariable ) ) );
             gurobi.addGeqConstraint( terms, -1 );
         }
     }
 }
 
 
-void LPFormulator::addMaxLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addMaxLayerToLpRelaxation( ILPSolver &gurobi,
                                               const Layer *layer,
                                               bool createVariables )
 {
@@ -1206,7 +1129,7 @@ void LPFormulator::addMaxLayerToLpRelaxation( GurobiWrapper &gurobi,
 
         double maxConcreteUb = FloatUtils::negativeInfinity();
 
-        List<GurobiWrapper::Term> terms;
+        List<ILPSolver::Term> terms;
 
         for ( const auto &source : sources )
         {
@@ -1232,8 +1155,8 @@ void LPFormulator::addMaxLayerToLpRelaxation( GurobiWrapper &gurobi,
 
             // Target is at least source: target - source >= 0
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-            terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
             gurobi.addGeqConstraint( terms, 0 );
 
             // Find maximal concrete upper bound
@@ -1246,7 +1169,7 @@ void LPFormulator::addMaxLayerToLpRelaxation( GurobiWrapper &gurobi,
             // At least one of the sources has a fixed value,
             // and this fixed value dominates other sources.
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
             gurobi.addEqConstraint( terms, maxFixedSourceValue );
         }
         else
@@ -1255,20 +1178,20 @@ void LPFormulator::addMaxLayerToLpRelaxation( GurobiWrapper &gurobi,
             if ( haveFixedSourceValue )
             {
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                 gurobi.addGeqConstraint( terms, maxFixedSourceValue );
             }
 
             // Target must be smaller than greatest concrete upper bound
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
             gurobi.addLeqConstraint( terms, maxConcreteUb );
         }
     }
 }
 
 
-void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addSoftmaxLayerToLpRelaxation( ILPSolver &gurobi,
                                                   const Layer *layer,
                                                   bool createVariables )
 {
@@ -1332,11 +1255,11 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
         SoftmaxBoundType boundType = Options::get()->getSoftmaxBoundType();
 
 
-        List<GurobiWrapper::Term> terms;
+        List<ILPSolver::Term> terms;
         if ( FloatUtils::areEqual( lb, ub ) )
         {
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
             gurobi.addEqConstraint( terms, ub );
         }
         else
@@ -1354,7 +1277,7 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
                 if ( !useLSE2 )
                 {
                     terms.clear();
-                    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                     bias = DeepPolySoftmaxElement::LSELowerBound(
                         sourceMids, sourceLbs, sourceUbs, index );
                     for ( const auto &source : sources )
@@ -1365,7 +1288,7 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
                         double dldj = DeepPolySoftmaxElement::dLSELowerBound(
                             sourceMids, sourceLbs, sourceUbs, index, inputIndex );
                         terms.append(
-                            GurobiWrapper::Term( -dldj, Stringf( "x%u", sourceVariable ) ) );
+                            ILPSolver::Term( -dldj, Stringf( "x%u", sourceVariable ) ) );
                         bias -= dldj * sourceMids[inputIndex];
                         ++inputIndex;
                     }
@@ -1374,7 +1297,7 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
                 else
                 {
                     terms.clear();
-                    terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                    terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                     bias = DeepPolySoftmaxElement::LSELowerBound2(
                         sourceMids, sourceLbs, sourceUbs, index );
                     for ( const auto &source : sources )
@@ -1385,7 +1308,7 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
                         double dldj = DeepPolySoftmaxElement::dLSELowerBound2(
                             sourceMids, sourceLbs, sourceUbs, index, inputIndex );
                         terms.append(
-                            GurobiWrapper::Term( -dldj, Stringf( "x%u", sourceVariable ) ) );
+                            ILPSolver::Term( -dldj, Stringf( "x%u", sourceVariable ) ) );
                         bias -= dldj * sourceMids[inputIndex];
                         ++inputIndex;
                     }
@@ -1393,7 +1316,7 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
                 }
 
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                 bias = DeepPolySoftmaxElement::LSEUpperBound(
                     sourceMids, targetLbs, targetUbs, index );
                 inputIndex = 0;
@@ -1404,7 +1327,7 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
                     unsigned sourceVariable = sourceLayer->neuronToVariable( sourceNeuron );
                     double dudj = DeepPolySoftmaxElement::dLSEUpperbound(
                         sourceMids, targetLbs, targetUbs, index, inputIndex );
-                    terms.append( GurobiWrapper::Term( -dudj, Stringf( "x%u", sourceVariable ) ) );
+                    terms.append( ILPSolver::Term( -dudj, Stringf( "x%u", sourceVariable ) ) );
                     bias -= dudj * sourceMids[inputIndex];
                     ++inputIndex;
                 }
@@ -1413,7 +1336,7 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
             else if ( boundType == SoftmaxBoundType::EXPONENTIAL_RECIPROCAL_DECOMPOSITION )
             {
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                 bias =
                     DeepPolySoftmaxElement::ERLowerBound( sourceMids, sourceLbs, sourceUbs, index );
                 unsigned inputIndex = 0;
@@ -1424,14 +1347,14 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
                     unsigned sourceVariable = sourceLayer->neuronToVariable( sourceNeuron );
                     double dldj = DeepPolySoftmaxElement::dERLowerBound(
                         sourceMids, sourceLbs, sourceUbs, index, inputIndex );
-                    terms.append( GurobiWrapper::Term( -dldj, Stringf( "x%u", sourceVariable ) ) );
+                    terms.append( ILPSolver::Term( -dldj, Stringf( "x%u", sourceVariable ) ) );
                     bias -= dldj * sourceMids[inputIndex];
                     ++inputIndex;
                 }
                 gurobi.addGeqConstraint( terms, bias );
 
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
                 bias =
                     DeepPolySoftmaxElement::ERUpperBound( sourceMids, targetLbs, targetUbs, index );
                 inputIndex = 0;
@@ -1442,7 +1365,7 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
                     unsigned sourceVariable = sourceLayer->neuronToVariable( sourceNeuron );
                     double dudj = DeepPolySoftmaxElement::dERUpperBound(
                         sourceMids, targetLbs, targetUbs, index, inputIndex );
-                    terms.append( GurobiWrapper::Term( -dudj, Stringf( "x%u", sourceVariable ) ) );
+                    terms.append( ILPSolver::Term( -dudj, Stringf( "x%u", sourceVariable ) ) );
                     bias -= dudj * sourceMids[inputIndex];
                     ++inputIndex;
                 }
@@ -1452,7 +1375,7 @@ void LPFormulator::addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
     }
 }
 
-void LPFormulator::addBilinearLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addBilinearLayerToLpRelaxation( ILPSolver &gurobi,
                                                    const Layer *layer,
                                                    bool createVariables )
 {
@@ -1521,24 +1444,24 @@ void LPFormulator::addBilinearLayerToLpRelaxation( GurobiWrapper &gurobi,
             gurobi.addVariable( Stringf( "x%u", targetVariable ), lb, ub );
 
             // Lower bound: out >= l_y * x + l_x * y - l_x * l_y
-            List<GurobiWrapper::Term> terms;
+            List<ILPSolver::Term> terms;
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-            terms.append( GurobiWrapper::Term(
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            terms.append( ILPSolver::Term(
                 -sourceLbs[1],
                 Stringf( "x%u", sourceLayer->neuronToVariable( sourceNeurons[0] ) ) ) );
-            terms.append( GurobiWrapper::Term(
+            terms.append( ILPSolver::Term(
                 -sourceLbs[0],
                 Stringf( "x%u", sourceLayer->neuronToVariable( sourceNeurons[1] ) ) ) );
             gurobi.addGeqConstraint( terms, -sourceLbs[0] * sourceLbs[1] );
 
             // Upper bound: out <= u_y * x + l_x * y - l_x * u_y
             terms.clear();
-            terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-            terms.append( GurobiWrapper::Term(
+            terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+            terms.append( ILPSolver::Term(
                 -sourceUbs[1],
                 Stringf( "x%u", sourceLayer->neuronToVariable( sourceNeurons[0] ) ) ) );
-            terms.append( GurobiWrapper::Term(
+            terms.append( ILPSolver::Term(
                 -sourceLbs[0],
                 Stringf( "x%u", sourceLayer->neuronToVariable( sourceNeurons[1] ) ) ) );
             gurobi.addLeqConstraint( terms, -sourceLbs[0] * sourceUbs[1] );
@@ -1547,7 +1470,7 @@ void LPFormulator::addBilinearLayerToLpRelaxation( GurobiWrapper &gurobi,
 }
 
 
-void LPFormulator::addWeightedSumLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addWeightedSumLayerToLpRelaxation( ILPSolver &gurobi,
                                                       const Layer *layer,
                                                       bool createVariables )
 {
@@ -1581,8 +1504,8 @@ void LPFormulator::addWeightedSumLayerToLpRelaxation( GurobiWrapper &gurobi,
 
             gurobi.addVariable( Stringf( "x%u", variable ), layer->getLb( i ), layer->getUb( i ) );
 
-            List<GurobiWrapper::Term> terms;
-            terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", variable ) ) );
+            List<ILPSolver::Term> terms;
+            terms.append( ILPSolver::Term( -1, Stringf( "x%u", variable ) ) );
 
             double bias = -layer->getBias( i );
 
@@ -1597,7 +1520,7 @@ void LPFormulator::addWeightedSumLayerToLpRelaxation( GurobiWrapper &gurobi,
                     if ( !sourceLayer->neuronEliminated( j ) )
                     {
                         Stringf sourceVariableName( "x%u", sourceLayer->neuronToVariable( j ) );
-                        terms.append( GurobiWrapper::Term( weight, sourceVariableName ) );
+                        terms.append( ILPSolver::Term( weight, sourceVariableName ) );
                     }
                     else
                     {
@@ -1611,7 +1534,7 @@ void LPFormulator::addWeightedSumLayerToLpRelaxation( GurobiWrapper &gurobi,
     }
 }
 
-void LPFormulator::addLeakyReluLayerToLpRelaxation( GurobiWrapper &gurobi,
+void LPFormulator::addLeakyReluLayerToLpRelaxation( ILPSolver &gurobi,
                                                     const Layer *layer,
                                                     bool createVariables )
 {
@@ -1652,17 +1575,17 @@ void LPFormulator::addLeakyReluLayerToLpRelaxation( GurobiWrapper &gurobi,
             {
                 // The LeakyReLU is active, y = x
 
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
                 gurobi.addEqConstraint( terms, 0 );
             }
             else if ( !FloatUtils::isPositive( sourceUb ) )
             {
                 // The LeakyReLU is inactive, y = alpha * x
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -slope, Stringf( "x%u", sourceVariable ) ) );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -slope, Stringf( "x%u", sourceVariable ) ) );
                 gurobi.addEqConstraint( terms, 0 );
             }
             else
@@ -1680,20 +1603,20 @@ void LPFormulator::addLeakyReluLayerToLpRelaxation( GurobiWrapper &gurobi,
                 */
 
                 // y >= alpha * x
-                List<GurobiWrapper::Term> terms;
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -slope, Stringf( "x%u", sourceVariable ) ) );
+                List<ILPSolver::Term> terms;
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -slope, Stringf( "x%u", sourceVariable ) ) );
                 gurobi.addGeqConstraint( terms, 0 );
 
                 // y >= x, i.e. y - x >= 0
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -1, Stringf( "x%u", sourceVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -1, Stringf( "x%u", sourceVariable ) ) );
                 gurobi.addGeqConstraint( terms, 0 );
 
                 terms.clear();
-                terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
-                terms.append( GurobiWrapper::Term( -coeff, Stringf( "x%u", sourceVariable ) ) );
+                terms.append( ILPSolver::Term( 1, Stringf( "x%u", targetVariable ) ) );
+                terms.append( ILPSolver::Term( -coeff, Stringf( "x%u", sourceVariable ) ) );
                 gurobi.addLeqConstraint( terms, bias );
             }
         }
@@ -16,15 +16,12 @@
 #ifndef __LPFormulator_h__
 #define __LPFormulator_h__
 
-#include "GurobiWrapper.h"
+#include "ILPSolver.h"
 #include "LayerOwner.h"
 #include "Map.h"
 #include "ParallelSolver.h"
 
 #include <atomic>
-#include <boost/chrono.hpp>
-#include <boost/lockfree/queue.hpp>
-#include <boost/thread.hpp>
 #include <climits>
 #include <mutex>
 
@@ -57,6 +54,12 @@ public:
                                                    unsigned targetIndex );
     void optimizeBoundsWithIncrementalLpRelaxation( const Map<unsigned, Layer *> &layers );
 
+    /*
+      Create a solver for the LP relaxation: Gurobi if it is
+      available, or Marabou's native LP solver otherwise
+    */
+    static ILPSolver *createLPSolver();
+
     /*
       When optimizing, we compute lower and upper bounds for each
       varibale. If a cutoff value is set, once one of these bounds
@@ -71,69 +74,75 @@ public:
       tightening
     */
     void createLPRelaxation( const Map<unsigned, Layer *> &layers,
-                             GurobiWrapper &gurobi,
+                             ILPSolver &gurobi,
                              unsigned lastLayer = UINT_MAX );
     void createLPRelaxationAfter( const Map<unsigned, Layer *> &layers,
-                                  GurobiWrapper &gurobi,
+                                  ILPSolver &gurobi,
                                   unsigned firstLayer );
-    double solveLPRelaxation( GurobiWrapper &gurobi,
+    double solveLPRelaxation( ILPSolver &gurobi,
                               const Map<unsigned, Layer *> &layers,
                               MinOrMax minOrMax,
                               String variableName,
                               unsigned lastLayer = UINT_MAX );
 
-    void addLayerToModel( GurobiWrapper &gurobi, const Layer *layer, bool createVariables );
+    void addLayerToModel( ILPSolver &gurobi, const Layer *layer, bool createVariables );
 
 private:
     LayerOwner *_layerOwner;
     bool _cutoffInUse;
     double _cutoffValue;
 
-    void addInputLayerToLpRelaxation( GurobiWrapper &gurobi, const Layer *layer );
+    void addInputLayerToLpRelaxation( ILPSolver &gurobi, const Layer *layer );
 
     void
-    addReluLayerToLpRelaxation( GurobiWrapper &gurobi, const Layer *layer, bool createVariables );
+    addReluLayerToLpRelaxation( ILPSolver &gurobi, const Layer *layer, bool createVariables );
 
-    void addLeakyReluLayerToLpRelaxation( GurobiWrapper &gurobi,
+    void addLeakyReluLayerToLpRelaxation( ILPSolver &gurobi,
                                           const Layer *layer,
                                           bool createVariables );
 
     void
-    addSignLayerToLpRelaxation( GurobiWrapper &gurobi, const Layer *layer, bool createVariables );
+    addSignLayerToLpRelaxation( ILPSolver &gurobi, const Layer *layer, bool createVariables );
 
     void
-    addMaxLayerToLpRelaxation( GurobiWrapper &gurobi, const Layer *layer, bool createVariables );
+    addMaxLayerToLpRelaxation( ILPSolver &gurobi, const Layer *layer, bool createVariables );
 
     void
-    addRoundLayerToLpRelaxation( GurobiWrapper &gurobi, const Layer *layer, bool createVariables );
+    addRoundLayerToLpRelaxation( ILPSolver &gurobi, const Layer *layer, bool createVariables );
 
-    void addAbsoluteValueLayerToLpRelaxation( GurobiWrapper &gurobi,
+    void addAbsoluteValueLayerToLpRelaxation( ILPSolver &gurobi,
                                               const Layer *layer,
                                               bool createVariables );
 
-    void addSigmoidLayerToLpRelaxation( GurobiWrapper &gurobi,
+    void addSigmoidLayerToLpRelaxation( ILPSolver &gurobi,
                                         const Layer *layer,
                                         bool createVariables );
 
-    void addSoftmaxLayerToLpRelaxation( GurobiWrapper &gurobi,
+    void addSoftmaxLayerToLpRelaxation( ILPSolver &gurobi,
                                         const Layer *layer,
                                         bool createVariables );
 
-    void addBilinearLayerToLpRelaxation( GurobiWrapper &gurobi,
+    void addBilinearLayerToLpRelaxation( ILPSolver &gurobi,
                                          const Layer *layer,
                                          bool createVariables );
 
-    void addWeightedSumLayerToLpRelaxation( GurobiWrapper &gurobi,
+    void addWeightedSumLayerToLpRelaxation( ILPSolver &gurobi,
                                             const Layer *layer,
                                             bool createVariables );
 
+    /*
+      Tighten the neurons of a single layer, in batches, using the
+      thread pool. Returns once all of the layer's neurons are done.
+    */
     void optimizeBoundsOfNeuronsWithLpRlaxation( ThreadArgument &args, bool backward );
 
+    ILPSolver *createSolver();
+
     /*
       Optimize for the min/max value of variableName with respect to the constraints
       encoded in gurobi. If the query is infeasible, *infeasible is set to true.
     */
-    static double optimizeWithGurobi( GurobiWrapper &gurobi,
+    static double optimizeWithGurobi( ILPSolver &gurobi,
                                       MinOrMax minOrMax,
                                       String variableName,
                                       double cutoffValue,
@@ -50,6 +50,9 @@ Layer::Layer( unsigned index, Type type, unsigned size, LayerOwner *layerOwner )
     , _symbolicUbOfLb( NULL )
     , _symbolicLbOfUb( NULL )
     , _symbolicUbOfUb( NULL )
+    , _lbAtSymbolicComputation( NULL )
+    , _ubAtSymbolicComputation( NULL )
+    , _symbolicBoundsComputed( false )
 {
     allocateMemory();
 }
@@ -98,6 +101,9 @@ void Layer::allocateMemory()
         std::fill_n( _symbolicUbOfLb, _size, 0 );
         std::fill_n( _symbolicLbOfUb, _size, 0 );
         std::fill_n( _symbolicUbOfUb, _size, 0 );
+
+        _lbAtSymbolicComputation = new double[_size];
+        _ubAtSymbolicComputation = new double[_size];
     }
 }
 
@@ -480,6 +486,7 @@ void Layer::addSourceLayer( unsigned layerNumber, unsigned layerSize )
         return;
 
     _sourceLayers[layerNumber] = layerSize;
+    invalidateSymbolicBounds();
 
     if ( _type == WEIGHTED_SUM )
     {
@@ -493,7 +500,7 @@ void Layer::addSourceLayer( unsigned layerNumber, unsigned layerSize )
     }
 }
 
-const Map<unsigned, unsigned> &Layer::getSourceLayers() const
+const FlatMap<unsigned, unsigned> &Layer::getSourceLayers() const
 {
     return _sourceLayers;
 }
@@ -521,11 +528,13 @@ void Layer::removeSourceLayer( unsigned sourceLayer )
     delete[] _layerToWeights[sourceLayer];
     delete[] _layerToPositiveWeights[sourceLayer];
     delete[] _layerToNegativeWeights[sourceLayer];
+    invalidateSparseWeights( sourceLayer );
 
     _sourceLayers.erase( sourceLayer );
     _layerToWeights.erase( sourceLayer );
     _layerToPositiveWeights.erase( sourceLayer );
     _layerToNegativeWeights.erase( sourceLayer );
+    invalidateSymbolicBounds();
 }
 
 void Layer::setWeight( unsigned sourceLayer,
@@ -546,6 +555,9 @@ void Layer::setWeight( unsigned sourceLayer,
         _layerToPositiveWeights[sourceLayer][index] = 0;
         _layerToNegativeWeights[sourceLayer][index] = weight;
     }
+
+    invalidateSparseWeights( sourceLayer );
+    invalidateSymbolicBounds();
 }
 
 double Layer::getWeight( unsigned sourceLayer, unsigned sourceNeuron, unsigned targetNeuron ) const
@@ -569,9 +581,57 @@ double *Layer::getNegativeWeights( unsigned sourceLayerIndex ) const
     return _layerToNegativeWeights[sourceLayerIndex];
 }
 
+const CSRMatrix *Layer::getSparseWeights( unsigned sourceLayerIndex )
+{
+    ASSERT( _layerToWeights.exists( sourceLayerIndex ) );
+
+    if ( _layerToSparseWeights.exists( sourceLayerIndex ) )
+        return _layerToSparseWeights[sourceLayerIndex];
+
+    unsigned sourceLayerSize = _sourceLayers[sourceLayerIndex];
+    const double *weights = _layerToWeights[sourceLayerIndex];
+
+    unsigned nnz = 0;
+    for ( unsigned i = 0; i < sourceLayerSize * _size; ++i )
+    {
+        if ( !FloatUtils::isZero( weights[i] ) )
+            ++nnz;
+    }
+
+    // A NULL entry indicates that the dense matrices should be used
+    CSRMatrix *sparseWeights = NULL;
+    if ( nnz <= GlobalConfiguration::NLR_SPARSE_WEIGHTS_DENSITY_THRESHOLD * sourceLayerSize *
+                    _size )
+        sparseWeights = new CSRMatrix( weights, sourceLayerSize, _size );
+
+    _layerToSparseWeights[sourceLayerIndex] = sparseWeights;
+    return sparseWeights;
+}
+
+void Layer::invalidateSparseWeights( unsigned sourceLayerIndex )
+{
+    if ( !_layerToSparseWeights.exists( sourceLayerIndex ) )
+        return;
+
+    if ( _layerToSparseWeights[sourceLayerIndex] )
+        delete _layerToSparseWeights[sourceLayerIndex];
+    _layerToSparseWeights.erase( sourceLayerIndex );
+}
+
+void Layer::freeSparseWeights()
+{
+    for ( const auto &sparseWeights : _layerToSparseWeights )
+    {
+        if ( sparseWeights.second )
+            delete sparseWeights.second;
+    }
+    _layerToSparseWeights.clear();
+}
+
 void Layer::setBias( unsigned neuron, double bias )
 {
     _bias[neuron] = bias;
+    invalidateSymbolicBounds();
 }
 
 double Layer::getBias( unsigned neuron ) const
@@ -596,6 +656,7 @@ void Layer::addActivationSource( unsigned sourceLayer,
         _neuronToActivationSources[targetNeuron] = List<NeuronIndex>();
 
     _neuronToActivationSources[targetNeuron].append( NeuronIndex( sourceLayer, sourceNeuron ) );
+    invalidateSymbolicBounds();
 
     DEBUG( {
         if ( _type == RELU || _type == LEAKY_RELU || _type == ABSOLUTE_VALUE || _type == SIGN ||
@@ -625,6 +686,7 @@ void Layer::setNeuronVariable( unsigned neuron, unsigned variable )
 
     _neuronToVariable[neuron] = variable;
     _variableToNeuron[variable] = neuron;
+    invalidateSymbolicBounds();
 }
 
 void Layer::obtainCurrentBounds( const Query &inputQuery )
@@ -774,6 +836,40 @@ void Layer::computeIntervalArithmeticBoundsForWeightedSum()
         const Layer *sourceLayer = _layerOwner->getLayer( sourceLayerIndex );
         const double *weights = _layerToWeights[sourceLayerIndex];
 
+        const CSRMatrix *sparseWeights = getSparseWeights( sourceLayerIndex );
+        if ( sparseWeights )
+        {
+            // Only visit the non-zero weights, row by row
+            const double *A = sparseWeights->getA();
+            const unsigned *IA = sparseWeights->getIA();
+            const unsigned *JA = sparseWeights->getJA();
+
+            for ( unsigned j = 0; j < sourceLayerSize; ++j )
+            {
+                double previousLb = sourceLayer->getLb( j );
+                double previousUb = sourceLayer->getUb( j );
+
+                for ( unsigned entry = IA[j]; entry < IA[j + 1]; ++entry )
+                {
+                    unsigned i = JA[entry];
+                    double weight = A[entry];
+
+                    if ( weight > 0 )
+                    {
+                        newLb[i] += weight * previousLb;
+                        newUb[i] += weight * previousUb;
+                    }
+                    else
+                    {
+                        newLb[i] += weight * previousUb;
+                        newUb[i] += weight * previousLb;
+                    }
+                }
+            }
+
+            continue;
+        }
+
         for ( unsigned i = 0; i < _size; ++i )
         {
             for ( unsigned j = 0; j < sourceLayerSize; ++j )
@@ -1333,6 +1429,9 @@ void Layer::computeIntervalArithmeticBoundsForBilinear()
 
 void Layer::computeSymbolicBounds()
 {
+    // If the computation is interrupted, the symbolic bounds are left stale
+    invalidateSymbolicBounds();
+
     switch ( _type )
     {
     case INPUT:
@@ -1383,6 +1482,34 @@ void Layer::computeSymbolicBounds()
         computeSymbolicBoundsDefault();
         break;
     }
+
+    if ( _lbAtSymbolicComputation )
+    {
+        memcpy( _lbAtSymbolicComputation, _lb, sizeof( double ) * _size );
+        memcpy( _ubAtSymbolicComputation, _ub, sizeof( double ) * _size );
+        _symbolicBoundsComputed = true;
+    }
+}
+
+bool Layer::symbolicBoundsUpToDate() const
+{
+    if ( !_symbolicBoundsComputed )
+        return false;
+
+    // Bounds are compared exactly: any change, including a loosening
+    // after backtracking, requires recomputation
+    for ( unsigned i = 0; i < _size; ++i )
+    {
+        if ( _lb[i] != _lbAtSymbolicComputation[i] || _ub[i] != _ubAtSymbolicComputation[i] )
+            return false;
+    }
+
+    return true;
+}
+
+void Layer::invalidateSymbolicBounds()
+{
+    _symbolicBoundsComputed = false;
 }
 
 void Layer::computeSymbolicBoundsDefault()
@@ -3263,30 +3390,67 @@ void Layer::computeSymbolicBoundsForWeightedSum()
           newLB = oldUB * negWeights + oldLB * posWeights
         */
 
-        matrixMultiplication( sourceLayer->getSymbolicUb(),
-                              _layerToPositiveWeights[sourceLayerIndex],
-                              _symbolicUb,
-                              _inputLayerSize,
-                              sourceLayerSize,
-                              _size );
-        matrixMultiplication( sourceLayer->getSymbolicLb(),
-                              _layerToNegativeWeights[sourceLayerIndex],
-                              _symbolicUb,
-                              _inputLayerSize,
-                              sourceLayerSize,
-                              _size );
-        matrixMultiplication( sourceLayer->getSymbolicLb(),
-                              _layerToPositiveWeights[sourceLayerIndex],
-                              _symbolicLb,
-                              _inputLayerSize,
-                              sourceLayerSize,
-                              _size );
-        matrixMultiplication( sourceLayer->getSymbolicUb(),
-                              _layerToNegativeWeights[sourceLayerIndex],
-                              _symbolicLb,
-                              _inputLayerSize,
-                              sourceLayerSize,
-                              _size );
+        const CSRMatrix *sparseWeights = getSparseWeights( sourceLayerIndex );
+        if ( sparseWeights )
+        {
+            /*
+              Sparse weights: a single sweep over the non-zero weights
+              updates both bounds. Each weight is sent to the upper or
+              lower symbolic bound according to its sign.
+            */
+            const double *A = sparseWeights->getA();
+            const unsigned *IA = sparseWeights->getIA();
+            const unsigned *JA = sparseWeights->getJA();
+
+            const double *sourceSymbolicLb = sourceLayer->getSymbolicLb();
+            const double *sourceSymbolicUb = sourceLayer->getSymbolicUb();
+
+            for ( unsigned i = 0; i < _inputLayerSize; ++i )
+            {
+                const double *sourceLbRow = sourceSymbolicLb + i * sourceLayerSize;
+                const double *sourceUbRow = sourceSymbolicUb + i * sourceLayerSize;
+                double *lbRow = _symbolicLb + i * _size;
+                double *ubRow = _symbolicUb + i * _size;
+
+                for ( unsigned k = 0; k < sourceLayerSize; ++k )
+                {
+                    double sourceLb = sourceLbRow[k];
+                    double sourceUb = sourceUbRow[k];
+
+                    if ( sourceLb == 0 && sourceUb == 0 )
+                        continue;
+
+                    for ( unsigned entry = IA[k]; entry < IA[k + 1]; ++entry )
+                    {
+                        unsigned j = JA[entry];
+                        double weight = A[entry];
+
+                        if ( weight > 0 )
+                        {
+                            ubRow[j] += sourceUb * weight;
+                            lbRow[j] += sourceLb * weight;
+                        }
+                        else
+                        {
+                            ubRow[j] += sourceLb * weight;
+                            lbRow[j] += sourceUb * weight;
+                        }
+                    }
+                }
+            }
+        }
+        else
+        {
+            symbolicBoundMultiplication( sourceLayer->getSymbolicLb(),
+                                         sourceLayer->getSymbolicUb(),
+                                         _layerToPositiveWeights[sourceLayerIndex],
+                                         _layerToNegativeWeights[sourceLayerIndex],
+                                         _symbolicLb,
+                                         _symbolicUb,
+                                         _inputLayerSize,
+                                         sourceLayerSize,
+                                         _size );
+        }
 
         // Restore the zero bound on eliminated neurons
         unsigned index;
@@ -3303,30 +3467,56 @@ void Layer::computeSymbolicBoundsForWeightedSum()
         /*
           Compute the biases for the new layer
         */
-        for ( unsigned j = 0; j < _size; ++j )
+        if ( sparseWeights )
         {
-            if ( _eliminatedNeurons.exists( j ) )
-                continue;
+            const double *A = sparseWeights->getA();
+            const unsigned *IA = sparseWeights->getIA();
+            const unsigned *JA = sparseWeights->getJA();
 
-            // Add the weighted bias from the source layer
             for ( unsigned k = 0; k < sourceLayerSize; ++k )
             {
-                double weight = _layerToWeights[sourceLayerIndex][k * _size + j];
+                double sourceLowerBias = sourceLayer->getSymbolicLowerBias()[k];
+                double sourceUpperBias = sourceLayer->getSymbolicUpperBias()[k];
 
-                if ( weight > 0 )
-                {
-                    _symbolicLowerBias[j] += sourceLayer->getSymbolicLowerBias()[k] * weight;
-                    _symbolicUpperBias[j] += sourceLayer->getSymbolicUpperBias()[k] * weight;
-                }
-                else
+                for ( unsigned entry = IA[k]; entry < IA[k + 1]; ++entry )
                 {
-                    _symbolicLowerBias[j] += sourceLayer->getSymbolicUpperBias()[k] * weight;
-                    _symbolicUpperBias[j] += sourceLayer->getSymbolicLowerBias()[k] * weight;
+                    unsigned j = JA[entry];
+                    double weight = A[entry];
+
+                    if ( weight > 0 )
+                    {
+                        _symbolicLowerBias[j] += sourceLowerBias * weight;
+                        _symbolicUpperBias[j] += sourceUpperBias * weight;
+                    }
+                    else
+                    {
+                        _symbolicLowerBias[j] += sourceUpperBias * weight;
+                        _symbolicUpperBias[j] += sourceLowerBias * weight;
+                    }
                 }
             }
         }
-    }
+        else
+        {
+            // The biases are a single row of symbolic bounds
+            symbolicBoundMultiplication( sourceLayer->getSymbolicLowerBias(),
+                                         sourceLayer->getSymbolicUpperBias(),
+                                         _layerToPositiveWeights[sourceLayerIndex],
+                                         _layerToNegativeWeights[sourceLayerIndex],
+                                         _symbolicLowerBias,
+                                         _symbolicUpperBias,
+                                         1,
+                                         sourceLayerSize,
+                                         _size );
+        }
 
+        // Eliminated neurons keep their fixed values
+        for ( const auto &eliminated : _eliminatedNeurons )
+        {
+            _symbolicLowerBias[eliminated.first] = eliminated.second;
+            _symbolicUpperBias[eliminated.first] = eliminated.second;
+        }
+    }
 
     /*
       We now have the symbolic representation for the current
@@ -3721,6 +3911,7 @@ void Layer::eliminateVariable( unsigned variable, double value )
     _ub[neuron] = value;
     _neuronToVariable.erase( _variableToNeuron[variable] );
     _variableToNeuron.erase( variable );
+    invalidateSymbolicBounds();
 }
 
 void Layer::updateVariableIndices( const Map<unsigned, unsigned> &oldIndexToNewIndex,
@@ -3767,6 +3958,8 @@ void Layer::updateVariableIndices( const Map<unsigned, unsigned> &oldIndexToNewI
             continue;
         }
     }
+
+    invalidateSymbolicBounds();
 }
 
 unsigned Layer::getLayerIndex() const
@@ -3788,6 +3981,9 @@ Layer::Layer( const Layer *other )
     , _symbolicUbOfLb( NULL )
     , _symbolicLbOfUb( NULL )
     , _symbolicUbOfUb( NULL )
+    , _lbAtSymbolicComputation( NULL )
+    , _ubAtSymbolicComputation( NULL )
+    , _symbolicBoundsComputed( false )
 {
     _layerIndex = other->_layerIndex;
     _type = other->_type;
@@ -3885,6 +4081,8 @@ void Layer::freeMemoryIfNeeded()
         delete[] weights.second;
     _layerToNegativeWeights.clear();
 
+    freeSparseWeights();
+
     if ( _bias )
     {
         delete[] _bias;
@@ -3956,6 +4154,20 @@ void Layer::freeMemoryIfNeeded()
         delete[] _symbolicUbOfUb;
         _symbolicUbOfUb = NULL;
     }
+
+    if ( _lbAtSymbolicComputation )
+    {
+        delete[] _lbAtSymbolicComputation;
+        _lbAtSymbolicComputation = NULL;
+    }
+
+    if ( _ubAtSymbolicComputation )
+    {
+        delete[] _ubAtSymbolicComputation;
+        _ubAtSymbolicComputation = NULL;
+    }
+
+    _symbolicBoundsComputed = false;
 }
 
 String Layer::typeToString( Type type )
@@ -4132,12 +4344,13 @@ double Layer::getEliminatedNeuronValue( unsigned neuron ) const
 void Layer::reduceIndexFromAllMaps( unsigned startIndex )
 {
     // Adjust the source layers
-    Map<unsigned, unsigned> copyOfSources = _sourceLayers;
+    FlatMap<unsigned, unsigned> copyOfSources = _sourceLayers;
     _sourceLayers.clear();
     for ( const auto &pair : copyOfSources )
         _sourceLayers[pair.first >= startIndex ? pair.first - 1 : pair.first] = pair.second;
 
-    // Adjust all weight maps
+    // Adjust all weight maps. The sparse weights are rebuilt on demand.
+    freeSparseWeights();
     adjustWeightMapIndexing( _layerToWeights, startIndex );
     adjustWeightMapIndexing( _layerToPositiveWeights, startIndex );
     adjustWeightMapIndexing( _layerToNegativeWeights, startIndex );
@@ -4151,6 +4364,8 @@ void Layer::reduceIndexFromAllMaps( unsigned startIndex )
                 --source._layer;
         }
     }
+
+    invalidateSymbolicBounds();
 }
 
 void Layer::adjustWeightMapIndexing( Map<unsigned, double *> &map, unsigned startIndex )
@@ -4165,6 +4380,8 @@ void Layer::reduceIndexAfterMerge( unsigned startIndex )
 {
     if ( _layerIndex >= startIndex )
         --_layerIndex;
+
+    invalidateSymbolicBounds();
 }
 
 bool Layer::operator==( const Layer &layer ) const
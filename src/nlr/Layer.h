@@ -17,7 +17,9 @@
 #define __Layer_h__
 
 #include "AbsoluteValueConstraint.h"
+#include "CSRMatrix.h"
 #include "Debug.h"
+#include "FlatMap.h"
 #include "FloatUtils.h"
 #include "LayerOwner.h"
 #include "MarabouError.h"
@@ -63,7 +65,7 @@ public:
     void addSourceLayer( unsigned layerNumber, unsigned layerSize );
     void addSuccessorLayer( unsigned layerNumber );
     void removeSourceLayer( unsigned sourceLayer );
-    const Map<unsigned, unsigned> &getSourceLayers() const;
+    const FlatMap<unsigned, unsigned> &getSourceLayers() const;
     const Set<unsigned> &getSuccessorLayers() const;
     const double *getWeightMatrix( unsigned sourceLayer ) const;
 
@@ -81,6 +83,14 @@ public:
     double *getPositiveWeights( unsigned sourceLayerIndex ) const;
     double *getNegativeWeights( unsigned sourceLayerIndex ) const;
 
+    /*
+      A CSR copy of the weight matrix of the given source layer. It is
+      built lazily and discarded whenever the weights change. NULL is
+      returned if the matrix is too dense for the sparse representation
+      to pay off, in which case the dense matrices should be used.
+    */
+    const CSRMatrix *getSparseWeights( unsigned sourceLayerIndex );
+
     void setBias( unsigned neuron, double bias );
     double getBias( unsigned neuron ) const;
     double *getBiases() const;
@@ -139,6 +149,15 @@ public:
     void computeSymbolicBounds();
     void computeIntervalArithmeticBounds();
 
+    /*
+      The symbolic bounds of a layer are up to date if they have been
+      computed, and its bounds have not changed since. Changes to the
+      structure of the layer (weights, biases, sources, variables)
+      invalidate them.
+    */
+    bool symbolicBoundsUpToDate() const;
+    void invalidateSymbolicBounds();
+
     /*
       Preprocessing functionality: variable elimination and reindexing
     */
@@ -169,12 +188,13 @@ private:
     unsigned _size;
     LayerOwner *_layerOwner;
 
-    Map<unsigned, unsigned> _sourceLayers;
+    FlatMap<unsigned, unsigned> _sourceLayers;
     Set<unsigned> _successorLayers;
 
     Map<unsigned, double *> _layerToWeights;
     Map<unsigned, double *> _layerToPositiveWeights;
     Map<unsigned, double *> _layerToNegativeWeights;
+    Map<unsigned, CSRMatrix *> _layerToSparseWeights;
     double *_bias;
 
     double *_assignment;
@@ -186,9 +206,9 @@ private:
 
     Map<unsigned, List<NeuronIndex>> _neuronToActivationSources;
 
-    Map<unsigned, unsigned> _neuronToVariable;
-    Map<unsigned, unsigned> _variableToNeuron;
-    Map<unsigned, double> _eliminatedNeurons;
+    FlatMap<unsigned, unsigned> _neuronToVariable;
+    FlatMap<unsigned, unsigned> _variableToNeuron;
+    FlatMap<unsigned, double> _eliminatedNeurons;
 
     unsigned _inputLayerSize;
     double *_symbolicLb;
@@ -200,6 +220,14 @@ private:
     double *_symbolicLbOfUb;
     double *_symbolicUbOfUb;
 
+    /*
+      The bounds of the layer when its symbolic bounds were last
+      computed, used for detecting changes
+    */
+    double *_lbAtSymbolicComputation;
+    double *_ubAtSymbolicComputation;
+    bool _symbolicBoundsComputed;
+
     // A field variable to store parameter value. Right now it is only used to store the slope of
     // leaky relus. Moving forward, we should keep a parameter map (e.g., Map<String, void *>)
     // to store layer-specific information like "weights" and "alpha".
@@ -208,6 +236,12 @@ private:
     void allocateMemory();
     void freeMemoryIfNeeded();
 
+    /*
+      Discard the cached sparse weights of one, or all, source layers
+    */
+    void invalidateSparseWeights( unsigned sourceLayerIndex );
+    void freeSparseWeights();
+
     /*
        The following methods compute concrete softmax output bounds
        using different linear approximation, as well as the coefficients
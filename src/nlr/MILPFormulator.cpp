@@ -25,7 +25,6 @@
 #include "TimeUtils.h"
 #include "Vector.h"
 
-#include <boost/thread.hpp>
 
 namespace NLR {
 
@@ -44,6 +43,11 @@ MILPFormulator::~MILPFormulator()
 {
 }
 
+ILPSolver *MILPFormulator::createSolver()
+{
+    return new GurobiWrapper();
+}
+
 void MILPFormulator::optimizeBoundsWithIncrementalMILPEncoding(
     const Map<unsigned, Layer *> &layers )
 {
@@ -151,21 +155,6 @@ void MILPFormulator::optimizeBoundsWithIncrementalMILPEncoding(
 
 void MILPFormulator::optimizeBoundsWithMILPEncoding( const Map<unsigned, Layer *> &layers )
 {
-    unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
-
-    Map<GurobiWrapper *, unsigned> solverToIndex;
-    // Create a queue of free workers
-    // When a worker is working, it is popped off the queue, when it is done, it
-    // is added back to the queue.
-    SolverQueue freeSolvers( numberOfWorkers );
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        GurobiWrapper *gurobi = new GurobiWrapper();
-        solverToIndex[gurobi] = i;
-        enqueueSolver( freeSolvers, gurobi );
-    }
-
-    boost::thread *threads = new boost::thread[numberOfWorkers];
     std::mutex mtx;
     std::atomic_bool infeasible( false );
 
@@ -181,26 +170,18 @@ void MILPFormulator::optimizeBoundsWithMILPEncoding( const Map<unsigned, Layer *
 
         ThreadArgument argument( layer,
                                  &layers,
-                                 std::ref( freeSolvers ),
                                  std::ref( mtx ),
                                  std::ref( infeasible ),
                                  std::ref( tighterBoundCounter ),
                                  std::ref( signChanges ),
                                  std::ref( cutoffs ),
                                  layer->getLayerIndex(),
-                                 currentLayer.first,
-                                 threads,
-                                 &solverToIndex );
+                                 currentLayer.first );
 
         // optimize every neuron of layer
         optimizeBoundsOfNeuronsWithMILPEncoding( argument );
     }
 
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        threads[i].join();
-    }
-
     struct timespec gurobiEnd = TimeUtils::sampleMicro();
 
     log( Stringf( "Number of tighter bounds found by Gurobi: %u. Sign changes: %u. Cutoffs: %u\n",
@@ -209,30 +190,11 @@ void MILPFormulator::optimizeBoundsWithMILPEncoding( const Map<unsigned, Layer *
                   cutoffs.load() ) );
     log( Stringf( "Seconds spent Gurobiing: %llu\n",
                   TimeUtils::timePassed( gurobiStart, gurobiEnd ) / 1000000 ) );
-    clearSolverQueue( freeSolvers );
-
-    if ( infeasible )
-        throw InfeasibleQueryException();
 }
 
 void MILPFormulator::optimizeBoundsOfOneLayerWithMILPEncoding( const Map<unsigned, Layer *> &layers,
                                                                unsigned targetIndex )
 {
-    unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
-
-    Map<GurobiWrapper *, unsigned> solverToIndex;
-    // Create a queue of free workers
-    // When a worker is working, it is popped off the queue, when it is done, it
-    // is added back to the queue.
-    SolverQueue freeSolvers( numberOfWorkers );
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        GurobiWrapper *gurobi = new GurobiWrapper();
-        solverToIndex[gurobi] = i;
-        enqueueSolver( freeSolvers, gurobi );
-    }
-
-    boost::thread *threads = new boost::thread[numberOfWorkers];
     std::mutex mtx;
     std::atomic_bool infeasible( false );
 
@@ -246,25 +208,17 @@ void MILPFormulator::optimizeBoundsOfOneLayerWithMILPEncoding( const Map<unsigne
 
     ThreadArgument argument( layer,
                              &layers,
-                             std::ref( freeSolvers ),
                              std::ref( mtx ),
                              std::ref( infeasible ),
                              std::ref( tighterBoundCounter ),
                              std::ref( signChanges ),
                              std::ref( cutoffs ),
                              layers.size() - 1,
-                             targetIndex,
-                             threads,
-                             &solverToIndex );
+                             targetIndex );
 
     // optimize every neuron of layer
     optimizeBoundsOfNeuronsWithMILPEncoding( argument );
 
-    for ( unsigned i = 0; i < numberOfWorkers; ++i )
-    {
-        threads[i].join();
-    }
-
     struct timespec gurobiEnd = TimeUtils::sampleMicro();
 
     log( Stringf( "Number of tighter bounds found by Gurobi: %u. Sign changes: %u. Cutoffs: %u\n",
@@ -273,35 +227,14 @@ void MILPFormulator::optimizeBoundsOfOneLayerWithMILPEncoding( const Map<unsigne
                   cutoffs.load() ) );
     log( Stringf( "Seconds spent Gurobiing: %llu\n",
                   TimeUtils::timePassed( gurobiStart, gurobiEnd ) / 1000000 ) );
-    clearSolverQueue( freeSolvers );
-
-    if ( infeasible )
-        throw InfeasibleQueryException();
 }
 
 void MILPFormulator::optimizeBoundsOfNeuronsWithMILPEncoding( ThreadArgument &args )
 {
-    unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
-
-    // Time to wait if no idle worker is availble
-    boost::chrono::milliseconds waitTime( numberOfWorkers - 1 );
+    SolverThreadPool &threadPool = getThreadPool();
 
     Layer *layer = args._layer;
-    const Map<unsigned, Layer *> &layers = *args._layers;
     unsigned targetIndex = args._targetIndex;
-    unsigned lastIndexOfRelaxation = args._lastIndexOfRelaxation;
-
-    Map<GurobiWrapper *, unsigned> solverToIndex = *args._solverToIndex;
-    SolverQueue &freeSolvers = args._freeSolvers;
-    std::mutex &mtx = args._mtx;
-    std::atomic_bool &infeasible = args._infeasible;
-    std::atomic_uint &tighterBoundCounter = args._tighterBoundCounter;
-    std::atomic_uint &signChanges = args._signChanges;
-    std::atomic_uint &cutoffs = args._cutoffs;
-    boost::thread *threads = args._threads;
-
-    double currentLb;
-    double currentUb;
 
     bool skipTightenLb = false; // If true, skip lower bound tightening
     bool skipTightenUb = false; // If true, skip upper bound tightening
@@ -311,13 +244,14 @@ void MILPFormulator::optimizeBoundsOfNeuronsWithMILPEncoding( ThreadArgument &ar
     const Vector<Vector<double>> *simulations =
         _layerOwner->getLayer( targetIndex )->getSimulations();
 
+    Vector<NeuronToTighten> neurons;
     for ( unsigned i = 0; i < layer->getSize(); ++i )
     {
         if ( layer->neuronEliminated( i ) )
             continue;
 
-        currentLb = layer->getLb( i );
-        currentUb = layer->getUb( i );
+        double currentLb = layer->getLb( i );
+        double currentUb = layer->getUb( i );
 
         if ( _cutoffInUse && ( currentLb >= _cutoffValue || currentUb <= _cutoffValue ) )
             continue;
@@ -360,237 +294,231 @@ void MILPFormulator::optimizeBoundsOfNeuronsWithMILPEncoding( ThreadArgument &ar
                      .ascii() );
         }
 
-        if ( infeasible )
-        {
-            // infeasibility is derived, interupt all active threads
-            for ( unsigned i = 0; i < numberOfWorkers; ++i )
-            {
-                threads[i].interrupt();
-                threads[i].join();
-            }
-            clearSolverQueue( freeSolvers );
-            throw InfeasibleQueryException();
-        }
+        neurons.append( NeuronToTighten{ i, currentLb, currentUb, skipTightenLb, skipTightenUb } );
+    }
 
-        // Wait until there is an idle solver
-        GurobiWrapper *freeSolver;
-        while ( !freeSolvers.pop( freeSolver ) )
-            boost::this_thread::sleep_for( waitTime );
+    Vector<Batch> batches;
+    createBatches( neurons, threadPool.getNumberOfWorkers(), batches );
 
-        freeSolver->resetModel();
+    for ( const auto &batch : batches )
+    {
+        threadPool.submit( [this, &threadPool, &args, batch]( ILPSolver &solver ) {
+            for ( const auto &neuron : batch )
+            {
+                // Once infeasibility is derived, the remaining neurons are dropped
+                if ( args._infeasible )
+                {
+                    threadPool.cancelPendingTasks();
+                    return;
+                }
 
-        mtx.lock();
-        _lpFormulator.createLPRelaxation( layers, *freeSolver, lastIndexOfRelaxation );
-        mtx.unlock();
+                solver.resetModel();
 
-        // spawn a thread to tighten the bounds for the current variable
-        ThreadArgument argument( freeSolver,
-                                 layer,
-                                 &layers,
-                                 i,
-                                 currentLb,
-                                 currentUb,
-                                 _cutoffInUse,
-                                 _cutoffValue,
-                                 _layerOwner,
-                                 std::ref( freeSolvers ),
-                                 std::ref( mtx ),
-                                 std::ref( infeasible ),
-                                 std::ref( tighterBoundCounter ),
-                                 std::ref( signChanges ),
-                                 std::ref( cutoffs ),
-                                 skipTightenLb,
-                                 skipTightenUb );
+                {
+                    std::lock_guard<std::mutex> lock( args._mtx );
+                    _lpFormulator.createLPRelaxation(
+                        *args._layers, solver, args._lastIndexOfRelaxation );
+                }
 
-        if ( numberOfWorkers == 1 )
-            tightenSingleVariableBoundsWithMILPEncoding( argument );
-        else
-            threads[solverToIndex[freeSolver]] =
-                boost::thread( tightenSingleVariableBoundsWithMILPEncoding, argument );
+                ThreadArgument argument( &solver,
+                                         args._layer,
+                                         args._layers,
+                                         neuron._index,
+                                         neuron._currentLb,
+                                         neuron._currentUb,
+                                         _cutoffInUse,
+                                         _cutoffValue,
+                                         _layerOwner,
+                                         std::ref( args._mtx ),
+                                         std::ref( args._infeasible ),
+                                         std::ref( args._tighterBoundCounter ),
+                                         std::ref( args._signChanges ),
+                                         std::ref( args._cutoffs ),
+                                         neuron._skipTightenLb,
+                                         neuron._skipTightenUb );
+
+                tightenSingleVariableBoundsWithMILPEncoding( argument );
+            }
+        } );
     }
+
+    // The encoding of the next layer depends on this layer's bounds, so
+    // wait for all of its neurons to be tightened
+    threadPool.waitForCompletion();
+
+    if ( args._infeasible )
+        throw InfeasibleQueryException();
 }
 
 void MILPFormulator::tightenSingleVariableBoundsWithMILPEncoding( ThreadArgument &argument )
 {
-    try
-    {
-        /*
-          The optimiziation is performed layer by layer, and for each
-          individual neuron. It has 4 steps:
+    /*
+      The optimiziation is performed layer by layer, and for each
+      individual neuron. It has 4 steps:
+
+      1. Use an LP relaxation to minimize the variable
+      2. Use an LP relaxation to maximize the variable
+      3. Use a MILP encoding to minimize the variable
+      4. Use a MILP encoding to maximize the variable
+
+      We perform the steps in this order, and stop if at some
+      point we discover either an upper bound that is non-positive
+      or a lower obund that is non-negative (this is aimed at
+      ReLUs, as their phase would become fixed in these cases)
+    */
 
-          1. Use an LP relaxation to minimize the variable
-          2. Use an LP relaxation to maximize the variable
-          3. Use a MILP encoding to minimize the variable
-          4. Use a MILP encoding to maximize the variable
+    ILPSolver *gurobi = argument._gurobi;
+    Layer *layer = argument._layer;
+    const Map<unsigned, Layer *> &layers = *( argument._layers );
+    unsigned index = argument._index;
+    double currentLb = argument._currentLb;
+    double currentUb = argument._currentUb;
+    bool cutoffInUse = argument._cutoffInUse;
+    double cutoffValue = argument._cutoffValue;
+    LayerOwner *layerOwner = argument._layerOwner;
+    std::mutex &mtx = argument._mtx;
+    std::atomic_bool &infeasible = argument._infeasible;
+    std::atomic_uint &tighterBoundCounter = argument._tighterBoundCounter;
+    std::atomic_uint &signChanges = argument._signChanges;
+    std::atomic_uint &cutoffs = argument._cutoffs;
+    bool skipTightenLb = argument._skipTightenLb;
+    bool skipTightenUb = argument._skipTightenUb;
+
+    // LP Relaxation
+    log(
+        Stringf( "Tightening bounds for layer %u index %u", layer->getLayerIndex(), index ).ascii() );
+
+    unsigned variable = layer->neuronToVariable( index );
+    Stringf variableName( "x%u", variable );
 
-          We perform the steps in this order, and stop if at some
-          point we discover either an upper bound that is non-positive
-          or a lower obund that is non-negative (this is aimed at
-          ReLUs, as their phase would become fixed in these cases)
-        */
+    if ( !skipTightenLb )
+    {
+        log( Stringf( "Computing lowerbound..." ).ascii() );
+        double lb =
+            optimizeWithGurobi( *gurobi, MinOrMax::MIN, variableName, cutoffValue, &infeasible );
+        log( Stringf( "Lowerbound computed: %f", lb ).ascii() );
 
-        GurobiWrapper *gurobi = argument._gurobi;
-        Layer *layer = argument._layer;
-        const Map<unsigned, Layer *> &layers = *( argument._layers );
-        unsigned index = argument._index;
-        double currentLb = argument._currentLb;
-        double currentUb = argument._currentUb;
-        bool cutoffInUse = argument._cutoffInUse;
-        double cutoffValue = argument._cutoffValue;
-        LayerOwner *layerOwner = argument._layerOwner;
-        SolverQueue &freeSolvers = argument._freeSolvers;
-        std::mutex &mtx = argument._mtx;
-        std::atomic_bool &infeasible = argument._infeasible;
-        std::atomic_uint &tighterBoundCounter = argument._tighterBoundCounter;
-        std::atomic_uint &signChanges = argument._signChanges;
-        std::atomic_uint &cutoffs = argument._cutoffs;
-        bool skipTightenLb = argument._skipTightenLb;
-        bool skipTightenUb = argument._skipTightenUb;
-
-        // LP Relaxation
-        log( Stringf( "Tightening bounds for layer %u index %u", layer->getLayerIndex(), index )
-                 .ascii() );
-
-        unsigned variable = layer->neuronToVariable( index );
-        Stringf variableName( "x%u", variable );
-
-        if ( !skipTightenLb )
+        // Store the new bound if it is tighter
+        if ( lb > currentLb )
         {
-            log( Stringf( "Computing lowerbound..." ).ascii() );
-            double lb = optimizeWithGurobi(
-                *gurobi, MinOrMax::MIN, variableName, cutoffValue, &infeasible );
-            log( Stringf( "Lowerbound computed: %f", lb ).ascii() );
+            if ( FloatUtils::isNegative( currentLb ) && !FloatUtils::isNegative( lb ) )
+                ++signChanges;
 
-            // Store the new bound if it is tighter
-            if ( lb > currentLb )
-            {
-                if ( FloatUtils::isNegative( currentLb ) && !FloatUtils::isNegative( lb ) )
-                    ++signChanges;
-
-                mtx.lock();
-                layer->setLb( index, lb );
-                layerOwner->receiveTighterBound( Tightening( variable, lb, Tightening::LB ) );
-                mtx.unlock();
-                ++tighterBoundCounter;
+            mtx.lock();
+            layer->setLb( index, lb );
+            layerOwner->receiveTighterBound( Tightening( variable, lb, Tightening::LB ) );
+            mtx.unlock();
+            ++tighterBoundCounter;
 
-                if ( cutoffInUse && lb > cutoffValue )
-                {
-                    ++cutoffs;
-                    enqueueSolver( freeSolvers, gurobi );
-                    return;
-                }
+            if ( cutoffInUse && lb > cutoffValue )
+            {
+                ++cutoffs;
+                return;
             }
         }
+    }
+
+    if ( !skipTightenUb )
+    {
+        log( Stringf( "Computing upperbound..." ).ascii() );
+        gurobi->reset();
+        double ub =
+            optimizeWithGurobi( *gurobi, MinOrMax::MAX, variableName, cutoffValue, &infeasible );
+        log( Stringf( "Upperbound computed %f", ub ).ascii() );
 
-        if ( !skipTightenUb )
+        // Store the new bound if it is tighter
+        if ( ub < currentUb )
         {
-            log( Stringf( "Computing upperbound..." ).ascii() );
-            gurobi->reset();
-            double ub = optimizeWithGurobi(
-                *gurobi, MinOrMax::MAX, variableName, cutoffValue, &infeasible );
-            log( Stringf( "Upperbound computed %f", ub ).ascii() );
-
-            // Store the new bound if it is tighter
-            if ( ub < currentUb )
-            {
-                if ( FloatUtils::isPositive( currentUb ) && !FloatUtils::isPositive( ub ) )
-                    ++signChanges;
+            if ( FloatUtils::isPositive( currentUb ) && !FloatUtils::isPositive( ub ) )
+                ++signChanges;
 
-                mtx.lock();
-                layer->setUb( index, ub );
-                layerOwner->receiveTighterBound( Tightening( variable, ub, Tightening::UB ) );
-                mtx.unlock();
+            mtx.lock();
+            layer->setUb( index, ub );
+            layerOwner->receiveTighterBound( Tightening( variable, ub, Tightening::UB ) );
+            mtx.unlock();
 
-                ++tighterBoundCounter;
+            ++tighterBoundCounter;
 
-                if ( cutoffInUse && ub < cutoffValue )
-                {
-                    ++cutoffs;
-                    enqueueSolver( freeSolvers, gurobi );
-                    return;
-                }
+            if ( cutoffInUse && ub < cutoffValue )
+            {
+                ++cutoffs;
+                return;
             }
         }
+    }
 
-        gurobi->reset();
-        // Exact encoding
-        // Now, add the MILP constraints
-        unsigned lastLayer = layer->getLayerIndex();
-        for ( const auto &layer : layers )
-        {
-            if ( layer.second->getLayerIndex() > lastLayer )
-                continue;
+    gurobi->reset();
+    // Exact encoding
+    // Now, add the MILP constraints
+    unsigned lastLayer = layer->getLayerIndex();
+    for ( const auto &layer : layers )
+    {
+        if ( layer.second->getLayerIndex() > lastLayer )
+            continue;
 
-            addLayerToModel( *gurobi, layer.second, layerOwner );
-        }
+        addLayerToModel( *gurobi, layer.second, layerOwner );
+    }
 
-        if ( !skipTightenLb )
-        {
-            log( Stringf( "Computing lowerbound..." ).ascii() );
-            double lb = optimizeWithGurobi(
-                *gurobi, MinOrMax::MIN, variableName, cutoffValue, &infeasible );
-            log( Stringf( "Lowerbound computed: %f", lb ).ascii() );
+    if ( !skipTightenLb )
+    {
+        log( Stringf( "Computing lowerbound..." ).ascii() );
+        double lb =
+            optimizeWithGurobi( *gurobi, MinOrMax::MIN, variableName, cutoffValue, &infeasible );
+        log( Stringf( "Lowerbound computed: %f", lb ).ascii() );
 
-            // Store the new bound if it is tighter
-            if ( lb > currentLb )
-            {
-                if ( FloatUtils::isNegative( currentLb ) && !FloatUtils::isNegative( lb ) )
-                    ++signChanges;
+        // Store the new bound if it is tighter
+        if ( lb > currentLb )
+        {
+            if ( FloatUtils::isNegative( currentLb ) && !FloatUtils::isNegative( lb ) )
+                ++signChanges;
 
-                mtx.lock();
-                layer->setLb( index, lb );
-                layerOwner->receiveTighterBound( Tightening( variable, lb, Tightening::LB ) );
-                mtx.unlock();
-                ++tighterBoundCounter;
+            mtx.lock();
+            layer->setLb( index, lb );
+            layerOwner->receiveTighterBound( Tightening( variable, lb, Tightening::LB ) );
+            mtx.unlock();
+            ++tighterBoundCounter;
 
-                if ( cutoffInUse && lb > cutoffValue )
-                {
-                    ++cutoffs;
-                    enqueueSolver( freeSolvers, gurobi );
-                    return;
-                }
+            if ( cutoffInUse && lb > cutoffValue )
+            {
+                ++cutoffs;
+                return;
             }
         }
+    }
 
-        if ( !skipTightenUb )
-        {
-            log( Stringf( "Tightening bounds for layer %u index %u", layer->getLayerIndex(), index )
-                     .ascii() );
+    if ( !skipTightenUb )
+    {
+        log(
+            Stringf( "Tightening bounds for layer %u index %u", layer->getLayerIndex(), index )
+                .ascii() );
 
-            log( Stringf( "Computing upperbound..." ).ascii() );
-            gurobi->reset();
-            double ub = optimizeWithGurobi(
-                *gurobi, MinOrMax::MAX, variableName, cutoffValue, &infeasible );
-            log( Stringf( "Upperbound computed %f", ub ).ascii() );
+        log( Stringf( "Computing upperbound..." ).ascii() );
+        gurobi->reset();
+        double ub =
+            optimizeWithGurobi( *gurobi, MinOrMax::MAX, variableName, cutoffValue, &infeasible );
+        log( Stringf( "Upperbound computed %f", ub ).ascii() );
 
-            // Store the new bound if it is tighter
-            if ( ub < currentUb )
-            {
-                if ( FloatUtils::isPositive( currentUb ) && !FloatUtils::isPositive( ub ) )
-                    ++signChanges;
+        // Store the new bound if it is tighter
+        if ( ub < currentUb )
+        {
+            if ( FloatUtils::isPositive( currentUb ) && !FloatUtils::isPositive( ub ) )
+                ++signChanges;
 
-                mtx.lock();
-                layer->setUb( index, ub );
-                layerOwner->receiveTighterBound( Tightening( variable, ub, Tightening::UB ) );
-                mtx.unlock();
+            mtx.lock();
+            layer->setUb( index, ub );
+            layerOwner->receiveTighterBound( Tightening( variable, ub, Tightening::UB ) );
+            mtx.unlock();
 
-                ++tighterBoundCounter;
+            ++tighterBoundCounter;
 
-                if ( cutoffInUse && ub < cutoffValue )
-                    ++cutoffs;
-            }
+            if ( cutoffInUse && ub < cutoffValue )
+                ++cutoffs;
         }
-
-        enqueueSolver( freeSolvers, gurobi );
-    }
-    catch ( boost::thread_interrupted & )
-    {
-        enqueueSolver( argument._freeSolvers, argument._gurobi );
     }
 }
 
 void MILPFormulator::createMILPEncoding( const Map<unsigned, Layer *> &layers,
-                                         GurobiWrapper &gurobi,
+                                         ILPSolver &gurobi,
                                          unsigned lastLayer )
 {
     // First, create the LP relaxation of the problem
@@ -606,7 +534,7 @@ void MILPFormulator::createMILPEncoding( const Map<unsigned, Layer *> &layers,
     }
 }
 
-void MILPFormulator::addLayerToModel( GurobiWrapper &gurobi,
+void MILPFormulator::addLayerToModel( ILPSolver &gurobi,
                                       const Layer *layer,
                                       LayerOwner *layerOwner )
 {
@@ -626,7 +554,7 @@ void MILPFormulator::addLayerToModel( GurobiWrapper &gurobi,
     }
 }
 
-void MILPFormulator::addNeuronToModel( GurobiWrapper &gurobi,
+void MILPFormulator::addNeuronToModel( ILPSolver &gurobi,
                                        const Layer *layer,
                                        unsigned neuron,
                                        LayerOwner *layerOwner )
@@ -666,7 +594,7 @@ void MILPFormulator::addNeuronToModel( GurobiWrapper &gurobi,
       y - ua <= 0
     */
 
-    gurobi.addVariable( Stringf( "a%u", targetVariable ), 0, 1, GurobiWrapper::BINARY );
+    gurobi.addVariable( Stringf( "a%u", targetVariable ), 0, 1, ILPSolver::BINARY );
 
     List<GurobiWrapper::Term> terms;
     terms.append( GurobiWrapper::Term( 1, Stringf( "x%u", targetVariable ) ) );
@@ -680,7 +608,7 @@ void MILPFormulator::addNeuronToModel( GurobiWrapper &gurobi,
     gurobi.addLeqConstraint( terms, 0 );
 }
 
-void MILPFormulator::addReluLayerToMILPFormulation( GurobiWrapper &gurobi,
+void MILPFormulator::addReluLayerToMILPFormulation( ILPSolver &gurobi,
                                                     const Layer *layer,
                                                     LayerOwner *layerOwner )
 {
@@ -690,7 +618,7 @@ void MILPFormulator::addReluLayerToMILPFormulation( GurobiWrapper &gurobi,
     }
 }
 
-double MILPFormulator::optimizeWithGurobi( GurobiWrapper &gurobi,
+double MILPFormulator::optimizeWithGurobi( ILPSolver &gurobi,
                                            MinOrMax minOrMax,
                                            String variableName,
                                            double cutoffValue,
@@ -775,7 +703,7 @@ void MILPFormulator::setCutoff( double cutoff )
     _cutoffValue = cutoff;
 }
 
-bool MILPFormulator::tightenUpperBound( GurobiWrapper &gurobi,
+bool MILPFormulator::tightenUpperBound( ILPSolver &gurobi,
                                         Layer *layer,
                                         unsigned neuron,
                                         unsigned variable,
@@ -840,7 +768,7 @@ bool MILPFormulator::tightenUpperBound( GurobiWrapper &gurobi,
     return false;
 }
 
-bool MILPFormulator::tightenLowerBound( GurobiWrapper &gurobi,
+bool MILPFormulator::tightenLowerBound( ILPSolver &gurobi,
                                         Layer *layer,
                                         unsigned neuron,
                                         unsigned variable,
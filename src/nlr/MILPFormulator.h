@@ -21,8 +21,6 @@
 #include "LayerOwner.h"
 
 #include <atomic>
-#include <boost/chrono.hpp>
-#include <boost/lockfree/queue.hpp>
 #include <climits>
 #include <mutex>
 
@@ -52,7 +50,7 @@ public:
     void setCutoff( double cutoff );
 
     void createMILPEncoding( const Map<unsigned, Layer *> &layers,
-                             GurobiWrapper &gurobi,
+                             ILPSolver &gurobi,
                              unsigned lastLayer = UINT_MAX );
 
 private:
@@ -64,26 +62,26 @@ private:
     bool _cutoffInUse;
     double _cutoffValue;
 
-    bool tightenLowerBound( GurobiWrapper &gurobi,
+    bool tightenLowerBound( ILPSolver &gurobi,
                             Layer *layer,
                             unsigned neuron,
                             unsigned variable,
                             double &currentLb );
 
-    bool tightenUpperBound( GurobiWrapper &gurobi,
+    bool tightenUpperBound( ILPSolver &gurobi,
                             Layer *layer,
                             unsigned neuron,
                             unsigned variable,
                             double &currentUb );
 
     static void
-    addLayerToModel( GurobiWrapper &gurobi, const Layer *layer, LayerOwner *layerOwner );
+    addLayerToModel( ILPSolver &gurobi, const Layer *layer, LayerOwner *layerOwner );
 
-    static void addReluLayerToMILPFormulation( GurobiWrapper &gurobi,
+    static void addReluLayerToMILPFormulation( ILPSolver &gurobi,
                                                const Layer *layer,
                                                LayerOwner *layerOwner );
 
-    static void addNeuronToModel( GurobiWrapper &gurobi,
+    static void addNeuronToModel( ILPSolver &gurobi,
                                   const Layer *layer,
                                   unsigned neuron,
                                   LayerOwner *layerOwner );
@@ -92,7 +90,7 @@ private:
       Optimize for the min/max value of variableName with respect to the constraints
       encoded in gurobi. If the query is infeasible, *infeasible is set to true.
     */
-    static double optimizeWithGurobi( GurobiWrapper &gurobi,
+    static double optimizeWithGurobi( ILPSolver &gurobi,
                                       MinOrMax minOrMax,
                                       String variableName,
                                       double cutoffValue,
@@ -106,8 +104,14 @@ private:
 
     static void log( const String &message );
 
+    /*
+      Tighten the neurons of a single layer, in batches, using the
+      thread pool. Returns once all of the layer's neurons are done.
+    */
     void optimizeBoundsOfNeuronsWithMILPEncoding( ThreadArgument &args );
 
+    ILPSolver *createSolver();
+
     /*
       Tighten the upper- and lower- bound of a varaible with MILP encoding
     */
@@ -30,6 +30,7 @@
 #include "Options.h"
 #include "Query.h"
 #include "ReluConstraint.h"
+#include "Set.h"
 #include "SignConstraint.h"
 
 #include <cstring>
@@ -204,6 +205,32 @@ void NetworkLevelReasoner::symbolicBoundPropagation()
         _layerIndexToLayer[i]->computeSymbolicBounds();
 }
 
+void NetworkLevelReasoner::incrementalSymbolicBoundPropagation()
+{
+    // Layers are stored in topological order, so the sources of a layer
+    // are handled before the layer itself
+    Set<unsigned> recomputedLayers;
+    for ( unsigned i = 0; i < _layerIndexToLayer.size(); ++i )
+    {
+        Layer *layer = _layerIndexToLayer[i];
+
+        // All symbolic bounds are concretized using the input bounds
+        bool recompute = !layer->symbolicBoundsUpToDate() || recomputedLayers.exists( 0 );
+        for ( const auto &sourceLayer : layer->getSourceLayers() )
+        {
+            if ( recompute )
+                break;
+            recompute = recomputedLayers.exists( sourceLayer.first );
+        }
+
+        if ( recompute )
+        {
+            layer->computeSymbolicBounds();
+            recomputedLayers.insert( i );
+        }
+    }
+}
+
 void NetworkLevelReasoner::deepPolyPropagation()
 {
     if ( _deepPolyAnalysis == nullptr )
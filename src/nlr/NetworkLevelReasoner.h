@@ -103,6 +103,11 @@ public:
           bound on the upper bound of a ReLU node is negative, that
           ReLU is inactive and its output can be set to 0.
 
+        - Incremental symbolic: as above, but the symbolic bounds of
+          a layer are only recomputed if its bounds, or those of the
+          layers it depends on, have changed since they were last
+          computed. The other layers would not yield new tightenings.
+
         - LP Relaxation: invoking an LP solver on a series of LP
           relaxations of the problem we're trying to solve, and
           optimizing the lower and upper bounds of each of the
@@ -123,6 +128,7 @@ public:
     void obtainCurrentBounds();
     void intervalArithmeticBoundPropagation();
     void symbolicBoundPropagation();
+    void incrementalSymbolicBoundPropagation();
     void deepPolyPropagation();
     void lpRelaxationPropagation();
     void LPTighteningForOneLayer( unsigned targetIndex );
@@ -15,30 +15,69 @@
 
 #include "ParallelSolver.h"
 
-#include "InfeasibleQueryException.h"
-#include "Layer.h"
-#include "MStringf.h"
-#include "NLRError.h"
+#include "GlobalConfiguration.h"
 #include "Options.h"
-#include "TimeUtils.h"
 
-#include <boost/thread.hpp>
+#include <algorithm>
 
 namespace NLR {
 
-void ParallelSolver::clearSolverQueue( SolverQueue &freeSolvers )
+ParallelSolver::ParallelSolver()
+    : _threadPool( NULL )
 {
-    // Remove the solvers
-    GurobiWrapper *freeSolver;
-    while ( freeSolvers.pop( freeSolver ) )
-        delete freeSolver;
 }
 
-void ParallelSolver::enqueueSolver( SolverQueue &solvers, GurobiWrapper *solver )
+ParallelSolver::~ParallelSolver()
 {
-    if ( !solvers.push( solver ) )
+    if ( _threadPool )
     {
-        ASSERT( false );
+        delete _threadPool;
+        _threadPool = NULL;
+    }
+}
+
+SolverThreadPool &ParallelSolver::getThreadPool()
+{
+    if ( !_threadPool )
+    {
+        unsigned numberOfWorkers = Options::get()->getInt( Options::NUM_WORKERS );
+        _threadPool = new SolverThreadPool( std::max( numberOfWorkers, 1u ),
+                                            [this]() { return createSolver(); } );
+    }
+
+    return *_threadPool;
+}
+
+void ParallelSolver::createBatches( const Vector<NeuronToTighten> &neurons,
+                                    unsigned numberOfWorkers,
+                                    Vector<Batch> &batches )
+{
+    batches.clear();
+    if ( neurons.empty() )
+        return;
+
+    // A wider interval leaves more room for tightening. Ties are
+    // broken by the index of the neuron, to keep the order stable.
+    Vector<NeuronToTighten> sorted( neurons );
+    std::sort( sorted.begin(),
+               sorted.end(),
+               []( const NeuronToTighten &a, const NeuronToTighten &b ) {
+                   double widthA = a._currentUb - a._currentLb;
+                   double widthB = b._currentUb - b._currentLb;
+                   if ( widthA != widthB )
+                       return widthA > widthB;
+                   return a._index < b._index;
+               } );
+
+    unsigned numberOfBatches =
+        std::max( numberOfWorkers, 1u ) * GlobalConfiguration::LP_TIGHTENING_BATCHES_PER_WORKER;
+    unsigned batchSize = ( sorted.size() + numberOfBatches - 1 ) / numberOfBatches;
+
+    for ( unsigned i = 0; i < sorted.size(); ++i )
+    {
+        if ( i % batchSize == 0 )
+            batches.append( Batch() );
+        batches[batches.size() - 1].append( sorted[i] );
     }
 }
 
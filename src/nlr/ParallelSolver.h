@@ -16,11 +16,12 @@
 #ifndef __ParallelSolver_h__
 #define __ParallelSolver_h__
 
-#include "GurobiWrapper.h"
+#include "ILPSolver.h"
+#include "Map.h"
+#include "SolverThreadPool.h"
+#include "Vector.h"
 
 #include <atomic>
-#include <boost/lockfree/queue.hpp>
-#include <boost/thread.hpp>
 #include <mutex>
 
 namespace NLR {
@@ -32,15 +33,13 @@ struct NeuronIndex;
 class ParallelSolver
 {
 public:
-    typedef boost::lockfree::queue<GurobiWrapper *, boost::lockfree::fixed_sized<true>> SolverQueue;
-
     /*
-      Arguments for the spawned thread. This is needed because Boost::thread does
-      not seem to support functions with more than 7 arguments.
+      Arguments for the tightening of a single neuron, or of the
+      neurons of a single layer
     */
     struct ThreadArgument
     {
-        ThreadArgument( GurobiWrapper *gurobi,
+        ThreadArgument( ILPSolver *gurobi,
                         Layer *layer,
                         const Map<unsigned, Layer *> *layers,
                         unsigned index,
@@ -49,7 +48,6 @@ public:
                         bool cutoffInUse,
                         double cutoffValue,
                         LayerOwner *layerOwner,
-                        SolverQueue &freeSolvers,
                         std::mutex &mtx,
                         std::atomic_bool &infeasible,
                         std::atomic_uint &tighterBoundCounter,
@@ -66,7 +64,6 @@ public:
             , _cutoffInUse( cutoffInUse )
             , _cutoffValue( cutoffValue )
             , _layerOwner( layerOwner )
-            , _freeSolvers( freeSolvers )
             , _mtx( mtx )
             , _infeasible( infeasible )
             , _tighterBoundCounter( tighterBoundCounter )
@@ -78,7 +75,7 @@ public:
         {
         }
 
-        ThreadArgument( GurobiWrapper *gurobi,
+        ThreadArgument( ILPSolver *gurobi,
                         Layer *layer,
                         unsigned index,
                         double currentLb,
@@ -86,7 +83,6 @@ public:
                         bool cutoffInUse,
                         double cutoffValue,
                         LayerOwner *layerOwner,
-                        SolverQueue &freeSolvers,
                         std::mutex &mtx,
                         std::atomic_bool &infeasible,
                         std::atomic_uint &tighterBoundCounter,
@@ -103,7 +99,6 @@ public:
             , _cutoffInUse( cutoffInUse )
             , _cutoffValue( cutoffValue )
             , _layerOwner( layerOwner )
-            , _freeSolvers( freeSolvers )
             , _mtx( mtx )
             , _infeasible( infeasible )
             , _tighterBoundCounter( tighterBoundCounter )
@@ -115,7 +110,7 @@ public:
         {
         }
 
-        ThreadArgument( GurobiWrapper *gurobi,
+        ThreadArgument( ILPSolver *gurobi,
                         Layer *layer,
                         unsigned index,
                         double currentLb,
@@ -123,7 +118,6 @@ public:
                         bool cutoffInUse,
                         double cutoffValue,
                         LayerOwner *layerOwner,
-                        SolverQueue &freeSolvers,
                         std::mutex &mtx,
                         std::atomic_bool &infeasible,
                         std::atomic_uint &tighterBoundCounter,
@@ -139,7 +133,6 @@ public:
             , _cutoffInUse( cutoffInUse )
             , _cutoffValue( cutoffValue )
             , _layerOwner( layerOwner )
-            , _freeSolvers( freeSolvers )
             , _mtx( mtx )
             , _infeasible( infeasible )
             , _tighterBoundCounter( tighterBoundCounter )
@@ -151,19 +144,15 @@ public:
 
         ThreadArgument( Layer *layer,
                         const Map<unsigned, Layer *> *layers,
-                        SolverQueue &freeSolvers,
                         std::mutex &mtx,
                         std::atomic_bool &infeasible,
                         std::atomic_uint &tighterBoundCounter,
                         std::atomic_uint &signChanges,
                         std::atomic_uint &cutoffs,
                         unsigned lastIndexOfRelaxation,
-                        unsigned targetIndex,
-                        boost::thread *threads,
-                        const Map<GurobiWrapper *, unsigned> *solverToIndex )
+                        unsigned targetIndex )
             : _layer( layer )
             , _layers( layers )
-            , _freeSolvers( freeSolvers )
             , _mtx( mtx )
             , _infeasible( infeasible )
             , _tighterBoundCounter( tighterBoundCounter )
@@ -171,12 +160,10 @@ public:
             , _cutoffs( cutoffs )
             , _lastIndexOfRelaxation( lastIndexOfRelaxation )
             , _targetIndex( targetIndex )
-            , _threads( threads )
-            , _solverToIndex( solverToIndex )
         {
         }
 
-        GurobiWrapper *_gurobi;
+        ILPSolver *_gurobi;
         Layer *_layer;
         const Map<unsigned, Layer *> *_layers;
         unsigned _index;
@@ -185,7 +172,6 @@ public:
         bool _cutoffInUse;
         double _cutoffValue;
         LayerOwner *_layerOwner;
-        SolverQueue &_freeSolvers;
         std::mutex &_mtx;
         std::atomic_bool &_infeasible;
         std::atomic_uint &_tighterBoundCounter;
@@ -196,16 +182,52 @@ public:
         NeuronIndex *_lastFixedNeuron;
         unsigned _lastIndexOfRelaxation;
         unsigned _targetIndex;
-        boost::thread *_threads;
-        const Map<GurobiWrapper *, unsigned> *_solverToIndex;
     };
 
     /*
-      Free all the solvers in the SolverQueue
+      A neuron scheduled for tightening, and the bounds it had when it
+      was scheduled
+    */
+    struct NeuronToTighten
+    {
+        unsigned _index;
+        double _currentLb;
+        double _currentUb;
+        bool _skipTightenLb;
+        bool _skipTightenUb;
+    };
+
+    typedef Vector<NeuronToTighten> Batch;
+
+    ParallelSolver();
+    virtual ~ParallelSolver();
+
+    /*
+      Order the neurons by the expected gain of tightening them, so
+      that the neurons with the widest intervals are solved first,
+      and split them into batches, GlobalConfiguration::
+      LP_TIGHTENING_BATCHES_PER_WORKER per worker.
+    */
+    static void createBatches( const Vector<NeuronToTighten> &neurons,
+                               unsigned numberOfWorkers,
+                               Vector<Batch> &batches );
+
+protected:
+    /*
+      The pool of workers that solve the per-neuron (MI)LPs. It is
+      created on first use with Options::NUM_WORKERS workers, and is
+      kept for the lifetime of this object, so that its threads and
+      solvers are reused across layers and calls.
+    */
+    SolverThreadPool &getThreadPool();
+
+    /*
+      Create the solver of a single worker
     */
-    static void clearSolverQueue( SolverQueue &freeSolvers );
+    virtual ILPSolver *createSolver() = 0;
 
-    static void enqueueSolver( SolverQueue &solvers, GurobiWrapper *solver );
+private:
+    SolverThreadPool *_threadPool;
 };
 
 } // namespace NLR
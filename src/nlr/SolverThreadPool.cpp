@@ -0,0 +1,144 @@
+/*********************                                                        */
+/*! \file SolverThreadPool.cpp
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** [[ Add lengthier description here ]]
+
+ **/
+
+#include "SolverThreadPool.h"
+
+#include "Debug.h"
+
+namespace NLR {
+
+SolverThreadPool::SolverThreadPool( unsigned numberOfWorkers, const SolverFactory &createSolver )
+    : _runningTasks( 0 )
+    , _stopping( false )
+{
+    ASSERT( numberOfWorkers > 0 );
+
+    for ( unsigned i = 0; i < numberOfWorkers; ++i )
+        _solvers.append( createSolver() );
+
+    if ( numberOfWorkers > 1 )
+    {
+        for ( unsigned i = 0; i < numberOfWorkers; ++i )
+            _threads.emplace_back( &SolverThreadPool::workerLoop, this, i );
+    }
+}
+
+SolverThreadPool::~SolverThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock( _mutex );
+        _tasks.clear();
+        _stopping = true;
+    }
+    _taskAvailable.notify_all();
+
+    for ( auto &thread : _threads )
+        thread.join();
+
+    for ( const auto &solver : _solvers )
+        delete solver;
+}
+
+unsigned SolverThreadPool::getNumberOfWorkers() const
+{
+    return _solvers.size();
+}
+
+void SolverThreadPool::submit( const Task &task )
+{
+    if ( _threads.empty() )
+    {
+        task( *_solvers[0] );
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock( _mutex );
+        _tasks.push_back( task );
+    }
+    _taskAvailable.notify_one();
+}
+
+void SolverThreadPool::waitForIdleWorker()
+{
+    if ( _threads.empty() )
+        return;
+
+    std::unique_lock<std::mutex> lock( _mutex );
+    _taskDone.wait( lock, [this] { return _tasks.empty() && _runningTasks < _threads.size(); } );
+}
+
+void SolverThreadPool::cancelPendingTasks()
+{
+    {
+        std::lock_guard<std::mutex> lock( _mutex );
+        _tasks.clear();
+    }
+    _taskDone.notify_all();
+}
+
+void SolverThreadPool::waitForCompletion()
+{
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> lock( _mutex );
+        _taskDone.wait( lock, [this] { return _tasks.empty() && _runningTasks == 0; } );
+        exception = _exception;
+        _exception = nullptr;
+    }
+
+    if ( exception )
+        std::rethrow_exception( exception );
+}
+
+void SolverThreadPool::workerLoop( unsigned workerId )
+{
+    ILPSolver &solver = *_solvers[workerId];
+
+    while ( true )
+    {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock( _mutex );
+            _taskAvailable.wait( lock, [this] { return _stopping || !_tasks.empty(); } );
+            if ( _stopping )
+                return;
+
+            task = std::move( _tasks.front() );
+            _tasks.pop_front();
+            ++_runningTasks;
+        }
+
+        std::exception_ptr exception;
+        try
+        {
+            task( solver );
+        }
+        catch ( ... )
+        {
+            exception = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock( _mutex );
+            if ( exception && !_exception )
+                _exception = exception;
+            --_runningTasks;
+        }
+        _taskDone.notify_all();
+    }
+}
+
+} // namespace NLR
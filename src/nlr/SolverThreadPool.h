@@ -0,0 +1,109 @@
+/*********************                                                        */
+/*! \file SolverThreadPool.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Haoze Wu
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** A pool of persistent worker threads, each owning an (MI)LP solver, used
+ ** for the per-neuron bound tightening of the network level reasoner.
+ ** Tasks are queued and picked up by idle workers, which block on a
+ ** condition variable instead of polling. With a single worker no thread
+ ** is created, and tasks are run in the calling thread.
+
+**/
+
+#ifndef __SolverThreadPool_h__
+#define __SolverThreadPool_h__
+
+#include "ILPSolver.h"
+#include "Vector.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace NLR {
+
+class SolverThreadPool
+{
+public:
+    typedef std::function<void( ILPSolver & )> Task;
+    typedef std::function<ILPSolver *()> SolverFactory;
+
+    /*
+      Create the workers, and one solver for each worker
+    */
+    SolverThreadPool( unsigned numberOfWorkers, const SolverFactory &createSolver );
+
+    /*
+      Discard the pending tasks, wait for the running ones, and join
+      the workers
+    */
+    ~SolverThreadPool();
+
+    unsigned getNumberOfWorkers() const;
+
+    /*
+      Queue a task, to be run by the next idle worker with that
+      worker's solver. With a single worker, the task is run
+      immediately in the calling thread.
+    */
+    void submit( const Task &task );
+
+    /*
+      Block until no task is pending and some worker is idle, so that
+      the next submitted task starts immediately
+    */
+    void waitForIdleWorker();
+
+    /*
+      Drop all the tasks that have not yet been picked up by a worker
+    */
+    void cancelPendingTasks();
+
+    /*
+      Block until all submitted tasks are done. If any task threw an
+      exception, the first such exception is rethrown here.
+    */
+    void waitForCompletion();
+
+private:
+    Vector<ILPSolver *> _solvers;
+    std::vector<std::thread> _threads;
+
+    /*
+      The pending tasks, the number of tasks currently being run, and
+      the first exception thrown by a task, all guarded by _mutex
+    */
+    std::deque<Task> _tasks;
+    unsigned _runningTasks;
+    bool _stopping;
+    std::exception_ptr _exception;
+
+    std::mutex _mutex;
+    std::condition_variable _taskAvailable;
+    std::condition_variable _taskDone;
+
+    void workerLoop( unsigned workerId );
+};
+
+} // namespace NLR
+
+#endif // __SolverThreadPool_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
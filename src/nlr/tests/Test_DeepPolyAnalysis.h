@@ -211,6 +211,144 @@ public:
             TS_ASSERT( existsBound( bounds, bound ) );
     }
 
+    void populateSparseWeightsNetwork( NLR::NetworkLevelReasoner &nlr, MockTableau &tableau )
+    {
+        /*
+          A network whose first weighted sum layer has a sparse
+          (25% dense) weight matrix
+
+              2      R       1
+          x0 --- x4 ---> x8 ---
+            \                   \
+             \ 1    R      -1    \
+              ---- x5 ---> x9 ---- x12
+                                 /  /
+          x1                    /  /
+              1      R       1 /  /
+          x2 --- x6 ---> x10 --   /
+                                /
+             -3      R       1 /
+          x3 --- x7 ---> x11 --
+
+          x4 also has a bias of 1
+        */
+
+        // Create the layers
+        nlr.addLayer( 0, NLR::Layer::INPUT, 4 );
+        nlr.addLayer( 1, NLR::Layer::WEIGHTED_SUM, 4 );
+        nlr.addLayer( 2, NLR::Layer::RELU, 4 );
+        nlr.addLayer( 3, NLR::Layer::WEIGHTED_SUM, 1 );
+
+        // Mark layer dependencies
+        for ( unsigned i = 1; i <= 3; ++i )
+            nlr.addLayerDependency( i - 1, i );
+
+        // Set the weights and biases for the weighted sum layers
+        nlr.setWeight( 0, 0, 1, 0, 2 );
+        nlr.setWeight( 0, 0, 1, 1, 1 );
+        nlr.setWeight( 0, 2, 1, 2, 1 );
+        nlr.setWeight( 0, 3, 1, 3, -3 );
+        nlr.setWeight( 2, 0, 3, 0, 1 );
+        nlr.setWeight( 2, 1, 3, 0, -1 );
+        nlr.setWeight( 2, 2, 3, 0, 1 );
+        nlr.setWeight( 2, 3, 3, 0, 1 );
+
+        nlr.setBias( 1, 0, 1 );
+
+        // Mark the ReLU sources
+        for ( unsigned i = 0; i < 4; ++i )
+            nlr.addActivationSource( 1, i, 2, i );
+
+        // Variable indexing
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            nlr.setNeuronVariable( NLR::NeuronIndex( 0, i ), i );
+            nlr.setNeuronVariable( NLR::NeuronIndex( 1, i ), i + 4 );
+            nlr.setNeuronVariable( NLR::NeuronIndex( 2, i ), i + 8 );
+        }
+        nlr.setNeuronVariable( NLR::NeuronIndex( 3, 0 ), 12 );
+
+        // Very loose bounds for neurons except inputs
+        double large = 1000000;
+
+        tableau.getBoundManager().initialize( 13 );
+        for ( unsigned i = 4; i < 13; ++i )
+        {
+            tableau.setLowerBound( i, -large );
+            tableau.setUpperBound( i, large );
+        }
+    }
+
+    void test_deeppoly_sparse_weights()
+    {
+        NLR::NetworkLevelReasoner nlr;
+        MockTableau tableau;
+        nlr.setTableau( &tableau );
+        populateSparseWeightsNetwork( nlr, tableau );
+
+        tableau.setLowerBound( 0, 1 );
+        tableau.setUpperBound( 0, 2 );
+        tableau.setLowerBound( 1, 0 );
+        tableau.setUpperBound( 1, 1 );
+        tableau.setLowerBound( 2, -2 );
+        tableau.setUpperBound( 2, -1 );
+        tableau.setLowerBound( 3, -1 );
+        tableau.setUpperBound( 3, -0.5 );
+
+        // Invoke Deeppoly
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.deepPolyPropagation() );
+
+        /*
+          Input ranges:
+
+          x0: [1, 2]
+          x1: [0, 1]
+          x2: [-2, -1]
+          x3: [-1, -0.5]
+
+          Layer 1:
+
+          x4: [3, 5]
+          x5: [1, 2]
+          x6: [-2, -1]
+          x7: [1.5, 3]
+
+          Layer 2:
+
+          x8: [3, 5]
+          x9: [1, 2]
+          x10: [0, 0]
+          x11: [1.5, 3]
+
+          Layer 3, back-substituted through the sparse layer:
+
+          x12 = x0 - 3x3 + 1 : [3.5, 6]
+        */
+
+        List<Tightening> expectedBounds(
+            { Tightening( 4, 3, Tightening::LB ),    Tightening( 4, 5, Tightening::UB ),
+              Tightening( 5, 1, Tightening::LB ),    Tightening( 5, 2, Tightening::UB ),
+              Tightening( 6, -2, Tightening::LB ),   Tightening( 6, -1, Tightening::UB ),
+              Tightening( 7, 1.5, Tightening::LB ),  Tightening( 7, 3, Tightening::UB ),
+
+              Tightening( 8, 3, Tightening::LB ),    Tightening( 8, 5, Tightening::UB ),
+              Tightening( 9, 1, Tightening::LB ),    Tightening( 9, 2, Tightening::UB ),
+              Tightening( 10, 0, Tightening::LB ),   Tightening( 10, 0, Tightening::UB ),
+              Tightening( 11, 1.5, Tightening::LB ), Tightening( 11, 3, Tightening::UB ),
+
+              Tightening( 12, 3.5, Tightening::LB ), Tightening( 12, 6, Tightening::UB )
+
+            } );
+
+        List<Tightening> bounds;
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+
+        TS_ASSERT_EQUALS( expectedBounds.size(), bounds.size() );
+        for ( const auto &bound : expectedBounds )
+            TS_ASSERT( existsBound( bounds, bound ) );
+    }
+
     void populateResidualNetwork1( NLR::NetworkLevelReasoner &nlr, MockTableau &tableau )
     {
         /*
@@ -1932,6 +1932,83 @@ public:
         tableau.setUpperBound( 5, large );
     }
 
+    void populateNetworkSBTSparseWeights( NLR::NetworkLevelReasoner &nlr, MockTableau &tableau )
+    {
+        /*
+          A network whose first weighted sum layer has a sparse
+          (25% dense) weight matrix
+
+              2      R       1
+          x0 --- x4 ---> x8 ---
+            \                   \
+             \ 1    R      -1    \
+              ---- x5 ---> x9 ---- x12
+                                 /  /
+          x1                    /  /
+              1      R       1 /  /
+          x2 --- x6 ---> x10 --   /
+                                /
+             -3      R       1 /
+          x3 --- x7 ---> x11 --
+
+          x4 also has a bias of 1
+        */
+
+        // Create the layers
+        nlr.addLayer( 0, NLR::Layer::INPUT, 4 );
+        nlr.addLayer( 1, NLR::Layer::WEIGHTED_SUM, 4 );
+        nlr.addLayer( 2, NLR::Layer::RELU, 4 );
+        nlr.addLayer( 3, NLR::Layer::WEIGHTED_SUM, 1 );
+
+        // Mark layer dependencies
+        for ( unsigned i = 1; i <= 3; ++i )
+            nlr.addLayerDependency( i - 1, i );
+
+        // Weights
+        nlr.setWeight( 0, 0, 1, 0, 2 );
+        nlr.setWeight( 0, 0, 1, 1, 1 );
+        nlr.setWeight( 0, 2, 1, 2, 1 );
+        nlr.setWeight( 0, 3, 1, 3, -3 );
+        nlr.setWeight( 2, 0, 3, 0, 1 );
+        nlr.setWeight( 2, 1, 3, 0, -1 );
+        nlr.setWeight( 2, 2, 3, 0, 1 );
+        nlr.setWeight( 2, 3, 3, 0, 1 );
+
+        nlr.setBias( 1, 0, 1 );
+
+        // Mark the ReLU sources
+        for ( unsigned i = 0; i < 4; ++i )
+            nlr.addActivationSource( 1, i, 2, i );
+
+        // Variable indexing
+        for ( unsigned i = 0; i < 4; ++i )
+        {
+            nlr.setNeuronVariable( NLR::NeuronIndex( 0, i ), i );
+            nlr.setNeuronVariable( NLR::NeuronIndex( 1, i ), i + 4 );
+            nlr.setNeuronVariable( NLR::NeuronIndex( 2, i ), i + 8 );
+        }
+        nlr.setNeuronVariable( NLR::NeuronIndex( 3, 0 ), 12 );
+
+        // Very loose bounds for neurons except inputs
+        double large = 1000000;
+
+        tableau.getBoundManager().initialize( 13 );
+        for ( unsigned i = 4; i < 13; ++i )
+        {
+            tableau.setLowerBound( i, -large );
+            tableau.setUpperBound( i, large );
+        }
+
+        tableau.setLowerBound( 0, 1 );
+        tableau.setUpperBound( 0, 2 );
+        tableau.setLowerBound( 1, 0 );
+        tableau.setUpperBound( 1, 1 );
+        tableau.setLowerBound( 2, -2 );
+        tableau.setUpperBound( 2, -1 );
+        tableau.setLowerBound( 3, -1 );
+        tableau.setUpperBound( 3, -0.5 );
+    }
+
     void test_evaluate_relu()
     {
         NLR::NetworkLevelReasoner nlr;
@@ -7596,6 +7673,230 @@ public:
         TS_ASSERT( boundsEqual( bounds, expectedBounds ) );
     }
 
+    void test_sparse_weights()
+    {
+        NLR::NetworkLevelReasoner nlr;
+        MockTableau tableau;
+        nlr.setTableau( &tableau );
+        populateNetworkSBTSparseWeights( nlr, tableau );
+
+        // The first weighted sum layer is sparse, the output layer is dense
+        const CSRMatrix *sparseWeights = NULL;
+        TS_ASSERT_THROWS_NOTHING( sparseWeights = nlr.getLayer( 1 )->getSparseWeights( 0 ) );
+        TS_ASSERT( sparseWeights );
+        TS_ASSERT_EQUALS( sparseWeights->getNnz(), 4U );
+        TS_ASSERT_EQUALS( sparseWeights->get( 0, 0 ), 2 );
+        TS_ASSERT_EQUALS( sparseWeights->get( 0, 1 ), 1 );
+        TS_ASSERT_EQUALS( sparseWeights->get( 3, 3 ), -3 );
+
+        TS_ASSERT( !nlr.getLayer( 3 )->getSparseWeights( 2 ) );
+
+        // Changing the weights discards the sparse copy
+        nlr.setWeight( 0, 1, 1, 1, 5 );
+        TS_ASSERT( !nlr.getLayer( 1 )->getSparseWeights( 0 ) );
+        nlr.setWeight( 0, 1, 1, 1, 0 );
+        TS_ASSERT_THROWS_NOTHING( sparseWeights = nlr.getLayer( 1 )->getSparseWeights( 0 ) );
+        TS_ASSERT( sparseWeights );
+        TS_ASSERT_EQUALS( sparseWeights->getNnz(), 4U );
+    }
+
+    void test_interval_arithmetic_bound_propagation_sparse_weights()
+    {
+        NLR::NetworkLevelReasoner nlr;
+        MockTableau tableau;
+        nlr.setTableau( &tableau );
+        populateNetworkSBTSparseWeights( nlr, tableau );
+
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.intervalArithmeticBoundPropagation() );
+
+        /*
+          Input ranges:
+
+          x0: [1, 2]
+          x1: [0, 1]
+          x2: [-2, -1]
+          x3: [-1, -0.5]
+
+          Layer 1:
+
+          x4 = 2x0 + 1 : [3, 5]
+          x5 = x0      : [1, 2]
+          x6 = x2      : [-2, -1]
+          x7 = -3x3    : [1.5, 3]
+
+          Layer 2, where interval arithmetic keeps the negative upper
+          bound of the inactive ReLU:
+
+          x8: [3, 5]
+          x9: [1, 2]
+          x10: [0, -1]
+          x11: [1.5, 3]
+
+          Layer 3:
+
+          x12 = x8 - x9 + x10 + x11 : [2.5, 6]
+        */
+
+        List<Tightening> expectedBounds( {
+            Tightening( 4, 3, Tightening::LB ),    Tightening( 4, 5, Tightening::UB ),
+            Tightening( 5, 1, Tightening::LB ),    Tightening( 5, 2, Tightening::UB ),
+            Tightening( 6, -2, Tightening::LB ),   Tightening( 6, -1, Tightening::UB ),
+            Tightening( 7, 1.5, Tightening::LB ),  Tightening( 7, 3, Tightening::UB ),
+
+            Tightening( 8, 3, Tightening::LB ),    Tightening( 8, 5, Tightening::UB ),
+            Tightening( 9, 1, Tightening::LB ),    Tightening( 9, 2, Tightening::UB ),
+            Tightening( 10, 0, Tightening::LB ),   Tightening( 10, -1, Tightening::UB ),
+            Tightening( 11, 1.5, Tightening::LB ), Tightening( 11, 3, Tightening::UB ),
+
+            Tightening( 12, 2.5, Tightening::LB ), Tightening( 12, 6, Tightening::UB ),
+        } );
+
+        List<Tightening> bounds;
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+        TS_ASSERT( boundsEqual( bounds, expectedBounds ) );
+    }
+
+    void test_sbt_sparse_weights()
+    {
+        Options::get()->setString( Options::SYMBOLIC_BOUND_TIGHTENING_TYPE, "sbt" );
+
+        NLR::NetworkLevelReasoner nlr;
+        MockTableau tableau;
+        nlr.setTableau( &tableau );
+        populateNetworkSBTSparseWeights( nlr, tableau );
+
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.symbolicBoundPropagation() );
+
+        /*
+          Input ranges:
+
+          x0: [1, 2]
+          x1: [0, 1]
+          x2: [-2, -1]
+          x3: [-1, -0.5]
+
+          Layer 1:
+
+          x4.lb = x4.ub = 2x0 + 1 : [3, 5]
+          x5.lb = x5.ub = x0      : [1, 2]
+          x6.lb = x6.ub = x2      : [-2, -1]
+          x7.lb = x7.ub = -3x3    : [1.5, 3]
+
+          x6 is inactive, the other ReLUs are active
+
+          Layer 3, where x0 cancels out partially:
+
+          x12.lb = x12.ub = x0 - 3x3 + 1 : [3.5, 6]
+        */
+
+        List<Tightening> expectedBounds( {
+            Tightening( 4, 3, Tightening::LB ),    Tightening( 4, 5, Tightening::UB ),
+            Tightening( 5, 1, Tightening::LB ),    Tightening( 5, 2, Tightening::UB ),
+            Tightening( 6, -2, Tightening::LB ),   Tightening( 6, -1, Tightening::UB ),
+            Tightening( 7, 1.5, Tightening::LB ),  Tightening( 7, 3, Tightening::UB ),
+
+            Tightening( 8, 3, Tightening::LB ),    Tightening( 8, 5, Tightening::UB ),
+            Tightening( 9, 1, Tightening::LB ),    Tightening( 9, 2, Tightening::UB ),
+            Tightening( 10, 0, Tightening::LB ),   Tightening( 10, 0, Tightening::UB ),
+            Tightening( 11, 1.5, Tightening::LB ), Tightening( 11, 3, Tightening::UB ),
+
+            Tightening( 12, 3.5, Tightening::LB ), Tightening( 12, 6, Tightening::UB ),
+        } );
+
+        List<Tightening> bounds;
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+        TS_ASSERT( boundsEqual( bounds, expectedBounds ) );
+    }
+
+    void compareIncrementalWithFullSbt( NLR::NetworkLevelReasoner &nlr,
+                                        MockTableau &tableau,
+                                        double outputBias = 0 )
+    {
+        // A fresh reasoner over the same bounds, on which a full pass is run
+        NLR::NetworkLevelReasoner fullNlr;
+        MockTableau fullTableau;
+        fullNlr.setTableau( &fullTableau );
+        populateNetworkSBTRelu( fullNlr, fullTableau );
+        fullNlr.setBias( 1, 0, -15 );
+        fullNlr.setBias( 3, 0, outputBias );
+        for ( unsigned i = 0; i < 7; ++i )
+        {
+            fullTableau.setLowerBound( i, tableau.getLowerBound( i ) );
+            fullTableau.setUpperBound( i, tableau.getUpperBound( i ) );
+        }
+
+        TS_ASSERT_THROWS_NOTHING( fullNlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( fullNlr.symbolicBoundPropagation() );
+        List<Tightening> expectedBounds;
+        TS_ASSERT_THROWS_NOTHING( fullNlr.getConstraintTightenings( expectedBounds ) );
+
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.incrementalSymbolicBoundPropagation() );
+        List<Tightening> bounds;
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+
+        TS_ASSERT( boundsEqual( bounds, expectedBounds ) );
+        updateTableau( tableau, bounds );
+    }
+
+    void test_incremental_sbt()
+    {
+        Options::get()->setString( Options::SYMBOLIC_BOUND_TIGHTENING_TYPE, "sbt" );
+
+        NLR::NetworkLevelReasoner nlr;
+        MockTableau tableau;
+        nlr.setTableau( &tableau );
+        populateNetworkSBTRelu( nlr, tableau );
+
+        tableau.setLowerBound( 0, 4 );
+        tableau.setUpperBound( 0, 6 );
+        tableau.setLowerBound( 1, 1 );
+        tableau.setUpperBound( 1, 5 );
+        nlr.setBias( 1, 0, -15 );
+
+        // Initially, all layers are computed
+        for ( unsigned i = 0; i < 4; ++i )
+            TS_ASSERT( !nlr.getLayer( i )->symbolicBoundsUpToDate() );
+        compareIncrementalWithFullSbt( nlr, tableau );
+        for ( unsigned i = 0; i < 4; ++i )
+            TS_ASSERT( nlr.getLayer( i )->symbolicBoundsUpToDate() );
+
+        // Nothing changed, so nothing is recomputed
+        List<Tightening> bounds;
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT_THROWS_NOTHING( nlr.incrementalSymbolicBoundPropagation() );
+        TS_ASSERT_THROWS_NOTHING( nlr.getConstraintTightenings( bounds ) );
+        TS_ASSERT( bounds.empty() );
+
+        // Split on the first ReLU: only the layers from x2 onwards are stale
+        tableau.setLowerBound( 2, 0 );
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT( nlr.getLayer( 0 )->symbolicBoundsUpToDate() );
+        TS_ASSERT( !nlr.getLayer( 1 )->symbolicBoundsUpToDate() );
+        TS_ASSERT( nlr.getLayer( 2 )->symbolicBoundsUpToDate() );
+        compareIncrementalWithFullSbt( nlr, tableau );
+
+        // Backtracking loosens the bound again
+        tableau.setLowerBound( 2, -4 );
+        compareIncrementalWithFullSbt( nlr, tableau );
+
+        // A change to the input bounds affects all layers
+        tableau.setUpperBound( 0, 5 );
+        TS_ASSERT_THROWS_NOTHING( nlr.obtainCurrentBounds() );
+        TS_ASSERT( !nlr.getLayer( 0 )->symbolicBoundsUpToDate() );
+        TS_ASSERT( nlr.getLayer( 3 )->symbolicBoundsUpToDate() );
+        compareIncrementalWithFullSbt( nlr, tableau );
+        for ( unsigned i = 0; i < 4; ++i )
+            TS_ASSERT( nlr.getLayer( i )->symbolicBoundsUpToDate() );
+
+        // Structural changes invalidate the symbolic bounds
+        nlr.setBias( 3, 0, 1 );
+        TS_ASSERT( !nlr.getLayer( 3 )->symbolicBoundsUpToDate() );
+        compareIncrementalWithFullSbt( nlr, tableau, 1 );
+    }
+
     void test_concretize_input_assignment()
     {
         NLR::NetworkLevelReasoner nlr;
@@ -17,8 +17,12 @@
 #include "IterativePropagator.h"
 #include "NetworkLevelReasoner.h"
 #include "ParallelSolver.h"
+#include "SolverThreadPool.h"
 
+#include <atomic>
 #include <cxxtest/TestSuite.h>
+#include <stdexcept>
+#include <thread>
 
 class MockForNetworkLevelReasoner
 {
@@ -36,34 +40,117 @@ public:
     {
     }
 
-    void test_enqueueSolver()
+    void test_create_batches()
     {
-        NLR::NetworkLevelReasoner nlr;
-        NLR::IterativePropagator mock = NLR::IterativePropagator( &nlr );
-        unsigned numberOfWorkers = 4;
-        NLR::ParallelSolver::SolverQueue solvers( numberOfWorkers );
-        GurobiWrapper *gurobi = new GurobiWrapper();
-        TS_ASSERT_THROWS_NOTHING( mock.enqueueSolver( solvers, gurobi ) );
-        TS_ASSERT( !solvers.empty() );
-        GurobiWrapper *gurobiPtr = NULL;
-        TS_ASSERT_THROWS_NOTHING( solvers.pop( gurobiPtr ) );
-        TS_ASSERT( solvers.empty() );
-        delete gurobiPtr;
+        Vector<NLR::ParallelSolver::NeuronToTighten> neurons;
+        for ( unsigned i = 0; i < 10; ++i )
+        {
+            // Neuron i has an interval of width i, except neuron 5
+            // whose interval is the widest
+            double width = ( i == 5 ) ? 100 : i;
+            neurons.append( NLR::ParallelSolver::NeuronToTighten{ i, -1, width - 1, false, false } );
+        }
+
+        // One worker, GlobalConfiguration::LP_TIGHTENING_BATCHES_PER_WORKER batches
+        Vector<NLR::ParallelSolver::Batch> batches;
+        TS_ASSERT_THROWS_NOTHING( NLR::ParallelSolver::createBatches( neurons, 1, batches ) );
+        TS_ASSERT_EQUALS( batches.size(), 4U );
+
+        Vector<unsigned> order;
+        for ( const auto &batch : batches )
+        {
+            TS_ASSERT( batch.size() <= 3U );
+            for ( const auto &neuron : batch )
+                order.append( neuron._index );
+        }
+
+        // Widest interval first
+        Vector<unsigned> expected = { 5, 9, 8, 7, 6, 4, 3, 2, 1, 0 };
+        TS_ASSERT_EQUALS( order.size(), expected.size() );
+        for ( unsigned i = 0; i < expected.size(); ++i )
+            TS_ASSERT_EQUALS( order[i], expected[i] );
+
+        // More batches than neurons
+        TS_ASSERT_THROWS_NOTHING( NLR::ParallelSolver::createBatches( neurons, 4, batches ) );
+        TS_ASSERT_EQUALS( batches.size(), 10U );
+
+        neurons.clear();
+        TS_ASSERT_THROWS_NOTHING( NLR::ParallelSolver::createBatches( neurons, 4, batches ) );
+        TS_ASSERT( batches.empty() );
     }
 
-    void test_clear_solver_queue()
+    void test_thread_pool_runs_all_tasks()
     {
-        NLR::NetworkLevelReasoner nlr;
-        NLR::IterativePropagator mock = NLR::IterativePropagator( &nlr );
-        unsigned numberOfWorkers = 4;
-        NLR::ParallelSolver::SolverQueue solvers( numberOfWorkers );
-        for ( unsigned i = 0; i < numberOfWorkers; ++i )
+        NLR::SolverThreadPool pool( 4, []() { return new GurobiWrapper(); } );
+        TS_ASSERT_EQUALS( pool.getNumberOfWorkers(), 4U );
+
+        std::atomic_uint counter( 0 );
+        for ( unsigned i = 0; i < 100; ++i )
+            pool.submit( [&counter]( ILPSolver & ) { ++counter; } );
+
+        TS_ASSERT_THROWS_NOTHING( pool.waitForCompletion() );
+        TS_ASSERT_EQUALS( counter.load(), 100U );
+
+        // The pool is reusable after all tasks are done
+        for ( unsigned i = 0; i < 10; ++i )
         {
-            GurobiWrapper *gurobi = new GurobiWrapper();
-            TS_ASSERT_THROWS_NOTHING( mock.enqueueSolver( solvers, gurobi ) );
+            TS_ASSERT_THROWS_NOTHING( pool.waitForIdleWorker() );
+            pool.submit( [&counter]( ILPSolver & ) { ++counter; } );
         }
-        TS_ASSERT( !solvers.empty() );
-        TS_ASSERT_THROWS_NOTHING( mock.clearSolverQueue( solvers ) );
-        TS_ASSERT( solvers.empty() );
+
+        TS_ASSERT_THROWS_NOTHING( pool.waitForCompletion() );
+        TS_ASSERT_EQUALS( counter.load(), 110U );
+    }
+
+    void test_single_worker_runs_in_calling_thread()
+    {
+        NLR::SolverThreadPool pool( 1, []() { return new GurobiWrapper(); } );
+
+        std::thread::id caller = std::this_thread::get_id();
+        std::thread::id worker;
+        pool.submit( [&worker]( ILPSolver & ) { worker = std::this_thread::get_id(); } );
+
+        TS_ASSERT_EQUALS( worker, caller );
+        TS_ASSERT_THROWS_NOTHING( pool.waitForIdleWorker() );
+        TS_ASSERT_THROWS_NOTHING( pool.waitForCompletion() );
+    }
+
+    void test_cancel_pending_tasks()
+    {
+        NLR::SolverThreadPool pool( 2, []() { return new GurobiWrapper(); } );
+
+        // Keep both workers busy until released
+        std::atomic_bool released( false );
+        for ( unsigned i = 0; i < 2; ++i )
+            pool.submit( [&released]( ILPSolver & ) {
+                while ( !released )
+                    std::this_thread::yield();
+            } );
+
+        std::atomic_uint counter( 0 );
+        for ( unsigned i = 0; i < 10; ++i )
+            pool.submit( [&counter]( ILPSolver & ) { ++counter; } );
+
+        pool.cancelPendingTasks();
+        released = true;
+
+        TS_ASSERT_THROWS_NOTHING( pool.waitForCompletion() );
+        TS_ASSERT_EQUALS( counter.load(), 0U );
+    }
+
+    void test_thread_pool_rethrows_exceptions()
+    {
+        NLR::SolverThreadPool pool( 2, []() { return new GurobiWrapper(); } );
+
+        std::atomic_uint counter( 0 );
+        pool.submit( []( ILPSolver & ) { throw std::runtime_error( "failure" ); } );
+        for ( unsigned i = 0; i < 10; ++i )
+            pool.submit( [&counter]( ILPSolver & ) { ++counter; } );
+
+        TS_ASSERT_THROWS( pool.waitForCompletion(), const std::runtime_error & );
+        TS_ASSERT_EQUALS( counter.load(), 10U );
+
+        // The exception is only reported once
+        TS_ASSERT_THROWS_NOTHING( pool.waitForCompletion() );
     }
 };
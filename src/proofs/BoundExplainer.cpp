@@ -120,7 +120,6 @@ void BoundExplainer::updateBoundExplanation( const TableauRow &row, bool isUpper
     ASSERT( !FloatUtils::isZero( ci ) );
     Vector<double> rowCoefficients = Vector<double>( _numberOfRows, 0 );
     Vector<double> sum = Vector<double>( _numberOfRows, 0 );
-    SparseUnsortedList tempBound;
 
     for ( unsigned i = 0; i < row._size; ++i )
     {
@@ -144,7 +143,8 @@ void BoundExplainer::updateBoundExplanation( const TableauRow &row, bool isUpper
              ( !tempUpper && *_trivialLowerBoundExplanation[curVar] ) )
             continue;
 
-        tempBound = tempUpper ? *_upperBoundExplanations[curVar] : *_lowerBoundExplanations[curVar];
+        const SparseUnsortedList &tempBound = tempUpper ? _upperBoundExplanations[curVar]->get()
+                                                        : _lowerBoundExplanations[curVar]->get();
         addVecTimesScalar( sum, tempBound, realCoefficient );
     }
 
@@ -158,8 +158,9 @@ void BoundExplainer::updateBoundExplanation( const TableauRow &row, bool isUpper
             if ( !( tempUpper && *_trivialUpperBoundExplanation[row._lhs] ) &&
                  !( !tempUpper && *_trivialLowerBoundExplanation[row._lhs] ) )
             {
-                tempBound = tempUpper ? *_upperBoundExplanations[row._lhs]
-                                      : *_lowerBoundExplanations[row._lhs];
+                const SparseUnsortedList &tempBound =
+                    tempUpper ? _upperBoundExplanations[row._lhs]->get()
+                              : _lowerBoundExplanations[row._lhs]->get();
                 addVecTimesScalar( sum, tempBound, realCoefficient );
             }
         }
@@ -197,7 +198,6 @@ void BoundExplainer::updateBoundExplanationSparse( const SparseUnsortedList &row
     ASSERT( !FloatUtils::isZero( ci ) );
     Vector<double> rowCoefficients = Vector<double>( _numberOfRows, 0 );
     Vector<double> sum = Vector<double>( _numberOfRows, 0 );
-    SparseUnsortedList tempBound;
 
     for ( const auto &entry : row )
     {
@@ -219,8 +219,9 @@ void BoundExplainer::updateBoundExplanationSparse( const SparseUnsortedList &row
              ( !tempUpper && *_trivialLowerBoundExplanation[entry._index] ) )
             continue;
 
-        tempBound = tempUpper ? *_upperBoundExplanations[entry._index]
-                              : *_lowerBoundExplanations[entry._index];
+        const SparseUnsortedList &tempBound = tempUpper
+                                                ? _upperBoundExplanations[entry._index]->get()
+                                                : _lowerBoundExplanations[entry._index]->get();
         addVecTimesScalar( sum, tempBound, realCoefficient );
     }
 
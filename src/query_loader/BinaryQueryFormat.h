@@ -0,0 +1,69 @@
+/*********************                                                        */
+/*! \file BinaryQueryFormat.h
+ ** \verbatim
+ ** Top contributors (to current version):
+ **   Christopher Lazarus
+ ** This file is part of the Marabou project.
+ ** Copyright (c) 2017-2024 by the authors listed in the file AUTHORS
+ ** in the top-level source directory) and their institutional affiliations.
+ ** All rights reserved. See the file COPYING in the top-level source
+ ** directory for licensing information.\endverbatim
+ **
+ ** The layout of the binary query format, written by Query::saveBinaryQuery
+ ** and read by QueryLoader. All integers are 32-bit unsigned and all reals
+ ** are 64-bit doubles, in the byte order of the machine that wrote the
+ ** file. Records are packed, without padding.
+ **
+ **   Header
+ **   Input variables:  <index, variable> for each input variable
+ **   Output variables: <index, variable> for each output variable
+ **   Lower bounds:     <variable, bound> for each lower bound
+ **   Upper bounds:     <variable, bound> for each upper bound
+ **   Equations:        <type, scalar, number of addends>, followed by
+ **                     <variable, coefficient> for each addend
+ **   Constraints:      <length>, followed by the constraint serialized as a
+ **                     string of that length, as in the text format
+ **
+ ** The version is bumped whenever the layout changes; files of other
+ ** versions are rejected.
+
+**/
+
+#ifndef __BinaryQueryFormat_h__
+#define __BinaryQueryFormat_h__
+
+#include <cstdint>
+
+namespace BinaryQueryFormat {
+
+static const char MAGIC[8] = { 'M', 'A', 'R', 'A', 'B', 'O', 'U', 'Q' };
+static const uint32_t VERSION = 1;
+
+// Written as is, for detecting files written with a different byte order
+static const uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+struct Header
+{
+    char _magic[8];
+    uint32_t _version;
+    uint32_t _byteOrderMark;
+    uint32_t _numberOfVariables;
+    uint32_t _numberOfInputVariables;
+    uint32_t _numberOfOutputVariables;
+    uint32_t _numberOfLowerBounds;
+    uint32_t _numberOfUpperBounds;
+    uint32_t _numberOfEquations;
+    uint32_t _numberOfConstraints;
+};
+
+} // namespace BinaryQueryFormat
+
+#endif // __BinaryQueryFormat_h__
+
+//
+// Local Variables:
+// compile-command: "make -C ../.. "
+// tags-file-name: "../../TAGS"
+// c-basic-offset: 4
+// End:
+//
@@ -18,6 +18,7 @@
 
 #include "AutoFile.h"
 #include "BilinearConstraint.h"
+#include "BinaryQueryFormat.h"
 #include "Debug.h"
 #include "DisjunctionConstraint.h"
 #include "Equation.h"
@@ -32,6 +33,53 @@
 #include "SignConstraint.h"
 #include "SoftmaxConstraint.h"
 
+#include <cstring>
+
+/*
+  A cursor over the contents of a binary query file, which checks that
+  every read stays within the file.
+*/
+class BinaryQueryReader
+{
+public:
+    BinaryQueryReader( const char *data, unsigned size )
+        : _current( data )
+        , _end( data + size )
+    {
+    }
+
+    template <typename T> T read()
+    {
+        T value;
+        memcpy( &value, advance( sizeof( T ) ), sizeof( T ) );
+        return value;
+    }
+
+    String readString( unsigned length )
+    {
+        return String( advance( length ), length );
+    }
+
+    bool done() const
+    {
+        return _current == _end;
+    }
+
+private:
+    const char *_current;
+    const char *_end;
+
+    const char *advance( unsigned size )
+    {
+        if ( (unsigned)( _end - _current ) < size )
+            throw MarabouError( MarabouError::INVALID_QUERY_FILE, "Binary query file is truncated" );
+
+        const char *result = _current;
+        _current += size;
+        return result;
+    }
+};
+
 void QueryLoader::loadQuery( const String &fileName, IQuery &inputQuery )
 {
     if ( !IFile::exists( fileName ) )
@@ -43,6 +91,14 @@ void QueryLoader::loadQuery( const String &fileName, IQuery &inputQuery )
     AutoFile input( fileName );
     input->open( IFile::MODE_READ );
 
+    unsigned size;
+    const char *data = input->map( size );
+    if ( isBinaryQuery( data, size ) )
+    {
+        loadBinaryQuery( data, size, inputQuery );
+        return;
+    }
+
     unsigned numVars = atoi( input->readLine().trim().ascii() );
     unsigned numLowerBounds = atoi( input->readLine().trim().ascii() );
     unsigned numUpperBounds = atoi( input->readLine().trim().ascii() );
@@ -209,61 +265,162 @@ void QueryLoader::loadQuery( const String &fileName, IQuery &inputQuery )
 
         QL_LOG( Stringf( "Non-Linear Constraint: %u, Type: %s \n", i, coType.ascii() ).ascii() );
         QL_LOG( Stringf( "\tserialized:\t%s \n", serializeConstraint.ascii() ).ascii() );
-        if ( coType == "relu" )
-        {
-            inputQuery.addPiecewiseLinearConstraint( new ReluConstraint( serializeConstraint ) );
-        }
-        else if ( coType == "leaky_relu" )
-        {
-            inputQuery.addPiecewiseLinearConstraint(
-                new LeakyReluConstraint( serializeConstraint ) );
-        }
-        else if ( coType == "max" )
-        {
-            inputQuery.addPiecewiseLinearConstraint( new MaxConstraint( serializeConstraint ) );
-        }
-        else if ( coType == "absoluteValue" )
-        {
-            inputQuery.addPiecewiseLinearConstraint(
-                new AbsoluteValueConstraint( serializeConstraint ) );
-        }
-        else if ( coType == "sign" )
-        {
-            inputQuery.addPiecewiseLinearConstraint( new SignConstraint( serializeConstraint ) );
-        }
-        else if ( coType == "disj" )
-        {
-            inputQuery.addPiecewiseLinearConstraint(
-                new DisjunctionConstraint( serializeConstraint ) );
-        }
-        else if ( coType == "sigmoid" )
-        {
-            inputQuery.addNonlinearConstraint( new SigmoidConstraint( serializeConstraint ) );
-        }
-        else if ( coType == "softmax" )
-        {
-            SoftmaxConstraint *softmax = new SoftmaxConstraint( serializeConstraint );
-            inputQuery.addNonlinearConstraint( softmax );
-            Equation eq;
-            for ( const auto &output : softmax->getOutputs() )
-                eq.addAddend( 1, output );
-            eq.setScalar( 1 );
-            inputQuery.addEquation( eq );
-        }
-        else if ( coType == "bilinear" )
-        {
-            BilinearConstraint *bilinear = new BilinearConstraint( serializeConstraint );
-            inputQuery.addNonlinearConstraint( bilinear );
-        }
-        else if ( coType == "round" )
-        {
-            inputQuery.addNonlinearConstraint( new RoundConstraint( serializeConstraint ) );
-        }
-        else
+        addConstraint( coType, serializeConstraint, inputQuery );
+    }
+}
+
+bool QueryLoader::isBinaryQuery( const char *data, unsigned size )
+{
+    return size >= sizeof( BinaryQueryFormat::MAGIC ) &&
+           memcmp( data, BinaryQueryFormat::MAGIC, sizeof( BinaryQueryFormat::MAGIC ) ) == 0;
+}
+
+void QueryLoader::loadBinaryQuery( const char *data, unsigned size, IQuery &inputQuery )
+{
+    BinaryQueryReader reader( data, size );
+
+    BinaryQueryFormat::Header header = reader.read<BinaryQueryFormat::Header>();
+    if ( header._byteOrderMark != BinaryQueryFormat::BYTE_ORDER_MARK )
+        throw MarabouError( MarabouError::INVALID_QUERY_FILE,
+                            "Binary query file was written with a different byte order" );
+    if ( header._version != BinaryQueryFormat::VERSION )
+        throw MarabouError( MarabouError::INVALID_QUERY_FILE,
+                            Stringf( "Unsupported binary query version: %u (expected %u)",
+                                     header._version,
+                                     BinaryQueryFormat::VERSION )
+                                .ascii() );
+
+    QL_LOG( Stringf( "Number of variables: %u\n", header._numberOfVariables ).ascii() );
+    QL_LOG( Stringf( "Number of equations: %u\n", header._numberOfEquations ).ascii() );
+    QL_LOG(
+        Stringf( "Number of non-linear constraints: %u\n", header._numberOfConstraints ).ascii() );
+
+    inputQuery.setNumberOfVariables( header._numberOfVariables );
+
+    // Input and output variables
+    for ( unsigned i = 0; i < header._numberOfInputVariables; ++i )
+    {
+        unsigned inputIndex = reader.read<uint32_t>();
+        unsigned variable = reader.read<uint32_t>();
+        inputQuery.markInputVariable( variable, inputIndex );
+    }
+
+    for ( unsigned i = 0; i < header._numberOfOutputVariables; ++i )
+    {
+        unsigned outputIndex = reader.read<uint32_t>();
+        unsigned variable = reader.read<uint32_t>();
+        inputQuery.markOutputVariable( variable, outputIndex );
+    }
+
+    // Bounds
+    for ( unsigned i = 0; i < header._numberOfLowerBounds; ++i )
+    {
+        unsigned variable = reader.read<uint32_t>();
+        double lb = reader.read<double>();
+        inputQuery.setLowerBound( variable, lb );
+    }
+
+    for ( unsigned i = 0; i < header._numberOfUpperBounds; ++i )
+    {
+        unsigned variable = reader.read<uint32_t>();
+        double ub = reader.read<double>();
+        inputQuery.setUpperBound( variable, ub );
+    }
+
+    // Equations
+    for ( unsigned i = 0; i < header._numberOfEquations; ++i )
+    {
+        unsigned eqType = reader.read<uint32_t>();
+        if ( eqType > Equation::LE )
+            throw MarabouError( MarabouError::INVALID_EQUATION_TYPE,
+                                Stringf( "Invalid Equation Type\n" ).ascii() );
+
+        Equation equation( (Equation::EquationType)eqType );
+        equation.setScalar( reader.read<double>() );
+
+        unsigned numAddends = reader.read<uint32_t>();
+        for ( unsigned j = 0; j < numAddends; ++j )
         {
-            throw MarabouError(
-                MarabouError::UNSUPPORTED_NON_LINEAR_CONSTRAINT,
-                Stringf( "Unsupported non-linear constraint: %s\n", coType.ascii() ).ascii() );
+            unsigned variable = reader.read<uint32_t>();
+            double coefficient = reader.read<double>();
+            equation.addAddend( coefficient, variable );
         }
+
+        inputQuery.addEquation( equation );
+    }
+
+    // Non-Linear(Piecewise and Nonlinear) Constraints
+    for ( unsigned i = 0; i < header._numberOfConstraints; ++i )
+    {
+        unsigned length = reader.read<uint32_t>();
+        String serializeConstraint = reader.readString( length );
+        String coType = serializeConstraint.substring( 0, serializeConstraint.find( "," ) );
+
+        QL_LOG( Stringf( "Non-Linear Constraint: %u, Type: %s \n", i, coType.ascii() ).ascii() );
+        addConstraint( coType, serializeConstraint, inputQuery );
+    }
+
+    if ( !reader.done() )
+        throw MarabouError( MarabouError::INVALID_QUERY_FILE,
+                            "Unexpected data at the end of the binary query file" );
+}
+
+void QueryLoader::addConstraint( const String &coType,
+                                 const String &serializeConstraint,
+                                 IQuery &inputQuery )
+{
+    if ( coType == "relu" )
+    {
+        inputQuery.addPiecewiseLinearConstraint( new ReluConstraint( serializeConstraint ) );
+    }
+    else if ( coType == "leaky_relu" )
+    {
+        inputQuery.addPiecewiseLinearConstraint( new LeakyReluConstraint( serializeConstraint ) );
+    }
+    else if ( coType == "max" )
+    {
+        inputQuery.addPiecewiseLinearConstraint( new MaxConstraint( serializeConstraint ) );
+    }
+    else if ( coType == "absoluteValue" )
+    {
+        inputQuery.addPiecewiseLinearConstraint(
+            new AbsoluteValueConstraint( serializeConstraint ) );
+    }
+    else if ( coType == "sign" )
+    {
+        inputQuery.addPiecewiseLinearConstraint( new SignConstraint( serializeConstraint ) );
+    }
+    else if ( coType == "disj" )
+    {
+        inputQuery.addPiecewiseLinearConstraint( new DisjunctionConstraint( serializeConstraint ) );
+    }
+    else if ( coType == "sigmoid" )
+    {
+        inputQuery.addNonlinearConstraint( new SigmoidConstraint( serializeConstraint ) );
+    }
+    else if ( coType == "softmax" )
+    {
+        SoftmaxConstraint *softmax = new SoftmaxConstraint( serializeConstraint );
+        inputQuery.addNonlinearConstraint( softmax );
+        Equation eq;
+        for ( const auto &output : softmax->getOutputs() )
+            eq.addAddend( 1, output );
+        eq.setScalar( 1 );
+        inputQuery.addEquation( eq );
+    }
+    else if ( coType == "bilinear" )
+    {
+        BilinearConstraint *bilinear = new BilinearConstraint( serializeConstraint );
+        inputQuery.addNonlinearConstraint( bilinear );
+    }
+    else if ( coType == "round" )
+    {
+        inputQuery.addNonlinearConstraint( new RoundConstraint( serializeConstraint ) );
+    }
+    else
+    {
+        throw MarabouError(
+            MarabouError::UNSUPPORTED_NON_LINEAR_CONSTRAINT,
+            Stringf( "Unsupported non-linear constraint: %s\n", coType.ascii() ).ascii() );
     }
 }
@@ -29,9 +29,17 @@ public:
     unsigned _numConstraunsigneds;
 
     /*
-      Parse a serialized query and return it in Query form
+      Parse a serialized query and return it in Query form. Both the text
+      and the binary query formats are supported; binary files are
+      recognized by their header, and are memory-mapped.
     */
     static void loadQuery( const String &fileName, IQuery &inputQuery );
+
+private:
+    static bool isBinaryQuery( const char *data, unsigned size );
+    static void loadBinaryQuery( const char *data, unsigned size, IQuery &inputQuery );
+    static void
+    addConstraint( const String &coType, const String &serializeConstraint, IQuery &inputQuery );
 };
 
 #endif // __QueryLoader_h__
@@ -14,7 +14,10 @@
 **/
 
 #include "AutoFile.h"
+#include "BinaryQueryFormat.h"
 #include "Equation.h"
+#include "MarabouError.h"
+#include "MockErrno.h"
 #include "MockFileFactory.h"
 #include "Query.h"
 #include "QueryLoader.h"
@@ -27,6 +30,7 @@ const String QUERY_TEST_FILE( "QueryTest.txt" );
 
 class MockForQueryLoader
     : public MockFileFactory
+    , public MockErrno
     , public T::Base_stat
 {
 public:
@@ -52,10 +56,9 @@ public:
         TS_ASSERT_THROWS_NOTHING( delete mock );
     }
 
-    void test_load_query()
+    void createQuery( Query &inputQuery )
     {
         // Set up simple query as a test
-        Query inputQuery;
         inputQuery.setNumberOfVariables( 10 );
 
         // Input layer with one variable
@@ -121,16 +124,10 @@ public:
         equation4.addAddend( 1.0, 8 );  // Weighted equation input
         equation4.setScalar( 0.5 );     // Equation bias
         inputQuery.addEquation( equation4 );
+    }
 
-        // Save the query and then reload the query
-        inputQuery.saveQuery( QUERY_TEST_FILE );
-
-        mock->mockFile.wasCreated = false;
-        mock->mockFile.wasDiscarded = false;
-
-        Query inputQuery2;
-        QueryLoader::loadQuery( QUERY_TEST_FILE, inputQuery2 );
-
+    void compareQueries( Query &inputQuery, Query &inputQuery2 )
+    {
         // Check that inputQuery is unchanged when saving and loading the query
         // Number of variables unchanged
         TS_ASSERT( inputQuery.getNumberOfVariables() == inputQuery2.getNumberOfVariables() );
@@ -179,6 +176,60 @@ public:
         nlConstraint2 = (SigmoidConstraint *)*tsIt2;
         TS_ASSERT( nlConstraint->serializeToString() == nlConstraint2->serializeToString() );
     }
+
+    void test_load_query()
+    {
+        Query inputQuery;
+        createQuery( inputQuery );
+
+        // Save the query and then reload the query
+        inputQuery.saveQuery( QUERY_TEST_FILE );
+
+        mock->mockFile.wasCreated = false;
+        mock->mockFile.wasDiscarded = false;
+
+        Query inputQuery2;
+        QueryLoader::loadQuery( QUERY_TEST_FILE, inputQuery2 );
+
+        compareQueries( inputQuery, inputQuery2 );
+    }
+
+    void test_load_binary_query()
+    {
+        Query inputQuery;
+        createQuery( inputQuery );
+
+        // Save the query in the binary format and then reload the query
+        inputQuery.saveBinaryQuery( QUERY_TEST_FILE );
+
+        mock->mockFile.wasCreated = false;
+        mock->mockFile.wasDiscarded = false;
+
+        Query inputQuery2;
+        QueryLoader::loadQuery( QUERY_TEST_FILE, inputQuery2 );
+
+        compareQueries( inputQuery, inputQuery2 );
+    }
+
+    void test_load_invalid_binary_query()
+    {
+        Query inputQuery;
+        createQuery( inputQuery );
+        inputQuery.saveBinaryQuery( QUERY_TEST_FILE );
+
+        // Keep the header, but drop the rest of the file
+        mock->mockFile.writtenLines = mock->mockFile.writtenLines.substring(
+            0, sizeof( BinaryQueryFormat::Header ) + 4 );
+
+        mock->mockFile.wasCreated = false;
+        mock->mockFile.wasDiscarded = false;
+
+        Query inputQuery2;
+        TS_ASSERT_THROWS_EQUALS( QueryLoader::loadQuery( QUERY_TEST_FILE, inputQuery2 ),
+                                 const MarabouError &e,
+                                 e.getCode(),
+                                 MarabouError::INVALID_QUERY_FILE );
+    }
 };
 
 //